@@ -7,6 +7,8 @@
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <list>
 #include <mutex>
@@ -41,11 +43,26 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
       m_operationCondition.notify_one();
     }
 
+    /**
+     * @brief Wait for a result to be available, while calling the pollers which produce it.
+     *
+     * @param context The context to use for cancellation.
+     * @param pollers The objects to poll until a result is available.
+     * @return std::unique_ptr<std::tuple<T...>> The result, or nullptr if the context is cancelled.
+     *
+     * @remarks Between two polls, the queue is waited on for an interval which grows while no result
+     * is available, so that a result completed by another thread is returned as soon as it is
+     * queued.
+     */
     template <class... Poller>
     std::unique_ptr<std::tuple<T...>> WaitForPolledResult(
         Context const& context,
         Poller&... pollers)
     {
+      constexpr std::chrono::microseconds MinimumPollingInterval{50};
+      constexpr std::chrono::microseconds MaximumPollingInterval{10000};
+
+      auto pollingInterval = MinimumPollingInterval;
       do
       {
         {
@@ -62,11 +79,17 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
             return nullptr;
           }
         }
-        std::this_thread::yield();
 
         // Note: We need to call Poll() *outside* the lock because the poller is going to call the
         // CompleteOperation function.
         Poll(pollers...);
+
+        {
+          std::unique_lock<std::mutex> lock(m_operationComplete);
+          m_operationCondition.wait_for(
+              lock, pollingInterval, [this]() { return !m_operationQueue.empty(); });
+        }
+        pollingInterval = (std::min)(pollingInterval * 2, MaximumPollingInterval);
       } while (true);
     }
 
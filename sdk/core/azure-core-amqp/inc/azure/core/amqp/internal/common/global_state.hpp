@@ -6,6 +6,9 @@
 #include <azure/core/azure_assert.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -47,11 +50,27 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     ~GlobalStateHolder();
 
 #if ENABLE_UAMQP
+    // The pollables are polled again right away after activity, then less and less often while
+    // they are idle, up to the maximum interval.
+    static constexpr std::chrono::microseconds MinimumPollingInterval{100};
+    static constexpr std::chrono::microseconds MaximumPollingInterval{100000};
+
     std::list<std::shared_ptr<Pollable>> m_pollables;
     std::mutex m_pollablesMutex;
+    // Signaled under m_pollablesMutex when a polling pass completes.
+    std::condition_variable m_pollingPassCompleted;
     std::thread m_pollingThread;
-    std::atomic<bool> m_activelyPolling;
+    bool m_activelyPolling{false};
+    std::uint64_t m_pollingPass{0};
+
+    // Never held while polling, so that the activity can be notified with the connection locks
+    // held.
+    std::mutex m_activityMutex;
+    std::condition_variable m_activityCondition;
+    bool m_activity{false};
     bool m_stopped{false};
+
+    void PollingLoop();
 #elif ENABLE_RUST_AMQP
     RustRuntimeContext m_runtimeContext;
 #endif
@@ -69,6 +88,15 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     void AddPollable(std::shared_ptr<Pollable> pollable);
 
     void RemovePollable(std::shared_ptr<Pollable> pollable);
+
+    /**
+     * @brief Wake the polling thread up, so that the pollables are polled right away and then
+     * frequently for a while.
+     *
+     * @remark Called when a response is expected, for instance after a message was sent, or when
+     * frames are being received.
+     */
+    void NotifyActivity();
 #elif ENABLE_RUST_AMQP
     Azure::Core::Amqp::_detail::RustRuntimeContext* GetRuntimeContext()
     {
@@ -185,6 +185,27 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>
     TryWaitForIncomingMessage();
 
+    /** @brief Waits until a message has been received, without decoding it.
+     *
+     * @param context The context for cancelling operations.
+     *
+     * @return A pair of a view of the received message and the error if any.
+     *
+     * @remarks Unlike WaitForIncomingMessage, the sections of the message are only converted when
+     * they are read from the returned view.
+     */
+    std::pair<Models::AmqpMessageView, Models::_internal::AmqpError> WaitForIncomingMessageView(
+        Context const& context = {});
+
+    /** @brief Return a view of the next message if one is waiting to be processed.
+     *
+     * @return A pair of a view of the received message and the error if any. If both values are
+     * empty, then no messages are available and the caller should call
+     * WaitForIncomingMessageView.
+     */
+    std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+    TryWaitForIncomingMessageView();
+
   private:
     MessageReceiver(std::shared_ptr<_detail::MessageReceiverImpl> impl) : m_impl{impl} {}
     friend class _detail::MessageReceiverFactory;
@@ -15,6 +15,7 @@
 
 #include <azure/core/nullable.hpp>
 
+#include <functional>
 #include <tuple>
 
 #if defined(_azure_TESTING_BUILD)
@@ -134,6 +135,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
 #if ENABLE_UAMQP
     using MessageSendCompleteCallback
         = std::function<void(MessageSendStatus sendResult, Models::AmqpValue const& deliveryState)>;
+    using MessageSendResultCallback = std::function<
+        void(MessageSendStatus sendResult, Models::_internal::AmqpError const& error)>;
 #endif
     ~MessageSender() noexcept;
 
@@ -181,6 +184,24 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     _azure_NODISCARD std::tuple<MessageSendStatus, Models::_internal::AmqpError> Send(
         Models::AmqpMessage const& message,
         Context const& context = {});
+
+    /** @brief Send a message to the target of the message sender without waiting for it to be
+     * settled.
+     *
+     * @param message The message to send.
+     * @param onSendComplete Called with the status of the send operation and the send disposition
+     * once the message is settled. It is called from the AMQP polling thread, so it should not
+     * block.
+     * @param context The context to use for the operation. If it is already cancelled, the
+     * message is not sent and onSendComplete is called with MessageSendStatus::Cancelled.
+     *
+     * @remarks Several messages can be sent this way without waiting for each other, up to the
+     * link credit granted by the remote node.
+     */
+    void SendAsync(
+        Models::AmqpMessage const& message,
+        MessageSendResultCallback onSendComplete,
+        Context const& context = {});
 #elif ENABLE_RUST_AMQP
     _azure_NODISCARD Models::_internal::AmqpError Send(
         Models::AmqpMessage const& message,
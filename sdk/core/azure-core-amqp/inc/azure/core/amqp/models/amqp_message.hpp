@@ -10,10 +10,12 @@
 #include <azure/core/nullable.hpp>
 
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace Azure { namespace Core { namespace Amqp { namespace Models { namespace _detail {
   class AmqpMessageFactory;
+  struct AmqpMessageViewImpl;
 }}}}} // namespace Azure::Core::Amqp::Models::_detail
 
 namespace Azure { namespace Core { namespace Amqp { namespace Models {
@@ -271,6 +273,23 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
      */
     static std::vector<uint8_t> Serialize(AmqpMessage const& message);
 
+    /** @brief Serialize the message at the end of a buffer.
+     *
+     * @param message The message to serialize.
+     * @param buffer The buffer to which the serialized message is appended. If serialization
+     * fails, the buffer may contain part of the message.
+     *
+     * @remarks This API will fail if BodyType is not set.
+     */
+    static void Serialize(AmqpMessage const& message, std::vector<uint8_t>& buffer);
+
+    /** @brief Returns the size (in bytes) of the serialized form of the message, without
+     * serializing it.
+     *
+     * @remarks This API will fail if BodyType is not set.
+     */
+    static size_t GetSerializedSize(AmqpMessage const& message);
+
     /** @brief Deserialize the message from a buffer.
      *
      * @remarks This API will fail if BodyType is not set.
@@ -286,4 +305,111 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
     bool m_hasValue{true}; // By default, an AmqpMessage has a value.
   };
   std::ostream& operator<<(std::ostream&, AmqpMessage const&);
+
+  /** @brief A read-only view over a range of bytes which is owned by another object.
+   *
+   * @remarks The bytes referenced by the view are only valid for as long as the object which
+   * produced the view is alive.
+   */
+  class AmqpBinaryDataView final {
+  public:
+    /** @brief Iterator over the bytes in the view. */
+    using const_iterator = std::uint8_t const*;
+
+    /** @brief Construct an empty view. */
+    AmqpBinaryDataView() = default;
+
+    /** @brief Construct a view over `size` bytes starting at `data`.
+     *
+     * @param data The first byte in the view.
+     * @param size The number of bytes in the view.
+     */
+    AmqpBinaryDataView(std::uint8_t const* data, size_t size) noexcept : m_data{data}, m_size{size}
+    {
+    }
+
+    /** @brief Returns a pointer to the first byte in the view. */
+    std::uint8_t const* data() const noexcept { return m_data; }
+
+    /** @brief Returns the number of bytes in the view. */
+    size_t size() const noexcept { return m_size; }
+
+    /** @brief Returns true if the view contains no bytes. */
+    bool empty() const noexcept { return m_size == 0; }
+
+    /** @brief Returns an iterator to the first byte in the view. */
+    const_iterator begin() const noexcept { return m_data; }
+
+    /** @brief Returns an iterator past the last byte in the view. */
+    const_iterator end() const noexcept { return m_data + m_size; }
+
+  private:
+    std::uint8_t const* m_data{};
+    size_t m_size{};
+  };
+
+  /** @brief An AmqpMessageView is a read-only view of a received AMQP message.
+   *
+   * @remark Unlike AmqpMessage, which decodes every section of a message when it is received, an
+   * AmqpMessageView holds on to the message as it was decoded from the wire and only converts the
+   * parts of the message which the caller asks for. Binary data body sections are returned as
+   * views over the buffers held by the message, without being copied.
+   *
+   * Copies of an AmqpMessageView share the same underlying message.
+   */
+  class AmqpMessageView final {
+  public:
+    /** @brief Construct an empty AMQP message view. */
+    AmqpMessageView() = default;
+
+    /** @brief Construct a view over an encoded copy of an AMQP message.
+     *
+     * @param message The message to encode.
+     */
+    explicit AmqpMessageView(AmqpMessage const& message);
+
+    /** @brief Returns true if the view refers to a message, false otherwise. */
+    operator bool() const noexcept { return m_impl != nullptr; }
+
+    /** @brief Returns the type of the body of the message. */
+    MessageBodyType GetBodyType() const;
+
+    /** @brief Returns views over the binary data sections of the message body.
+     *
+     * @remarks The returned views are valid for as long as this AmqpMessageView, or a copy of it,
+     * is alive.
+     *
+     * @remarks This API will fail if the body type of the message is not MessageBodyType::Data.
+     */
+    std::vector<AmqpBinaryDataView> GetBodyAsBinary() const;
+
+    /** @brief Returns the value of a single message annotation.
+     *
+     * @param key The symbol which identifies the annotation.
+     *
+     * @returns The value of the annotation, or a null AmqpValue if the message does not have an
+     * annotation with that key. Only the returned value is converted.
+     */
+    AmqpValue GetMessageAnnotation(std::string const& key) const;
+
+    /** @brief Returns the header of the message. */
+    MessageHeader GetHeader() const;
+
+    /** @brief Returns the message annotations of the message. */
+    AmqpAnnotations GetMessageAnnotations() const;
+
+    /** @brief Returns the immutable properties of the message. */
+    MessageProperties GetProperties() const;
+
+    /** @brief Returns the application properties of the message. */
+    std::map<std::string, AmqpValue> GetApplicationProperties() const;
+
+    /** @brief Converts the whole message to an AmqpMessage. */
+    std::shared_ptr<AmqpMessage> ToAmqpMessage() const;
+
+    friend class _detail::AmqpMessageFactory;
+
+  private:
+    std::shared_ptr<_detail::AmqpMessageViewImpl> m_impl;
+  };
 }}}} // namespace Azure::Core::Amqp::Models
@@ -551,6 +551,13 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
     /** @brief Serialize this AMQP value as an array of bytes. */
     static std::vector<uint8_t> Serialize(AmqpValue const& value);
 
+    /** @brief Serialize this AMQP value at the end of an array of bytes.
+     *
+     * @param value The value to serialize.
+     * @param buffer The buffer to which the serialized form of the value is appended.
+     */
+    static void Serialize(AmqpValue const& value, std::vector<uint8_t>& buffer);
+
     /** @brief Returns the size (in bytes) of the serialized form of this value */
     static size_t GetSerializedSize(AmqpValue const& value);
 
@@ -585,7 +592,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models { namespace
     using initializer_type = std::initializer_list<typename T::value_type>;
 
     AmqpCollectionBase(initializer_type const& initializer) : m_value{initializer} {}
-    AmqpCollectionBase(T initializer) : m_value{initializer} {}
+    AmqpCollectionBase(T initializer) : m_value{std::move(initializer)} {}
     AmqpCollectionBase(){};
 
     // Copy constructor
@@ -96,6 +96,38 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     }
   }
 
+  std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+  MessageReceiver::WaitForIncomingMessageView(Azure::Core::Context const& context)
+  {
+    if (m_impl)
+    {
+      return m_impl->WaitForIncomingMessageView(context);
+    }
+    else
+    {
+      AZURE_ASSERT_FALSE(
+          "MessageReceiver::WaitForIncomingMessageView called on moved message receiver.");
+      Azure::Core::_internal::AzureNoReturnPath(
+          "MessageReceiver::WaitForIncomingMessageView called on moved message receiver.");
+    }
+  }
+
+  std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+  MessageReceiver::TryWaitForIncomingMessageView()
+  {
+    if (m_impl)
+    {
+      return m_impl->TryWaitForIncomingMessageView();
+    }
+    else
+    {
+      AZURE_ASSERT_FALSE(
+          "MessageReceiver::TryWaitForIncomingMessageView called on moved message receiver.");
+      Azure::Core::_internal::AzureNoReturnPath(
+          "MessageReceiver::TryWaitForIncomingMessageView called on moved message receiver.");
+    }
+  }
+
 #if ENABLE_UAMQP
   std::string MessageReceiver::GetLinkName() const { return m_impl->GetLinkName(); }
 #endif
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iomanip>
 #include <list>
 #include <mutex>
@@ -106,39 +107,18 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     // Integrate AMQP logging with Azure Core logging.
     xlogging_set_log_function(AmqpLogFunction);
 
-    m_pollingThread = std::thread([this]() {
-      do
-      {
-        {
-          std::list<std::shared_ptr<Pollable>> capturedList;
-          {
-            std::unique_lock<std::mutex> lock{m_pollablesMutex};
-            // If there are no pollables, there's no point in doing any work.
-            if (m_pollables.empty())
-            {
-              continue;
-            }
-            capturedList = m_pollables;
-            m_activelyPolling = true;
-          }
-
-          for (auto const& pollable : capturedList)
-          {
-            pollable->Poll();
-          }
-        }
-        m_activelyPolling = false;
-        //        std::this_thread::yield();
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-      } while (!m_stopped);
-    });
+    m_pollingThread = std::thread([this]() { PollingLoop(); });
 #endif
   }
 
   GlobalStateHolder::~GlobalStateHolder()
   {
 #if ENABLE_UAMQP
-    m_stopped = true;
+    {
+      std::lock_guard<std::mutex> lock(m_activityMutex);
+      m_stopped = true;
+    }
+    m_activityCondition.notify_one();
     if (m_pollingThread.joinable())
     {
       m_pollingThread.join();
@@ -151,6 +131,61 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
   }
 
 #if ENABLE_UAMQP
+  constexpr std::chrono::microseconds GlobalStateHolder::MinimumPollingInterval;
+  constexpr std::chrono::microseconds GlobalStateHolder::MaximumPollingInterval;
+
+  void GlobalStateHolder::PollingLoop()
+  {
+    auto pollingInterval = MinimumPollingInterval;
+    while (true)
+    {
+      std::list<std::shared_ptr<Pollable>> capturedList;
+      {
+        std::lock_guard<std::mutex> lock{m_pollablesMutex};
+        capturedList = m_pollables;
+        m_activelyPolling = !capturedList.empty();
+        ++m_pollingPass;
+      }
+
+      bool const hasPollables = !capturedList.empty();
+      if (hasPollables)
+      {
+        for (auto const& pollable : capturedList)
+        {
+          pollable->Poll();
+        }
+        capturedList.clear();
+        {
+          std::lock_guard<std::mutex> lock{m_pollablesMutex};
+          m_activelyPolling = false;
+        }
+        m_pollingPassCompleted.notify_all();
+      }
+
+      std::unique_lock<std::mutex> lock{m_activityMutex};
+      if (!m_activity && !m_stopped)
+      {
+        // If there are no pollables, there's no point in doing any work until one is added.
+        if (!hasPollables)
+        {
+          m_activityCondition.wait(lock, [this]() { return m_activity || m_stopped; });
+        }
+        else
+        {
+          m_activityCondition.wait_for(
+              lock, pollingInterval, [this]() { return m_activity || m_stopped; });
+        }
+      }
+      if (m_stopped)
+      {
+        return;
+      }
+      pollingInterval = m_activity ? MinimumPollingInterval
+                                   : (std::min)(pollingInterval * 2, MaximumPollingInterval);
+      m_activity = false;
+    }
+  }
+
   /**
    * @brief Adds a pollable object to the list of objects to be polled.
    *
@@ -171,11 +206,13 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     {
       m_pollables.push_back(pollable);
     }
+    // The new pollable is starting its handshake, poll it right away.
+    NotifyActivity();
   }
 
   void GlobalStateHolder::RemovePollable(std::shared_ptr<Pollable> pollable)
   {
-    // There is a bit of a complicated lock-free dance happening here.
+    // There is a bit of a complicated dance happening here.
     // The m_pollables list is accessed by the polling thread, and the list is modified by the user
     // thread. To ensure integrity of the list, the polling thread takes the lock, copies the
     // pollable from the list, releases the lock and then iterates over the pollables at the
@@ -186,20 +223,33 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     //
     // But we want to make sure that the thread has finished polling (and thus has removed the copy
     // of the pollables list). For that, we have the m_activelyPolling variable. It is set under the
-    // pollables lock, and cleared after the polling thread has finished polling (outside the lock).
+    // pollables lock when a polling pass starts, and cleared under the lock after the captured list
+    // is freed.
     //
-    // This means that we can spin on the m_activelyPolling variable *under* the pollables lock safe
-    // in the knowledge that IF the variable is set to true, it means that we acquired the
-    // pollablesMutex during the interval when the captured list is being interated over. And that
-    // the m_activelyPolling variable will only be cleared AFTER the captured list is freed.
+    // This means that we can wait until the variable is cleared, or until a new pass started (which
+    // captured the list without the removed pollable), safe in the knowledge that the polling
+    // thread no longer uses the pollable.
     //
 
-    std::lock_guard<std::mutex> lock(m_pollablesMutex);
+    std::unique_lock<std::mutex> lock(m_pollablesMutex);
     m_pollables.remove(pollable);
-    // Spin until m_activelyPolling is false, this ensures that the polling thread is not using the
-    // capturedList copy of m_pollables.
-    while (m_activelyPolling.load())
-      ;
+    // A pollable removed by the polling thread itself is released with the captured list.
+    if (std::this_thread::get_id() != m_pollingThread.get_id())
+    {
+      auto const pollingPass = m_pollingPass;
+      m_pollingPassCompleted.wait(lock, [this, pollingPass]() {
+        return !m_activelyPolling || m_pollingPass != pollingPass;
+      });
+    }
+  }
+
+  void GlobalStateHolder::NotifyActivity()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_activityMutex);
+      m_activity = true;
+    }
+    m_activityCondition.notify_one();
   }
 #endif
 
@@ -72,43 +72,47 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
 
   std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
   MessageReceiverImpl::WaitForIncomingMessage(Context const& context)
+  {
+    auto result = WaitForIncomingMessageView(context);
+    return std::make_pair(
+        result.first ? result.first.ToAmqpMessage() : nullptr, std::move(result.second));
+  }
+
+  std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
+  MessageReceiverImpl::TryWaitForIncomingMessage()
+  {
+    auto result = TryWaitForIncomingMessageView();
+    return std::make_pair(
+        result.first ? result.first.ToAmqpMessage() : nullptr, std::move(result.second));
+  }
+
+  std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+  MessageReceiverImpl::WaitForIncomingMessageView(Context const& context)
   {
     context.ThrowIfCancelled();
 
     Common::_detail::CallContext callContext(
         Common::_detail::GlobalStateHolder::GlobalStateInstance()->GetRuntimeContext(), context);
 
-    {
-
-      auto message = Models::_detail::AmqpMessageFactory::FromImplementation(
-          amqpmessagereceiver_receive_message_wait(callContext.GetCallContext(), m_receiver.get()));
+    // The received message is owned by the caller, so the view takes ownership of it.
+    auto message = Models::_detail::AmqpMessageFactory::ViewFromImplementation(
+        Models::_detail::UniqueMessageHandle{amqpmessagereceiver_receive_message_wait(
+            callContext.GetCallContext(), m_receiver.get())});
 
-      return std::make_pair(message, Models::_internal::AmqpError{});
-    }
+    return std::make_pair(message, Models::_internal::AmqpError{});
   }
 
-  std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
-  MessageReceiverImpl::TryWaitForIncomingMessage()
+  std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+  MessageReceiverImpl::TryWaitForIncomingMessageView()
   {
     Common::_detail::CallContext callContext(
         Common::_detail::GlobalStateHolder::GlobalStateInstance()->GetRuntimeContext(), {});
 
-    auto message = Models::_detail::AmqpMessageFactory::FromImplementation(
-        amqpmessagereceiver_receive_message_async_poll(
-            callContext.GetCallContext(), m_receiver.get()));
+    auto message = Models::_detail::AmqpMessageFactory::ViewFromImplementation(
+        Models::_detail::UniqueMessageHandle{amqpmessagereceiver_receive_message_async_poll(
+            callContext.GetCallContext(), m_receiver.get())});
 
-    if (message)
-    {
-      return std::make_pair(message, Models::_internal::AmqpError{});
-    }
-    else if (callContext.GetError().empty())
-    {
-      return std::make_pair(nullptr, Models::_internal::AmqpError{});
-    }
-    else
-    {
-      return std::make_pair(nullptr, Models::_internal::AmqpError{});
-    }
+    return std::make_pair(message, Models::_internal::AmqpError{});
   }
 
   MessageReceiverImpl::~MessageReceiverImpl() noexcept
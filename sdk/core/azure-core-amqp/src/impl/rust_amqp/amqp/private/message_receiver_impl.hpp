@@ -56,6 +56,12 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
     TryWaitForIncomingMessage();
 
+    std::pair<Models::AmqpMessageView, Models::_internal::AmqpError> WaitForIncomingMessageView(
+        Context const& context);
+
+    std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+    TryWaitForIncomingMessageView();
+
   private:
     bool m_receiverOpen{false};
     UniqueMessageReceiver m_receiver;
@@ -302,6 +302,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       CONNECTION_STATE oldState)
   {
     ConnectionImpl* connection = static_cast<ConnectionImpl*>(context);
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->NotifyActivity();
 
     if (connection->m_options.EnableTrace)
     {
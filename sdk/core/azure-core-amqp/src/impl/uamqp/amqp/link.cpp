@@ -365,6 +365,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
   void LinkImpl::OnLinkStateChangedFn(void* context, LINK_STATE newState, LINK_STATE oldState)
   {
     LinkImpl* link = static_cast<LinkImpl*>(context);
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->NotifyActivity();
     if (link->m_eventHandler)
     {
       link->m_eventHandler->OnLinkStateChanged(
@@ -128,21 +128,32 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
   AMQP_VALUE MessageReceiverImpl::OnMessageReceivedFn(const void* context, MESSAGE_HANDLE message)
   {
     MessageReceiverImpl* receiver = static_cast<MessageReceiverImpl*>(const_cast<void*>(context));
+    // Keep polling at a short interval while messages are flowing.
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->NotifyActivity();
     // There is a window where the receiver could be closed between the time the message is
     // received by the AMQP connection and when is indicated to the MessageReceiver. Ensure that
     // the message receiver is open before attempting to process the incoming message.
     if (receiver->m_receiverOpen)
     {
-      auto incomingMessage(Models::_detail::AmqpMessageFactory::FromImplementation(message));
       Models::AmqpValue rv;
       if (receiver->m_eventHandler)
       {
         rv = receiver->m_eventHandler->OnMessageReceived(
             MessageReceiverFactory::CreateFromInternal(receiver->shared_from_this()),
-            incomingMessage);
+            Models::_detail::AmqpMessageFactory::FromImplementation(message));
       }
       else
       {
+        // uAMQP destroys the message when this callback returns, so the queued view holds a clone.
+        // The clone shares the decoded values of the message and copies its binary data sections;
+        // converting them is deferred until the message is read by the caller.
+        auto incomingMessage{Models::_detail::AmqpMessageFactory::ViewFromImplementation(
+            Models::_detail::UniqueMessageHandle{message_clone(message)})};
+        if (!incomingMessage)
+        {
+          return amqpvalue_clone(Models::_detail::AmqpValueFactory::ToImplementation(
+              Models::_internal::Messaging::DeliveryReleased()));
+        }
         rv = receiver->OnMessageReceived(incomingMessage);
       }
       return amqpvalue_clone(Models::_detail::AmqpValueFactory::ToImplementation(rv));
@@ -156,7 +167,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
   }
 
   Models::AmqpValue MessageReceiverImpl::OnMessageReceived(
-      std::shared_ptr<Models::AmqpMessage> const& message)
+      Models::AmqpMessageView const& message)
   {
     m_messageQueue.CompleteOperation(message, Models::_internal::AmqpError{});
     return Models::_internal::Messaging::DeliveryAccepted();
@@ -188,6 +199,22 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
 
   std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
   MessageReceiverImpl::WaitForIncomingMessage(Context const& context)
+  {
+    auto result = WaitForIncomingMessageView(context);
+    return std::make_pair(
+        result.first ? result.first.ToAmqpMessage() : nullptr, std::move(result.second));
+  }
+
+  std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
+  MessageReceiverImpl::TryWaitForIncomingMessage()
+  {
+    auto result = TryWaitForIncomingMessageView();
+    return std::make_pair(
+        result.first ? result.first.ToAmqpMessage() : nullptr, std::move(result.second));
+  }
+
+  std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+  MessageReceiverImpl::WaitForIncomingMessageView(Context const& context)
   {
     if (m_eventHandler)
     {
@@ -197,22 +224,16 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     auto result = m_messageQueue.WaitForResult(context);
     if (result)
     {
-      std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError> rv;
-      std::shared_ptr<Models::AmqpMessage> message{std::move(std::get<0>(*result))};
-      if (message)
-      {
-        rv.first = std::move(message);
-      }
-      rv.second = std::move(std::get<1>(*result));
-      return rv;
+      return std::make_pair(std::move(std::get<0>(*result)), std::move(std::get<1>(*result)));
     }
     else
     {
       throw Azure::Core::OperationCancelledException("Receive Operation was cancelled.");
     }
   }
-  std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
-  MessageReceiverImpl::TryWaitForIncomingMessage()
+
+  std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+  MessageReceiverImpl::TryWaitForIncomingMessageView()
   {
     if (m_eventHandler)
     {
@@ -222,14 +243,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     auto result = m_messageQueue.TryWaitForResult();
     if (result)
     {
-      std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError> rv;
-      std::shared_ptr<Models::AmqpMessage> message{std::move(std::get<0>(*result))};
-      if (message)
-      {
-        rv.first = std::move(message);
-      }
-      rv.second = std::move(std::get<1>(*result));
-      return rv;
+      return std::make_pair(std::move(std::get<0>(*result)), std::move(std::get<1>(*result)));
     }
     else
     {
@@ -357,14 +371,15 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       {
         if (receiver->m_savedMessageError)
         {
-          receiver->m_messageQueue.CompleteOperation(nullptr, receiver->m_savedMessageError);
+          receiver->m_messageQueue.CompleteOperation(
+              Models::AmqpMessageView{}, receiver->m_savedMessageError);
         }
         else
         {
           Models::_internal::AmqpError error;
           error.Condition = Models::_internal::AmqpErrorCondition::InternalError;
           error.Description = "Message receiver has transitioned to the error state.";
-          receiver->m_messageQueue.CompleteOperation(nullptr, error);
+          receiver->m_messageQueue.CompleteOperation(Models::AmqpMessageView{}, error);
         }
       }
 
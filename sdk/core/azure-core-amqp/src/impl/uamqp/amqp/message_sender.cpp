@@ -513,7 +513,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
   };
 
-  void MessageSenderImpl::QueueSendInternal(
+  bool MessageSenderImpl::QueueSendInternal(
       Models::AmqpMessage const& message,
       Azure::Core::Amqp::_internal::MessageSender::MessageSendCompleteCallback onSendComplete,
       Context const& context)
@@ -537,7 +537,57 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       {
         throw std::runtime_error("Could not send message");
       }
+      // Wake up the polling thread so that the transfer is sent right away.
+      Common::_detail::GlobalStateHolder::GlobalStateInstance()->NotifyActivity();
+      return true;
     }
+    return false;
+  }
+
+  Models::_internal::AmqpError MessageSenderImpl::GetSendError(
+      _internal::MessageSendStatus sendResult,
+      Models::AmqpValue const& deliveryStatus)
+  {
+    Models::_internal::AmqpError error;
+
+    // If the send failed. then we need to return the error. If the send completed because of an
+    // error, it's possible that the deliveryStatus provided is null. In that case, we use the
+    // cached saved error because it is highly likely to be better than nothing.
+    if (sendResult != _internal::MessageSendStatus::Ok)
+    {
+      if (deliveryStatus.IsNull())
+      {
+        error = m_savedMessageError;
+      }
+      else
+      {
+        if (deliveryStatus.GetType() != Models::AmqpValueType::List)
+        {
+          throw std::runtime_error("Delivery status is not a list");
+        }
+        auto deliveryStatusAsList{deliveryStatus.AsList()};
+        if (deliveryStatusAsList.size() != 1)
+        {
+          throw std::runtime_error("Delivery Status list is not of size 1");
+        }
+        Models::AmqpValue firstState{deliveryStatusAsList[0]};
+        ERROR_HANDLE errorHandle;
+        if (!amqpvalue_get_error(
+                Models::_detail::AmqpValueFactory::ToImplementation(firstState), &errorHandle))
+        {
+          Models::_detail::UniqueAmqpErrorHandle uniqueError{
+              errorHandle}; // This will free the error handle when it goes out of scope.
+          error = Models::_detail::AmqpErrorFactory::FromImplementation(errorHandle);
+        }
+      }
+    }
+    else
+    {
+      // If we successfully sent the message, then whatever saved error should be cleared, it's no
+      // longer valid.
+      m_savedMessageError = Models::_internal::AmqpError();
+    }
+    return error;
   }
 
   std::tuple<_internal::MessageSendStatus, Models::_internal::AmqpError> MessageSenderImpl::Send(
@@ -552,48 +602,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
           [this](
               Azure::Core::Amqp::_internal::MessageSendStatus sendResult,
               Models::AmqpValue deliveryStatus) {
-            Models::_internal::AmqpError error;
-
-            // If the send failed. then we need to return the error. If the send completed because
-            // of an error, it's possible that the deliveryStatus provided is null. In that case,
-            // we use the cached saved error because it is highly likely to be better than
-            // nothing.
-            if (sendResult != _internal::MessageSendStatus::Ok)
-            {
-              if (deliveryStatus.IsNull())
-              {
-                error = m_savedMessageError;
-              }
-              else
-              {
-                if (deliveryStatus.GetType() != Models::AmqpValueType::List)
-                {
-                  throw std::runtime_error("Delivery status is not a list");
-                }
-                auto deliveryStatusAsList{deliveryStatus.AsList()};
-                if (deliveryStatusAsList.size() != 1)
-                {
-                  throw std::runtime_error("Delivery Status list is not of size 1");
-                }
-                Models::AmqpValue firstState{deliveryStatusAsList[0]};
-                ERROR_HANDLE errorHandle;
-                if (!amqpvalue_get_error(
-                        Models::_detail::AmqpValueFactory::ToImplementation(firstState),
-                        &errorHandle))
-                {
-                  Models::_detail::UniqueAmqpErrorHandle uniqueError{
-                      errorHandle}; // This will free the error handle when it goes out of scope.
-                  error = Models::_detail::AmqpErrorFactory::FromImplementation(errorHandle);
-                }
-              }
-            }
-            else
-            {
-              // If we successfully sent the message, then whatever saved error should be cleared,
-              // it's no longer valid.
-              m_savedMessageError = Models::_internal::AmqpError();
-            }
-            m_sendCompleteQueue.CompleteOperation(sendResult, error);
+            m_sendCompleteQueue.CompleteOperation(
+                sendResult, GetSendError(sendResult, deliveryStatus));
           },
           context);
     }
@@ -612,6 +622,41 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
   }
 
+  void MessageSenderImpl::SendAsync(
+      Models::AmqpMessage const& message,
+      _internal::MessageSender::MessageSendResultCallback onSendComplete,
+      Context const& context)
+  {
+    // The pending operation is owned by the uAMQP message sender, so it must not keep this sender
+    // alive.
+    std::weak_ptr<MessageSenderImpl> weakSender{shared_from_this()};
+    bool queued;
+    {
+      auto lock{m_session->GetConnection()->Lock()};
+      queued = QueueSendInternal(
+          message,
+          [weakSender, onSendComplete](
+              Azure::Core::Amqp::_internal::MessageSendStatus sendResult,
+              Models::AmqpValue deliveryStatus) {
+            auto sender = weakSender.lock();
+            onSendComplete(
+                sendResult,
+                sender ? sender->GetSendError(sendResult, deliveryStatus)
+                       : Models::_internal::AmqpError{});
+          },
+          context);
+    }
+    if (!queued)
+    {
+      onSendComplete(
+          _internal::MessageSendStatus::Cancelled,
+          Models::_internal::AmqpError{
+              Models::_internal::AmqpErrorCondition::OperationCancelled,
+              "Message send operation cancelled.",
+              {}});
+    }
+  }
+
   std::string MessageSenderImpl::GetLinkName() const { return m_link->GetName(); }
 
 }}}} // namespace Azure::Core::Amqp::_detail
@@ -66,6 +66,12 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
 
     std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
     TryWaitForIncomingMessage();
+
+    std::pair<Models::AmqpMessageView, Models::_internal::AmqpError> WaitForIncomingMessageView(
+        Context const& context);
+
+    std::pair<Models::AmqpMessageView, Models::_internal::AmqpError>
+    TryWaitForIncomingMessageView();
     void EnableLinkPolling();
 
   private:
@@ -82,8 +88,9 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     bool m_linkPollingEnabled{false};
     std::mutex m_mutableState;
 
+    // Messages are queued undecoded; WaitForIncomingMessage converts them when they are dequeued.
     Azure::Core::Amqp::Common::_internal::
-        AsyncOperationQueue<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
+        AsyncOperationQueue<Models::AmqpMessageView, Models::_internal::AmqpError>
             m_messageQueue;
 
     // When we close a uAMQP messagereceiver, the link is left in the half closed state. We need to
@@ -95,8 +102,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     _internal::MessageReceiverEvents* m_eventHandler{};
     static AMQP_VALUE OnMessageReceivedFn(const void* context, MESSAGE_HANDLE message);
 
-    virtual Models::AmqpValue OnMessageReceived(
-        std::shared_ptr<Models::AmqpMessage> const& message);
+    virtual Models::AmqpValue OnMessageReceived(Models::AmqpMessageView const& message);
 
     void OnLinkDetached(Models::_internal::AmqpError const& error);
 
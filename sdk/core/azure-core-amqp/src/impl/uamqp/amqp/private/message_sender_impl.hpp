@@ -55,6 +55,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     std::tuple<_internal::MessageSendStatus, Models::_internal::AmqpError> Send(
         Models::AmqpMessage const& message,
         Context const& context);
+    void SendAsync(
+        Models::AmqpMessage const& message,
+        _internal::MessageSender::MessageSendResultCallback onSendComplete,
+        Context const& context);
 
     std::uint64_t GetMaxMessageSize() const;
 
@@ -68,11 +72,14 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     void CreateLink();
     void CreateLink(_internal::LinkEndpoint& endpoint);
     void PopulateLinkProperties();
-    void QueueSendInternal(
+    bool QueueSendInternal(
         Models::AmqpMessage const& message,
         Azure::Core::Amqp::_internal::MessageSender::MessageSendCompleteCallback onSendComplete,
         Context const& context);
     void OnLinkDetached(Models::_internal::AmqpError const& error);
+    Models::_internal::AmqpError GetSendError(
+        _internal::MessageSendStatus sendResult,
+        Models::AmqpValue const& deliveryStatus);
 
     bool m_senderOpen{false};
     UniqueMessageSender m_messageSender{};
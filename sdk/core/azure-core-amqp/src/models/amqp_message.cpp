@@ -25,6 +25,7 @@ using namespace Azure::Core::Amqp::RustInterop::_detail;
 
 constexpr auto AMQP_TYPE_DESCRIBED = RustAmqpValueType::AmqpValueDescribed;
 constexpr auto AMQP_TYPE_MAP = RustAmqpValueType::AmqpValueMap;
+constexpr auto AMQP_TYPE_SYMBOL = RustAmqpValueType::AmqpValueSymbol;
 
 using NativeMessageBodyType = RustAmqpMessageBodyType;
 constexpr auto MESSAGE_BODY_TYPE_NONE = RustAmqpMessageBodyType::None;
@@ -87,43 +88,24 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
       }
       return nullptr;
     }
-  } // namespace
 
-  std::shared_ptr<AmqpMessage> _detail::AmqpMessageFactory::FromImplementation(
-      MessageImplementation* message)
-  {
-    if (message == nullptr)
-    {
-      return nullptr;
-    }
-    auto rv{std::make_shared<AmqpMessage>()};
-    rv->Header = _detail::MessageHeaderFactory::FromImplementation(GetHeaderFromMessage(message));
-    rv->Properties
-        = _detail::MessagePropertiesFactory::FromImplementation(GetPropertiesFromMessage(message));
-
-    {
-      AmqpValueImplementation* annotationsVal;
-      // message_get_delivery_annotations returns a clone of the message annotations.
-      if (!message_get_delivery_annotations(message, &annotationsVal) && annotationsVal != nullptr)
-      {
-        UniqueAmqpValueHandle deliveryAnnotations(annotationsVal);
-        auto deliveryMap
-            = Models::_detail::AmqpValueFactory::FromImplementation(deliveryAnnotations)
-                  .AsAnnotations();
-        rv->DeliveryAnnotations = deliveryMap;
-      }
-    }
+    AmqpAnnotations GetMessageAnnotationsFromMessage(MessageImplementation* message)
     {
       // message_get_message_annotations returns a clone of the message annotations.
       AmqpValueImplementation* messageAnnotations{};
       if (!message_get_message_annotations(message, &messageAnnotations) && messageAnnotations)
       {
-        rv->MessageAnnotations = Models::_detail::AmqpValueFactory::FromImplementation(
-                                     UniqueAmqpValueHandle{messageAnnotations})
-                                     .AsAnnotations();
+        return Models::_detail::AmqpValueFactory::FromImplementation(
+                   UniqueAmqpValueHandle{messageAnnotations})
+            .AsAnnotations();
       }
+      return {};
     }
+
+    std::map<std::string, AmqpValue> GetApplicationPropertiesFromMessage(
+        MessageImplementation* message)
     {
+      std::map<std::string, AmqpValue> rv;
       /*
        * The ApplicationProperties field in an AMQP message for uAMQP expects that the map value
        * is wrapped as a described value. A described value has a ULONG descriptor value and a
@@ -194,12 +176,102 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
             {
               throw std::runtime_error("Key of Application Properties must be a string.");
             }
-            rv->ApplicationProperties.emplace(
-                std::make_pair(static_cast<std::string>(val.first), val.second));
+            rv.emplace(std::make_pair(static_cast<std::string>(val.first), val.second));
           }
         }
       }
+      return rv;
+    }
+
+    MessageBodyType GetBodyTypeFromMessage(MessageImplementation* message)
+    {
+      NativeMessageBodyType bodyType;
+      if (message_get_body_type(message, &bodyType))
+      {
+        return MessageBodyType::None;
+      }
+      switch (bodyType)
+      {
+        case MESSAGE_BODY_TYPE_NONE:
+          return MessageBodyType::None;
+        case MESSAGE_BODY_TYPE_DATA:
+          return MessageBodyType::Data;
+        case MESSAGE_BODY_TYPE_SEQUENCE:
+          return MessageBodyType::Sequence;
+        case MESSAGE_BODY_TYPE_VALUE:
+          return MessageBodyType::Value;
+#if ENABLE_UAMQP
+        case MESSAGE_BODY_TYPE_INVALID:
+          throw std::runtime_error("Invalid message body type.");
+#endif
+        default:
+          throw std::runtime_error("Unknown body type.");
+      }
+    }
+
+    // Returns views over the binary data sections held by the message, without copying them.
+    std::vector<AmqpBinaryDataView> GetBodyDataFromMessage(MessageImplementation* message)
+    {
+      std::vector<AmqpBinaryDataView> rv;
+      size_t dataCount;
+      if (!message_get_body_amqp_data_count(message, &dataCount))
+      {
+        rv.reserve(dataCount);
+        for (auto i = 0ul; i < dataCount; i += 1)
+        {
+#if ENABLE_UAMQP
+          BINARY_DATA binaryValue;
+          if (!message_get_body_amqp_data_in_place(message, i, &binaryValue))
+          {
+            rv.emplace_back(binaryValue.bytes, binaryValue.length);
+          }
+#elif ENABLE_RUST_AMQP
+          uint8_t* data;
+          uint32_t size;
+          if (!message_get_body_amqp_data_in_place(message, i, &data, &size))
+          {
+            rv.emplace_back(data, size);
+          }
+#endif
+        }
+      }
+      return rv;
+    }
+
+    MessageImplementation* GetViewMessage(std::shared_ptr<AmqpMessageViewImpl> const& view)
+    {
+      if (!view)
+      {
+        throw std::runtime_error("The AMQP message view does not refer to a message.");
+      }
+      return view->Message.get();
+    }
+  } // namespace
+
+  std::shared_ptr<AmqpMessage> _detail::AmqpMessageFactory::FromImplementation(
+      MessageImplementation* message)
+  {
+    if (message == nullptr)
+    {
+      return nullptr;
+    }
+    auto rv{std::make_shared<AmqpMessage>()};
+    rv->Header = _detail::MessageHeaderFactory::FromImplementation(GetHeaderFromMessage(message));
+    rv->Properties
+        = _detail::MessagePropertiesFactory::FromImplementation(GetPropertiesFromMessage(message));
+
+    {
+      AmqpValueImplementation* annotationsVal;
+      // message_get_delivery_annotations returns a clone of the message annotations.
+      if (!message_get_delivery_annotations(message, &annotationsVal) && annotationsVal != nullptr)
+      {
+        rv->DeliveryAnnotations = Models::_detail::AmqpValueFactory::FromImplementation(
+                                      UniqueAmqpValueHandle{annotationsVal})
+                                      .AsAnnotations();
+      }
     }
+    rv->MessageAnnotations = GetMessageAnnotationsFromMessage(message);
+    rv->ApplicationProperties = GetApplicationPropertiesFromMessage(message);
 #if ENABLE_UAMQP
     {
       AmqpValueImplementation* deliveryTagVal;
@@ -214,102 +286,158 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
       AmqpValueImplementation* footerVal;
       if (!message_get_footer(message, &footerVal) && footerVal)
       {
-        UniqueAmqpValueHandle footerAnnotations(footerVal);
-        footerVal = nullptr;
-        auto footerMap
-            = _detail::AmqpValueFactory::FromImplementation(footerAnnotations).AsAnnotations();
-        rv->Footer = footerMap;
+        rv->Footer = _detail::AmqpValueFactory::FromImplementation(
+                         UniqueAmqpValueHandle{footerVal})
+                         .AsAnnotations();
       }
     }
+    rv->BodyType = GetBodyTypeFromMessage(message);
+    switch (rv->BodyType)
     {
-      NativeMessageBodyType bodyType;
-
-      if (!message_get_body_type(message, &bodyType))
-      {
-        switch (bodyType)
+      case MessageBodyType::Data:
+        for (auto const& data : GetBodyDataFromMessage(message))
         {
-          case MESSAGE_BODY_TYPE_NONE:
-            rv->BodyType = MessageBodyType::None;
-            break;
-          case MESSAGE_BODY_TYPE_DATA: {
-            size_t dataCount;
-            if (!message_get_body_amqp_data_count(message, &dataCount))
-            {
-              for (auto i = 0ul; i < dataCount; i += 1)
-              {
-#if ENABLE_UAMQP
-                BINARY_DATA binaryValue;
-                if (!message_get_body_amqp_data_in_place(message, i, &binaryValue))
-                {
-                  rv->m_binaryDataBody.push_back(AmqpBinaryData(std::vector<std::uint8_t>(
-                      binaryValue.bytes, binaryValue.bytes + binaryValue.length)));
-                }
-#elif ENABLE_RUST_AMQP
-                uint8_t* data;
-                uint32_t size;
-                if (!message_get_body_amqp_data_in_place(message, i, &data, &size))
-                {
-                  rv->m_binaryDataBody.push_back(
-                      AmqpBinaryData(std::vector<std::uint8_t>(data, data + size)));
-                }
-#endif
-              }
-            }
-            rv->BodyType = MessageBodyType::Data;
-          }
-          break;
-          case MESSAGE_BODY_TYPE_SEQUENCE: {
-
-            size_t sequenceCount;
-            if (!message_get_body_amqp_sequence_count(message, &sequenceCount))
+          rv->m_binaryDataBody.push_back(
+              AmqpBinaryData(std::vector<std::uint8_t>(data.begin(), data.end())));
+        }
+        break;
+      case MessageBodyType::Sequence: {
+        size_t sequenceCount;
+        if (!message_get_body_amqp_sequence_count(message, &sequenceCount))
+        {
+          for (auto i = 0ul; i < sequenceCount; i += 1)
+          {
+            AmqpValueImplementation* sequence;
+            if (!message_get_body_amqp_sequence_in_place(message, i, &sequence))
             {
-              for (auto i = 0ul; i < sequenceCount; i += 1)
-              {
-                AmqpValueImplementation* sequence;
-                if (!message_get_body_amqp_sequence_in_place(message, i, &sequence))
-                {
 #if ENABLE_UAMQP
-                  rv->m_amqpSequenceBody.push_back(_detail::AmqpValueFactory::FromImplementation(
-                      _detail::UniqueAmqpValueHandle{amqpvalue_clone(sequence)}));
+              rv->m_amqpSequenceBody.push_back(_detail::AmqpValueFactory::FromImplementation(
+                  _detail::UniqueAmqpValueHandle{amqpvalue_clone(sequence)}));
 #elif ENABLE_RUST_AMQP
-                  // Rust AMQP cannot return an in-place value - the value returned is already
-                  // cloned.
-                  rv->m_amqpSequenceBody.push_back(_detail::AmqpValueFactory::FromImplementation(
-                      _detail::UniqueAmqpValueHandle{sequence}));
+              // Rust AMQP cannot return an in-place value - the value returned is already
+              // cloned.
+              rv->m_amqpSequenceBody.push_back(_detail::AmqpValueFactory::FromImplementation(
+                  _detail::UniqueAmqpValueHandle{sequence}));
 #endif
-                }
-              }
             }
-            rv->BodyType = MessageBodyType::Sequence;
           }
-          break;
-          case MESSAGE_BODY_TYPE_VALUE: {
-            AmqpValueImplementation* bodyValue;
-            if (!message_get_body_amqp_value_in_place(message, &bodyValue))
-            {
+        }
+      }
+      break;
+      case MessageBodyType::Value: {
+        AmqpValueImplementation* bodyValue;
+        if (!message_get_body_amqp_value_in_place(message, &bodyValue))
+        {
 #if ENABLE_UAMQP
-              rv->m_amqpValueBody = _detail::AmqpValueFactory::FromImplementation(
-                  _detail::UniqueAmqpValueHandle{amqpvalue_clone(bodyValue)});
+          rv->m_amqpValueBody = _detail::AmqpValueFactory::FromImplementation(
+              _detail::UniqueAmqpValueHandle{amqpvalue_clone(bodyValue)});
 #elif ENABLE_RUST_AMQP
-              rv->m_amqpValueBody = _detail::AmqpValueFactory::FromImplementation(
-                  _detail::UniqueAmqpValueHandle{bodyValue});
+          rv->m_amqpValueBody = _detail::AmqpValueFactory::FromImplementation(
+              _detail::UniqueAmqpValueHandle{bodyValue});
 #endif
-            }
-            rv->BodyType = MessageBodyType::Value;
-          }
-          break;
-#if ENABLE_UAMQP
-          case MESSAGE_BODY_TYPE_INVALID:
-            throw std::runtime_error("Invalid message body type.");
-#endif
-          default:
-            throw std::runtime_error("Unknown body type.");
         }
       }
+      break;
+      default:
+        break;
     }
     return rv;
   }
 
+  AmqpMessageView _detail::AmqpMessageFactory::ViewFromImplementation(
+      UniqueMessageHandle&& message)
+  {
+    AmqpMessageView rv;
+    if (message)
+    {
+      rv.m_impl = std::make_shared<AmqpMessageViewImpl>(AmqpMessageViewImpl{std::move(message)});
+    }
+    return rv;
+  }
+
+  AmqpMessageView::AmqpMessageView(AmqpMessage const& message)
+      : AmqpMessageView{_detail::AmqpMessageFactory::ViewFromImplementation(
+          _detail::AmqpMessageFactory::ToImplementation(message))}
+  {
+  }
+
+  MessageBodyType AmqpMessageView::GetBodyType() const
+  {
+    return GetBodyTypeFromMessage(GetViewMessage(m_impl));
+  }
+
+  std::vector<AmqpBinaryDataView> AmqpMessageView::GetBodyAsBinary() const
+  {
+    if (GetBodyType() != MessageBodyType::Data)
+    {
+      throw std::runtime_error("Invalid body type, should be MessageBodyType::Data.");
+    }
+    return GetBodyDataFromMessage(GetViewMessage(m_impl));
+  }
+
+  AmqpValue AmqpMessageView::GetMessageAnnotation(std::string const& key) const
+  {
+    // message_get_message_annotations returns a clone of the message annotations.
+    AmqpValueImplementation* messageAnnotations{};
+    if (message_get_message_annotations(GetViewMessage(m_impl), &messageAnnotations)
+        || messageAnnotations == nullptr)
+    {
+      return {};
+    }
+    UniqueAmqpValueHandle annotations{messageAnnotations};
+    std::uint32_t pairCount;
+    if (amqpvalue_get_type(annotations.get()) != AMQP_TYPE_MAP
+        || amqpvalue_get_map_pair_count(annotations.get(), &pairCount))
+    {
+      throw std::runtime_error("Message annotations must be a map.");
+    }
+    // Compare the keys in place and only convert the value which matches.
+    for (std::uint32_t i = 0; i < pairCount; i += 1)
+    {
+      AmqpValueImplementation *keyValue{}, *value{};
+      if (amqpvalue_get_map_key_value_pair(annotations.get(), i, &keyValue, &value))
+      {
+        throw std::runtime_error("Could not retrieve message annotation.");
+      }
+      UniqueAmqpValueHandle uniqueKey{keyValue};
+      UniqueAmqpValueHandle uniqueValue{value};
+      const char* symbol;
+      if (amqpvalue_get_type(keyValue) == AMQP_TYPE_SYMBOL
+          && !amqpvalue_get_symbol(keyValue, &symbol) && key == symbol)
+      {
+        return _detail::AmqpValueFactory::FromImplementation(std::move(uniqueValue));
+      }
+    }
+    return {};
+  }
+
+  MessageHeader AmqpMessageView::GetHeader() const
+  {
+    return _detail::MessageHeaderFactory::FromImplementation(
+        GetHeaderFromMessage(GetViewMessage(m_impl)));
+  }
+
+  AmqpAnnotations AmqpMessageView::GetMessageAnnotations() const
+  {
+    return GetMessageAnnotationsFromMessage(GetViewMessage(m_impl));
+  }
+
+  MessageProperties AmqpMessageView::GetProperties() const
+  {
+    return _detail::MessagePropertiesFactory::FromImplementation(
+        GetPropertiesFromMessage(GetViewMessage(m_impl)));
+  }
+
+  std::map<std::string, AmqpValue> AmqpMessageView::GetApplicationProperties() const
+  {
+    return GetApplicationPropertiesFromMessage(GetViewMessage(m_impl));
+  }
+
+  std::shared_ptr<AmqpMessage> AmqpMessageView::ToAmqpMessage() const
+  {
+    return _detail::AmqpMessageFactory::FromImplementation(GetViewMessage(m_impl));
+  }
+
   UniqueMessageHandle _detail::AmqpMessageFactory::ToImplementation(AmqpMessage const& message)
   {
 #if ENABLE_UAMQP
@@ -586,111 +714,123 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
         && (m_binaryDataBody == that.m_binaryDataBody);
   }
 
-  std::vector<uint8_t> AmqpMessage::Serialize(AmqpMessage const& message)
-  {
-    std::vector<uint8_t> rv;
-
-    // Append the message Header to the serialized message.
-    if (message.Header.ShouldSerialize())
-    {
-      auto serializedHeader = MessageHeader::Serialize(message.Header);
-      rv.insert(rv.end(), serializedHeader.begin(), serializedHeader.end());
-    }
-    if (!message.DeliveryAnnotations.empty())
-    {
-      AmqpValue deliveryAnnotations{
-          _detail::AmqpValueFactory::FromImplementation(_detail::UniqueAmqpValueHandle{
-              amqpvalue_create_delivery_annotations(_detail::AmqpValueFactory::ToImplementation(
-                  message.DeliveryAnnotations.AsAmqpValue()))})};
-      auto serializedDeliveryAnnotations = AmqpValue::Serialize(deliveryAnnotations);
-      rv.insert(
-          rv.end(), serializedDeliveryAnnotations.begin(), serializedDeliveryAnnotations.end());
-    }
-    if (!message.MessageAnnotations.empty())
+  namespace {
+    // Calls visitSection with each of the sections of the AMQP message, in the order they are
+    // serialized.
+    template <typename VisitSection>
+    void ForEachMessageSection(AmqpMessage const& message, VisitSection&& visitSection)
     {
-      AmqpValue messageAnnotations{
-          _detail::AmqpValueFactory::FromImplementation(_detail::UniqueAmqpValueHandle{
-              amqpvalue_create_message_annotations(_detail::AmqpValueFactory::ToImplementation(
-                  message.MessageAnnotations.AsAmqpValue()))})};
-      auto serializedAnnotations = AmqpValue::Serialize(messageAnnotations);
-      rv.insert(rv.end(), serializedAnnotations.begin(), serializedAnnotations.end());
-    }
+      if (message.Header.ShouldSerialize())
+      {
+        auto handle = _detail::MessageHeaderFactory::ToImplementation(message.Header);
+        visitSection(AmqpValue{_detail::AmqpValueFactory::FromImplementation(
+            _detail::UniqueAmqpValueHandle{amqpvalue_create_header(handle.get())})});
+      }
+      if (!message.DeliveryAnnotations.empty())
+      {
+        visitSection(AmqpValue{_detail::AmqpValueFactory::FromImplementation(
+            _detail::UniqueAmqpValueHandle{amqpvalue_create_delivery_annotations(
+                _detail::AmqpValueFactory::ToImplementation(
+                    message.DeliveryAnnotations.AsAmqpValue()))})});
+      }
+      if (!message.MessageAnnotations.empty())
+      {
+        visitSection(AmqpValue{_detail::AmqpValueFactory::FromImplementation(
+            _detail::UniqueAmqpValueHandle{amqpvalue_create_message_annotations(
+                _detail::AmqpValueFactory::ToImplementation(
+                    message.MessageAnnotations.AsAmqpValue()))})});
+      }
 
-    if (message.Properties.ShouldSerialize())
-    {
-      auto serializedMessageProperties = MessageProperties::Serialize(message.Properties);
-      rv.insert(rv.end(), serializedMessageProperties.begin(), serializedMessageProperties.end());
-    }
+      if (message.Properties.ShouldSerialize())
+      {
+        auto handle = _detail::MessagePropertiesFactory::ToImplementation(message.Properties);
+        visitSection(AmqpValue{_detail::AmqpValueFactory::FromImplementation(
+            _detail::UniqueAmqpValueHandle{amqpvalue_create_properties(handle.get())})});
+      }
 
-    if (!message.ApplicationProperties.empty())
-    {
-      AmqpMap appProperties;
-      for (auto const& val : message.ApplicationProperties)
+      if (!message.ApplicationProperties.empty())
       {
-        if ((val.second.GetType() == AmqpValueType::List)
-            || (val.second.GetType() == AmqpValueType::Map)
-            || (val.second.GetType() == AmqpValueType::Composite)
-            || (val.second.GetType() == AmqpValueType::Described))
+        AmqpMap appProperties;
+        for (auto const& val : message.ApplicationProperties)
         {
-          throw std::runtime_error(
-              "Message Application Property values must be simple value types");
+          if ((val.second.GetType() == AmqpValueType::List)
+              || (val.second.GetType() == AmqpValueType::Map)
+              || (val.second.GetType() == AmqpValueType::Composite)
+              || (val.second.GetType() == AmqpValueType::Described))
+          {
+            throw std::runtime_error(
+                "Message Application Property values must be simple value types");
+          }
+          appProperties.emplace(val);
         }
-        appProperties.emplace(val);
+        visitSection(AmqpValue{_detail::AmqpValueFactory::FromImplementation(
+            _detail::UniqueAmqpValueHandle{amqpvalue_create_application_properties(
+                _detail::AmqpValueFactory::ToImplementation(appProperties.AsAmqpValue()))})});
       }
-      AmqpValue propertiesValue{Models::_detail::AmqpValueFactory::FromImplementation(
-          Models::_detail::UniqueAmqpValueHandle{amqpvalue_create_application_properties(
-              Models::_detail::AmqpValueFactory::ToImplementation(appProperties.AsAmqpValue()))})};
-      auto serializedApplicationProperties = AmqpValue::Serialize(propertiesValue);
-      rv.insert(
-          rv.end(), serializedApplicationProperties.begin(), serializedApplicationProperties.end());
-    }
 
-    switch (message.BodyType)
-    {
-      default:
-      case MessageBodyType::Invalid:
-        throw std::runtime_error("Invalid message body type.");
+      switch (message.BodyType)
+      {
+        default:
+        case MessageBodyType::Invalid:
+          throw std::runtime_error("Invalid message body type.");
 
-      case MessageBodyType::Value: {
-        // The message body element is an AMQP Described type, create one and serialize the
-        // described body.
-        AmqpDescribed describedBody(
-            static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpValue), message.m_amqpValueBody);
-        auto serializedBodyValue = AmqpValue::Serialize(describedBody.AsAmqpValue());
-        rv.insert(rv.end(), serializedBodyValue.begin(), serializedBodyValue.end());
-      }
-      break;
-      case MessageBodyType::Data:
-        for (auto const& val : message.m_binaryDataBody)
-        {
+        case MessageBodyType::Value: {
+          // The message body element is an AMQP Described type, create one and serialize the
+          // described body.
           AmqpDescribed describedBody(
-              static_cast<std::uint64_t>(AmqpDescriptors::DataBinary), val.AsAmqpValue());
-          auto serializedBodyValue = AmqpValue::Serialize(describedBody.AsAmqpValue());
-          rv.insert(rv.end(), serializedBodyValue.begin(), serializedBodyValue.end());
+              static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpValue),
+              message.GetBodyAsAmqpValue());
+          visitSection(describedBody.AsAmqpValue());
         }
         break;
-      case MessageBodyType::Sequence: {
-        for (auto const& val : message.m_amqpSequenceBody)
-        {
-          AmqpDescribed describedBody(
-              static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpSequence), val.AsAmqpValue());
-          auto serializedBodyValue = AmqpValue::Serialize(describedBody.AsAmqpValue());
-          rv.insert(rv.end(), serializedBodyValue.begin(), serializedBodyValue.end());
-        }
+        case MessageBodyType::Data:
+          for (auto const& val : message.GetBodyAsBinary())
+          {
+            AmqpDescribed describedBody(
+                static_cast<std::uint64_t>(AmqpDescriptors::DataBinary), val.AsAmqpValue());
+            visitSection(describedBody.AsAmqpValue());
+          }
+          break;
+        case MessageBodyType::Sequence:
+          for (auto const& val : message.GetBodyAsAmqpList())
+          {
+            AmqpDescribed describedBody(
+                static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpSequence), val.AsAmqpValue());
+            visitSection(describedBody.AsAmqpValue());
+          }
+          break;
+      }
+      if (!message.Footer.empty())
+      {
+        visitSection(AmqpValue{_detail::AmqpValueFactory::FromImplementation(
+            _detail::UniqueAmqpValueHandle{amqpvalue_create_footer(
+                _detail::AmqpValueFactory::ToImplementation(message.Footer.AsAmqpValue()))})});
       }
     }
-    if (!message.Footer.empty())
-    {
-      AmqpValue footer{Models::_detail::AmqpValueFactory::FromImplementation(
-          Models::_detail::UniqueAmqpValueHandle{amqpvalue_create_footer(
-              Models::_detail::AmqpValueFactory::ToImplementation(message.Footer.AsAmqpValue()))})};
-      auto serializedFooter = AmqpValue::Serialize(footer);
-      rv.insert(rv.end(), serializedFooter.begin(), serializedFooter.end());
-    }
+  } // namespace
 
+  std::vector<uint8_t> AmqpMessage::Serialize(AmqpMessage const& message)
+  {
+    std::vector<uint8_t> rv;
+    Serialize(message, rv);
     return rv;
   }
 
+  void AmqpMessage::Serialize(AmqpMessage const& message, std::vector<uint8_t>& buffer)
+  {
+    ForEachMessageSection(
+        message, [&buffer](AmqpValue const& section) { AmqpValue::Serialize(section, buffer); });
+  }
+
+  size_t AmqpMessage::GetSerializedSize(AmqpMessage const& message)
+  {
+    size_t size = 0;
+    ForEachMessageSection(message, [&size](AmqpValue const& section) {
+      size += AmqpValue::GetSerializedSize(section);
+    });
+    return size;
+  }
+
 #if ENABLE_UAMQP
   namespace {
     class AmqpMessageDeserializer final {
@@ -823,21 +823,19 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
 
     class AmqpValueSerializer final {
     public:
-      AmqpValueSerializer() = default;
+      AmqpValueSerializer(std::vector<uint8_t>& encodedValue) : m_encodedValue{encodedValue} {}
 
-      std::vector<uint8_t> operator()(AmqpValue const& value)
+      void operator()(AmqpValue const& value)
       {
         if (amqpvalue_encode(
                 _detail::AmqpValueFactory::ToImplementation(value), OnAmqpValueEncoded, this))
         {
           throw std::runtime_error("Could not encode object");
         }
-        (void)value;
-        return m_encodedValue;
       }
 
     private:
-      std::vector<uint8_t> m_encodedValue;
+      std::vector<uint8_t>& m_encodedValue;
 
       // The OnAmqpValueEncoded callback appends the array provided to the existing encoded
       // value, extending as needed.
@@ -890,9 +888,16 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
   }
 
   std::vector<uint8_t> AmqpValue::Serialize(AmqpValue const& value)
+  {
+    std::vector<uint8_t> encodedValue;
+    Serialize(value, encodedValue);
+    return encodedValue;
+  }
+
+  void AmqpValue::Serialize(AmqpValue const& value, std::vector<uint8_t>& buffer)
   {
 #if ENABLE_UAMQP
-    return AmqpValueSerializer{}(value);
+    AmqpValueSerializer{buffer}(value);
 #elif ENABLE_RUST_AMQP
     size_t encodedSize;
     if (amqpvalue_get_encoded_size(
@@ -900,15 +905,16 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
     {
       throw std::runtime_error("Could not get encoded size for value.");
     }
-    std::vector<uint8_t> encodedValue(encodedSize);
+    auto const offset = buffer.size();
+    buffer.resize(offset + encodedSize);
     if (amqpvalue_encode(
             _detail::AmqpValueFactory::ToImplementation(value),
-            encodedValue.data(),
-            encodedValue.size()))
+            buffer.data() + offset,
+            encodedSize))
     {
+      buffer.resize(offset);
       throw std::runtime_error("Could not encode object");
     }
-    return encodedValue;
 #endif
   }
 
@@ -1049,16 +1055,16 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
       Azure::Core::Amqp::_detail::AmqpValueImplementation *key{}, *val{};
       amqpvalue_get_map_key_value_pair(
           _detail::AmqpValueFactory::ToImplementation(value), i, &key, &val);
-      if (amqpvalue_get_type(key) == AMQP_TYPE_SYMBOL)
-      {
-        m_value.emplace(std::make_pair(
-            _detail::AmqpValueFactory::FromImplementation(UniqueAmqpValueHandle{key}),
-            _detail::AmqpValueFactory::FromImplementation(UniqueAmqpValueHandle{val})));
-      }
-      else
+      UniqueAmqpValueHandle uniqueKey{key};
+      UniqueAmqpValueHandle uniqueValue{val};
+      // Read the symbol from the key directly, rather than through an intermediate AmqpValue.
+      const char* symbol;
+      if (amqpvalue_get_type(key) != AMQP_TYPE_SYMBOL || amqpvalue_get_symbol(key, &symbol))
       {
         throw std::runtime_error("Annotation key MUST be a symbol.");
       }
+      m_value.emplace(
+          AmqpSymbol{symbol}, _detail::AmqpValueFactory::FromImplementation(std::move(uniqueValue)));
     }
   }
 
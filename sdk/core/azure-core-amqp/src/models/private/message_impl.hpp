@@ -52,6 +52,14 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models { namespace
   using UniqueMessageBuilderHandle
       = Amqp::_detail::UniqueHandle<Azure::Core::Amqp::_detail::MessageBuilderImplementation>;
 #endif
+  /**
+   * @brief The message held by an AmqpMessageView.
+   */
+  struct AmqpMessageViewImpl final
+  {
+    UniqueMessageHandle Message;
+  };
+
   /**
    * @brief uAMQP interoperability functions to convert a Message to a uAMQP
    * MESSAGE_HANDLE and back.
@@ -66,5 +74,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models { namespace
     static std::shared_ptr<AmqpMessage> FromImplementation(
         Azure::Core::Amqp::_detail::MessageImplementation* message);
     static UniqueMessageHandle ToImplementation(AmqpMessage const& message);
+
+    /** @brief Create a view over a message, taking ownership of the message. */
+    static AmqpMessageView ViewFromImplementation(UniqueMessageHandle&& message);
   };
 }}}}} // namespace Azure::Core::Amqp::Models::_detail
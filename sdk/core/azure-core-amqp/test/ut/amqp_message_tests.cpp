@@ -4,6 +4,8 @@
 #include "../src/models/private/message_impl.hpp"
 #include "azure/core/amqp/models/amqp_message.hpp"
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 using namespace Azure::Core::Amqp::Models;
@@ -240,6 +242,62 @@ TEST_F(TestMessage, TestBodyAmqpData)
   EXPECT_EQ(message, *round_trip_message.get());
 }
 
+TEST_F(TestMessage, TestMessageView)
+{
+  AmqpMessage message;
+  message.SetBody({AmqpBinaryData{1, 3, 5, 7, 9, 10}, AmqpBinaryData{2, 4, 6, 8}});
+  message.MessageAnnotations[AmqpSymbol("x-opt-offset")] = "12345";
+  message.MessageAnnotations[AmqpSymbol("x-opt-sequence-number")] = static_cast<int64_t>(17);
+  message.ApplicationProperties["prop"] = "value";
+  message.Properties.MessageId = "message-id";
+
+  auto view = _detail::AmqpMessageFactory::ViewFromImplementation(
+      _detail::AmqpMessageFactory::ToImplementation(message));
+  EXPECT_TRUE(view);
+  EXPECT_EQ(view.GetBodyType(), MessageBodyType::Data);
+
+  auto body = view.GetBodyAsBinary();
+  ASSERT_EQ(body.size(), 2);
+  EXPECT_EQ(
+      std::vector<uint8_t>(body[0].begin(), body[0].end()),
+      (std::vector<uint8_t>{1, 3, 5, 7, 9, 10}));
+  EXPECT_EQ(
+      std::vector<uint8_t>(body[1].begin(), body[1].end()), (std::vector<uint8_t>{2, 4, 6, 8}));
+
+  EXPECT_EQ(view.GetMessageAnnotation("x-opt-offset"), AmqpValue{"12345"});
+  EXPECT_EQ(
+      view.GetMessageAnnotation("x-opt-sequence-number"), AmqpValue{static_cast<int64_t>(17)});
+  EXPECT_TRUE(view.GetMessageAnnotation("x-opt-partition-key").IsNull());
+
+  EXPECT_TRUE(view.GetMessageAnnotations() == message.MessageAnnotations);
+  EXPECT_EQ(view.GetApplicationProperties(), message.ApplicationProperties);
+  EXPECT_EQ(view.GetProperties().MessageId, message.Properties.MessageId);
+  EXPECT_EQ(*view.ToAmqpMessage(), message);
+
+  // Copies of a view share the message, so body views stay valid after the original is gone.
+  AmqpMessageView copy;
+  {
+    AmqpMessageView original{message};
+    copy = original;
+  }
+  EXPECT_EQ(copy.GetBodyAsBinary()[1].size(), 4);
+}
+
+TEST_F(TestMessage, TestEmptyMessageView)
+{
+  AmqpMessageView view;
+  EXPECT_FALSE(view);
+  EXPECT_ANY_THROW(view.GetBodyType());
+
+  AmqpMessage message;
+  message.SetBody(AmqpValue{"value"});
+  auto valueView = _detail::AmqpMessageFactory::ViewFromImplementation(
+      _detail::AmqpMessageFactory::ToImplementation(message));
+  EXPECT_EQ(valueView.GetBodyType(), MessageBodyType::Value);
+  EXPECT_ANY_THROW(valueView.GetBodyAsBinary());
+  EXPECT_TRUE(valueView.GetMessageAnnotation("x-opt-offset").IsNull());
+}
+
 class MessageSerialization : public testing::Test {
 protected:
   void SetUp() override {}
@@ -437,3 +495,31 @@ TEST_F(MessageSerialization, SerializeMessageWithFooter)
     EXPECT_EQ(message, deserialized);
   }
 }
+
+TEST_F(MessageSerialization, SerializeMessageIntoBuffer)
+{
+  AmqpMessage message;
+  message.Header.Priority = 5;
+  message.Properties.MessageId = "12345";
+  message.MessageAnnotations["key1"] = "value1";
+  message.ApplicationProperties["key1"] = 37;
+  message.Footer["footer1"] = "value1";
+  message.SetBody(AmqpBinaryData{'a', 'b', 'c'});
+  message.SetBody(AmqpBinaryData{'d', 'e', 'f'});
+
+  auto serialized = AmqpMessage::Serialize(message);
+  EXPECT_EQ(AmqpMessage::GetSerializedSize(message), serialized.size());
+
+  // Serializing into a buffer appends the message to its existing content.
+  std::vector<uint8_t> buffer{1, 2, 3};
+  AmqpMessage::Serialize(message, buffer);
+  AmqpMessage::Serialize(message, buffer);
+  ASSERT_EQ(buffer.size(), 3 + 2 * serialized.size());
+  EXPECT_TRUE(std::equal(serialized.begin(), serialized.end(), buffer.begin() + 3));
+  AmqpMessage deserialized
+      = AmqpMessage::Deserialize(buffer.data() + 3 + serialized.size(), serialized.size());
+  EXPECT_EQ(message, deserialized);
+
+  AmqpValue value{"String value."};
+  EXPECT_EQ(AmqpValue::GetSerializedSize(value), AmqpValue::Serialize(value).size());
+}
@@ -3,6 +3,9 @@
 
 #include "azure/core/amqp/internal/common/async_operation_queue.hpp"
 
+#include <chrono>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 using namespace Azure::Core::Amqp::Common::_internal;
@@ -85,3 +88,56 @@ TEST_F(TestAsyncQueue, ReadCanceled)
     EXPECT_FALSE(item);
   }
 }
+
+namespace {
+class CountingPoller {
+public:
+  CountingPoller(AsyncOperationQueue<int>& queue, int completeAfter)
+      : m_queue(queue), m_completeAfter(completeAfter)
+  {
+  }
+  void Poll()
+  {
+    if (++Polls == m_completeAfter)
+    {
+      m_queue.CompleteOperation(Polls);
+    }
+  }
+  int Polls{0};
+
+private:
+  AsyncOperationQueue<int>& m_queue;
+  int m_completeAfter;
+};
+} // namespace
+
+TEST_F(TestAsyncQueue, WaitForPolledResult)
+{
+  // The result is produced by the poller.
+  {
+    AsyncOperationQueue<int> queue;
+    CountingPoller poller(queue, 5);
+    Azure::Core::Context context;
+    auto item = queue.WaitForPolledResult(context, poller);
+    ASSERT_TRUE(item);
+    EXPECT_EQ(5, std::get<0>(*item));
+    EXPECT_EQ(5, poller.Polls);
+  }
+
+  // The result is produced by another thread, and returned without waiting for the next poll.
+  {
+    AsyncOperationQueue<int> queue;
+    CountingPoller poller(queue, -1);
+    Azure::Core::Context context;
+    std::thread completer([&queue]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(200));
+      queue.CompleteOperation(42);
+    });
+    auto item = queue.WaitForPolledResult(context, poller);
+    completer.join();
+    ASSERT_TRUE(item);
+    EXPECT_EQ(42, std::get<0>(*item));
+    // The poller isn't called in a tight loop while waiting.
+    EXPECT_LT(poller.Polls, 100);
+  }
+}
@@ -27,8 +27,11 @@
 #include <azure/core/platform.hpp>
 #include <azure/core/url.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <random>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -569,6 +572,210 @@ namespace Azure { namespace Core { namespace Amqp { namespace Tests {
   }
 
 #if ENABLE_UAMQP
+  namespace {
+    // Accepts, or rejects, the messages sent to it and counts them.
+    class SendAsyncEndpoint final : public MessageTests::MockServiceEndpoint {
+    public:
+      SendAsyncEndpoint(
+          std::string const& name,
+          MessageTests::MockServiceEndpointOptions const& options,
+          bool rejectMessages = false)
+          : MockServiceEndpoint(name, options), m_rejectMessages(rejectMessages)
+      {
+      }
+
+      virtual ~SendAsyncEndpoint() = default;
+
+      std::atomic<size_t> ReceivedMessageCount{0};
+
+    private:
+      bool m_rejectMessages;
+
+      Models::AmqpValue OnMessageReceived(
+          MessageReceiver const& receiver,
+          std::shared_ptr<Models::AmqpMessage> const& message) override
+      {
+        if (m_rejectMessages)
+        {
+          return Models::_internal::Messaging::DeliveryRejected(
+              "test:Rejected", "Message rejected by the test.", {});
+        }
+        return MockServiceEndpoint::OnMessageReceived(receiver, message);
+      }
+
+      void MessageReceived(std::string const&, std::shared_ptr<Models::AmqpMessage> const&)
+          override
+      {
+        ++ReceivedMessageCount;
+      }
+    };
+
+    using SendResultQueue = Common::_internal::
+        AsyncOperationQueue<MessageSendStatus, Models::_internal::AmqpError>;
+  } // namespace
+
+  TEST_F(TestMessageSendReceive, SenderSendAsyncPipelined)
+  {
+    auto senderEndpoint = std::make_shared<SendAsyncEndpoint>(
+        "localhost/ingress", MessageTests::MockServiceEndpointOptions{});
+    m_mockServer.AddServiceEndpoint(senderEndpoint);
+
+    auto connection{CreateAmqpConnection()};
+    auto session{CreateAmqpSession(connection)};
+    StartServerListening();
+
+    {
+      MessageSenderOptions options;
+      options.Name = "sender-link";
+      options.MessageSource = "ingress";
+      options.SettleMode = SenderSettleMode::Unsettled;
+      options.MaxMessageSize = 65536;
+      MessageSender sender(session.CreateMessageSender("localhost/ingress", options));
+      EXPECT_FALSE(sender.Open());
+
+      Models::AmqpMessage message;
+      message.SetBody(Models::AmqpBinaryData{'h', 'e', 'l', 'l', 'o'});
+
+      // The messages are sent one at a time first, to compare the send times.
+      constexpr size_t messageCount = 100;
+      auto const sendStart = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < messageCount; i++)
+      {
+        EXPECT_EQ(std::get<0>(sender.Send(message)), MessageSendStatus::Ok);
+      }
+      auto const sendDuration = std::chrono::steady_clock::now() - sendStart;
+
+      // All the messages are sent before any of them is settled.
+      SendResultQueue sendResults;
+      auto const sendAsyncStart = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < messageCount; i++)
+      {
+        sender.SendAsync(
+            message,
+            [&sendResults](MessageSendStatus status, Models::_internal::AmqpError const& error) {
+              sendResults.CompleteOperation(status, error);
+            });
+      }
+
+      Azure::Core::Context context{Azure::DateTime::clock::now() + std::chrono::seconds(15)};
+      for (size_t i = 0; i < messageCount; i++)
+      {
+        auto result = sendResults.WaitForResult(context);
+        ASSERT_TRUE(result);
+        EXPECT_EQ(std::get<0>(*result), MessageSendStatus::Ok);
+      }
+      auto const sendAsyncDuration = std::chrono::steady_clock::now() - sendAsyncStart;
+      using std::chrono::milliseconds;
+      GTEST_LOG_(INFO) << "Sent " << messageCount << " messages in "
+                       << std::chrono::duration_cast<milliseconds>(sendDuration).count()
+                       << " ms one at a time, and in "
+                       << std::chrono::duration_cast<milliseconds>(sendAsyncDuration).count()
+                       << " ms pipelined.";
+
+      for (int i = 0; i < 100 && senderEndpoint->ReceivedMessageCount != 2 * messageCount; i++)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      }
+      EXPECT_EQ(senderEndpoint->ReceivedMessageCount, 2 * messageCount);
+
+      sender.Close();
+    }
+    StopServerListening();
+
+    EndAmqpSession(session);
+    CloseAmqpConnection(connection);
+  }
+
+  TEST_F(TestMessageSendReceive, SenderSendAsyncCancelled)
+  {
+    auto senderEndpoint = std::make_shared<SendAsyncEndpoint>(
+        "localhost/ingress", MessageTests::MockServiceEndpointOptions{});
+    m_mockServer.AddServiceEndpoint(senderEndpoint);
+
+    auto connection{CreateAmqpConnection()};
+    auto session{CreateAmqpSession(connection)};
+    StartServerListening();
+
+    {
+      MessageSenderOptions options;
+      options.Name = "sender-link";
+      options.MessageSource = "ingress";
+      options.MaxMessageSize = 65536;
+      MessageSender sender(session.CreateMessageSender("localhost/ingress", options));
+      EXPECT_FALSE(sender.Open());
+
+      Models::AmqpMessage message;
+      message.SetBody(Models::AmqpBinaryData{'h', 'e', 'l', 'l', 'o'});
+
+      // The message isn't sent, and the callback is still called, before SendAsync returns.
+      Azure::Core::Context context;
+      context.Cancel();
+      bool called = false;
+      sender.SendAsync(
+          message,
+          [&called](MessageSendStatus status, Models::_internal::AmqpError const& error) {
+            called = true;
+            EXPECT_EQ(status, MessageSendStatus::Cancelled);
+            EXPECT_EQ(error.Condition, Models::_internal::AmqpErrorCondition::OperationCancelled);
+          },
+          context);
+      EXPECT_TRUE(called);
+      EXPECT_EQ(senderEndpoint->ReceivedMessageCount, 0u);
+
+      sender.Close();
+    }
+    StopServerListening();
+
+    EndAmqpSession(session);
+    CloseAmqpConnection(connection);
+  }
+
+  TEST_F(TestMessageSendReceive, SenderSendAsyncRejected)
+  {
+    auto senderEndpoint = std::make_shared<SendAsyncEndpoint>(
+        "localhost/ingress", MessageTests::MockServiceEndpointOptions{}, true);
+    m_mockServer.AddServiceEndpoint(senderEndpoint);
+
+    auto connection{CreateAmqpConnection()};
+    auto session{CreateAmqpSession(connection)};
+    StartServerListening();
+
+    {
+      MessageSenderOptions options;
+      options.Name = "sender-link";
+      options.MessageSource = "ingress";
+      options.SettleMode = SenderSettleMode::Unsettled;
+      options.MaxMessageSize = 65536;
+      MessageSender sender(session.CreateMessageSender("localhost/ingress", options));
+      EXPECT_FALSE(sender.Open());
+
+      Models::AmqpMessage message;
+      message.SetBody(Models::AmqpBinaryData{'h', 'e', 'l', 'l', 'o'});
+
+      SendResultQueue sendResults;
+      sender.SendAsync(
+          message,
+          [&sendResults](MessageSendStatus status, Models::_internal::AmqpError const& error) {
+            sendResults.CompleteOperation(status, error);
+          });
+
+      // The rejection is reported with the error sent by the remote node.
+      Azure::Core::Context context{Azure::DateTime::clock::now() + std::chrono::seconds(15)};
+      auto result = sendResults.WaitForResult(context);
+      ASSERT_TRUE(result);
+      EXPECT_EQ(std::get<0>(*result), MessageSendStatus::Error);
+      EXPECT_EQ(
+          std::get<1>(*result).Condition, Models::_internal::AmqpErrorCondition("test:Rejected"));
+      EXPECT_EQ(std::get<1>(*result).Description, "Message rejected by the test.");
+
+      sender.Close();
+    }
+    StopServerListening();
+
+    EndAmqpSession(session);
+    CloseAmqpConnection(connection);
+  }
+
   TEST_F(TestMessageSendReceive, AuthenticatedSender)
   {
 #if !defined(USE_NATIVE_BROKER)
@@ -13,6 +13,8 @@
 #include "azure/core/nullable.hpp"
 
 #include <chrono>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -20,6 +22,8 @@ namespace Azure { namespace Core { namespace Http {
   class CurlNetworkConnection;
 
   namespace _detail {
+    class CurlEventLoopGroup;
+
     /**
      * @brief Default maximum time in milliseconds that you allow the connection phase to the server
      * to take.
@@ -199,6 +203,115 @@ namespace Azure { namespace Core { namespace Http {
      * @brief If set, enables libcurl's internal SSL session caching.
      */
     bool EnableCurlSslCaching = true;
+
+    /**
+     * @brief The number of event loop threads used to multiplex requests with libcurl's multi
+     * interface.
+     *
+     * @details When `0` (the default), every request is performed on the calling thread with a
+     * connection taken from the connection pool. When greater than `0`, the transport drives all
+     * the requests from this many background threads, each one running many transfers
+     * concurrently with `curl_multi`. The number of requests in flight is then no longer bound to
+     * the number of threads sending them.
+     *
+     * @remark Requires libcurl >= 7.68.0. Older versions of libcurl, and requests that need the
+     * certificate revocation list check or a WebSocket upgrade, are always performed on the
+     * calling thread.
+     */
+    size_t EventLoopThreadCount = 0;
+
+    /**
+     * @brief The size, in bytes, of the buffer used to receive data from the network.
+     *
+     * @details The buffer holds the status line and the headers of a response, and the response
+     * body when it is read in chunks smaller than the buffer. Reads at least as large as the buffer
+     * receive the data straight into the caller's memory.
+     *
+     * @remarks The default size is 4 KiB and using `0` would set this default value.
+     *
+     */
+    size_t ReceiveBufferSize = 0;
+
+    /**
+     * @brief If set, the receive buffer grows, up to 256 KiB, for large response bodies.
+     *
+     * @details The buffer is sized from the `Content-Length` of the response, or, when the length
+     * is not known, doubled each time a read from the network fills it.
+     */
+    bool EnableAdaptiveReceiveBuffer = true;
+
+    /**
+     * @brief The maximum number of idle connections kept in the connection pool for each host.
+     *
+     * @details When a connection is moved back to the pool of a host which is already full, the
+     * least recently used connection of the host is closed.
+     *
+     * @remarks The default is 1024 connections and using `0` would set this default value.
+     *
+     */
+    size_t MaxIdleConnectionsPerHost = 0;
+
+    /**
+     * @brief The maximum number of connections opened by the connection pool for each host,
+     * including the connections in use.
+     *
+     * @details Once the limit is reached, sending a request to the host waits until another
+     * request releases its connection or until the context is cancelled.
+     *
+     * @remarks The default value `0` means there is no limit. This option doesn't apply to the
+     * requests performed by event loops (see
+     * #Azure::Core::Http::CurlTransportOptions::EventLoopThreadCount).
+     *
+     */
+    size_t MaxConnectionsPerHost = 0;
+
+    /**
+     * @brief If set, requests to `https` endpoints negotiate HTTP/2, and concurrent requests to
+     * the same host are multiplexed over a shared connection.
+     *
+     * @details HTTP/2 requests are performed by event loops. When
+     * #Azure::Core::Http::CurlTransportOptions::EventLoopThreadCount is `0`, the transport uses one
+     * event loop. Requests keep using HTTP/1.1 when the server doesn't support HTTP/2, for `http`
+     * endpoints, and when libcurl is built without HTTP/2 support.
+     *
+     * @remark Requires libcurl >= 7.68.0. The option is ignored when the certificate revocation
+     * list check is enabled.
+     */
+    bool EnableHttp2 = false;
+  };
+
+  /**
+   * @brief Metrics of the connection pool shared by all the #Azure::Core::Http::CurlTransport
+   * instances of the application.
+   */
+  struct CurlConnectionPoolMetrics final
+  {
+    /**
+     * @brief The number of requests which re-used a connection from the pool.
+     */
+    uint64_t Hits = 0;
+
+    /**
+     * @brief The number of requests which needed a new connection.
+     */
+    uint64_t Misses = 0;
+
+    /**
+     * @brief The number of idle connections closed by the pool, because they expired or because
+     * the pool of their host was full.
+     */
+    uint64_t Evictions = 0;
+
+    /**
+     * @brief The total time spent by requests waiting for a connection because the
+     * #Azure::Core::Http::CurlTransportOptions::MaxConnectionsPerHost limit was reached.
+     */
+    std::chrono::microseconds WaitTime{0};
+
+    /**
+     * @brief The number of idle connections currently in the pool.
+     */
+    size_t IdleConnections = 0;
   };
 
   /**
@@ -208,6 +321,12 @@ namespace Azure { namespace Core { namespace Http {
   private:
     CurlTransportOptions m_options;
 
+    /**
+     * @brief The event loops used to perform the requests when
+     * #Azure::Core::Http::CurlTransportOptions::EventLoopThreadCount is greater than `0`.
+     */
+    std::shared_ptr<_detail::CurlEventLoopGroup> m_eventLoops;
+
     /**
      * @brief Called when an HTTP response indicates the connection should be upgraded to
      * a websocket. Takes ownership of the CurlNetworkConnection object.
@@ -220,9 +339,7 @@ namespace Azure { namespace Core { namespace Http {
      *
      * @param options Optional parameter to override the default options.
      */
-    CurlTransport(CurlTransportOptions const& options = CurlTransportOptions()) : m_options(options)
-    {
-    }
+    CurlTransport(CurlTransportOptions const& options = CurlTransportOptions());
 
     /**
      * @brief Construct a new CurlTransport object based on common Azure HTTP Transport Options
@@ -250,6 +367,54 @@ namespace Azure { namespace Core { namespace Http {
      * @return unique ptr to an HTTP RawResponse.
      */
     std::unique_ptr<RawResponse> Send(Request& request, Context const& context) override;
+
+    /**
+     * @brief Starts sending an HTTP Request and returns without waiting for the response.
+     *
+     * @details When the transport runs event loops, the request is queued to one of them and no
+     * thread is blocked while the request is in flight. Otherwise, the request is sent from a new
+     * thread.
+     *
+     * @param request an HTTP Request to be send. It must outlive the returned future and the body
+     * stream of the response. The transport must outlive the returned future.
+     * @param context A context to control the request lifetime.
+     *
+     * @return A future which becomes ready once the status line and the headers of the response
+     * have been received.
+     */
+    std::future<std::unique_ptr<RawResponse>> SendAsync(Request& request, Context const& context)
+        override;
+
+    /**
+     * @brief Opens connections to a host ahead of time and adds them to the connection pool, so
+     * the first requests sent to the host don't wait for the TCP and TLS handshakes.
+     *
+     * @details The connections are opened in parallel, by up to 8 threads, with the options of
+     * this transport. They are re-used by the requests sent to the same host by any transport
+     * using the same connection options.
+     *
+     * @remark Idle connections are closed by the pool after 60 seconds. No more connections are
+     * opened than #Azure::Core::Http::CurlTransportOptions::MaxIdleConnectionsPerHost and
+     * #Azure::Core::Http::CurlTransportOptions::MaxConnectionsPerHost allow. No connection is
+     * opened when the transport runs event loops, since they don't use the connection pool.
+     *
+     * @param url The URL of the host to connect to. Only its scheme, host and port are used.
+     * @param connectionCount The number of connections to open.
+     * @param context A context to stop opening connections.
+     *
+     * @return The number of connections opened and added to the pool.
+     */
+    size_t WarmUpConnections(
+        Azure::Core::Url const& url,
+        size_t connectionCount,
+        Context const& context = Context{});
+
+    /**
+     * @brief Gets the metrics of the connection pool.
+     *
+     * @remark The connection pool is shared by all the transports of the application.
+     */
+    static CurlConnectionPoolMetrics GetConnectionPoolMetrics();
   };
 
 }}} // namespace Azure::Core::Http
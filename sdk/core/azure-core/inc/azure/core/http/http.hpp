@@ -19,8 +19,10 @@
 #include "azure/core/url.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <stdexcept>
@@ -174,6 +176,186 @@ namespace Azure { namespace Core { namespace Http {
     class RetryPolicy;
   }} // namespace Policies::_internal
 
+  namespace _detail {
+    /**
+     * @brief An HTTP header of an #Azure::Core::Http::Request.
+     *
+     */
+    struct RequestHeader final
+    {
+      /**
+       * @brief The lowercase name of a well-known header, shared by all the requests, or null when
+       * the header holds its name in #Name.
+       *
+       */
+      std::string const* WellKnownName;
+
+      /**
+       * @brief The lowercase name of the header, when it isn't a well-known header.
+       *
+       */
+      std::string Name;
+
+      /**
+       * @brief The value of the header.
+       *
+       */
+      std::string Value;
+
+      /**
+       * @brief Whether the header was set during the current try of the retry policy. The next
+       * try removes it, or restores #ValueBeforeTry.
+       *
+       */
+      bool IsRetryHeader;
+
+      /**
+       * @brief The value the header had before the current try of the retry policy set it.
+       *
+       */
+      Azure::Nullable<std::string> ValueBeforeTry;
+
+      /**
+       * @brief Get the lowercase name of the header.
+       *
+       */
+      std::string const& GetName() const { return WellKnownName ? *WellKnownName : Name; }
+    };
+  } // namespace _detail
+
+  /**
+   * @brief A read-only view of the HTTP headers of an #Azure::Core::Http::Request, in the order
+   * they were set.
+   *
+   * @details Unlike #Azure::Core::Http::Request::GetHeaders(), the view doesn't copy the headers.
+   * It reflects the changes made to the headers of the request, but its iterators are invalidated
+   * by them.
+   *
+   */
+  class RequestHeadersView final {
+    std::vector<_detail::RequestHeader> const* m_headers;
+
+  public:
+    /**
+     * @brief An iterator over the headers of the view, which yields pairs of references to the
+     * lowercase name and the value of each header.
+     *
+     */
+    class const_iterator final {
+      std::vector<_detail::RequestHeader>::const_iterator m_current;
+
+    public:
+      /** @brief The category of the iterator. */
+      using iterator_category = std::forward_iterator_tag;
+      /** @brief The type of the elements. */
+      using value_type = std::pair<std::string const&, std::string const&>;
+      /** @brief The type of the distance between iterators. */
+      using difference_type = std::ptrdiff_t;
+      /** @brief The elements are returned by value, as they are references. */
+      using pointer = void;
+      /** @brief The elements are returned by value, as they are references. */
+      using reference = value_type;
+
+      /**
+       * @brief Constructs an iterator pointing to \p current.
+       *
+       * @param current The header the iterator points to.
+       */
+      explicit const_iterator(std::vector<_detail::RequestHeader>::const_iterator current)
+          : m_current(current)
+      {
+      }
+
+      /**
+       * @brief Get the name and the value of the header.
+       *
+       */
+      value_type operator*() const { return value_type(m_current->GetName(), m_current->Value); }
+
+      /**
+       * @brief Advance to the next header.
+       *
+       */
+      const_iterator& operator++()
+      {
+        ++m_current;
+        return *this;
+      }
+
+      /**
+       * @brief Advance to the next header.
+       *
+       */
+      const_iterator operator++(int)
+      {
+        auto previous = *this;
+        ++m_current;
+        return previous;
+      }
+
+      /**
+       * @brief Whether both iterators point to the same header.
+       *
+       */
+      bool operator==(const_iterator const& other) const { return m_current == other.m_current; }
+
+      /**
+       * @brief Whether the iterators point to different headers.
+       *
+       */
+      bool operator!=(const_iterator const& other) const { return m_current != other.m_current; }
+    };
+
+    /**
+     * @brief Constructs a view of \p headers.
+     *
+     * @param headers The headers of a request.
+     */
+    explicit RequestHeadersView(std::vector<_detail::RequestHeader> const& headers)
+        : m_headers(&headers)
+    {
+    }
+
+    /**
+     * @brief Get an iterator to the first header.
+     *
+     */
+    const_iterator begin() const { return const_iterator(m_headers->begin()); }
+
+    /**
+     * @brief Get an iterator past the last header.
+     *
+     */
+    const_iterator end() const { return const_iterator(m_headers->end()); }
+
+    /**
+     * @brief Get the number of headers.
+     *
+     */
+    size_t size() const { return m_headers->size(); }
+
+    /**
+     * @brief Whether there are no headers.
+     *
+     */
+    bool empty() const { return m_headers->empty(); }
+
+    /**
+     * @brief Find a header by name, which is compared case-insensitively.
+     *
+     * @param name The name of the header.
+     * @return An iterator to the header, or #end() if it isn't found.
+     */
+    const_iterator find(std::string const& name) const
+    {
+      return const_iterator(std::find_if(
+          m_headers->begin(), m_headers->end(), [&name](_detail::RequestHeader const& header) {
+            return Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+                header.GetName(), name);
+          }));
+    }
+  };
+
   /**
    * @brief A request message from a client to a server.
    *
@@ -203,8 +385,9 @@ namespace Azure { namespace Core { namespace Http {
   private:
     HttpMethod m_method;
     Url m_url;
-    CaseInsensitiveMap m_headers;
-    CaseInsensitiveMap m_retryHeaders;
+    // A few headers are set on a request, so they are searched linearly, and the retry headers
+    // are kept with the others.
+    std::vector<_detail::RequestHeader> m_headers;
 
     Azure::Core::IO::BodyStream* m_bodyStream;
 
@@ -312,6 +495,15 @@ namespace Azure { namespace Core { namespace Http {
      */
     CaseInsensitiveMap GetHeaders() const;
 
+    /**
+     * @brief Get a view of the HTTP headers, which doesn't copy them.
+     *
+     * @remark The view must not outlive this request, and its iterators are invalidated when the
+     * headers are changed.
+     *
+     */
+    RequestHeadersView GetHeadersView() const { return RequestHeadersView(m_headers); }
+
     /**
      * @brief Get HTTP body as #Azure::Core::IO::BodyStream.
      *
@@ -346,6 +538,15 @@ namespace Azure { namespace Core { namespace Http {
   namespace _detail {
     struct RawResponseHelpers final
     {
+      /**
+       * @brief Check that \p headerName does not contain invalid characters.
+       *
+       * @param headerName The header name to be checked.
+       *
+       * @throw if \p headerName is invalid.
+       */
+      static void ValidateHeaderName(std::string const& headerName);
+
       /**
        * @brief Insert a header into \p headers checking that \p headerName does not contain invalid
        * characters.
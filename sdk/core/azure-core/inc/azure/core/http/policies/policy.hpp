@@ -20,6 +20,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -227,6 +228,18 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
      */
     std::string ExpectedTlsRootCertificate{};
 
+    /**
+     * @brief Enable HTTP/2, so concurrent requests to the same host can be multiplexed over a
+     * shared connection.
+     *
+     * @remark HTTP/2 is negotiated with the server during the TLS handshake. Requests keep using
+     * HTTP/1.1 when either the server or the platform doesn't support HTTP/2.
+     *
+     * @remark This field is only used if the customer has not specified a default transport
+     * adapter. If the customer has set a Transport adapter, this option is ignored.
+     */
+    bool EnableHttp2{false};
+
     /**
      * @brief #Azure::Core::Http::HttpTransport that the transport policy will use to send and
      * receive requests and responses over the wire.
@@ -277,6 +290,29 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         NextHttpPolicy nextPolicy,
         Context const& context) const = 0;
 
+    /**
+     * @brief Applies this HTTP policy, and returns without waiting for the response.
+     *
+     * @details The policies which don't override it block: they run #Send, so the policies after
+     * them and the transport send the request synchronously too, and return a future which is
+     * already ready. Their #Send is opaque, so it can't be split around an asynchronous send. The
+     * policies which override it forward the request with
+     * #Azure::Core::Http::Policies::NextHttpPolicy::SendAsync, and process the response in a
+     * deferred continuation run by the thread waiting for the future. A custom policy added to a
+     * pipeline used asynchronously should override it.
+     *
+     * @param request An HTTP request being sent. It must outlive the returned future.
+     * @param nextPolicy The next HTTP to invoke after this policy has been applied.
+     * @param context A context to control the request lifetime.
+     *
+     * @return The future of the HTTP response after this policy, and all subsequent HTTP policies
+     * in the stack sequence of policies have been applied. The policies must outlive it.
+     */
+    virtual std::future<std::unique_ptr<RawResponse>> SendAsync(
+        Request& request,
+        NextHttpPolicy nextPolicy,
+        Context const& context) const;
+
     /**
      * @brief Destructs `%HttpPolicy`.
      *
@@ -356,6 +392,18 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
      * sequence of policies have been applied.
      */
     std::unique_ptr<RawResponse> Send(Request& request, Context const& context);
+
+    /**
+     * @brief Applies this HTTP policy, and returns without waiting for the response.
+     *
+     * @param request An HTTP request being sent. It must outlive the returned future.
+     * @param context A context to control the request lifetime.
+     *
+     * @return The future of the HTTP response after this policy, and all subsequent HTTP policies
+     * in the stack sequence of policies have been applied. An exception thrown by a policy is
+     * stored in the future.
+     */
+    std::future<std::unique_ptr<RawResponse>> SendAsync(Request& request, Context const& context);
   };
 
   namespace _internal {
@@ -385,6 +433,11 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      std::future<std::unique_ptr<RawResponse>> SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
     };
 
     /**
@@ -416,6 +469,15 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           NextHttpPolicy nextPolicy,
           Context const& context) const final;
 
+      /**
+       * @brief Sends the first try of the request without waiting for the response. The retries,
+       * if any, are sent by the thread waiting for the future.
+       */
+      std::future<std::unique_ptr<RawResponse>> SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const final;
+
       /**
        * @brief Get the Retry Count from the context.
        *
@@ -442,6 +504,16 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           int32_t attempt,
           std::chrono::milliseconds& retryAfter,
           double jitterFactor = -1) const;
+
+    private:
+      std::unique_ptr<RawResponse> SendTries(
+          Request& request,
+          NextHttpPolicy& nextPolicy,
+          Context const& context,
+          Context const& retryContext,
+          int32_t& retryCount,
+          std::future<std::unique_ptr<RawResponse>> firstTry,
+          std::map<std::string, std::string> firstTryQueryParameters) const;
     };
 
     /**
@@ -479,6 +551,20 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
 
         return nextPolicy.Send(request, context);
       }
+
+      std::future<std::unique_ptr<RawResponse>> SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override
+      {
+        if (!request.GetHeader(RequestIdHeader).HasValue())
+        {
+          auto const uuid = Uuid::CreateUuid().ToString();
+          request.SetHeader(RequestIdHeader, uuid);
+        }
+
+        return nextPolicy.SendAsync(request, context);
+      }
     };
 
     /**
@@ -518,6 +604,11 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      std::future<std::unique_ptr<RawResponse>> SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
     };
 
     /**
@@ -566,6 +657,11 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      std::future<std::unique_ptr<RawResponse>> SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
     };
 
     /**
@@ -608,6 +704,11 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
 
+      std::future<std::unique_ptr<RawResponse>> SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
+
     protected:
       BearerTokenAuthenticationPolicy(BearerTokenAuthenticationPolicy const& other)
           : BearerTokenAuthenticationPolicy(other.m_credential, other.m_tokenRequestContext)
@@ -625,6 +726,16 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           NextHttpPolicy& nextPolicy,
           Context const& context) const;
 
+      /**
+       * @brief Authorizes the request like #AuthorizeAndSendRequest, and sends it with
+       * #Azure::Core::Http::Policies::NextHttpPolicy::SendAsync. A policy overriding
+       * #AuthorizeAndSendRequest must override it too.
+       */
+      virtual std::future<std::unique_ptr<RawResponse>> AuthorizeAndSendRequestAsync(
+          Request& request,
+          NextHttpPolicy& nextPolicy,
+          Context const& context) const;
+
       virtual bool AuthorizeRequestOnChallenge(
           std::string const& challenge,
           Request& request,
@@ -666,6 +777,11 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      std::future<std::unique_ptr<RawResponse>> SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
     };
   } // namespace _internal
 }}}} // namespace Azure::Core::Http::Policies
@@ -12,6 +12,7 @@
 #include "azure/core/http/http.hpp"
 #include "azure/core/http/raw_response.hpp"
 
+#include <future>
 #include <memory>
 
 namespace Azure { namespace Core { namespace Http {
@@ -34,6 +35,24 @@ namespace Azure { namespace Core { namespace Http {
     // TODO - Should this be const
     virtual std::unique_ptr<RawResponse> Send(Request& request, Context const& context) = 0;
 
+    /**
+     * @brief Starts sending an HTTP request over the wire, and returns without waiting for the
+     * response.
+     *
+     * @details Transports which can't wait for several responses at once don't override it. It
+     * sends the request with #Send from a new thread, unless too many requests are already sent
+     * this way by the process; the request is then sent by the thread waiting for the future.
+     *
+     * @param request An #Azure::Core::Http::Request to send. It must outlive the returned future.
+     * @param context A context to control the request lifetime.
+     *
+     * @return A future which becomes ready once the status line and the headers of the response
+     * have been received. The transport must outlive it.
+     */
+    virtual std::future<std::unique_ptr<RawResponse>> SendAsync(
+        Request& request,
+        Context const& context);
+
     /**
      * @brief Destructs `%HttpTransport`.
      *
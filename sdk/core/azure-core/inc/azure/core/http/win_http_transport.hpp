@@ -105,6 +105,14 @@ namespace Azure { namespace Core { namespace Http {
      * authentication.
      */
     PCCERT_CONTEXT TlsClientCertificate{nullptr};
+
+    /**
+     * @brief If True, enables HTTP/2 for the requests of the transport.
+     *
+     * @remark Requires Windows 10 version 1607 or later. Requests keep using HTTP/1.1 on older
+     * versions of Windows and with servers which don't support HTTP/2.
+     */
+    bool EnableHttp2{false};
   };
 
   /**
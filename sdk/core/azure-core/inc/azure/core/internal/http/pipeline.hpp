@@ -16,6 +16,8 @@
 #include "azure/core/internal/client_options.hpp"
 #include "azure/core/internal/http/http_sanitizer.hpp"
 
+#include <exception>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -230,5 +232,36 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
       return m_policies[0]->Send(
           request, Azure::Core::Http::Policies::NextHttpPolicy(0, m_policies), context);
     }
+
+    /**
+     * @brief Start the HTTP pipeline, and return without waiting for the response.
+     *
+     * @details The request is sent without blocking a thread when the transport supports it, see
+     * #Azure::Core::Http::HttpTransport::SendAsync. The future is deferred: the policies process
+     * the response on the thread calling `get()` or `wait()` on the future, and the retries, if
+     * any, are sent from that thread.
+     *
+     * @param request The HTTP request to be processed. It must outlive the returned future.
+     * @param context A context to control the request lifetime.
+     *
+     * @return The future of the HTTP response after the request has been processed. The pipeline
+     * must outlive it. An exception thrown while processing the request is stored in the future.
+     */
+    std::future<std::unique_ptr<Azure::Core::Http::RawResponse>> SendAsync(
+        Azure::Core::Http::Request& request,
+        Context const& context) const
+    {
+      try
+      {
+        return m_policies[0]->SendAsync(
+            request, Azure::Core::Http::Policies::NextHttpPolicy(0, m_policies), context);
+      }
+      catch (...)
+      {
+        std::promise<std::unique_ptr<Azure::Core::Http::RawResponse>> failedResponse;
+        failedResponse.set_exception(std::current_exception());
+        return failedResponse.get_future();
+      }
+    }
   };
 }}}} // namespace Azure::Core::Http::_internal
@@ -25,6 +25,9 @@
 #include <vector>
 
 namespace Azure { namespace Core { namespace IO {
+  namespace _detail {
+    class BodyStreamAccessor;
+  } // namespace _detail
 
   /**
    * @brief Used to read data to/from a service.
@@ -128,6 +131,8 @@ namespace Azure { namespace Core { namespace IO {
 
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
+    friend class _detail::BodyStreamAccessor;
+
   public:
     // Forbid constructor for rval so we don't end up storing dangling ptr
     MemoryBodyStream(std::vector<uint8_t> const&&) = delete;
@@ -180,6 +185,8 @@ namespace Azure { namespace Core { namespace IO {
 
       size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
+      friend class _detail::BodyStreamAccessor;
+
     public:
 #if defined(AZ_PLATFORM_POSIX)
       /**
@@ -258,6 +265,8 @@ namespace Azure { namespace Core { namespace IO {
 
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
+    friend class _detail::BodyStreamAccessor;
+
   public:
     /**
      * @brief Constructs `%FileBodyStream` from a file name.
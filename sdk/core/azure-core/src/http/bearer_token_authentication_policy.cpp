@@ -6,6 +6,7 @@
 #include "azure/core/internal/credentials/authorization_challenge_parser.hpp"
 
 #include <chrono>
+#include <future>
 
 using Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy;
 
@@ -51,6 +52,48 @@ std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::AuthorizeAndSendRe
   return nextPolicy.Send(request, context);
 }
 
+std::future<std::unique_ptr<RawResponse>> BearerTokenAuthenticationPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  if (request.GetUrl().GetScheme() != "https")
+  {
+    throw AuthenticationException(
+        "Bearer token authentication is not permitted for non TLS protected (https) endpoints.");
+  }
+
+  auto pendingResult = AuthorizeAndSendRequestAsync(request, nextPolicy, context);
+
+  // A challenge is answered by the thread waiting for the future.
+  return std::async(
+      std::launch::deferred,
+      [this, &request, nextPolicy, context, pendingResult = std::move(pendingResult)]() mutable {
+        auto result = pendingResult.get();
+        {
+          auto const& response = *result;
+          m_invalidateToken = (response.GetStatusCode() == HttpStatusCode::Unauthorized);
+          auto const& challenge = AuthorizationChallengeHelper::GetChallenge(response);
+          if (!challenge.empty() && AuthorizeRequestOnChallenge(challenge, request, context))
+          {
+            result = nextPolicy.Send(request, context);
+          }
+        }
+
+        return result;
+      });
+}
+
+std::future<std::unique_ptr<RawResponse>>
+BearerTokenAuthenticationPolicy::AuthorizeAndSendRequestAsync(
+    Request& request,
+    NextHttpPolicy& nextPolicy,
+    Context const& context) const
+{
+  AuthenticateAndAuthorizeRequest(request, m_tokenRequestContext, context);
+  return nextPolicy.SendAsync(request, context);
+}
+
 bool BearerTokenAuthenticationPolicy::AuthorizeRequestOnChallenge(
     std::string const& challenge,
     Request& request,
@@ -21,8 +21,10 @@
 #include "azure/core/internal/strings.hpp"
 
 // Private include
+#include "../../private/body_stream_accessor.hpp"
 #include "curl_connection_pool_private.hpp"
 #include "curl_connection_private.hpp"
+#include "curl_multi_private.hpp"
 #include "curl_session_private.hpp"
 
 #if defined(AZ_PLATFORM_POSIX)
@@ -53,16 +55,23 @@
 #include <poll.h> // for poll()
 
 #include <sys/socket.h> // for socket shutdown
+#if defined(AZ_PLATFORM_LINUX)
+#include <sys/sendfile.h> // for sendfile()
+#endif
 #elif defined(AZ_PLATFORM_WINDOWS)
 #include <winsock2.h> // for WSAPoll();
 #endif // AZ_PLATFORM_POSIX/AZ_PLATFORM_WINDOWS
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <chrono>
+#include <future>
 #include <iomanip>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace {
 std::string const LogMsgPrefix = "[CURL Transport Adapter]: ";
@@ -206,71 +215,83 @@ static void CleanupThread()
   // This method can wake up in de-attached mode after the application has been terminated.
   // If that happens, trying to use `Log` would cause `abort` as it was previously deallocated.
   using namespace Azure::Core::Http::_detail;
+  auto& pool = CurlConnectionPool::g_curlConnectionPool;
   for (;;)
   {
-    // Won't continue until the ConnectionPoolMutex is released from MoveConnectionBackToPool
-    std::unique_lock<std::mutex> lockForPoolCleaning(
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-
-    // Wait for the default time OR to the signal from the conditional variable.
-    // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
-    // wakes up (or it's cancelled).
-    if (CurlConnectionPool::g_curlConnectionPool.ConditionalVariableForCleanThread.wait_for(
-            lockForPoolCleaning,
-            std::chrono::milliseconds(DefaultCleanerIntervalMilliseconds),
-            []() {
-              return CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size() == 0;
-            }))
-    {
-      // Cancelled by another thread or no connections on wakeup
-      CurlConnectionPool::g_curlConnectionPool.IsCleanThreadRunning = false;
-      break;
-    }
-
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeCleaned;
-
-    // loop the connection pool index - Note: lock is re-taken for the mutex
-    // Notes: The size of each host-index is always expected to be greater than 0 because the
-    // host-index is removed anytime it becomes empty.
-    for (auto index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.begin();
-         index != CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.end();)
     {
-      // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
-      // push_front). The last connection moved to the pool will be the first to be re-used. Because
-      // of this, the oldest connection in the pool can be found at the end of the list. Looping the
-      // connection pool backwards until a connection that is not expired is found or until all
-      // connections are removed.
-      auto& connectionList = index->second;
-      auto connectionIter = connectionList.end();
-      while (connectionIter != connectionList.begin())
+      std::unique_lock<std::mutex> lockForCleanThread(pool.CleanThreadMutex);
+
+      // Wait for the default time OR to the signal from the conditional variable.
+      // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
+      // wakes up (or it's cancelled).
+      if (pool.ConditionalVariableForCleanThread.wait_for(
+              lockForCleanThread,
+              std::chrono::milliseconds(DefaultCleanerIntervalMilliseconds),
+              [&pool]() { return pool.IdleConnectionCount == 0; }))
       {
-        --connectionIter;
-        if ((*connectionIter)->IsExpired())
-        {
-          // remove connection from the pool and update the connection to the next one
-          // which is going to be list.end()
-          connectionsToBeCleaned.emplace_back(std::move(*connectionIter));
-          connectionIter = connectionList.erase(connectionIter);
-        }
-        else
+        // Cancelled by another thread or no connections on wakeup. A connection moved to the pool
+        // after the count was checked, but before the flag is cleared, is still cleaned by this
+        // thread.
+        pool.IsCleanThreadRunning = false;
+        if (pool.IdleConnectionCount == 0)
         {
           break;
         }
+        pool.IsCleanThreadRunning = true;
+        continue;
       }
+    }
 
-      if (connectionList.empty())
-      {
-        index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.erase(index);
-      }
-      else
+    // Each stripe is locked on its own, so threads using the pool only wait for the stripe being
+    // cleaned.
+    for (auto& shard : pool.GetShards())
+    {
+      decltype(shard.ConnectionPoolIndex)::mapped_type connectionsToBeCleaned;
       {
-        ++index;
+        std::lock_guard<std::mutex> lockForPoolCleaning(shard.Mutex);
+
+        // Notes: The size of each host-index is always expected to be greater than 0 because the
+        // host-index is removed anytime it becomes empty.
+        for (auto index = shard.ConnectionPoolIndex.begin();
+             index != shard.ConnectionPoolIndex.end();)
+        {
+          // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
+          // push_front). The last connection moved to the pool will be the first to be re-used.
+          // Because of this, the oldest connection in the pool can be found at the end of the list.
+          // Looping the connection pool backwards until a connection that is not expired is found
+          // or until all connections are removed.
+          auto& connectionList = index->second;
+          auto connectionIter = connectionList.end();
+          while (connectionIter != connectionList.begin())
+          {
+            --connectionIter;
+            if ((*connectionIter)->IsExpired())
+            {
+              // remove connection from the pool and update the connection to the next one
+              // which is going to be list.end()
+              connectionsToBeCleaned.emplace_back(std::move(*connectionIter));
+              connectionIter = connectionList.erase(connectionIter);
+            }
+            else
+            {
+              break;
+            }
+          }
+
+          if (connectionList.empty())
+          {
+            index = shard.ConnectionPoolIndex.erase(index);
+          }
+          else
+          {
+            ++index;
+          }
+        }
+        pool.IdleConnectionCount -= connectionsToBeCleaned.size();
       }
+      pool.AddEvictions(connectionsToBeCleaned.size());
+      // Do actual connections release work here, without holding the mutex.
     }
-
-    lockForPoolCleaning.unlock();
-    // Do actual connections release work here, without holding the mutex.
   }
 }
 
@@ -319,6 +340,7 @@ Azure::Core::Http::CurlTransportOptions CurlTransportOptionsFromTransportOptions
   }
 #endif
   curlOptions.SslVerifyPeer = !transportOptions.DisableTlsCertificateValidation;
+  curlOptions.EnableHttp2 = transportOptions.EnableHttp2;
   return curlOptions;
 }
 
@@ -335,23 +357,82 @@ using Azure::Core::Http::RawResponse;
 using Azure::Core::Http::Request;
 using Azure::Core::Http::TransportException;
 using Azure::Core::Http::_detail::CurlConnectionPool;
+using Azure::Core::IO::_detail::BodyStreamAccessor;
 
 Azure::Core::Http::_detail::CurlConnectionPool
     Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool;
 
+CurlTransport::CurlTransport(CurlTransportOptions const& options) : m_options(options)
+{
+#if defined(_azure_CURL_EVENT_LOOP_SUPPORTED)
+  // The certificate revocation list check needs a connection bound to the SSL context, which
+  // only the connection pool provides.
+  if ((m_options.EventLoopThreadCount > 0 || m_options.EnableHttp2)
+      && !m_options.SslOptions.EnableCertificateRevocationListCheck)
+  {
+    // HTTP/2 streams are multiplexed by the event loops, so at least one is needed.
+    m_eventLoops = std::make_shared<_detail::CurlEventLoopGroup>(
+        (std::max)(m_options.EventLoopThreadCount, static_cast<size_t>(1)));
+  }
+#endif
+}
+
 CurlTransport::CurlTransport(Azure::Core::Http::Policies::TransportOptions const& options)
     : CurlTransport(CurlTransportOptionsFromTransportOptions(options))
 {
 }
 
+std::future<std::unique_ptr<RawResponse>> CurlTransport::SendAsync(
+    Request& request,
+    Context const& context)
+{
+#if defined(_azure_CURL_EVENT_LOOP_SUPPORTED)
+  if (m_eventLoops && !HasWebSocketSupport())
+  {
+    return m_eventLoops->Submit(request, m_options, context);
+  }
+#endif
+  return HttpTransport::SendAsync(request, context);
+}
+
+size_t CurlTransport::WarmUpConnections(
+    Azure::Core::Url const& url,
+    size_t connectionCount,
+    Context const& context)
+{
+  if (m_eventLoops)
+  {
+    // Requests performed by the event loops don't use the connection pool.
+    return 0;
+  }
+  Request request(HttpMethod::Get, url);
+  return CurlConnectionPool::g_curlConnectionPool.WarmUp(
+      request, m_options, connectionCount, context);
+}
+
+Azure::Core::Http::CurlConnectionPoolMetrics CurlTransport::GetConnectionPoolMetrics()
+{
+  return CurlConnectionPool::g_curlConnectionPool.GetMetrics();
+}
+
 std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const& context)
 {
+#if defined(_azure_CURL_EVENT_LOOP_SUPPORTED)
+  if (m_eventLoops && !HasWebSocketSupport())
+  {
+    // The event loop fails the response with OperationCancelledException if the context is
+    // cancelled while waiting.
+    return m_eventLoops->Submit(request, m_options, context).get();
+  }
+#endif
+
   // Create CurlSession to perform request
   Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Creating a new session.");
 
   auto session = std::make_unique<CurlSession>(
       request,
-      CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(request, m_options),
+      CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
+          request, m_options, false, context),
       m_options);
 
   CURLcode performing;
@@ -380,7 +461,8 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
         CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
             request,
             m_options,
-            getConnectionOpenIntent + 1 >= _detail::RequestPoolResetAfterConnectionFailed),
+            getConnectionOpenIntent + 1 >= _detail::RequestPoolResetAfterConnectionFailed,
+            context),
         m_options);
   }
 
@@ -416,7 +498,7 @@ CURLcode CurlSession::Perform(Context const& context)
 
   // libcurl settings after connection is open (headers)
   {
-    auto headers = this->m_request.GetHeaders();
+    auto const headers = this->m_request.GetHeadersView();
     auto hostHeader = headers.find("Host");
     if (hostHeader == headers.end())
     {
@@ -650,13 +732,130 @@ CURLcode CurlConnection::SendBuffer(
   return CURLE_OK;
 }
 
+#if defined(AZ_PLATFORM_LINUX)
+CURLcode CurlConnection::SendFile(
+    int fileDescriptor,
+    int64_t offset,
+    int64_t length,
+    Context const& context)
+{
+  // sendfile() writes to the socket directly, so it would bypass the TLS layer of libcurl.
+  if (!m_isPlainText)
+  {
+    return CURLE_NOT_BUILT_IN;
+  }
+  if (IsShutdown())
+  {
+    return CURLE_SEND_ERROR;
+  }
+  for (int64_t sentBytesTotal = 0; sentBytesTotal < length;)
+  {
+    // check cancelation for each chunk of data.
+    context.ThrowIfCancelled();
+    off_t fileOffset = static_cast<off_t>(offset + sentBytesTotal);
+    // sendfile() transfers at most 0x7ffff000 bytes per call
+    auto sentBytes = sendfile(
+        m_curlSocket,
+        fileDescriptor,
+        &fileOffset,
+        static_cast<size_t>((std::min)(length - sentBytesTotal, int64_t(0x7ffff000))));
+    if (sentBytes > 0)
+    {
+      sentBytesTotal += sentBytes;
+    }
+    else if (sentBytes == 0)
+    {
+      // The file is shorter than expected
+      return CURLE_READ_ERROR;
+    }
+    else if (errno == EAGAIN || errno == EWOULDBLOCK)
+    {
+      // start polling operation with 1 min timeout
+      auto pollUntilSocketIsReady = pollSocketUntilEventOrTimeout(
+          context, m_curlSocket, PollSocketDirection::Write, 60000L);
+
+      if (pollUntilSocketIsReady == 0)
+      {
+        throw TransportException("Timeout waiting for socket to upload.");
+      }
+      else if (pollUntilSocketIsReady < 0)
+      { // negative value, error while polling
+        throw TransportException("Error while polling for socket ready write");
+      }
+    }
+    else if (errno != EINTR)
+    {
+      // The file doesn't support sendfile() (e.g. a pipe), the caller can still read it
+      if (sentBytesTotal == 0 && (errno == EINVAL || errno == ENOSYS))
+      {
+        return CURLE_NOT_BUILT_IN;
+      }
+      return CURLE_SEND_ERROR;
+    }
+  }
+  return CURLE_OK;
+}
+#endif
+
 CURLcode CurlSession::UploadBody(Context const& context)
 {
-  // Send body UploadStreamPageSize at a time (libcurl default)
-  // NOTE: if stream is on top a contiguous memory, we can avoid allocating this copying buffer
   auto streamBody = this->m_request.GetBodyStream();
   CURLcode sendResult = CURLE_OK;
 
+#if defined(AZ_CORE_RTTI)
+  // Streams on top of contiguous memory are sent from their own buffer
+  if (auto memoryStream = dynamic_cast<Azure::Core::IO::MemoryBodyStream*>(streamBody))
+  {
+    context.ThrowIfCancelled();
+    auto const unreadBytes = BodyStreamAccessor::GetUnreadBytes(*memoryStream);
+    if (unreadBytes.second > 0)
+    {
+      sendResult = m_connection->SendBuffer(unreadBytes.first, unreadBytes.second, context);
+      if (sendResult == CURLE_OK)
+      {
+        BodyStreamAccessor::SetFullyRead(*memoryStream);
+      }
+    }
+    return sendResult;
+  }
+
+#if defined(AZ_PLATFORM_LINUX)
+  // Streams on top of a file are sent from the file by the kernel, unless the connection needs to
+  // encrypt the data.
+  Azure::Core::IO::_internal::RandomAccessFileBodyStream* fileStream = nullptr;
+  if (auto fileBodyStream = dynamic_cast<Azure::Core::IO::FileBodyStream*>(streamBody))
+  {
+    fileStream = &BodyStreamAccessor::GetFileStream(*fileBodyStream);
+  }
+  else
+  {
+    fileStream = dynamic_cast<Azure::Core::IO::_internal::RandomAccessFileBodyStream*>(streamBody);
+  }
+  auto const unreadRange = fileStream != nullptr ? BodyStreamAccessor::GetUnreadRange(*fileStream)
+                                                 : std::pair<int64_t, int64_t>(0, 0);
+  if (unreadRange.second > 0)
+  {
+    context.ThrowIfCancelled();
+    sendResult = m_connection->SendFile(
+        BodyStreamAccessor::GetFileDescriptor(*fileStream),
+        unreadRange.first,
+        unreadRange.second,
+        context);
+    if (sendResult == CURLE_OK)
+    {
+      BodyStreamAccessor::SetFullyRead(*fileStream);
+    }
+    if (sendResult != CURLE_NOT_BUILT_IN)
+    {
+      return sendResult;
+    }
+    sendResult = CURLE_OK;
+  }
+#endif
+#endif
+
+  // Send body UploadStreamPageSize at a time (libcurl default)
+
   auto unique_buffer
       = std::make_unique<uint8_t[]>(static_cast<size_t>(_detail::DefaultUploadChunkSize));
 
@@ -711,7 +910,7 @@ inline std::string CurlSession::GetHeadersAsString(Azure::Core::Http::Request co
 {
   std::string requestHeaderString;
 
-  for (auto const& header : request.GetHeaders())
+  for (auto const& header : request.GetHeadersView())
   {
     requestHeaderString += header.first; // string (key)
     requestHeaderString += ": ";
@@ -801,9 +1000,7 @@ void CurlSession::ParseChunkSize(Context const& context)
            * whatever we fetch will be the start of the chunk data. The bodyStart is set to 0 to
            * indicate the the next read call should read from the inner buffer start.
            */
-          this->m_innerBufferSize = m_connection->ReadFromSocket(
-              this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-          this->m_bodyStartInBuffer = 0;
+          FillReadBuffer(context);
         }
         else
         {
@@ -821,9 +1018,7 @@ void CurlSession::ParseChunkSize(Context const& context)
     }
     if (keepPolling)
     { // Read all internal buffer and \n was not found, pull from wire
-      this->m_innerBufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-      this->m_bodyStartInBuffer = 0;
+      FillReadBuffer(context);
     }
   }
   return;
@@ -846,18 +1041,19 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       // parse from internal buffer. This means previous read from server got more than one
       // response. This happens when Server returns a 100-continue plus an error code
       bufferSize = this->m_innerBufferSize - this->m_bodyStartInBuffer;
-      bytesParsed = parser.Parse(this->m_readBuffer + this->m_bodyStartInBuffer, bufferSize);
+      bytesParsed
+          = parser.Parse(this->m_readBuffer.data() + this->m_bodyStartInBuffer, bufferSize);
       // if parsing from internal buffer is not enough, do next read from wire
       reuseInternalBuffer = false;
       // reset body start
-      this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+      this->m_bodyStartInBuffer = this->m_readBuffer.size();
     }
     else
     {
       // Try to fill internal buffer from socket.
       // If response is smaller than buffer, we will get back the size of the response
       bufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+          this->m_readBuffer.data(), this->m_readBuffer.size(), context);
       if (bufferSize == 0)
       {
         // closed connection, prevent application from keep trying to pull more bytes from the wire
@@ -865,7 +1061,7 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
         return CURLE_RECV_ERROR;
       }
       // returns the number of bytes parsed up to the body Start
-      bytesParsed = parser.Parse(this->m_readBuffer, bufferSize);
+      bytesParsed = parser.Parse(this->m_readBuffer.data(), bufferSize);
     }
 
     if (bytesParsed < bufferSize)
@@ -997,7 +1193,7 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       || this->m_lastStatusCode == HttpStatusCode::NotModified)
   {
     this->m_contentLength = 0;
-    this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+    this->m_bodyStartInBuffer = this->m_readBuffer.size();
     return CURLE_OK;
   }
 
@@ -1030,6 +1226,15 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
   {
     this->m_contentLength
         = static_cast<int64_t>(std::stoull(isContentLengthHeaderInResponse->second.data()));
+    // Size the inner buffer for the body, so small reads from a large body don't all go to the
+    // network.
+    if (static_cast<uint64_t>(this->m_contentLength) > this->m_readBuffer.size())
+    {
+      GrowReadBuffer(
+          static_cast<uint64_t>(this->m_contentLength) < _detail::MaxAdaptiveLibcurlReaderSize
+              ? static_cast<size_t>(this->m_contentLength)
+              : _detail::MaxAdaptiveLibcurlReaderSize);
+    }
     return CURLE_OK;
   }
 
@@ -1050,16 +1255,13 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       // Need to move body start after chunk size
       if (this->m_bodyStartInBuffer >= this->m_innerBufferSize)
       { // if nothing on inner buffer, pull from wire
-        this->m_innerBufferSize = m_connection->ReadFromSocket(
-            this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-        if (this->m_innerBufferSize == 0)
+        if (FillReadBuffer(context) == 0)
         {
           // closed connection, prevent application from keep trying to pull more bytes from the
           // wire
           Log::Write(Logger::Level::Error, "Failed to read from socket");
           return CURLE_RECV_ERROR;
         }
-        this->m_bodyStartInBuffer = 0;
       }
 
       ParseChunkSize(context);
@@ -1087,15 +1289,12 @@ void CurlSession::ReadExpected(uint8_t expected, Context const& context)
   if (this->m_bodyStartInBuffer >= this->m_innerBufferSize)
   {
     // end of buffer, pull data from wire
-    this->m_innerBufferSize = m_connection->ReadFromSocket(
-        this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-    if (this->m_innerBufferSize == 0)
+    if (FillReadBuffer(context) == 0)
     {
       // closed connection, prevent application from keep trying to pull more bytes from the wire
       throw TransportException(
           "Connection was closed by the server while trying to read a response");
     }
-    this->m_bodyStartInBuffer = 0;
   }
   auto data = this->m_readBuffer[this->m_bodyStartInBuffer];
   if (data != expected)
@@ -1149,10 +1348,10 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   // For responses with content-length, avoid trying to read beyond Content-length or
   // libcurl could return a second response as BadRequest.
   // https://github.com/Azure/azure-sdk-for-cpp/issues/306
+  size_t remainingBodyContent = this->m_readBuffer.size();
   if (this->m_contentLength > 0)
   {
-    size_t remainingBodyContent
-        = static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead;
+    remainingBodyContent = static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead;
     readRequestLength = (std::min)(readRequestLength, remainingBodyContent);
   }
 
@@ -1161,7 +1360,7 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   {
     // still have data to take from innerbuffer
     Azure::Core::IO::MemoryBodyStream innerBufferMemoryStream(
-        this->m_readBuffer + this->m_bodyStartInBuffer,
+        this->m_readBuffer.data() + this->m_bodyStartInBuffer,
         this->m_innerBufferSize - this->m_bodyStartInBuffer);
 
     // From code inspection, it is guaranteed that the readRequestLength will fit within size_t
@@ -1187,7 +1386,19 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   }
   // Read from socket when no more data on internal buffer
   // For chunk request, read a chunk based on chunk size
-  totalRead = m_connection->ReadFromSocket(buffer, static_cast<size_t>(readRequestLength), context);
+  if (readRequestLength < this->m_readBuffer.size())
+  {
+    // Reads smaller than the inner buffer refill it, so the next reads can be served from it
+    // without another call to the network.
+    totalRead = (std::min)(FillReadBuffer(context, remainingBodyContent), readRequestLength);
+    std::copy(this->m_readBuffer.data(), this->m_readBuffer.data() + totalRead, buffer);
+    this->m_bodyStartInBuffer = totalRead;
+  }
+  else
+  {
+    // Reads at least as large as the inner buffer go straight to the customer's buffer.
+    totalRead = m_connection->ReadFromSocket(buffer, readRequestLength, context);
+  }
   this->m_sessionTotalRead += totalRead;
 
   // Reading 0 bytes means closed connection.
@@ -1211,6 +1422,31 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   return totalRead;
 }
 
+void CurlSession::GrowReadBuffer(size_t size)
+{
+  size = (std::min)(size, _detail::MaxAdaptiveLibcurlReaderSize);
+  if (this->m_adaptiveReadBuffer && size > this->m_readBuffer.size())
+  {
+    this->m_readBuffer.resize(size);
+  }
+}
+
+size_t CurlSession::FillReadBuffer(Context const& context, size_t maxSize)
+{
+  auto const bufferSize = this->m_readBuffer.size();
+  this->m_innerBufferSize = m_connection->ReadFromSocket(
+      this->m_readBuffer.data(), (std::min)(bufferSize, maxSize), context);
+  this->m_bodyStartInBuffer = 0;
+
+  // When the length of the response is unknown, a full buffer hints that more data is waiting on
+  // the wire.
+  if (this->m_innerBufferSize == bufferSize && this->m_contentLength < 0)
+  {
+    GrowReadBuffer(bufferSize * 2);
+  }
+  return this->m_innerBufferSize;
+}
+
 // Read from socket and return the number of bytes taken from socket
 size_t CurlConnection::ReadFromSocket(uint8_t* buffer, size_t bufferSize, Context const& context)
 {
@@ -2178,27 +2414,27 @@ int CurlConnection::SslCtxCallback(CURL*, void* sslctx)
 std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlConnection(
     Request& request,
     CurlTransportOptions const& options,
-    bool resetPool)
+    bool resetPool,
+    Context const& context)
 {
   uint16_t port = request.GetUrl().GetPort();
   // Generate a display name for the host being connected to
   std::string const& hostDisplayName = request.GetUrl().GetScheme() + "://"
       + request.GetUrl().GetHost() + (port != 0 ? ":" + std::to_string(port) : "");
   std::string const connectionKey = GetConnectionKey(hostDisplayName, options);
+  auto& shard = GetShard(connectionKey);
 
   {
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeReset;
+    decltype(shard.ConnectionPoolIndex)::mapped_type connectionsToBeReset;
 
-    // Critical section. Needs to own ConnectionPoolMutex before executing
+    // Critical section. Needs to own the mutex of the stripe before executing
     // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-    std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
+    std::unique_lock<std::mutex> lock(shard.Mutex);
 
     // get a ref to the pool from the map of pools
-    auto hostPoolIndex = g_curlConnectionPool.ConnectionPoolIndex.find(connectionKey);
+    auto hostPoolIndex = shard.ConnectionPoolIndex.find(connectionKey);
 
-    if (hostPoolIndex != g_curlConnectionPool.ConnectionPoolIndex.end()
-        && hostPoolIndex->second.size() > 0)
+    if (hostPoolIndex != shard.ConnectionPoolIndex.end() && hostPoolIndex->second.size() > 0)
     {
       if (resetPool)
       {
@@ -2206,7 +2442,8 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
         // clean the pool-index as requested in the call. Typically to force a new connection to be
         // created and to discard all current connections in the pool for the host-index. A caller
         // might request this after getting broken/closed connections multiple-times.
-        hostPoolIndex->second.clear();
+        shard.ConnectionPoolIndex.erase(hostPoolIndex);
+        IdleConnectionCount -= connectionsToBeReset.size();
         Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Reset connection pool requested.");
       }
       else
@@ -2217,32 +2454,224 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
         auto connection = std::move(*fistConnectionIterator);
         // Remove the connection ref from list
         hostPoolIndex->second.erase(fistConnectionIterator);
+        --IdleConnectionCount;
 
         // Remove index if there are no more connections
         if (hostPoolIndex->second.size() == 0)
         {
-          g_curlConnectionPool.ConnectionPoolIndex.erase(hostPoolIndex);
+          shard.ConnectionPoolIndex.erase(hostPoolIndex);
         }
 
+        m_hits.fetch_add(1, std::memory_order_relaxed);
         Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Re-using connection from the pool.");
         // return connection ref
         return connection;
       }
     }
+
+    if (options.MaxConnectionsPerHost != 0
+        && shard.OpenConnections[connectionKey] >= options.MaxConnectionsPerHost)
+    {
+      // Connections released from the pool to be reset are no longer counted once closed.
+      if (!connectionsToBeReset.empty())
+      {
+        lock.unlock();
+        connectionsToBeReset.clear();
+        lock.lock();
+      }
+
+      Log::Write(
+          Logger::Level::Verbose,
+          LogMsgPrefix + "Connection limit reached for the host. Waiting for a connection.");
+      auto const waitStart = std::chrono::steady_clock::now();
+      auto addWaitTime = [this, waitStart]() {
+        m_waitTimeMicroseconds.fetch_add(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - waitStart)
+                .count(),
+            std::memory_order_relaxed);
+      };
+      for (;;)
+      {
+        hostPoolIndex = shard.ConnectionPoolIndex.find(connectionKey);
+        if (hostPoolIndex != shard.ConnectionPoolIndex.end())
+        {
+          auto connection = std::move(hostPoolIndex->second.front());
+          hostPoolIndex->second.pop_front();
+          --IdleConnectionCount;
+          if (hostPoolIndex->second.empty())
+          {
+            shard.ConnectionPoolIndex.erase(hostPoolIndex);
+          }
+          addWaitTime();
+          m_hits.fetch_add(1, std::memory_order_relaxed);
+          return connection;
+        }
+        if (shard.OpenConnections[connectionKey] < options.MaxConnectionsPerHost)
+        {
+          break;
+        }
+        shard.ConnectionAvailable.wait_for(lock, ConnectionPoolWaitInterval);
+        if (context.IsCancelled())
+        {
+          addWaitTime();
+          context.ThrowIfCancelled();
+        }
+      }
+      addWaitTime();
+    }
+    // Reserve the connection before creating it, so the limit holds while the lock is released.
+    ++shard.OpenConnections[connectionKey];
   }
 
   // Creating a new connection is thread safe. No need to lock mutex here.
   // No available connection for the pool for the required host. Create one
   Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Spawn new connection.");
+  m_misses.fetch_add(1, std::memory_order_relaxed);
 
-  return std::make_unique<CurlConnection>(request, options, hostDisplayName, connectionKey);
+  return CreateCurlConnection(request, options, hostDisplayName, connectionKey);
+}
+
+std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::CreateCurlConnection(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName,
+    std::string const& connectionKey)
+{
+  std::unique_ptr<CurlConnection> connection;
+  try
+  {
+    connection
+        = std::make_unique<CurlConnection>(request, options, hostDisplayName, connectionKey);
+  }
+  catch (...)
+  {
+    ReleaseConnection(connectionKey);
+    throw;
+  }
+  std::weak_ptr<void> poolLifetime(m_lifetime);
+  connection->SetCloseCallback([this, poolLifetime, connectionKey]() {
+    if (!poolLifetime.expired())
+    {
+      ReleaseConnection(connectionKey);
+    }
+  });
+  return connection;
+}
+
+size_t CurlConnectionPool::WarmUp(
+    Request& request,
+    CurlTransportOptions const& options,
+    size_t connectionCount,
+    Context const& context)
+{
+  uint16_t port = request.GetUrl().GetPort();
+  std::string const hostDisplayName = request.GetUrl().GetScheme() + "://"
+      + request.GetUrl().GetHost() + (port != 0 ? ":" + std::to_string(port) : "");
+  std::string const connectionKey = GetConnectionKey(hostDisplayName, options);
+  size_t const maxIdleConnections = options.MaxIdleConnectionsPerHost == 0
+      ? MaxConnectionsPerIndex
+      : options.MaxIdleConnectionsPerHost;
+  auto& shard = GetShard(connectionKey);
+
+  {
+    // Reserve the connections to open. Connections above the limits of the host would either
+    // wait for another connection to be released or evict the connections just opened.
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto const hostPool = shard.ConnectionPoolIndex.find(connectionKey);
+    size_t const idleConnections
+        = hostPool == shard.ConnectionPoolIndex.end() ? 0 : hostPool->second.size();
+    connectionCount = (std::min)(
+        connectionCount,
+        idleConnections >= maxIdleConnections ? 0 : maxIdleConnections - idleConnections);
+    auto& openConnections = shard.OpenConnections[connectionKey];
+    if (options.MaxConnectionsPerHost != 0)
+    {
+      connectionCount = (std::min)(
+          connectionCount,
+          openConnections >= options.MaxConnectionsPerHost
+              ? 0
+              : options.MaxConnectionsPerHost - openConnections);
+    }
+    openConnections += connectionCount;
+    if (openConnections == 0)
+    {
+      shard.OpenConnections.erase(connectionKey);
+    }
+  }
+
+  Log::Write(
+      Logger::Level::Verbose,
+      LogMsgPrefix + "Opening " + std::to_string(connectionCount) + " connections to "
+          + hostDisplayName + ".");
+
+  // Each connection does its own TCP and TLS handshake, so they are opened in parallel, by a
+  // bounded number of threads which take the connections to open in turn.
+  std::atomic<size_t> nextConnection{0};
+  auto openConnections = [&]() {
+    std::vector<std::unique_ptr<CurlNetworkConnection>> connections;
+    while (nextConnection.fetch_add(1) < connectionCount)
+    {
+      if (context.IsCancelled())
+      {
+        ReleaseConnection(connectionKey);
+        continue;
+      }
+      try
+      {
+        connections.emplace_back(
+            CreateCurlConnection(request, options, hostDisplayName, connectionKey));
+      }
+      catch (TransportException const& error)
+      {
+        Log::Write(
+            Logger::Level::Warning,
+            LogMsgPrefix + "Failed to open a connection to " + hostDisplayName + ": "
+                + error.what());
+      }
+    }
+    return connections;
+  };
+  std::vector<std::future<std::vector<std::unique_ptr<CurlNetworkConnection>>>> threads;
+  size_t const threadCount = (std::min)(connectionCount, MaxWarmUpThreadCount);
+  threads.reserve(threadCount);
+  for (size_t count = 0; count < threadCount; count++)
+  {
+    threads.emplace_back(std::async(std::launch::async, openConnections));
+  }
+
+  size_t openedConnections = 0;
+  for (auto& thread : threads)
+  {
+    for (auto& openedConnection : thread.get())
+    {
+      MoveConnectionBackToPool(std::move(openedConnection), true, maxIdleConnections);
+      openedConnections++;
+    }
+  }
+  return openedConnections;
+}
+
+void CurlConnectionPool::ReleaseConnection(std::string const& connectionKey)
+{
+  auto& shard = GetShard(connectionKey);
+  {
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto openConnections = shard.OpenConnections.find(connectionKey);
+    if (openConnections != shard.OpenConnections.end() && --openConnections->second == 0)
+    {
+      shard.OpenConnections.erase(openConnections);
+    }
+  }
+  shard.ConnectionAvailable.notify_all();
 }
 
 // Move the connection back to the connection pool. Push it to the front so it becomes the
 // first connection to be picked next time some one ask for a connection to the pool (LIFO)
 void CurlConnectionPool::MoveConnectionBackToPool(
     std::unique_ptr<CurlNetworkConnection> connection,
-    bool httpKeepAlive)
+    bool httpKeepAlive,
+    size_t maxIdleConnections)
 {
   if (!httpKeepAlive)
   {
@@ -2257,26 +2686,37 @@ void CurlConnectionPool::MoveConnectionBackToPool(
 
   Log::Write(Logger::Level::Verbose, "Moving connection to pool...");
 
-  decltype(CurlConnectionPool::g_curlConnectionPool
-               .ConnectionPoolIndex)::mapped_type::value_type connectionToBeRemoved;
+  auto& shard = GetShard(connection->GetConnectionKey());
+  decltype(shard.ConnectionPoolIndex)::mapped_type::value_type connectionToBeRemoved;
+  {
+    // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
+    std::unique_lock<std::mutex> lock(shard.Mutex);
+    auto& poolId = connection->GetConnectionKey();
+    auto& hostPool = shard.ConnectionPoolIndex[poolId];
 
-  // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-  std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
-  auto& poolId = connection->GetConnectionKey();
-  auto& hostPool = g_curlConnectionPool.ConnectionPoolIndex[poolId];
+    if (hostPool.size() >= maxIdleConnections && !hostPool.empty())
+    {
+      // Remove the least recently used connection from the pool to insert this one.
+      auto lastConnection = --hostPool.end();
+      connectionToBeRemoved = std::move(*lastConnection);
+      hostPool.erase(lastConnection);
+      --IdleConnectionCount;
+      m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
 
-  if (hostPool.size() >= _detail::MaxConnectionsPerIndex && !hostPool.empty())
-  {
-    // Remove the last connection from the pool to insert this one.
-    auto lastConnection = --hostPool.end();
-    connectionToBeRemoved = std::move(*lastConnection);
-    hostPool.erase(lastConnection);
+    // update the time when connection was moved back to pool
+    connection->UpdateLastUsageTime();
+    hostPool.push_front(std::move(connection));
+    ++IdleConnectionCount;
   }
+  shard.ConnectionAvailable.notify_all();
 
-  // update the time when connection was moved back to pool
-  connection->UpdateLastUsageTime();
-  hostPool.push_front(std::move(connection));
+  if (IsCleanThreadRunning)
+  {
+    return;
+  }
 
+  std::unique_lock<std::mutex> lock(CleanThreadMutex);
   if (m_cleanThread.joinable() && !IsCleanThreadRunning)
   {
     // Clean thread was running before but it's finished, join it to finalize
@@ -2298,71 +2738,74 @@ void CurlConnectionPool::MoveConnectionBackToPool(
   }
 }
 
-CurlConnection::CurlConnection(
-    Request& request,
-    CurlTransportOptions const& options,
-    std::string const& hostDisplayName,
-    std::string const& connectionPropertiesKey)
-    : m_connectionKey(connectionPropertiesKey)
+size_t CurlConnectionPool::IndexCount()
 {
-  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
-  if (!m_handle)
+  size_t count = 0;
+  for (auto& shard : m_shards)
   {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string("curl_easy_init returned Null"));
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    count += shard.ConnectionPoolIndex.size();
   }
-  CURLcode result;
+  return count;
+}
 
-  if (!options.EnableCurlSslCaching)
+size_t CurlConnectionPool::ConnectionsOnPool(std::string const& host)
+{
+  auto& shard = GetShard(host);
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto hostPool = shard.ConnectionPoolIndex.find(host);
+  return hostPool == shard.ConnectionPoolIndex.end() ? 0 : hostPool->second.size();
+}
+
+void CurlConnectionPool::Clear()
+{
+  for (auto& shard : m_shards)
   {
-    // Disable SSL session ID caching
-    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_SESSIONID_CACHE, 0L, &result))
+    decltype(shard.ConnectionPoolIndex) connectionsToBeRemoved;
     {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_easy_strerror(result)));
+      std::lock_guard<std::mutex> lock(shard.Mutex);
+      for (auto const& hostPool : shard.ConnectionPoolIndex)
+      {
+        IdleConnectionCount -= hostPool.second.size();
+      }
+      connectionsToBeRemoved = std::move(shard.ConnectionPoolIndex);
+      shard.ConnectionPoolIndex.clear();
     }
+    // Connections are closed without holding the mutex, since closing a connection releases it
+    // from the pool.
   }
-  else
-  {
-    m_sslShareHandle = std::make_unique<Azure::Core::_detail::CURLSHWrapper>();
-
-    if (!m_sslShareHandle->share_handle)
-    {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string("curl_share_init returned Null"));
-    }
+}
 
-    CURLSHcode shResult;
-    if (!SetLibcurlShareOption(
-            m_sslShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION, &shResult))
-    {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_share_strerror(shResult)));
-    }
+Azure::Core::Http::CurlConnectionPoolMetrics CurlConnectionPool::GetMetrics() const
+{
+  Azure::Core::Http::CurlConnectionPoolMetrics metrics;
+  metrics.Hits = m_hits.load(std::memory_order_relaxed);
+  metrics.Misses = m_misses.load(std::memory_order_relaxed);
+  metrics.Evictions = m_evictions.load(std::memory_order_relaxed);
+  metrics.WaitTime
+      = std::chrono::microseconds(m_waitTimeMicroseconds.load(std::memory_order_relaxed));
+  metrics.IdleConnections = IdleConnectionCount.load();
+  return metrics;
+}
 
-    if (!SetLibcurlOption(m_handle, CURLOPT_SHARE, m_sslShareHandle->share_handle, &result))
-    {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_easy_strerror(result)));
-    }
-  }
+void CurlConnection::SetTransportOptions(
+    Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName)
+{
+  CURLcode result;
 
   if (options.EnableCurlTracing)
   {
     if (!SetLibcurlOption(
-            m_handle, CURLOPT_DEBUGFUNCTION, CurlConnection::CurlLoggingCallback, &result))
+            handle, CURLOPT_DEBUGFUNCTION, CurlConnection::CurlLoggingCallback, &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate
           + std::string(". Could not enable logging callback.")
           + std::string(curl_easy_strerror(result)));
     }
-    if (!SetLibcurlOption(m_handle, CURLOPT_VERBOSE, 1, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_VERBOSE, 1, &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate
@@ -2371,42 +2814,9 @@ CurlConnection::CurlConnection(
     }
   }
 
-  // Libcurl setup before open connection (url, connect_only, timeout)
-  if (!SetLibcurlOption(m_handle, CURLOPT_URL, request.GetUrl().GetAbsoluteUrl().data(), &result))
-  {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string(curl_easy_strerror(result)));
-  }
-
-  if (request.GetUrl().GetPort() != 0
-      && !SetLibcurlOption(m_handle, CURLOPT_PORT, request.GetUrl().GetPort(), &result))
-  {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string(curl_easy_strerror(result)));
-  }
-
-  if (!SetLibcurlOption(m_handle, CURLOPT_CONNECT_ONLY, 1L, &result))
-  {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string(curl_easy_strerror(result)));
-  }
-
-  //   Set timeout to 24h. Libcurl will fail uploading on windows if timeout is:
-  // timeout >= 25 days. Fails as soon as trying to upload any data
-  // 25 days < timeout > 1 days. Fail on huge uploads ( > 1GB)
-  if (!SetLibcurlOption(m_handle, CURLOPT_TIMEOUT, 60L * 60L * 24L, &result))
-  {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string(curl_easy_strerror(result)));
-  }
-
   if (options.ConnectionTimeout != Azure::Core::Http::_detail::DefaultConnectionTimeout)
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_CONNECTTIMEOUT_MS, options.ConnectionTimeout, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_CONNECTTIMEOUT_MS, options.ConnectionTimeout, &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2421,7 +2831,7 @@ CurlConnection::CurlConnection(
    */
   if (options.Proxy)
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_PROXY, options.Proxy->c_str(), &result))
+    if (!SetLibcurlOption(handle, CURLOPT_PROXY, options.Proxy->c_str(), &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2433,7 +2843,7 @@ CurlConnection::CurlConnection(
   if (options.ProxyUsername.HasValue())
   {
     if (!SetLibcurlOption(
-            m_handle, CURLOPT_PROXYUSERNAME, options.ProxyUsername.Value().c_str(), &result))
+            handle, CURLOPT_PROXYUSERNAME, options.ProxyUsername.Value().c_str(), &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2444,7 +2854,7 @@ CurlConnection::CurlConnection(
   if (options.ProxyPassword.HasValue())
   {
     if (!SetLibcurlOption(
-            m_handle, CURLOPT_PROXYPASSWORD, options.ProxyPassword.Value().c_str(), &result))
+            handle, CURLOPT_PROXYPASSWORD, options.ProxyPassword.Value().c_str(), &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2455,7 +2865,7 @@ CurlConnection::CurlConnection(
 
   if (!options.CAInfo.empty())
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_CAINFO, options.CAInfo.c_str(), &result))
+    if (!SetLibcurlOption(handle, CURLOPT_CAINFO, options.CAInfo.c_str(), &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2466,7 +2876,7 @@ CurlConnection::CurlConnection(
 
   if (!options.CAPath.empty())
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_CAPATH, options.CAPath.c_str(), &result))
+    if (!SetLibcurlOption(handle, CURLOPT_CAPATH, options.CAPath.c_str(), &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2483,7 +2893,7 @@ CurlConnection::CurlConnection(
                options.SslOptions.PemEncodedExpectedRootCertificates.c_str())),
            options.SslOptions.PemEncodedExpectedRootCertificates.size(),
            CURL_BLOB_COPY};
-    if (!SetLibcurlOption(m_handle, CURLOPT_CAINFO_BLOB, &rootCertBlob, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_CAINFO_BLOB, &rootCertBlob, &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2500,45 +2910,18 @@ CurlConnection::CurlConnection(
     sslOption |= CURLSSLOPT_NO_REVOKE;
   }
 
-  if (!SetLibcurlOption(m_handle, CURLOPT_SSL_OPTIONS, sslOption, &result))
+  if (!SetLibcurlOption(handle, CURLOPT_SSL_OPTIONS, sslOption, &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
         + ". Failed to set ssl options to long bitmask:" + std::to_string(sslOption) + ". "
         + std::string(curl_easy_strerror(result)));
   }
-#elif !defined(AZ_PLATFORM_MAC)
-  if (options.SslOptions.EnableCertificateRevocationListCheck)
-  {
-    if (!SetLibcurlOption(
-            m_handle, CURLOPT_SSL_CTX_FUNCTION, CurlConnection::CurlSslCtxCallback, &result))
-    {
-      throw TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
-          + ". Failed to set SSL context callback. " + std::string(curl_easy_strerror(result)));
-    }
-    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_CTX_DATA, this, &result))
-    {
-      throw TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
-          + ". Failed to set SSL context callback data. "
-          + std::string(curl_easy_strerror(result)));
-    }
-    //          if (!SetLibcurlOption(m_handle, CURLOPT_SSL_VERIFYSTATUS, 1, &result))
-    //          {
-    //            throw TransportException(
-    //                _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
-    //                + ". Failed to enable OCSP chaining. " +
-    //                std::string(curl_easy_strerror(result)));
-    //          }
-  }
-  m_allowFailedCrlRetrieval = options.SslOptions.AllowFailedCrlRetrieval;
 #endif
-  m_enableCrlValidation = options.SslOptions.EnableCertificateRevocationListCheck;
 
   if (!options.SslVerifyPeer)
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_VERIFYPEER, 0L, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_SSL_VERIFYPEER, 0L, &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2548,7 +2931,7 @@ CurlConnection::CurlConnection(
 
   if (options.NoSignal)
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_NOSIGNAL, 1L, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_NOSIGNAL, 1L, &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2560,7 +2943,7 @@ CurlConnection::CurlConnection(
   // curl-transport adapter supports only HTTP/1.1
   // https://github.com/Azure/azure-sdk-for-cpp/issues/2848
   // The libcurl uses HTTP/2 by default, if it can be negotiated with a server on handshake.
-  if (!SetLibcurlOption(m_handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1, &result))
+  if (!SetLibcurlOption(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1, &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2568,12 +2951,139 @@ CurlConnection::CurlConnection(
   }
 
   //   Make libcurl to support only TLS v1.2 or later
-  if (!SetLibcurlOption(m_handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2, &result))
+  if (!SetLibcurlOption(handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2, &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
         + ". Failed enforcing TLS v1.2 or greater. " + std::string(curl_easy_strerror(result)));
   }
+}
+
+CurlConnection::CurlConnection(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName,
+    std::string const& connectionPropertiesKey)
+    : m_connectionKey(connectionPropertiesKey)
+{
+  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
+  if (!m_handle)
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string("curl_easy_init returned Null"));
+  }
+  CURLcode result;
+
+  if (!options.EnableCurlSslCaching)
+  {
+    // Disable SSL session ID caching
+    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_SESSIONID_CACHE, 0L, &result))
+    {
+      throw Azure::Core::Http::TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+          + std::string(curl_easy_strerror(result)));
+    }
+  }
+  else
+  {
+    m_sslShareHandle = std::make_unique<Azure::Core::_detail::CURLSHWrapper>();
+
+    if (!m_sslShareHandle->share_handle)
+    {
+      throw Azure::Core::Http::TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+          + std::string("curl_share_init returned Null"));
+    }
+
+    CURLSHcode shResult;
+    if (!SetLibcurlShareOption(
+            m_sslShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION, &shResult))
+    {
+      throw Azure::Core::Http::TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+          + std::string(curl_share_strerror(shResult)));
+    }
+
+    if (!SetLibcurlOption(m_handle, CURLOPT_SHARE, m_sslShareHandle->share_handle, &result))
+    {
+      throw Azure::Core::Http::TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+          + std::string(curl_easy_strerror(result)));
+    }
+  }
+
+  // Libcurl setup before open connection (url, connect_only, timeout)
+  if (!SetLibcurlOption(m_handle, CURLOPT_URL, request.GetUrl().GetAbsoluteUrl().data(), &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  if (request.GetUrl().GetPort() != 0
+      && !SetLibcurlOption(m_handle, CURLOPT_PORT, request.GetUrl().GetPort(), &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  if (!SetLibcurlOption(m_handle, CURLOPT_CONNECT_ONLY, 1L, &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  //   Set timeout to 24h. Libcurl will fail uploading on windows if timeout is:
+  // timeout >= 25 days. Fails as soon as trying to upload any data
+  // 25 days < timeout > 1 days. Fail on huge uploads ( > 1GB)
+  if (!SetLibcurlOption(m_handle, CURLOPT_TIMEOUT, 60L * 60L * 24L, &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  SetTransportOptions(m_handle, options, hostDisplayName);
+
+#if defined(AZ_PLATFORM_LINUX)
+  m_isPlainText = request.GetUrl().GetScheme() == "http"
+      && (!options.Proxy.HasValue()
+          || Azure::Core::_internal::StringExtensions::ToLower(options.Proxy.Value())
+                  .compare(0, 8, "https://")
+              != 0);
+#endif
+
+#if !defined(AZ_PLATFORM_WINDOWS) && !defined(AZ_PLATFORM_MAC)
+  if (options.SslOptions.EnableCertificateRevocationListCheck)
+  {
+    if (!SetLibcurlOption(
+            m_handle, CURLOPT_SSL_CTX_FUNCTION, CurlConnection::CurlSslCtxCallback, &result))
+    {
+      throw TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+          + ". Failed to set SSL context callback. " + std::string(curl_easy_strerror(result)));
+    }
+    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_CTX_DATA, this, &result))
+    {
+      throw TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+          + ". Failed to set SSL context callback data. "
+          + std::string(curl_easy_strerror(result)));
+    }
+    //          if (!SetLibcurlOption(m_handle, CURLOPT_SSL_VERIFYSTATUS, 1, &result))
+    //          {
+    //            throw TransportException(
+    //                _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+    //                + ". Failed to enable OCSP chaining. " +
+    //                std::string(curl_easy_strerror(result)));
+    //          }
+  }
+  m_allowFailedCrlRetrieval = options.SslOptions.AllowFailedCrlRetrieval;
+#endif
+  m_enableCrlValidation = options.SslOptions.EnableCertificateRevocationListCheck;
 
   auto performResult = curl_easy_perform(m_handle.get());
   if (performResult != CURLE_OK)
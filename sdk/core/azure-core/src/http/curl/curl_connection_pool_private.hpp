@@ -15,11 +15,15 @@
 
 #include <azure/core/http/curl_transport.hpp>
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <unordered_map>
 
@@ -29,12 +33,60 @@ namespace Azure { namespace Core { namespace Test {
   class CurlConnectionPool_connectionPoolTest_Test;
   class CurlConnectionPool_uniquePort_Test;
   class CurlConnectionPool_connectionClose_Test;
+  class CurlConnectionPool_perHostLimits_Test;
+  class CurlConnectionPool_warmUpConnections_Test;
   class SdkWithLibcurl_globalCleanUp_Test;
 }}} // namespace Azure::Core::Test
 #endif
 
 namespace Azure { namespace Core { namespace Http { namespace _detail {
 
+  /**
+   * @brief The number of lock stripes of the connection pool. Each host-index is assigned to one
+   * stripe from the hash of its key, so threads using different hosts don't contend for the same
+   * mutex.
+   */
+  constexpr static size_t ConnectionPoolShardCount = 16;
+
+  /**
+   * @brief The interval used to check for a cancelled context while waiting for a connection
+   * because the connection limit of a host was reached.
+   */
+  constexpr static std::chrono::milliseconds ConnectionPoolWaitInterval
+      = std::chrono::milliseconds(100);
+
+  /**
+   * @brief The maximum number of threads opening connections to warm up the pool for a host.
+   */
+  constexpr static size_t MaxWarmUpThreadCount = 8;
+
+  /**
+   * @brief One lock stripe of the connection pool.
+   */
+  struct CurlConnectionPoolShard final
+  {
+    std::mutex Mutex;
+
+    // Signaled when a connection is moved back to the pool or when a connection is closed.
+    std::condition_variable ConnectionAvailable;
+
+    /**
+     * @brief Keeps a unique key for each host and creates a connection pool for each key.
+     *
+     * @details This way getting a connection for a specific host can be done in O(1) instead of
+     * looping a single connection list to find the first connection for the required host.
+     *
+     * @remark There might be multiple connections for each host. Connections are kept from the
+     * most recently used to the least recently used one.
+     */
+    std::unordered_map<std::string, std::list<std::unique_ptr<CurlNetworkConnection>>>
+        ConnectionPoolIndex;
+
+    // The number of connections created by the pool for each host-index which are still open,
+    // either waiting in the pool or in use.
+    std::unordered_map<std::string, size_t> OpenConnections;
+  };
+
   /**
    * @brief CURL HTTP connection pool makes it possible to re-use one curl connection to perform
    * more than one request. Use this component when connections are not re-used by default.
@@ -48,6 +100,8 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
     friend class Azure::Core::Test::CurlConnectionPool_connectionPoolTest_Test;
     friend class Azure::Core::Test::CurlConnectionPool_uniquePort_Test;
     friend class Azure::Core::Test::CurlConnectionPool_connectionClose_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_perHostLimits_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_warmUpConnections_Test;
     friend class Azure::Core::Test::SdkWithLibcurl_globalCleanUp_Test;
 #endif
 
@@ -55,61 +109,125 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
     ~CurlConnectionPool()
     {
       using namespace Azure::Core::Http::_detail;
+      {
+        std::unique_lock<std::mutex> lock(CleanThreadMutex);
+        // Remove all connections
+        Clear();
+      }
       if (m_cleanThread.joinable())
       {
-        {
-          std::unique_lock<std::mutex> lock(ConnectionPoolMutex);
-          // Remove all connections
-          g_curlConnectionPool.ConnectionPoolIndex.clear();
-        }
         // Signal clean thread to wake up
         ConditionalVariableForCleanThread.notify_one();
         // join thread
         m_cleanThread.join();
       }
+      // The connections still in use don't release themselves from the pool once it is gone.
+      m_lifetime.reset();
       curl_global_cleanup();
     }
 
     /**
      * @brief Finds a connection to be re-used from the connection pool.
-     * @remark If there is not any available connection, a new connection is created.
+     * @remark If there is not any available connection, a new connection is created. When the
+     * number of open connections for the host has reached
+     * #Azure::Core::Http::CurlTransportOptions::MaxConnectionsPerHost, waits for a connection to
+     * be moved back to the pool or to be closed.
      *
      * @param request HTTP request to get #Azure::Core::Http::CurlNetworkConnection for.
      * @param options The connection settings which includes host name and libcurl handle specific
      * configuration.
      * @param resetPool Request the pool to remove all current connections for the provided
      * options to force the creation of a new connection.
+     * @param context A context to control the time spent waiting for a connection.
      *
      * @return #Azure::Core::Http::CurlNetworkConnection to use.
      */
     std::unique_ptr<CurlNetworkConnection> ExtractOrCreateCurlConnection(
         Request& request,
         CurlTransportOptions const& options,
-        bool resetPool = false);
+        bool resetPool = false,
+        Context const& context = Context{});
 
     /**
      * @brief Moves a connection back to the pool to be re-used.
      *
+     * @remark When the host already has \p maxIdleConnections connections in the pool, the least
+     * recently used one is evicted.
+     *
      * @param connection CURL HTTP connection to add to the pool.
      * @param httpKeepAlive The status of keep-alive behavior, based on HTTP protocol version and
      * the most recent response header received through the \p connection.
+     * @param maxIdleConnections The maximum number of connections kept in the pool for the host.
      */
     void MoveConnectionBackToPool(
         std::unique_ptr<CurlNetworkConnection> connection,
-        bool httpKeepAlive);
+        bool httpKeepAlive,
+        size_t maxIdleConnections = MaxConnectionsPerIndex);
 
     /**
-     * @brief Keeps a unique key for each host and creates a connection pool for each key.
+     * @brief Opens new connections to the host of \p request in parallel and moves them to the
+     * pool.
      *
-     * @details This way getting a connection for a specific host can be done in O(1) instead of
-     * looping a single connection list to find the first connection for the required host.
+     * @remark No more connections are opened than the limits of the host allow.
+     *
+     * @param request HTTP request to the host to connect to.
+     * @param options The connection settings.
+     * @param connectionCount The number of connections to open.
+     * @param context A context to stop opening connections.
      *
-     * @remark There might be multiple connections for each host.
+     * @return The number of connections added to the pool.
      */
-    std::unordered_map<std::string, std::list<std::unique_ptr<CurlNetworkConnection>>>
-        ConnectionPoolIndex;
+    size_t WarmUp(
+        Request& request,
+        CurlTransportOptions const& options,
+        size_t connectionCount,
+        Context const& context);
+
+    /**
+     * @brief Lets the pool know a connection it created for \p connectionKey was closed.
+     */
+    void ReleaseConnection(std::string const& connectionKey);
+
+    /**
+     * @brief Gets the lock stripe which keeps the connections for \p connectionKey.
+     */
+    CurlConnectionPoolShard& GetShard(std::string const& connectionKey)
+    {
+      return m_shards[std::hash<std::string>{}(connectionKey) % ConnectionPoolShardCount];
+    }
+
+    /**
+     * @brief Gets the lock stripes of the pool.
+     */
+    std::array<CurlConnectionPoolShard, ConnectionPoolShardCount>& GetShards() { return m_shards; }
+
+    /**
+     * @brief Gets the number of host-index with at least one connection in the pool.
+     */
+    size_t IndexCount();
+
+    /**
+     * @brief Removes all the connections from the pool.
+     */
+    void Clear();
 
-    std::mutex ConnectionPoolMutex;
+    /**
+     * @brief Gets a snapshot of the metrics of the pool.
+     */
+    CurlConnectionPoolMetrics GetMetrics() const;
+
+    /**
+     * @brief Counts the connections removed from the pool without being re-used.
+     */
+    void AddEvictions(size_t count) { m_evictions.fetch_add(count, std::memory_order_relaxed); }
+
+    /**
+     * @brief Keeps the number of connections waiting in the pool, for all the hosts.
+     */
+    std::atomic<size_t> IdleConnectionCount{0};
+
+    // Guards the clean thread state.
+    std::mutex CleanThreadMutex;
 
     // This is used to put the cleaning pool thread to sleep and yet to be able to wake it if the
     // application finishes.
@@ -117,17 +235,34 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
 
     AZ_CORE_DLLEXPORT static Azure::Core::Http::_detail::CurlConnectionPool g_curlConnectionPool;
 
-    bool IsCleanThreadRunning = false;
+    std::atomic<bool> IsCleanThreadRunning{false};
 
   private:
     // private constructor to keep this as singleton.
     CurlConnectionPool() { curl_global_init(CURL_GLOBAL_ALL); }
 
+    // Creates a connection which was already counted in the open connections of its host.
+    std::unique_ptr<CurlNetworkConnection> CreateCurlConnection(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::string const& hostDisplayName,
+        std::string const& connectionKey);
+
     // Makes possible to know the number of current connections in the connection pool for an
     // index
-    size_t ConnectionsOnPool(std::string const& host) { return ConnectionPoolIndex[host].size(); }
+    size_t ConnectionsOnPool(std::string const& host);
+
+    std::array<CurlConnectionPoolShard, ConnectionPoolShardCount> m_shards;
+
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_evictions{0};
+    std::atomic<int64_t> m_waitTimeMicroseconds{0};
 
     std::thread m_cleanThread;
+
+    // Watched by the close callbacks of the connections, which can be destroyed after the pool.
+    std::shared_ptr<void> m_lifetime{std::make_shared<bool>()};
   };
 
 }}}} // namespace Azure::Core::Http::_detail
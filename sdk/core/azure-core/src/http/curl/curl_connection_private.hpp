@@ -11,8 +11,10 @@
 
 #include "azure/core/http/http.hpp"
 #include "azure/core/internal/unique_handle.hpp"
+#include "azure/core/platform.hpp"
 
 #include <chrono>
+#include <functional>
 #include <string>
 
 #if defined(_MSC_VER)
@@ -77,6 +79,8 @@ namespace Azure { namespace Core {
       // This can be customizable in the HttpRequest
       constexpr static size_t DefaultUploadChunkSize = 1024 * 64;
       constexpr static size_t DefaultLibcurlReaderSize = 4 * 1024;
+      // Upper bound for the session read buffer when it grows for large responses.
+      constexpr static size_t MaxAdaptiveLibcurlReaderSize = 256 * 1024;
       // Run time error template
       constexpr static const char* DefaultFailedToGetNewConnectionTemplate
           = "Fail to get a new connection for: ";
@@ -88,10 +92,10 @@ namespace Azure { namespace Core {
       constexpr static int32_t DefaultCleanerIntervalMilliseconds = 1000 * 90;
       // 60 sec -> expired connection is when it waits for 60 sec or more and it's not re-used
       constexpr static int32_t DefaultConnectionExpiredMilliseconds = 1000 * 60;
-      // Define the maximum allowed connections per host-index in the pool. If this number is
-      // reached for the host-index, next connections trying to be added to the pool will be
-      // ignored.
-      constexpr static int32_t MaxConnectionsPerIndex = 1024;
+      // Define the default maximum allowed connections per host-index in the pool. If this number
+      // is reached for the host-index, the least recently used connection is removed from the pool
+      // to add a new one.
+      constexpr static size_t MaxConnectionsPerIndex = 1024;
 
     } // namespace _detail
 
@@ -146,6 +150,28 @@ namespace Azure { namespace Core {
       virtual CURLcode SendBuffer(uint8_t const* buffer, size_t bufferSize, Context const& context)
           = 0;
 
+#if defined(AZ_PLATFORM_LINUX)
+      /**
+       * @brief This method will send \p length bytes of a file, starting at \p offset, straight
+       * from the file to the socket.
+       *
+       * @return CURLE_OK when the data is sent successfully. CURLE_NOT_BUILT_IN, without sending
+       * anything, when the connection can't send files directly.
+       */
+      virtual CURLcode SendFile(
+          int fileDescriptor,
+          int64_t offset,
+          int64_t length,
+          Context const& context)
+      {
+        (void)fileDescriptor;
+        (void)offset;
+        (void)length;
+        (void)context;
+        return CURLE_NOT_BUILT_IN;
+      }
+#endif
+
       /**
        * @brief Set the connection into an invalid and unusable state.
        *
@@ -177,6 +203,12 @@ namespace Azure { namespace Core {
       bool m_enableCrlValidation{false};
       // Allow the connection to proceed if retrieving the CRL failed.
       bool m_allowFailedCrlRetrieval{true};
+#if defined(AZ_PLATFORM_LINUX)
+      // Data written straight to the socket is only valid when libcurl doesn't encrypt it.
+      bool m_isPlainText{false};
+#endif
+      // Lets the connection pool know the connection was closed.
+      std::function<void()> m_onClose;
 
       static int CurlLoggingCallback(
           CURL* handle,
@@ -190,6 +222,22 @@ namespace Azure { namespace Core {
       int VerifyCertificateError(int ok, X509_STORE_CTX* storeContext);
 
     public:
+      /**
+       * @brief Applies the libcurl options which are common to every handle created by the
+       * transport (tracing, timeouts, proxy, certificate authorities and TLS settings).
+       *
+       * @remark The certificate revocation list check is not applied since it requires a
+       * #Azure::Core::Http::CurlConnection to be bound to the SSL context.
+       *
+       * @param handle The libcurl handle to configure.
+       * @param options Connection options.
+       * @param hostDisplayName Display name for remote host, used for diagnostics.
+       */
+      static void SetTransportOptions(
+          Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+          Azure::Core::Http::CurlTransportOptions const& options,
+          std::string const& hostDisplayName);
+
       /**
        * @brief Construct CURL HTTP connection.
        *
@@ -209,7 +257,19 @@ namespace Azure { namespace Core {
        * @brief Destructor.
        * @details Cleans up CURL (invokes `curl_easy_cleanup()`).
        */
-      ~CurlConnection() override {}
+      ~CurlConnection() override
+      {
+        if (m_onClose)
+        {
+          m_onClose();
+        }
+      }
+
+      /**
+       * @brief Sets a function called when the connection is destroyed.
+       *
+       */
+      void SetCloseCallback(std::function<void()> onClose) { m_onClose = std::move(onClose); }
 
       std::string const& GetConnectionKey() const override { return this->m_connectionKey; }
 
@@ -258,6 +318,25 @@ namespace Azure { namespace Core {
        */
       CURLcode SendBuffer(uint8_t const* buffer, size_t bufferSize, Context const& context)
           override;
+
+#if defined(AZ_PLATFORM_LINUX)
+      /**
+       * @brief This method will use `sendfile()` to write a file to the socket without copying it
+       * to a user-space buffer.
+       *
+       * @remark Only supported when the connection doesn't use TLS, neither to the server nor to
+       * a proxy.
+       *
+       * @param fileDescriptor The file to send.
+       * @param offset The offset in the file of the first byte to send.
+       * @param length The number of bytes to send.
+       * @param context A context to control the request lifetime.
+       * @return CURL_OK when the file is sent successfully, CURLE_NOT_BUILT_IN when the file can't
+       * be sent directly.
+       */
+      CURLcode SendFile(int fileDescriptor, int64_t offset, int64_t length, Context const& context)
+          override;
+#endif
     };
   } // namespace Http
 }} // namespace Azure::Core
@@ -0,0 +1,688 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/core/http/curl_transport.hpp"
+#include "azure/core/internal/diagnostics/log.hpp"
+
+// Private include
+#include "curl_multi_private.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if defined(_azure_CURL_EVENT_LOOP_SUPPORTED)
+
+using Azure::Core::Context;
+using Azure::Core::OperationCancelledException;
+using Azure::Core::Diagnostics::Logger;
+using Azure::Core::Diagnostics::_internal::Log;
+using Azure::Core::Http::CurlConnection;
+using Azure::Core::Http::CurlTransportOptions;
+using Azure::Core::Http::HttpMethod;
+using Azure::Core::Http::HttpStatusCode;
+using Azure::Core::Http::RawResponse;
+using Azure::Core::Http::Request;
+using Azure::Core::Http::TransportException;
+using Azure::Core::Http::_detail::CurlEventLoop;
+using Azure::Core::Http::_detail::CurlEventLoopGroup;
+using Azure::Core::Http::_detail::CurlMultiBodyStream;
+using Azure::Core::Http::_detail::CurlMultiTransfer;
+
+namespace {
+std::string const LogMsgPrefix = "[CURL Transport Adapter]: ";
+
+template <typename T>
+#if defined(_MSC_VER)
+#pragma warning(push)
+// C26812: The enum type 'CURLoption' is un-scoped. Prefer 'enum class' over 'enum' (Enum.3)
+#pragma warning(disable : 26812)
+#endif
+inline void SetTransferOption(
+    Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+    CURLoption option,
+    T value,
+    std::string const& hostDisplayName)
+{
+  auto result = curl_easy_setopt(handle.get(), option, value);
+  if (result != CURLE_OK)
+  {
+    throw TransportException(
+        Azure::Core::Http::_detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+        + ". " + std::string(curl_easy_strerror(result)));
+  }
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+// Parses status lines like `HTTP/1.1 200 OK` or `HTTP/2 200`.
+std::unique_ptr<RawResponse> CreateHttpResponse(char const* const begin, char const* const last)
+{
+  auto start = begin + 5; // HTTP = 4, / = 1, moving to 5th place for version
+  auto end = std::find(start, last, ' ');
+  auto const version = std::string(start, end);
+  auto const dot = version.find('.');
+  auto const majorVersion = std::stoi(version.substr(0, dot));
+  auto const minorVersion = dot == std::string::npos ? 0 : std::stoi(version.substr(dot + 1));
+
+  start = (std::min)(end + 1, last); // start of status code
+  end = std::find(start, last, ' ');
+  auto const statusCode = std::stoi(std::string(start, end));
+
+  start = (std::min)(end + 1, last); // start of reason phrase
+  auto const reasonPhrase = std::string(start, last);
+
+  return std::make_unique<RawResponse>(
+      static_cast<uint16_t>(majorVersion),
+      static_cast<uint16_t>(minorVersion),
+      HttpStatusCode(statusCode),
+      reasonPhrase);
+}
+} // namespace
+
+CurlMultiTransfer::CurlMultiTransfer(
+    Request& request,
+    CurlTransportOptions const& options,
+    Context const& context)
+    : m_request(request), m_context(context),
+      m_promise(std::make_unique<std::promise<std::unique_ptr<RawResponse>>>())
+{
+  auto const& url = request.GetUrl();
+  uint16_t port = url.GetPort();
+  std::string const hostDisplayName
+      = url.GetScheme() + "://" + url.GetHost() + (port != 0 ? ":" + std::to_string(port) : "");
+
+  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
+  if (!m_handle)
+  {
+    throw TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string("curl_easy_init returned Null"));
+  }
+
+  CurlConnection::SetTransportOptions(m_handle, options, hostDisplayName);
+
+  SetTransferOption(m_handle, CURLOPT_URL, url.GetAbsoluteUrl().c_str(), hostDisplayName);
+  if (port != 0)
+  {
+    SetTransferOption(m_handle, CURLOPT_PORT, static_cast<long>(port), hostDisplayName);
+  }
+  if (options.EnableHttp2 && (curl_version_info(CURLVERSION_NOW)->features & CURL_VERSION_HTTP2))
+  {
+    // HTTP/2 is negotiated with ALPN, so servers which don't support it keep using HTTP/1.1.
+    SetTransferOption(
+        m_handle, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS), hostDisplayName);
+    // Wait for a connection being opened to the same host rather than opening another one, so
+    // concurrent requests are multiplexed on it.
+    SetTransferOption(m_handle, CURLOPT_PIPEWAIT, 1L, hostDisplayName);
+  }
+  // The status line of a proxy CONNECT must not be mistaken for the response.
+  SetTransferOption(m_handle, CURLOPT_SUPPRESS_CONNECT_HEADERS, 1L, hostDisplayName);
+  if (!options.HttpKeepAlive)
+  {
+    SetTransferOption(m_handle, CURLOPT_FORBID_REUSE, 1L, hostDisplayName);
+  }
+  if (options.ReceiveBufferSize != 0)
+  {
+    // libcurl clamps the value to its supported range.
+    SetTransferOption(
+        m_handle,
+        CURLOPT_BUFFERSIZE,
+        static_cast<long>(options.ReceiveBufferSize),
+        hostDisplayName);
+  }
+
+  auto const& method = request.GetMethod();
+  if (method == HttpMethod::Head)
+  {
+    SetTransferOption(m_handle, CURLOPT_NOBODY, 1L, hostDisplayName);
+  }
+  else if (method != HttpMethod::Get)
+  {
+    SetTransferOption(m_handle, CURLOPT_CUSTOMREQUEST, method.ToString().c_str(), hostDisplayName);
+    auto const bodyLength = request.GetBodyStream()->Length();
+    if (bodyLength > 0 || method == HttpMethod::Put || method == HttpMethod::Post
+        || method == HttpMethod::Patch)
+    {
+      SetTransferOption(m_handle, CURLOPT_UPLOAD, 1L, hostDisplayName);
+      SetTransferOption(
+          m_handle,
+          CURLOPT_INFILESIZE_LARGE,
+          static_cast<curl_off_t>(bodyLength),
+          hostDisplayName);
+      SetTransferOption(m_handle, CURLOPT_READFUNCTION, ReadCallback, hostDisplayName);
+      SetTransferOption(m_handle, CURLOPT_READDATA, this, hostDisplayName);
+      SetTransferOption(m_handle, CURLOPT_SEEKFUNCTION, SeekCallback, hostDisplayName);
+      SetTransferOption(m_handle, CURLOPT_SEEKDATA, this, hostDisplayName);
+    }
+  }
+
+  for (auto const& header : request.GetHeadersView())
+  {
+    // libcurl sends `name;` as a header with an empty value.
+    auto const line
+        = header.first + (header.second.empty() ? std::string(";") : ": " + header.second);
+    auto headers = curl_slist_append(m_headers, line.c_str());
+    if (headers == nullptr)
+    {
+      throw TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+          + ". Failed to allocate the request headers.");
+    }
+    m_headers = headers;
+  }
+  SetTransferOption(m_handle, CURLOPT_HTTPHEADER, m_headers, hostDisplayName);
+
+  SetTransferOption(m_handle, CURLOPT_HEADERFUNCTION, HeaderCallback, hostDisplayName);
+  SetTransferOption(m_handle, CURLOPT_HEADERDATA, this, hostDisplayName);
+  SetTransferOption(m_handle, CURLOPT_WRITEFUNCTION, WriteCallback, hostDisplayName);
+  SetTransferOption(m_handle, CURLOPT_WRITEDATA, this, hostDisplayName);
+}
+
+CurlMultiTransfer::~CurlMultiTransfer()
+{
+  // The handle must be released before the headers it points to.
+  m_handle.reset();
+  curl_slist_free_all(m_headers);
+}
+
+size_t CurlMultiTransfer::HeaderCallback(char* data, size_t size, size_t count, void* userp)
+{
+  return static_cast<CurlMultiTransfer*>(userp)->OnHeader(data, size * count);
+}
+
+size_t CurlMultiTransfer::WriteCallback(char* data, size_t size, size_t count, void* userp)
+{
+  return static_cast<CurlMultiTransfer*>(userp)->OnWrite(data, size * count);
+}
+
+size_t CurlMultiTransfer::ReadCallback(char* data, size_t size, size_t count, void* userp)
+{
+  auto transfer = static_cast<CurlMultiTransfer*>(userp);
+  try
+  {
+    return transfer->m_request.GetBodyStream()->Read(
+        reinterpret_cast<uint8_t*>(data), size * count, transfer->m_context);
+  }
+  catch (...)
+  {
+    // Exceptions can't go through libcurl. Abort the transfer and report the error once libcurl
+    // completes it.
+    transfer->m_uploadError = std::current_exception();
+    return CURL_READFUNC_ABORT;
+  }
+}
+
+int CurlMultiTransfer::SeekCallback(void* userp, curl_off_t offset, int origin)
+{
+  // libcurl only needs to rewind the upload when it re-sends the request on a new connection.
+  if (origin != SEEK_SET || offset != 0)
+  {
+    return CURL_SEEKFUNC_CANTSEEK;
+  }
+  try
+  {
+    static_cast<CurlMultiTransfer*>(userp)->m_request.GetBodyStream()->Rewind();
+    return CURL_SEEKFUNC_OK;
+  }
+  catch (...)
+  {
+    return CURL_SEEKFUNC_FAIL;
+  }
+}
+
+size_t CurlMultiTransfer::OnHeader(char const* data, size_t size)
+{
+  if (!m_promise)
+  {
+    // Trailers after the body are ignored.
+    return size;
+  }
+
+  auto last = data + size;
+  while (last > data && (*(last - 1) == '\r' || *(last - 1) == '\n'))
+  {
+    --last;
+  }
+
+  try
+  {
+    if (last - data > 5 && std::strncmp(data, "HTTP/", 5) == 0)
+    {
+      m_response = CreateHttpResponse(data, last);
+    }
+    else if (last == data)
+    {
+      // End of headers. Interim 1xx responses (e.g. 100-continue) are followed by the final one.
+      if (m_response
+          && static_cast<std::underlying_type<HttpStatusCode>::type>(m_response->GetStatusCode())
+              >= 200)
+      {
+        PublishResponse();
+      }
+      else
+      {
+        m_response.reset();
+      }
+    }
+    else if (m_response)
+    {
+      Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(
+          *m_response, reinterpret_cast<uint8_t const*>(data), reinterpret_cast<uint8_t const*>(last));
+    }
+  }
+  catch (std::exception const& error)
+  {
+    Log::Write(Logger::Level::Error, LogMsgPrefix + "Invalid response. " + error.what());
+    // Returning a different size makes libcurl fail the transfer with CURLE_WRITE_ERROR.
+    return 0;
+  }
+  return size;
+}
+
+size_t CurlMultiTransfer::OnWrite(char const* data, size_t size)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const buffered = m_body.size() - m_bodyOffset;
+    if (buffered >= DefaultEventLoopMaxBufferedBytes)
+    {
+      // The data is not consumed when pausing. libcurl delivers it again once resumed.
+      m_isPaused = true;
+      return CURL_WRITEFUNC_PAUSE;
+    }
+
+    if (m_bodyOffset == m_body.size())
+    {
+      m_body.clear();
+      m_bodyOffset = 0;
+    }
+    else if (m_bodyOffset > m_body.size() / 2)
+    {
+      m_body.erase(m_body.begin(), m_body.begin() + m_bodyOffset);
+      m_bodyOffset = 0;
+    }
+    m_body.insert(
+        m_body.end(),
+        reinterpret_cast<uint8_t const*>(data),
+        reinterpret_cast<uint8_t const*>(data) + size);
+  }
+  m_bodyAvailable.notify_all();
+  return size;
+}
+
+void CurlMultiTransfer::PublishResponse()
+{
+  auto const statusCode = m_response->GetStatusCode();
+  if (m_request.GetMethod() == HttpMethod::Head || statusCode == HttpStatusCode::NoContent
+      || statusCode == HttpStatusCode::NotModified)
+  {
+    m_contentLength = 0;
+  }
+  else
+  {
+    auto const& headers = m_response->GetHeaders();
+    auto const contentLength = headers.find("content-length");
+    if (contentLength != headers.end())
+    {
+      m_contentLength = static_cast<int64_t>(std::stoull(contentLength->second));
+    }
+  }
+
+  // The promise is released right away so a response whose future was abandoned does not keep
+  // the transfer alive.
+  auto promise = std::move(m_promise);
+  m_response->SetBodyStream(std::make_unique<CurlMultiBodyStream>(shared_from_this()));
+  promise->set_value(std::move(m_response));
+}
+
+void CurlMultiTransfer::FailResponse(std::exception_ptr error)
+{
+  auto promise = std::move(m_promise);
+  m_response.reset();
+  promise->set_exception(error);
+}
+
+void CurlMultiTransfer::SetEventLoop(CurlEventLoop* eventLoop)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_eventLoop = eventLoop;
+}
+
+bool CurlMultiTransfer::TakeResumeRequest()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const isPaused = m_isPaused;
+  m_isPaused = false;
+  m_resumeRequested = false;
+  return isPaused;
+}
+
+void CurlMultiTransfer::OnDone(CURLcode result, std::string const& error)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isDone)
+    {
+      return;
+    }
+    m_isDone = true;
+    m_result = result;
+    m_error = error.empty() ? std::string(curl_easy_strerror(result)) : error;
+    m_eventLoop = nullptr;
+  }
+  m_bodyAvailable.notify_all();
+
+  if (!m_promise)
+  {
+    return;
+  }
+
+  if (m_uploadError)
+  {
+    FailResponse(m_uploadError);
+  }
+  else if (result != CURLE_OK && m_context.IsCancelled())
+  {
+    FailResponse(std::make_exception_ptr(
+        OperationCancelledException("Request was cancelled by context.")));
+  }
+  else if (result != CURLE_OK)
+  {
+    FailResponse(std::make_exception_ptr(
+        TransportException("Error while sending request. " + m_error)));
+  }
+  else
+  {
+    FailResponse(std::make_exception_ptr(
+        TransportException("Error while sending request. No response was received.")));
+  }
+}
+
+size_t CurlMultiTransfer::ReadBody(uint8_t* buffer, size_t count, Context const& context)
+{
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (m_bodyOffset == m_body.size())
+  {
+    if (m_isDone)
+    {
+      if (m_result != CURLE_OK)
+      {
+        throw TransportException(
+            "Error while reading the response. CURLE code: " + std::to_string(m_result) + ". "
+            + m_error);
+      }
+      return 0;
+    }
+    context.ThrowIfCancelled();
+    m_bodyAvailable.wait_for(lock, DefaultEventLoopPollInterval);
+  }
+
+  auto const readBytes = (std::min)(count, m_body.size() - m_bodyOffset);
+  std::memcpy(buffer, m_body.data() + m_bodyOffset, readBytes);
+  m_bodyOffset += readBytes;
+
+  if (m_isPaused && !m_resumeRequested && m_eventLoop != nullptr
+      && m_body.size() - m_bodyOffset < DefaultEventLoopMaxBufferedBytes / 2)
+  {
+    m_resumeRequested = true;
+    m_eventLoop->Resume(shared_from_this());
+  }
+  return readBytes;
+}
+
+void CurlMultiTransfer::Cancel()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_isDone && m_eventLoop != nullptr)
+  {
+    m_eventLoop->Cancel(shared_from_this());
+  }
+}
+
+CurlEventLoop::CurlEventLoop() : m_multiHandle(curl_multi_init())
+{
+  if (m_multiHandle == nullptr)
+  {
+    throw TransportException("Failed to create the event loop. curl_multi_init returned Null");
+  }
+  // Let the transfers using HTTP/2 share their connections.
+  curl_multi_setopt(m_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+}
+
+CurlEventLoop::~CurlEventLoop()
+{
+  if (m_multiHandle != nullptr)
+  {
+    curl_multi_cleanup(m_multiHandle);
+  }
+}
+
+void CurlEventLoop::Start()
+{
+  std::thread(Run, shared_from_this()).detach();
+}
+
+void CurlEventLoop::Run(std::shared_ptr<CurlEventLoop> self)
+{
+  {
+    std::lock_guard<std::mutex> lock(self->m_mutex);
+    self->m_threadId = std::this_thread::get_id();
+  }
+
+  self->RunLoop();
+
+  curl_multi_cleanup(self->m_multiHandle);
+  {
+    std::lock_guard<std::mutex> lock(self->m_mutex);
+    self->m_multiHandle = nullptr;
+    self->m_exited = true;
+  }
+  self->m_exitCondition.notify_all();
+  // Releasing `self` destroys the event loop once its owner is gone.
+}
+
+void CurlEventLoop::RunLoop()
+{
+  auto lastCancellationCheck = std::chrono::steady_clock::now();
+  for (;;)
+  {
+    decltype(m_pending) pending;
+    decltype(m_toResume) toResume;
+    decltype(m_toCancel) toCancel;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_stopRequested && m_transferCount == 0)
+      {
+        return;
+      }
+      pending.swap(m_pending);
+      toResume.swap(m_toResume);
+      toCancel.swap(m_toCancel);
+    }
+
+    for (auto& transfer : pending)
+    {
+      auto const addResult = curl_multi_add_handle(m_multiHandle, transfer->GetHandle());
+      if (addResult != CURLM_OK)
+      {
+        Complete(transfer, CURLE_FAILED_INIT, curl_multi_strerror(addResult));
+        continue;
+      }
+      m_active.emplace(transfer->GetHandle(), std::move(transfer));
+    }
+
+    for (auto& transfer : toCancel)
+    {
+      if (m_active.erase(transfer->GetHandle()) > 0)
+      {
+        curl_multi_remove_handle(m_multiHandle, transfer->GetHandle());
+        Complete(transfer, CURLE_ABORTED_BY_CALLBACK, "The transfer was abandoned.");
+      }
+    }
+
+    for (auto& transfer : toResume)
+    {
+      if (m_active.find(transfer->GetHandle()) != m_active.end() && transfer->TakeResumeRequest())
+      {
+        curl_easy_pause(transfer->GetHandle(), CURLPAUSE_CONT);
+      }
+    }
+
+    int runningTransfers = 0;
+    curl_multi_perform(m_multiHandle, &runningTransfers);
+
+    int queuedMessages = 0;
+    while (CURLMsg* message = curl_multi_info_read(m_multiHandle, &queuedMessages))
+    {
+      if (message->msg != CURLMSG_DONE)
+      {
+        continue;
+      }
+      // The message is released by curl_multi_remove_handle.
+      auto const handle = message->easy_handle;
+      auto const result = message->data.result;
+      auto transfer = m_active.find(handle);
+      if (transfer == m_active.end())
+      {
+        continue;
+      }
+      auto completed = std::move(transfer->second);
+      m_active.erase(transfer);
+      curl_multi_remove_handle(m_multiHandle, handle);
+      Complete(completed, result);
+    }
+
+    auto const now = std::chrono::steady_clock::now();
+    if (now - lastCancellationCheck >= DefaultEventLoopPollInterval)
+    {
+      lastCancellationCheck = now;
+      for (auto transfer = m_active.begin(); transfer != m_active.end();)
+      {
+        if (transfer->second->GetContext().IsCancelled())
+        {
+          auto cancelled = std::move(transfer->second);
+          transfer = m_active.erase(transfer);
+          curl_multi_remove_handle(m_multiHandle, cancelled->GetHandle());
+          Complete(cancelled, CURLE_ABORTED_BY_CALLBACK, "Request was cancelled by context.");
+        }
+        else
+        {
+          ++transfer;
+        }
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_pending.empty() || !m_toResume.empty() || !m_toCancel.empty())
+      {
+        continue;
+      }
+    }
+    curl_multi_poll(
+        m_multiHandle,
+        nullptr,
+        0,
+        static_cast<int>(DefaultEventLoopPollInterval.count()),
+        nullptr);
+  }
+}
+
+void CurlEventLoop::Complete(
+    std::shared_ptr<CurlMultiTransfer> const& transfer,
+    CURLcode result,
+    std::string const& error)
+{
+  transfer->OnDone(result, error);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  --m_transferCount;
+}
+
+void CurlEventLoop::Wakeup()
+{
+  if (m_multiHandle != nullptr)
+  {
+    curl_multi_wakeup(m_multiHandle);
+  }
+}
+
+void CurlEventLoop::Stop()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_stopRequested = true;
+  Wakeup();
+  // With responses still being read, the thread keeps running and exits on its own later.
+  if (m_transferCount == 0 && m_threadId != std::this_thread::get_id())
+  {
+    m_exitCondition.wait(lock, [this]() { return m_exited; });
+  }
+}
+
+void CurlEventLoop::Submit(std::shared_ptr<CurlMultiTransfer> transfer)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_transferCount;
+  m_pending.emplace_back(std::move(transfer));
+  Wakeup();
+}
+
+void CurlEventLoop::Resume(std::shared_ptr<CurlMultiTransfer> transfer)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_toResume.emplace_back(std::move(transfer));
+  Wakeup();
+}
+
+void CurlEventLoop::Cancel(std::shared_ptr<CurlMultiTransfer> transfer)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_toCancel.emplace_back(std::move(transfer));
+  Wakeup();
+}
+
+CurlEventLoopGroup::CurlEventLoopGroup(size_t threadCount)
+{
+  m_eventLoops.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; i++)
+  {
+    m_eventLoops.emplace_back(std::make_shared<CurlEventLoop>());
+    m_eventLoops.back()->Start();
+  }
+}
+
+CurlEventLoopGroup::~CurlEventLoopGroup()
+{
+  for (auto& eventLoop : m_eventLoops)
+  {
+    eventLoop->Stop();
+  }
+}
+
+std::future<std::unique_ptr<RawResponse>> CurlEventLoopGroup::Submit(
+    Request& request,
+    CurlTransportOptions const& options,
+    Context const& context)
+{
+  // Before doing any work, check to make sure that the context hasn't already been cancelled.
+  context.ThrowIfCancelled();
+
+  auto transfer = std::make_shared<CurlMultiTransfer>(request, options, context);
+  // The future must be taken before the event loop can complete the transfer.
+  auto response = transfer->GetResponse();
+
+  auto& eventLoop = m_eventLoops[m_next++ % m_eventLoops.size()];
+  transfer->SetEventLoop(eventLoop.get());
+  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Queue request to the event loop.");
+  eventLoop->Submit(std::move(transfer));
+  return response;
+}
+
+#endif // _azure_CURL_EVENT_LOOP_SUPPORTED
@@ -0,0 +1,271 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief The curl event loop drives many HTTP requests from a few threads by using the libcurl
+ * multi interface.
+ */
+
+#pragma once
+
+#include "azure/core/http/curl_transport.hpp"
+#include "azure/core/http/http.hpp"
+#include "azure/core/io/body_stream.hpp"
+#include "curl_connection_private.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// curl_multi_poll() and curl_multi_wakeup() were added in libcurl 7.68.0
+#if LIBCURL_VERSION_NUM >= 0x074400
+#define _azure_CURL_EVENT_LOOP_SUPPORTED
+#endif
+
+namespace Azure { namespace Core { namespace Http { namespace _detail {
+
+  /**
+   * @brief The maximum number of response body bytes a transfer keeps in memory before libcurl is
+   * asked to pause it until the body stream is read.
+   */
+  constexpr static size_t DefaultEventLoopMaxBufferedBytes = 1024 * 1024;
+
+  /**
+   * @brief The interval used by the event loop to check for cancelled requests while it is idle.
+   */
+  constexpr static std::chrono::milliseconds DefaultEventLoopPollInterval
+      = std::chrono::milliseconds(1000);
+
+  class CurlEventLoop;
+
+  /**
+   * @brief The state of one HTTP request performed by a #CurlEventLoop.
+   *
+   * @details The transfer is shared by the event loop thread, which runs the libcurl callbacks,
+   * and the thread reading the response body. The response is published through a future as soon
+   * as the status line and the headers are received; the body is then handed over chunk by chunk
+   * to the reader.
+   */
+  class CurlMultiTransfer final : public std::enable_shared_from_this<CurlMultiTransfer> {
+  private:
+    Azure::Core::_internal::UniqueHandle<CURL> m_handle;
+    curl_slist* m_headers = nullptr;
+    Request& m_request;
+    Context m_context;
+
+    std::mutex m_mutex;
+    std::condition_variable m_bodyAvailable;
+
+    // Owned by the event loop thread until the headers are received.
+    std::unique_ptr<RawResponse> m_response;
+    std::unique_ptr<std::promise<std::unique_ptr<RawResponse>>> m_promise;
+    std::exception_ptr m_uploadError;
+
+    // Guarded by m_mutex.
+    CurlEventLoop* m_eventLoop = nullptr;
+    std::vector<uint8_t> m_body;
+    size_t m_bodyOffset = 0;
+    bool m_isPaused = false;
+    bool m_resumeRequested = false;
+    bool m_isDone = false;
+    CURLcode m_result = CURLE_OK;
+    std::string m_error;
+    int64_t m_contentLength = -1;
+
+    static size_t HeaderCallback(char* data, size_t size, size_t count, void* userp);
+    static size_t WriteCallback(char* data, size_t size, size_t count, void* userp);
+    static size_t ReadCallback(char* data, size_t size, size_t count, void* userp);
+    static int SeekCallback(void* userp, curl_off_t offset, int origin);
+
+    size_t OnHeader(char const* data, size_t size);
+    size_t OnWrite(char const* data, size_t size);
+    void PublishResponse();
+    void FailResponse(std::exception_ptr error);
+
+  public:
+    /**
+     * @brief Creates the libcurl handle for \p request.
+     *
+     * @param request The HTTP request to perform. It must outlive the transfer.
+     * @param options The transport options.
+     * @param context A context to control the request lifetime.
+     */
+    CurlMultiTransfer(
+        Request& request,
+        CurlTransportOptions const& options,
+        Context const& context);
+
+    ~CurlMultiTransfer();
+
+    CURL* GetHandle() const { return m_handle.get(); }
+
+    Context const& GetContext() const { return m_context; }
+
+    /**
+     * @brief Returns the future that is completed once the response headers are received.
+     */
+    std::future<std::unique_ptr<RawResponse>> GetResponse() { return m_promise->get_future(); }
+
+    /**
+     * @brief Binds the transfer to the event loop that performs it.
+     */
+    void SetEventLoop(CurlEventLoop* eventLoop);
+
+    /**
+     * @brief Called from the event loop thread before resuming a paused transfer.
+     *
+     * @return `true` if the transfer was paused and libcurl must be asked to continue.
+     */
+    bool TakeResumeRequest();
+
+    /**
+     * @brief Called from the event loop thread once libcurl has completed the transfer, or once
+     * the transfer was removed from the event loop with \p result set to an error.
+     */
+    void OnDone(CURLcode result, std::string const& error = std::string());
+
+    /**
+     * @brief Reads the response body, waiting for the event loop to receive more data if needed.
+     */
+    size_t ReadBody(uint8_t* buffer, size_t count, Context const& context);
+
+    /**
+     * @brief Asks the event loop to abandon the transfer if it is still in progress.
+     */
+    void Cancel();
+
+    /**
+     * @brief The value of the `Content-Length` header, or `-1` if it is unknown.
+     */
+    int64_t GetContentLength() const { return m_contentLength; }
+  };
+
+  /**
+   * @brief Body stream returned by the transport for a response driven by a #CurlEventLoop.
+   *
+   * @remark Destroying the stream before reading the whole body abandons the transfer, and the
+   * connection it was using is closed by libcurl.
+   */
+  class CurlMultiBodyStream final : public Azure::Core::IO::BodyStream {
+  private:
+    std::shared_ptr<CurlMultiTransfer> m_transfer;
+
+    size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override
+    {
+      return m_transfer->ReadBody(buffer, count, context);
+    }
+
+  public:
+    explicit CurlMultiBodyStream(std::shared_ptr<CurlMultiTransfer> transfer)
+        : m_transfer(std::move(transfer))
+    {
+    }
+
+    ~CurlMultiBodyStream() override { m_transfer->Cancel(); }
+
+    int64_t Length() const override { return m_transfer->GetContentLength(); }
+  };
+
+  /**
+   * @brief A thread running a libcurl multi handle.
+   *
+   * @details The thread keeps the event loop alive while it runs. Once stopped, the thread keeps
+   * running until every transfer it owns is completed, so a response can be read after the
+   * transport that sent it has been destroyed.
+   */
+  class CurlEventLoop final : public std::enable_shared_from_this<CurlEventLoop> {
+  private:
+    CURLM* m_multiHandle;
+
+    std::mutex m_mutex;
+    std::condition_variable m_exitCondition;
+    std::deque<std::shared_ptr<CurlMultiTransfer>> m_pending;
+    std::vector<std::shared_ptr<CurlMultiTransfer>> m_toResume;
+    std::vector<std::shared_ptr<CurlMultiTransfer>> m_toCancel;
+    size_t m_transferCount = 0;
+    bool m_stopRequested = false;
+    bool m_exited = false;
+    std::thread::id m_threadId;
+
+    // Only accessed from the event loop thread.
+    std::unordered_map<CURL*, std::shared_ptr<CurlMultiTransfer>> m_active;
+
+    static void Run(std::shared_ptr<CurlEventLoop> self);
+    void RunLoop();
+    void Wakeup();
+    void Complete(
+        std::shared_ptr<CurlMultiTransfer> const& transfer,
+        CURLcode result,
+        std::string const& error = std::string());
+
+  public:
+    CurlEventLoop();
+    ~CurlEventLoop();
+
+    CurlEventLoop(CurlEventLoop const&) = delete;
+    CurlEventLoop& operator=(CurlEventLoop const&) = delete;
+
+    /**
+     * @brief Starts the event loop thread.
+     */
+    void Start();
+
+    /**
+     * @brief Requests the event loop thread to exit once all of its transfers are completed.
+     * Waits for the thread to exit when there is no transfer in progress.
+     */
+    void Stop();
+
+    /**
+     * @brief Queues \p transfer to be performed by the event loop.
+     */
+    void Submit(std::shared_ptr<CurlMultiTransfer> transfer);
+
+    /**
+     * @brief Asks the event loop to resume a transfer paused because of a full body buffer.
+     */
+    void Resume(std::shared_ptr<CurlMultiTransfer> transfer);
+
+    /**
+     * @brief Asks the event loop to abandon a transfer.
+     */
+    void Cancel(std::shared_ptr<CurlMultiTransfer> transfer);
+  };
+
+  /**
+   * @brief The set of event loops owned by a #Azure::Core::Http::CurlTransport.
+   */
+  class CurlEventLoopGroup final {
+  private:
+    std::vector<std::shared_ptr<CurlEventLoop>> m_eventLoops;
+    std::atomic<size_t> m_next{0};
+
+  public:
+    /**
+     * @brief Starts \p threadCount event loops.
+     */
+    explicit CurlEventLoopGroup(size_t threadCount);
+
+    ~CurlEventLoopGroup();
+
+    /**
+     * @brief Creates a transfer for \p request and queues it to the next event loop.
+     *
+     * @return The future completed once the response headers are received.
+     */
+    std::future<std::unique_ptr<RawResponse>> Submit(
+        Request& request,
+        CurlTransportOptions const& options,
+        Context const& context);
+  };
+
+}}}} // namespace Azure::Core::Http::_detail
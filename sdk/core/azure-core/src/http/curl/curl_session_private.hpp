@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifdef _azure_TESTING_BUILD
 // Define the class name that reads from ConnectionPool private members
@@ -282,13 +283,38 @@ namespace Azure { namespace Core { namespace Http {
     bool m_connectionUpgraded = false;
 
     /**
-     * @brief Internal buffer from a session used to read bytes from a socket. This buffer is only
-     * used while constructing an HTTP RawResponse without adding a body to it. Customers would
-     * provide their own buffer to copy from socket when reading the HTTP body using streams.
+     * @brief Internal buffer from a session used to read bytes from a socket. This buffer is used
+     * while constructing an HTTP RawResponse and to serve body reads smaller than the buffer, so
+     * many small reads cost a single call to the network. Reads at least as large as the buffer
+     * copy from socket straight into the customer's buffer.
      *
+     * @remark Sized from #Azure::Core::Http::CurlTransportOptions::ReceiveBufferSize.
      */
-    uint8_t m_readBuffer[_detail::DefaultLibcurlReaderSize]
-        = {0}; // to work with libcurl custom read.
+    std::vector<uint8_t> m_readBuffer;
+
+    /**
+     * @brief If True, the inner buffer grows for large responses. See
+     * #Azure::Core::Http::CurlTransportOptions::EnableAdaptiveReceiveBuffer.
+     */
+    bool m_adaptiveReadBuffer;
+
+    /**
+     * @brief Grows the inner buffer to \p size bytes, keeping the data it holds.
+     *
+     * @remark Does nothing if the adaptive buffer is disabled or the buffer is already large
+     * enough. The size is capped to `_detail::MaxAdaptiveLibcurlReaderSize`.
+     */
+    void GrowReadBuffer(size_t size);
+
+    /**
+     * @brief Replaces the content of the inner buffer with the next bytes from the network, up to
+     * \p maxSize bytes.
+     *
+     * @param context A context to control the request lifetime.
+     * @param maxSize The maximum number of bytes to read.
+     * @return The number of bytes read. Zero means the connection was closed.
+     */
+    size_t FillReadBuffer(Context const& context, size_t maxSize = static_cast<size_t>(-1));
 
     /**
      * @brief Function used when working with Streams to manually write from the HTTP Request to
@@ -303,6 +329,10 @@ namespace Azure { namespace Core { namespace Http {
     /**
      * @brief Upload body.
      *
+     * @remark A #Azure::Core::IO::MemoryBodyStream is sent from its own buffer. On Linux, a file
+     * body stream is sent with `sendfile()` when the connection is not encrypted. Other streams
+     * are copied to the network one chunk at a time.
+     *
      * @param context A context to control the request lifetime.
      *
      * @return Curl code.
@@ -374,6 +404,13 @@ namespace Azure { namespace Core { namespace Http {
      */
     bool m_keepAlive = true;
 
+    /**
+     * @brief The maximum number of connections kept in the connection pool for the host of the
+     * request.
+     *
+     */
+    size_t m_maxIdleConnectionsPerHost;
+
     Azure::Nullable<std::string> m_httpProxy;
     Azure::Nullable<std::string> m_httpProxyUser;
     Azure::Nullable<std::string> m_httpProxyPassword;
@@ -408,7 +445,15 @@ namespace Azure { namespace Core { namespace Http {
         std::unique_ptr<CurlNetworkConnection> connection,
         CurlTransportOptions curlOptions)
         : m_connection(std::move(connection)), m_request(request),
-          m_keepAlive(curlOptions.HttpKeepAlive), m_httpProxy(curlOptions.Proxy),
+          m_readBuffer(
+              curlOptions.ReceiveBufferSize == 0 ? _detail::DefaultLibcurlReaderSize
+                                                 : curlOptions.ReceiveBufferSize),
+          m_adaptiveReadBuffer(curlOptions.EnableAdaptiveReceiveBuffer),
+          m_keepAlive(curlOptions.HttpKeepAlive),
+          m_maxIdleConnectionsPerHost(
+              curlOptions.MaxIdleConnectionsPerHost == 0 ? _detail::MaxConnectionsPerIndex
+                                                         : curlOptions.MaxIdleConnectionsPerHost),
+          m_httpProxy(curlOptions.Proxy),
           m_httpProxyUser(curlOptions.ProxyUsername), m_httpProxyPassword(curlOptions.ProxyPassword)
     {
     }
@@ -424,7 +469,7 @@ namespace Azure { namespace Core { namespace Http {
       if (IsEOF() && m_keepAlive && !m_connectionUpgraded)
       {
         _detail::CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
-            std::move(m_connection), m_httpKeepAlive);
+            std::move(m_connection), m_httpKeepAlive, m_maxIdleConnectionsPerHost);
       }
     }
 
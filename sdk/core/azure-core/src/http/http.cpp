@@ -37,18 +37,23 @@ bool IsInvalidHeaderNameChar(char c)
 }
 } // namespace
 
-void Azure::Core::Http::_detail::RawResponseHelpers::InsertHeaderWithValidation(
-    Azure::Core::CaseInsensitiveMap& headers,
-    std::string const& headerName,
-    std::string const& headerValue)
+void Azure::Core::Http::_detail::RawResponseHelpers::ValidateHeaderName(
+    std::string const& headerName)
 {
-
   // Check all chars in name are valid
   if (std::find_if(headerName.begin(), headerName.end(), IsInvalidHeaderNameChar)
       != headerName.end())
   {
     throw std::invalid_argument("Invalid header name: " + headerName);
   }
+}
+
+void Azure::Core::Http::_detail::RawResponseHelpers::InsertHeaderWithValidation(
+    Azure::Core::CaseInsensitiveMap& headers,
+    std::string const& headerName,
+    std::string const& headerValue)
+{
+  ValidateHeaderName(headerName);
 
   // insert (override if duplicated)
   headers[headerName] = headerValue;
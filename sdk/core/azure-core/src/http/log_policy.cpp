@@ -5,6 +5,7 @@
 #include "azure/core/internal/diagnostics/log.hpp"
 
 #include <chrono>
+#include <future>
 #include <sstream>
 
 using Azure::Core::Context;
@@ -127,3 +128,38 @@ std::unique_ptr<RawResponse> LogPolicy::Send(
 
   return response;
 }
+
+std::future<std::unique_ptr<RawResponse>> LogPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  if (Log::ShouldWrite(Logger::Level::Verbose))
+  {
+    Log::Write(Logger::Level::Informational, GetRequestLogMessage(m_httpSanitizer, request));
+  }
+  else
+  {
+    return nextPolicy.SendAsync(request, context);
+  }
+
+  auto const start = std::chrono::system_clock::now();
+  auto pendingResponse = nextPolicy.SendAsync(request, context);
+
+  // The time logged is the time until the thread waiting for the future gets the response.
+  return std::async(
+      std::launch::deferred,
+      [this, start, pendingResponse = std::move(pendingResponse)]() mutable {
+        auto response = pendingResponse.get();
+        auto const end = std::chrono::system_clock::now();
+
+        Log::Write(
+            Logger::Level::Informational,
+            GetResponseLogMessage(m_httpSanitizer, *response, end - start));
+
+        return response;
+      });
+}
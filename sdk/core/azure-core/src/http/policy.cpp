@@ -5,6 +5,9 @@
 
 #include "azure/core/http/http.hpp"
 
+#include <future>
+#include <stdexcept>
+
 using Azure::Core::Context;
 using namespace Azure::Core::Http;
 using namespace Azure::Core::Http::Policies;
@@ -21,3 +24,37 @@ std::unique_ptr<RawResponse> NextHttpPolicy::Send(Request& request, Context cons
 
   return m_policies[m_index + 1]->Send(request, NextHttpPolicy{m_index + 1, m_policies}, context);
 }
+
+std::future<std::unique_ptr<RawResponse>> NextHttpPolicy::SendAsync(
+    Request& request,
+    Context const& context)
+{
+  try
+  {
+    if (m_index == m_policies.size() - 1)
+    {
+      // All the policies have run without running a transport policy
+      throw std::invalid_argument("Invalid pipeline. No transport policy found. Endless policy.");
+    }
+
+    return m_policies[m_index + 1]->SendAsync(
+        request, NextHttpPolicy{m_index + 1, m_policies}, context);
+  }
+  catch (...)
+  {
+    std::promise<std::unique_ptr<RawResponse>> failedResponse;
+    failedResponse.set_exception(std::current_exception());
+    return failedResponse.get_future();
+  }
+}
+
+std::future<std::unique_ptr<RawResponse>> HttpPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  // The policy only provides Send, so the whole request is sent before returning.
+  std::promise<std::unique_ptr<RawResponse>> response;
+  response.set_value(Send(request, nextPolicy, context));
+  return response.get_future();
+}
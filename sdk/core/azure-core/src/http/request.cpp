@@ -5,8 +5,10 @@
 #include "azure/core/internal/io/null_body_stream.hpp"
 #include "azure/core/internal/strings.hpp"
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace Azure::Core;
@@ -14,14 +16,42 @@ using namespace Azure::Core::Http;
 using namespace Azure::Core::IO::_internal;
 
 namespace {
-// returns left map plus all items in right
-// when duplicates, left items are preferred
-static Azure::Core::CaseInsensitiveMap MergeMaps(
-    Azure::Core::CaseInsensitiveMap left,
-    Azure::Core::CaseInsensitiveMap const& right)
+using Azure::Core::_internal::StringExtensions;
+
+// The headers set on most requests, by the pipeline policies or the transports. The headers with
+// these names point to them instead of allocating a copy of the name.
+std::string const* FindWellKnownHeaderName(std::string const& name)
 {
-  left.insert(right.begin(), right.end());
-  return left;
+  static std::string const WellKnownHeaderNames[] = {
+      "accept",
+      "authorization",
+      "content-length",
+      "content-type",
+      "host",
+      "traceparent",
+      "tracestate",
+      "user-agent",
+      "x-ms-client-request-id",
+      "x-ms-date",
+      "x-ms-return-client-request-id",
+      "x-ms-version",
+  };
+
+  for (auto const& wellKnownName : WellKnownHeaderNames)
+  {
+    if (StringExtensions::LocaleInvariantCaseInsensitiveEqual(wellKnownName, name))
+    {
+      return &wellKnownName;
+    }
+  }
+  return nullptr;
+}
+
+template <class Headers> auto FindHeader(Headers& headers, std::string const& name)
+{
+  return std::find_if(headers.begin(), headers.end(), [&name](auto const& header) {
+    return StringExtensions::LocaleInvariantCaseInsensitiveEqual(header.GetName(), name);
+  });
 }
 } // namespace
 
@@ -37,13 +67,10 @@ Request::Request(HttpMethod httpMethod, Url url)
 
 Azure::Nullable<std::string> Request::GetHeader(std::string const& name)
 {
-  for (auto const& hdrs : {m_retryHeaders, m_headers})
+  auto const header = FindHeader(m_headers, name);
+  if (header != m_headers.end())
   {
-    auto const header = hdrs.find(name);
-    if (header != hdrs.end())
-    {
-      return header->second;
-    }
+    return header->Value;
   }
 
   return {};
@@ -51,22 +78,64 @@ Azure::Nullable<std::string> Request::GetHeader(std::string const& name)
 
 void Request::SetHeader(std::string const& name, std::string const& value)
 {
-  return _detail::RawResponseHelpers::InsertHeaderWithValidation(
-      m_retryModeEnabled ? m_retryHeaders : m_headers,
-      Azure::Core::_internal::StringExtensions::ToLower(name),
-      value);
+  _detail::RawResponseHelpers::ValidateHeaderName(name);
+
+  auto const header = FindHeader(m_headers, name);
+  if (header != m_headers.end())
+  {
+    // Keep the value set before the first try, so that the next try can restore it.
+    if (m_retryModeEnabled && !header->IsRetryHeader)
+    {
+      header->ValueBeforeTry = std::move(header->Value);
+      header->IsRetryHeader = true;
+    }
+    header->Value = value;
+    return;
+  }
+
+  _detail::RequestHeader newHeader{
+      FindWellKnownHeaderName(name), std::string(), value, m_retryModeEnabled, {}};
+  if (!newHeader.WellKnownName)
+  {
+    newHeader.Name = StringExtensions::ToLower(name);
+  }
+  m_headers.emplace_back(std::move(newHeader));
 }
 
 void Request::RemoveHeader(std::string const& name)
 {
-  this->m_headers.erase(name);
-  this->m_retryHeaders.erase(name);
+  auto const header = FindHeader(m_headers, name);
+  if (header != m_headers.end())
+  {
+    m_headers.erase(header);
+  }
 }
 
 void Request::StartTry()
 {
   this->m_retryModeEnabled = true;
-  this->m_retryHeaders.clear();
+
+  // Reset the headers set by the previous try.
+  auto retained = this->m_headers.begin();
+  for (auto& header : this->m_headers)
+  {
+    if (header.IsRetryHeader)
+    {
+      if (!header.ValueBeforeTry.HasValue())
+      {
+        continue;
+      }
+      header.Value = std::move(header.ValueBeforeTry.Value());
+      header.ValueBeforeTry.Reset();
+      header.IsRetryHeader = false;
+    }
+    if (&*retained != &header)
+    {
+      *retained = std::move(header);
+    }
+    ++retained;
+  }
+  this->m_headers.erase(retained, this->m_headers.end());
 
   // Make sure to rewind the body stream before each attempt, including the first.
   // It's possible the request doesn't have a body, so make sure to check if a body stream exists.
@@ -80,7 +149,10 @@ HttpMethod const& Request::GetMethod() const { return this->m_method; }
 
 Azure::Core::CaseInsensitiveMap Request::GetHeaders() const
 {
-  // create map with retry headers which are the most important and we don't want
-  // to override them with any duplicate header
-  return MergeMaps(this->m_retryHeaders, this->m_headers);
+  Azure::Core::CaseInsensitiveMap headers;
+  for (auto const& header : this->m_headers)
+  {
+    headers.emplace(header.GetName(), header.Value);
+  }
+  return headers;
 }
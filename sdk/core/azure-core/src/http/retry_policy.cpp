@@ -6,7 +6,10 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <future>
 #include <limits>
+#include <map>
+#include <memory>
 #include <sstream>
 #include <thread>
 
@@ -123,22 +126,77 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
     NextHttpPolicy nextPolicy,
     Context const& context) const
 {
-  using Azure::Core::Diagnostics::Logger;
-  using Azure::Core::Diagnostics::_internal::Log;
   // retryCount needs to be apart from RetryNumber attempt.
   int32_t retryCount = 0;
   auto retryContext = context.WithValue(RetryKey, &retryCount);
 
+  return SendTries(request, nextPolicy, context, retryContext, retryCount, {}, {});
+}
+
+std::future<std::unique_ptr<RawResponse>> RetryPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  // The retry count is read through the context by the policies running after the future is
+  // returned.
+  auto retryCount = std::make_shared<int32_t>(0);
+  auto retryContext = context.WithValue(RetryKey, retryCount.get());
+
+  request.StartTry();
+  auto originalQueryParameters = request.GetUrl().GetQueryParameters();
+  auto firstTry = nextPolicy.SendAsync(request, retryContext);
+
+  return std::async(
+      std::launch::deferred,
+      [this,
+       &request,
+       nextPolicy,
+       context,
+       retryContext,
+       retryCount,
+       firstTry = std::move(firstTry),
+       originalQueryParameters = std::move(originalQueryParameters)]() mutable {
+        return SendTries(
+            request,
+            nextPolicy,
+            context,
+            retryContext,
+            *retryCount,
+            std::move(firstTry),
+            std::move(originalQueryParameters));
+      });
+}
+
+std::unique_ptr<RawResponse> RetryPolicy::SendTries(
+    Request& request,
+    NextHttpPolicy& nextPolicy,
+    Context const& context,
+    Context const& retryContext,
+    int32_t& retryCount,
+    std::future<std::unique_ptr<RawResponse>> firstTry,
+    std::map<std::string, std::string> firstTryQueryParameters) const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
   for (int32_t attempt = 1;; ++attempt)
   {
     std::chrono::milliseconds retryAfter{};
-    request.StartTry();
+    // The first try may have been sent already, and firstTry is then the future of its response.
+    bool const isFirstTryPending = firstTry.valid();
+    if (!isFirstTryPending)
+    {
+      request.StartTry();
+    }
     // creates a copy of original query parameters from request
-    auto originalQueryParameters = request.GetUrl().GetQueryParameters();
+    auto originalQueryParameters = isFirstTryPending ? std::move(firstTryQueryParameters)
+                                                     : request.GetUrl().GetQueryParameters();
 
     try
     {
-      auto response = nextPolicy.Send(request, retryContext);
+      auto response
+          = isFirstTryPending ? firstTry.get() : nextPolicy.Send(request, retryContext);
 
       // If we are out of retry attempts, if a response is non-retriable (or simply 200 OK, i.e
       // doesn't need to be retried), then ShouldRetry returns false.
@@ -3,6 +3,8 @@
 
 #include "azure/core/http/policies/policy.hpp"
 
+#include <future>
+
 using Azure::Core::Context;
 using namespace Azure::Core::Http;
 using namespace Azure::Core::Http::Policies;
@@ -22,3 +24,19 @@ std::unique_ptr<RawResponse> Azure::Core::Http::Policies::_internal::TelemetryPo
 
   return nextPolicy.Send(request, context);
 }
+
+std::future<std::unique_ptr<RawResponse>>
+Azure::Core::Http::Policies::_internal::TelemetryPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  static std::string const UserAgent{"User-Agent"};
+
+  if (!request.GetHeader(UserAgent).HasValue())
+  {
+    request.SetHeader(UserAgent, m_telemetryId);
+  }
+
+  return nextPolicy.SendAsync(request, context);
+}
@@ -11,6 +11,8 @@
 #include "azure/core/http/win_http_transport.hpp"
 #endif
 
+#include <atomic>
+#include <future>
 #include <sstream>
 #include <string>
 
@@ -31,7 +33,7 @@ namespace Azure { namespace Core { namespace Http { namespace Policies { namespa
               || transportOptions.ProxyUserName.HasValue()
               || transportOptions.EnableCertificateRevocationListCheck
               || !transportOptions.ExpectedTlsRootCertificate.empty())
-          || transportOptions.DisableTlsCertificateValidation;
+          || transportOptions.DisableTlsCertificateValidation || transportOptions.EnableHttp2;
     }
   } // namespace
 
@@ -92,6 +94,96 @@ TransportPolicy::TransportPolicy(TransportOptions const& options) : m_options(op
   }
 }
 
+namespace {
+/**
+ * @brief Downloads the payload of \p response to its buffer, unless \p request reads the body of
+ * successful responses from the body stream.
+ */
+std::unique_ptr<RawResponse> BufferResponse(
+    Request const& request,
+    std::unique_ptr<RawResponse> response,
+    Context const& context)
+{
+  auto statusCode = static_cast<typename std::underlying_type<HttpStatusCode>::type>(
+      response->GetStatusCode());
+
+  // special case to return a response with BodyStream to read directly from socket
+  // Return only if response did not fail.
+  if (!request.ShouldBufferResponse() && statusCode < 300)
+  {
+    return response;
+  }
+
+  // At this point, either the request is `shouldBufferResponse` or it return with an error code.
+  // The entire payload needs must be downloaded to the response's buffer.
+  auto bodyStream = response->ExtractBodyStream();
+  response->SetBody(bodyStream->ReadToEnd(context));
+
+  // BodyStream is moved out of response. This makes transport implementation to clean any active
+  // session with sockets or internal state.
+  return response;
+}
+
+/**
+ * @brief A response being received by the transport. If the response is not taken, the
+ * destructor waits for it, so that the request isn't destroyed while the transport sends it.
+ */
+class PendingResponse final {
+public:
+  explicit PendingResponse(std::future<std::unique_ptr<RawResponse>> response)
+      : m_response(std::move(response))
+  {
+  }
+
+  PendingResponse(PendingResponse&& other) = default;
+
+  ~PendingResponse()
+  {
+    if (m_response.valid())
+    {
+      m_response.wait();
+    }
+  }
+
+  std::unique_ptr<RawResponse> Get() { return m_response.get(); }
+
+private:
+  std::future<std::unique_ptr<RawResponse>> m_response;
+};
+
+// The number of threads sending a request for HttpTransport::SendAsync, and its maximum. The
+// requests sent beyond it are sent by the thread waiting for their response.
+std::atomic<size_t> SendAsyncThreadCount{0};
+constexpr size_t MaxSendAsyncThreadCount = 64;
+} // namespace
+
+std::future<std::unique_ptr<RawResponse>> HttpTransport::SendAsync(
+    Request& request,
+    Context const& context)
+{
+  if (SendAsyncThreadCount.fetch_add(1) < MaxSendAsyncThreadCount)
+  {
+    try
+    {
+      return std::async(std::launch::async, [this, &request, context]() {
+        struct ThreadCountGuard final
+        {
+          ~ThreadCountGuard() { --SendAsyncThreadCount; }
+        } threadCountGuard;
+        return Send(request, context);
+      });
+    }
+    catch (...)
+    {
+      --SendAsyncThreadCount;
+      throw;
+    }
+  }
+  --SendAsyncThreadCount;
+  return std::async(
+      std::launch::deferred, [this, &request, context]() { return Send(request, context); });
+}
+
 std::unique_ptr<RawResponse> TransportPolicy::Send(
     Request& request,
     NextHttpPolicy,
@@ -118,22 +210,22 @@ std::unique_ptr<RawResponse> TransportPolicy::Send(
    *
    */
   auto response = m_options.Transport->Send(request, context);
-  auto statusCode = static_cast<typename std::underlying_type<Http::HttpStatusCode>::type>(
-      response->GetStatusCode());
-
-  // special case to return a response with BodyStream to read directly from socket
-  // Return only if response did not fail.
-  if (!request.ShouldBufferResponse() && statusCode < 300)
-  {
-    return response;
-  }
+  return BufferResponse(request, std::move(response), context);
+}
 
-  // At this point, either the request is `shouldBufferResponse` or it return with an error code.
-  // The entire payload needs must be downloaded to the response's buffer.
-  auto bodyStream = response->ExtractBodyStream();
-  response->SetBody(bodyStream->ReadToEnd(context));
+std::future<std::unique_ptr<RawResponse>> TransportPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy,
+    Context const& context) const
+{
+  // Before doing any work, check to make sure that the context hasn't already been cancelled.
+  context.ThrowIfCancelled();
 
-  // BodyStream is moved out of response. This makes transport implementation to clean any active
-  // session with sockets or internal state.
-  return response;
+  // The payload of the response is buffered, if needed, by the thread waiting for the future.
+  PendingResponse response(m_options.Transport->SendAsync(request, context));
+  return std::async(
+      std::launch::deferred,
+      [&request, context, response = std::move(response)]() mutable {
+        return BufferResponse(request, response.Get(), context);
+      });
 }
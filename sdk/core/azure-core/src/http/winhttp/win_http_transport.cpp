@@ -258,9 +258,7 @@ std::string GetHeadersAsString(Azure::Core::Http::Request const& request)
 {
   std::string requestHeaderString;
 
-  // request.GetHeaders() aggregates the pre- and post-retry headers into a single map. Capture it
-  // so we don't recalculate the merge multiple times.
-  auto requestHeaders = request.GetHeaders();
+  auto const requestHeaders = request.GetHeadersView();
 
   for (auto const& header : requestHeaders)
   {
@@ -849,6 +847,20 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
         sizeof(tls_false_start));
 #endif
 
+#if defined(WINHTTP_OPTION_ENABLE_HTTP_PROTOCOL)
+    if (m_options.EnableHttp2)
+    {
+      // WinHTTP multiplexes the requests of a session over HTTP/2 connections. Versions of
+      // Windows which don't support it keep using HTTP/1.1, so the error is ignored.
+      DWORD httpProtocols = WINHTTP_PROTOCOL_FLAG_HTTP2;
+      WinHttpSetOption(
+          sessionHandle.get(),
+          WINHTTP_OPTION_ENABLE_HTTP_PROTOCOL,
+          &httpProtocols,
+          sizeof(httpProtocols));
+    }
+#endif
+
     // Enforce TLS version 1.2 or 1.3 (if available).
     auto tlsOption = WINHTTP_FLAG_SECURE_PROTOCOL_TLS1_2;
 #if defined(WINHTTP_FLAG_SECURE_PROTOCOL_TLS1_3)
@@ -1171,6 +1183,7 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
         httpOptions.IgnoreUnknownCertificateAuthority = true;
         httpOptions.IgnoreInvalidCertificateCommonName = true;
       }
+      httpOptions.EnableHttp2 = transportOptions.EnableHttp2;
 
       return httpOptions;
     }
@@ -1503,7 +1516,7 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
     std::wstring encodedHeaders;
     int encodedHeadersLength = 0;
 
-    auto requestHeaders = request.GetHeaders();
+    auto const requestHeaders = request.GetHeadersView();
     if (requestHeaders.size() != 0)
     {
       // The encodedHeaders will be null-terminated and the length is calculated.
@@ -22,12 +22,14 @@
 #include "azure/core/context.hpp"
 #include "azure/core/internal/io/null_body_stream.hpp"
 #include "azure/core/io/body_stream.hpp"
+#include "../private/buffer_pool.hpp"
 
 #include <algorithm>
 #include <codecvt>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -63,19 +65,36 @@ size_t BodyStream::ReadToCount(uint8_t* buffer, size_t count, Context const& con
 std::vector<uint8_t> BodyStream::ReadToEnd(Context const& context)
 {
   constexpr size_t chunkSize = 1024 * 8;
-  auto buffer = std::vector<uint8_t>();
 
-  for (auto chunkNumber = 0;; chunkNumber++)
+  // When the length is known, the buffer is sized for it up front. Otherwise it doubles as needed.
+  // Once the buffer is full, a single byte is read to find whether the stream ends there before
+  // growing the buffer, so a body of exactly the pooled size fits in the pooled buffer.
+  const int64_t length = this->Length();
+  size_t capacity = chunkSize;
+  if (length >= 0 && static_cast<uint64_t>(length) <= (std::numeric_limits<size_t>::max)())
   {
-    buffer.resize((static_cast<decltype(buffer)::size_type>(chunkNumber) + 1) * chunkSize);
-    size_t readBytes
-        = this->ReadToCount(buffer.data() + (chunkNumber * chunkSize), chunkSize, context);
+    capacity = static_cast<size_t>(length);
+  }
+  auto buffer = _detail::BufferPool::Acquire(capacity);
 
-    if (readBytes < chunkSize)
+  size_t size = 0;
+  for (;;)
+  {
+    buffer.resize(capacity);
+    size += this->ReadToCount(buffer.data() + size, capacity - size, context);
+    if (size < capacity)
+    {
+      buffer.resize(size);
+      return buffer;
+    }
+    uint8_t next = 0;
+    if (this->ReadToCount(&next, 1, context) == 0)
     {
-      buffer.resize(static_cast<size_t>((chunkNumber * chunkSize) + readBytes));
       return buffer;
     }
+    capacity = (std::max)(capacity * 2, chunkSize);
+    buffer.resize(capacity);
+    buffer[size++] = next;
   }
 }
 
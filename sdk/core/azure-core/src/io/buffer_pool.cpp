@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../private/buffer_pool.hpp"
+
+#include <array>
+#include <mutex>
+
+using namespace Azure::Core::IO::_detail;
+
+namespace {
+constexpr size_t MinClassSize = 4 * 1024;
+constexpr size_t ClassCount = 9; // 4 KiB to 1 MiB.
+constexpr size_t MaxBuffersPerClass = 16;
+constexpr size_t MaxPooledBytes = 8 * 1024 * 1024;
+
+struct Pool final
+{
+  std::mutex Mutex;
+  std::array<std::vector<std::vector<uint8_t>>, ClassCount> Classes;
+  size_t PooledBytes = 0;
+
+  // Release is called from destructors, so adding a buffer to a class must not allocate.
+  Pool()
+  {
+    for (auto& buffers : Classes)
+    {
+      buffers.reserve(MaxBuffersPerClass);
+    }
+  }
+};
+
+// The pool is never destroyed, so that responses destroyed during static destruction can still
+// release their body.
+Pool& GetPool()
+{
+  static Pool* pool = new Pool();
+  return *pool;
+}
+
+// The smallest class whose buffers hold size bytes, or ClassCount if none does.
+size_t ClassToAcquire(size_t size)
+{
+  size_t index = 0;
+  while (index < ClassCount && (MinClassSize << index) < size)
+  {
+    ++index;
+  }
+  return index;
+}
+
+// The largest class whose size a buffer of the capacity holds, or ClassCount if the capacity is
+// too small or too large to be pooled.
+size_t ClassToRelease(size_t capacity)
+{
+  if (capacity < MinClassSize || capacity >= (MinClassSize << ClassCount))
+  {
+    return ClassCount;
+  }
+  size_t index = 0;
+  while (index + 1 < ClassCount && (MinClassSize << (index + 1)) <= capacity)
+  {
+    ++index;
+  }
+  return index;
+}
+} // namespace
+
+std::vector<uint8_t> BufferPool::Acquire(size_t size)
+{
+  std::vector<uint8_t> buffer;
+  const size_t index = ClassToAcquire(size);
+  if (size == 0 || index == ClassCount)
+  {
+    buffer.reserve(size);
+    return buffer;
+  }
+
+  {
+    auto& pool = GetPool();
+    std::lock_guard<std::mutex> lock(pool.Mutex);
+    auto& buffers = pool.Classes[index];
+    if (!buffers.empty())
+    {
+      buffer = std::move(buffers.back());
+      buffers.pop_back();
+      pool.PooledBytes -= buffer.capacity();
+      return buffer;
+    }
+  }
+  // Round up to the class size, so that the buffer goes back to this class when released.
+  buffer.reserve(MinClassSize << index);
+  return buffer;
+}
+
+void BufferPool::Release(std::vector<uint8_t>&& buffer)
+{
+  const size_t index = ClassToRelease(buffer.capacity());
+  if (index == ClassCount)
+  {
+    return;
+  }
+
+  auto& pool = GetPool();
+  std::lock_guard<std::mutex> lock(pool.Mutex);
+  auto& buffers = pool.Classes[index];
+  if (buffers.size() < MaxBuffersPerClass
+      && pool.PooledBytes + buffer.capacity() <= MaxPooledBytes)
+  {
+    buffer.clear();
+    pool.PooledBytes += buffer.capacity();
+    buffers.push_back(std::move(buffer));
+  }
+}
+
+size_t BufferPool::GetPooledBytes()
+{
+  auto& pool = GetPool();
+  std::lock_guard<std::mutex> lock(pool.Mutex);
+  return pool.PooledBytes;
+}
+
+void BufferPool::Clear()
+{
+  auto& pool = GetPool();
+  std::lock_guard<std::mutex> lock(pool.Mutex);
+  for (auto& buffers : pool.Classes)
+  {
+    buffers.clear();
+  }
+  pool.PooledBytes = 0;
+}
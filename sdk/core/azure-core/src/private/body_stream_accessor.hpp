@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/core/io/body_stream.hpp"
+#include "azure/core/platform.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Azure { namespace Core { namespace IO { namespace _detail {
+
+  /**
+   * @brief Gives the transport adapters access to the content of the memory and file body
+   * streams, so that they can send it without reading it into a buffer.
+   */
+  class BodyStreamAccessor final {
+  public:
+    /**
+     * @brief Returns the bytes of \p stream which aren't read yet.
+     */
+    static std::pair<uint8_t const*, size_t> GetUnreadBytes(MemoryBodyStream const& stream)
+    {
+      return {stream.m_data + stream.m_offset, stream.m_length - stream.m_offset};
+    }
+
+    /**
+     * @brief Marks the content of \p stream as read, once it's sent.
+     */
+    static void SetFullyRead(MemoryBodyStream& stream) { stream.m_offset = stream.m_length; }
+
+    /**
+     * @brief Returns the stream reading the file of \p stream.
+     */
+    static _internal::RandomAccessFileBodyStream& GetFileStream(FileBodyStream& stream)
+    {
+      return *stream.m_randomAccessFileBodyStream;
+    }
+
+#if defined(AZ_PLATFORM_POSIX)
+    /**
+     * @brief Returns the descriptor of the file read by \p stream.
+     */
+    static int GetFileDescriptor(_internal::RandomAccessFileBodyStream const& stream)
+    {
+      return stream.m_fileDescriptor;
+    }
+#endif
+
+    /**
+     * @brief Returns the offset in the file of the first byte of \p stream which isn't read yet,
+     * and the number of bytes which aren't read yet.
+     */
+    static std::pair<int64_t, int64_t> GetUnreadRange(
+        _internal::RandomAccessFileBodyStream const& stream)
+    {
+      return {stream.m_baseOffset + stream.m_offset, stream.m_length - stream.m_offset};
+    }
+
+    /**
+     * @brief Marks the content of \p stream as read, once it's sent.
+     */
+    static void SetFullyRead(_internal::RandomAccessFileBodyStream& stream)
+    {
+      stream.m_offset = stream.m_length;
+    }
+  };
+}}}} // namespace Azure::Core::IO::_detail
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Azure { namespace Core { namespace IO { namespace _detail {
+
+  /**
+   * @brief A process-wide pool of byte buffers, kept by power-of-two size class from 4 KiB to
+   * 1 MiB, so that buffering response bodies doesn't allocate and free memory for each response.
+   */
+  class BufferPool final {
+    BufferPool() = delete;
+    ~BufferPool() = delete;
+
+  public:
+    /**
+     * @brief Returns an empty buffer with a capacity of at least \p size bytes, taken from the pool
+     * when it has one.
+     */
+    static std::vector<uint8_t> Acquire(size_t size);
+
+    /**
+     * @brief Keeps the memory of \p buffer for a later #Acquire, unless its size isn't pooled or the
+     * pool is full.
+     */
+    static void Release(std::vector<uint8_t>&& buffer);
+
+    /**
+     * @brief Returns the number of bytes kept by the pool.
+     */
+    static size_t GetPooledBytes();
+
+    /**
+     * @brief Frees the buffers kept by the pool.
+     */
+    static void Clear();
+  };
+
+}}}} // namespace Azure::Core::IO::_detail
@@ -20,6 +20,7 @@
 #endif
 
 #include <memory>
+#include <mutex>
 
 namespace Azure { namespace Core { namespace Test {
 
@@ -54,16 +55,9 @@ namespace Azure { namespace Core { namespace Test {
       auto body = response->ExtractBodyStream()->ReadToEnd();
     }
 
-  public:
-    /**
-     * @brief Construct a new HTTPTransportTest test.
-     *
-     * @param options The test options.
-     */
-    HTTPTransportTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
-
-    void Setup() override
+    std::shared_ptr<Azure::Core::Http::HttpTransport> CreateTransport()
     {
+      bool const enableHttp2 = m_options.GetOptionOrDefault<bool>("Http2", false);
 #if defined(BUILD_TRANSPORT_WINHTTP_ADAPTER)
       if ("winhttp" == m_options.GetMandatoryOption<std::string>("Transport"))
       {
@@ -71,7 +65,8 @@ namespace Azure { namespace Core { namespace Test {
         Azure::Core::Http::WinHttpTransportOptions transportOptions;
         transportOptions.IgnoreInvalidCertificateCommonName = true;
         transportOptions.IgnoreUnknownCertificateAuthority = true;
-        m_transport = std::make_shared<Azure::Core::Http::WinHttpTransport>(transportOptions);
+        transportOptions.EnableHttp2 = enableHttp2;
+        return std::make_shared<Azure::Core::Http::WinHttpTransport>(transportOptions);
       }
 #endif
 #if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
@@ -80,13 +75,50 @@ namespace Azure { namespace Core { namespace Test {
 
         Azure::Core::Http::CurlTransportOptions transportOptions;
         transportOptions.SslVerifyPeer = false;
-        m_transport = std::make_shared<Azure::Core::Http::CurlTransport>(transportOptions);
+        transportOptions.EnableHttp2 = enableHttp2;
+        return std::make_shared<Azure::Core::Http::CurlTransport>(transportOptions);
       }
 #endif
+      (void)enableHttp2;
+      return nullptr;
+    }
+
+  public:
+    /**
+     * @brief Construct a new HTTPTransportTest test.
+     *
+     * @param options The test options.
+     */
+    HTTPTransportTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    void Setup() override
+    {
+      if (m_options.GetOptionOrDefault<bool>("Http2", false))
+      {
+        // The parallel tests share one transport, so their requests can be multiplexed over the
+        // same connections.
+        static std::mutex sharedTransportMutex;
+        static std::shared_ptr<Azure::Core::Http::HttpTransport> sharedTransport;
+        std::lock_guard<std::mutex> lock(sharedTransportMutex);
+        if (!sharedTransport)
+        {
+          sharedTransport = CreateTransport();
+        }
+        m_transport = sharedTransport;
+      }
+      else
+      {
+        m_transport = CreateTransport();
+      }
       m_httpMethod
           = Azure::Core::Http::HttpMethod(m_options.GetMandatoryOption<std::string>("Method"));
 
-      if (m_httpMethod == Azure::Core::Http::HttpMethod::Get)
+      auto const url = m_options.GetOptionOrDefault<std::string>("Url", "");
+      if (!url.empty())
+      {
+        m_target = url;
+      }
+      else if (m_httpMethod == Azure::Core::Http::HttpMethod::Get)
       {
         m_target = GetTestProxy() + "/Admin/isAlive";
       }
@@ -128,7 +160,13 @@ namespace Azure { namespace Core { namespace Test {
     {
       return {
           {"Method", {"--method"}, "The HTTP method e.g. GET, POST etc.", 1, true},
-          {"Transport", {"--transport"}, "The HTTP Transport curl/winhttp.", 1, true}};
+          {"Transport", {"--transport"}, "The HTTP Transport curl/winhttp.", 1, true},
+          {"Url", {"--url"}, "The URL to send the requests to, instead of the test proxy.", 1, false},
+          {"Http2",
+           {"--http2"},
+           "Whether to use HTTP/2, with one transport shared by the parallel tests.",
+           1,
+           false}};
     }
 
     /**
@@ -16,7 +16,11 @@
 #include <azure/core/internal/http/pipeline.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
 #include <memory>
+#include <string>
 using namespace Azure::Core;
 using namespace Azure::Core::_internal;
 using namespace Azure::Core::Http;
@@ -26,6 +30,12 @@ using namespace Azure::Core::Http::Policies::_internal;
 
 namespace Azure { namespace Core { namespace Test {
 
+  /**
+   * @brief Get the number of allocations made by the current thread, counted by the perf program.
+   *
+   */
+  uint64_t GetThreadAllocationCount();
+
   class TestPolicy : public HttpPolicy {
 
   public:
@@ -43,11 +53,30 @@ namespace Azure { namespace Core { namespace Test {
     };
   };
 
+  // Answers every request without sending it, so that only the pipeline is measured.
+  class InMemoryTransport final : public HttpTransport {
+  public:
+    std::unique_ptr<RawResponse> Send(Request&, Context const&) override
+    {
+      auto response = std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+      response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(nullptr, 0));
+      return response;
+    }
+  };
+
   /**
    * @brief Measure the http pipeline / policies performance.
+   *
+   * @details The number of allocations per request is reported at the end of the test.
    */
   class PipelineTest : public Azure::Perf::PerfTest {
     std::unique_ptr<HttpPipeline> m_pipeline;
+    int m_headers = 0;
+    uint64_t m_requests = 0;
+    uint64_t m_allocations = 0;
+
+    static std::atomic<uint64_t> g_requests;
+    static std::atomic<uint64_t> g_allocations;
 
   public:
     /**
@@ -118,8 +147,39 @@ namespace Azure { namespace Core { namespace Test {
         }
       }
 
+      ClientOptions clientOptions;
+      if (m_options.GetOptionOrDefault<bool>("InMemory", false))
+      {
+        clientOptions.Transport.Transport = std::make_shared<InMemoryTransport>();
+      }
+      m_headers = m_options.GetOptionOrDefault<int>("Headers", 0);
+
       m_pipeline = std::make_unique<HttpPipeline>(
-          ClientOptions(), packageName, packageVersion, std::move(policies), std::move(policies2));
+          clientOptions, packageName, packageVersion, std::move(policies), std::move(policies2));
+    }
+
+    /**
+     * @brief Add the requests and allocations of this test to the totals.
+     *
+     */
+    void Cleanup() override
+    {
+      g_requests += m_requests;
+      g_allocations += m_allocations;
+    }
+
+    /**
+     * @brief Report the allocations per request.
+     *
+     */
+    void GlobalCleanup() override
+    {
+      if (g_requests != 0)
+      {
+        std::cout << "Allocations per request: "
+                  << static_cast<double>(g_allocations) / static_cast<double>(g_requests)
+                  << std::endl;
+      }
     }
 
     /**
@@ -128,10 +188,15 @@ namespace Azure { namespace Core { namespace Test {
      */
     void Run(Context const&) override
     {
+      auto const allocations = GetThreadAllocationCount();
       try
       {
         Azure::Core::Http::Request request(
             HttpMethod::Get, Url("http://127.0.0.1:5000/admin/isalive"));
+        for (int i = 0; i < m_headers; ++i)
+        {
+          request.SetHeader("x-ms-test-header-" + std::to_string(i), "value");
+        }
         Context context;
         m_pipeline->Send(request, context);
       }
@@ -139,6 +204,8 @@ namespace Azure { namespace Core { namespace Test {
       {
         // don't print exceptions, they are happening at each request, this is the point of the test
       }
+      m_allocations += GetThreadAllocationCount() - allocations;
+      ++m_requests;
     }
 
     /**
@@ -156,6 +223,16 @@ namespace Azure { namespace Core { namespace Test {
            "default:TestPolicy \n others: "
            "RetryPolicy,RequestIdPolicy,RequestActivityPolicy,TelemetryPolicy,LogPolicy",
            1,
+           false},
+          {"Headers",
+           {"--headers"},
+           "The number of headers set on each request, besides the ones set by the pipeline.",
+           1,
+           false},
+          {"InMemory",
+           {"--in-memory"},
+           "Answer the requests in memory instead of sending them.",
+           1,
            false}};
     }
 
@@ -175,4 +252,7 @@ namespace Azure { namespace Core { namespace Test {
     }
   };
 
+  std::atomic<uint64_t> PipelineTest::g_requests{0};
+  std::atomic<uint64_t> PipelineTest::g_allocations{0};
+
 }}} // namespace Azure::Core::Test
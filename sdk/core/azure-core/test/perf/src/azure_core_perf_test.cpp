@@ -13,8 +13,32 @@
 
 #include <azure/perf.hpp>
 
+#include <cstdint>
+#include <cstdlib>
+#include <new>
 #include <vector>
 
+namespace {
+thread_local uint64_t ThreadAllocationCount = 0;
+} // namespace
+
+// Count the allocations, so that the tests can report how many allocations an operation makes.
+void* operator new(std::size_t size)
+{
+  ++ThreadAllocationCount;
+  if (auto pointer = std::malloc(size == 0 ? 1 : size))
+  {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+uint64_t Azure::Core::Test::GetThreadAllocationCount() { return ThreadAllocationCount; }
+
 int main(int argc, char** argv)
 {
 
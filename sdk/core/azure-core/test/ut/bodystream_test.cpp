@@ -17,9 +17,13 @@
 #include <windows.h>
 #endif
 
+#include <azure/core/http/raw_response.hpp>
 #include <azure/core/io/body_stream.hpp>
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
+#include <private/buffer_pool.hpp>
 
 using namespace Azure::Core::IO;
 using namespace Azure::Core;
@@ -30,6 +34,28 @@ class TestBodyStream final : public BodyStream {
   int64_t Length() const override { return 0; }
 };
 
+// Returns the content in small reads and reports the given length, which may be wrong or unknown.
+class LengthBodyStream final : public BodyStream {
+  std::vector<uint8_t> m_content;
+  int64_t m_length;
+  size_t m_offset = 0;
+
+  size_t OnRead(uint8_t* buffer, size_t count, Context const&) override
+  {
+    count = (std::min)({count, size_t(1000), m_content.size() - m_offset});
+    std::copy(m_content.begin() + m_offset, m_content.begin() + m_offset + count, buffer);
+    m_offset += count;
+    return count;
+  }
+
+public:
+  LengthBodyStream(std::vector<uint8_t> content, int64_t length)
+      : m_content(std::move(content)), m_length(length)
+  {
+  }
+  int64_t Length() const override { return m_length; }
+};
+
 TEST(BodyStream, Rewind)
 {
   TestBodyStream tb;
@@ -268,3 +294,70 @@ TEST(ProgressBodyStream, ReadMultipleChunksRewind)
     EXPECT_EQ(readSize, 10);
   }
 }
+
+TEST(BodyStream, ReadToEndLength)
+{
+  for (size_t size : {size_t(0), size_t(1), size_t(4096), size_t(8192), size_t(100000)})
+  {
+    std::vector<uint8_t> content(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      content[i] = static_cast<uint8_t>(i * 7);
+    }
+    const auto length = static_cast<int64_t>(size);
+    for (int64_t reportedLength : {length, length / 2, length * 2 + 10, int64_t(-1)})
+    {
+      LengthBodyStream stream(content, reportedLength);
+      EXPECT_EQ(stream.ReadToEnd(Context{}), content) << size << " " << reportedLength;
+    }
+  }
+}
+
+TEST(BodyStream, BufferPool)
+{
+  using Azure::Core::IO::_detail::BufferPool;
+  BufferPool::Clear();
+
+  auto buffer = BufferPool::Acquire(5000);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_GE(buffer.capacity(), 8192U);
+  buffer.resize(5000);
+  const auto data = buffer.data();
+  const auto capacity = buffer.capacity();
+  BufferPool::Release(std::move(buffer));
+  EXPECT_EQ(BufferPool::GetPooledBytes(), capacity);
+
+  // The memory is reused for a buffer of the same size class.
+  auto reused = BufferPool::Acquire(6000);
+  EXPECT_EQ(reused.data(), data);
+  EXPECT_TRUE(reused.empty());
+  EXPECT_EQ(BufferPool::GetPooledBytes(), 0U);
+
+  // Buffers too small or too large aren't kept.
+  std::vector<uint8_t> small(100);
+  BufferPool::Release(std::move(small));
+  std::vector<uint8_t> large(4 * 1024 * 1024);
+  BufferPool::Release(std::move(large));
+  EXPECT_EQ(BufferPool::GetPooledBytes(), 0U);
+
+  // Responses give the memory of their body back to the pool.
+  {
+    Azure::Core::Http::RawResponse response(1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+    response.SetBody(std::move(reused));
+  }
+  EXPECT_EQ(BufferPool::GetPooledBytes(), capacity);
+  LengthBodyStream stream(std::vector<uint8_t>(6000, 'a'), 6000);
+  auto body = stream.ReadToEnd(Context{});
+  EXPECT_EQ(body.data(), data);
+  EXPECT_EQ(body, std::vector<uint8_t>(6000, 'a'));
+
+  // A body of exactly the size of a class fits in a buffer of that class.
+  BufferPool::Release(std::move(body));
+  LengthBodyStream exactStream(std::vector<uint8_t>(capacity, 'b'), static_cast<int64_t>(capacity));
+  auto exactBody = exactStream.ReadToEnd(Context{});
+  EXPECT_EQ(exactBody.data(), data);
+  EXPECT_EQ(exactBody.capacity(), capacity);
+  EXPECT_EQ(exactBody, std::vector<uint8_t>(capacity, 'b'));
+
+  BufferPool::Clear();
+}
@@ -45,11 +45,9 @@ namespace Azure { namespace Core { namespace Test {
     TEST(CurlConnectionPool, connectionPoolTest)
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there are nothing in the pool
-        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size(), 0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
       }
 
       // Use the same request for all connections.
@@ -77,18 +75,13 @@ namespace Azure { namespace Core { namespace Test {
       }
       // Check that after the connection is gone, it is moved back to the pool
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
             1);
-        auto connectionFromPool
-            = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.begin()
-                  ->second.begin()
-                  ->get();
-        EXPECT_EQ(connectionFromPool->GetConnectionKey(), expectedConnectionKey);
       }
 
       // Test that asking a connection with same config will re-use the same connection
@@ -100,8 +93,7 @@ namespace Azure { namespace Core { namespace Test {
 
         // There was just one connection in the pool, it should be empty now
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
         // And the connection key for the connection we got is the expected
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
@@ -114,17 +106,14 @@ namespace Azure { namespace Core { namespace Test {
         session->m_httpKeepAlive = true;
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check that after the connection is gone, it is moved back to the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
             1);
-        auto values = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                          .ConnectionPoolIndex.begin();
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), expectedConnectionKey);
       }
 
       // Now test that using a different connection config won't re-use the same connection
@@ -141,16 +130,12 @@ namespace Azure { namespace Core { namespace Test {
         // One connection still in the pool after getting a new connection and with first expected
         // key
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            expectedConnectionKey);
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
 
         auto session
             = std::make_unique<Azure::Core::Http::CurlSession>(req, std::move(connection), options);
@@ -162,28 +147,18 @@ namespace Azure { namespace Core { namespace Test {
 
       // Now there should be 2 index wit one connection each
       EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
+          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
           2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        for (auto& val : Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                             .ConnectionPoolIndex)
-        {
-          EXPECT_EQ(val.second.size(), 1);
-        }
         // The connection pool should have the two connections we added earlier.
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(expectedConnectionKey));
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(secondExpectedKey));
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
       }
 
       {
@@ -206,16 +181,12 @@ namespace Azure { namespace Core { namespace Test {
         // One connection still in the pool after getting a new connection and with first expected
         // key
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            secondExpectedKey);
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
 
         auto session
             = std::make_unique<Azure::Core::Http::CurlSession>(req, std::move(connection), options);
@@ -226,45 +197,30 @@ namespace Azure { namespace Core { namespace Test {
       }
       // Now there should be 2 index wit one connection each
       EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
+          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
           2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        for (auto& val : Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                             .ConnectionPoolIndex)
-        {
-          EXPECT_EQ(val.second.size(), 1);
-        }
         // The connection pool should have the two connections we added earlier.
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(expectedConnectionKey));
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(secondExpectedKey));
-      }
-      {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
+      }
+      {
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
       }
 
 #ifdef RUN_LONG_UNIT_TESTS
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
       }
 
@@ -291,16 +247,12 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
         EXPECT_EQ(
             Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                .ConnectionPoolIndex[expectedConnectionKey]
-                .size(),
+                .ConnectionsOnPool(expectedConnectionKey),
             5);
       }
 
@@ -318,10 +270,8 @@ namespace Azure { namespace Core { namespace Test {
           std::this_thread::sleep_for(10ms);
           // If test wakes while clean pool is running, it will wait until lock is released by
           // the clean pool thread.
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           poolIsEmpty = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                            .ConnectionPoolIndex.size()
+                            .IndexCount()
               == 0;
         }
         EXPECT_TRUE(poolIsEmpty);
@@ -339,7 +289,7 @@ namespace Azure { namespace Core { namespace Test {
       //       std::lock_guard<std::mutex> lock(
       //           CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
       //       // clean the pool
-      //       CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+      //       CurlConnectionPool::g_curlConnectionPool.Clear();
       //     }
 
       //     std::string hostKey("key");
@@ -396,7 +346,7 @@ namespace Azure { namespace Core { namespace Test {
 
       //       EXPECT_EQ(
       //           Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-      //               .ConnectionPoolIndex.size(),
+      //               .IndexCount(),
       //           2);
       //       EXPECT_EQ(
       //           Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
@@ -414,7 +364,7 @@ namespace Azure { namespace Core { namespace Test {
       //       std::lock_guard<std::mutex> lock(
       //           CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
       //       // clean the pool
-      //       CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+      //       CurlConnectionPool::g_curlConnectionPool.Clear();
       //     }
       //   }
     }
@@ -422,14 +372,10 @@ namespace Azure { namespace Core { namespace Test {
     TEST(CurlConnectionPool, uniquePort)
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there is nothing in the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
       }
 
@@ -448,11 +394,8 @@ namespace Azure { namespace Core { namespace Test {
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               0);
           EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         }
@@ -462,12 +405,9 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Test connection was moved to the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
       }
 
@@ -487,12 +427,9 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               1);
         }
         // move connection back to the pool
@@ -500,12 +437,9 @@ namespace Azure { namespace Core { namespace Test {
             .MoveConnectionBackToPool(std::move(connection), true);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check 2 connections in the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             2);
       }
 
@@ -525,11 +459,8 @@ namespace Azure { namespace Core { namespace Test {
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               1);
         }
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
@@ -540,11 +471,8 @@ namespace Azure { namespace Core { namespace Test {
 
       {
         // Make sure there is nothing in the pool
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             2);
       }
       {
@@ -563,12 +491,9 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               1);
         }
         // move connection back to the pool
@@ -576,14 +501,10 @@ namespace Azure { namespace Core { namespace Test {
             .MoveConnectionBackToPool(std::move(connection), true);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             2);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
       }
     }
 
@@ -635,11 +556,9 @@ namespace Azure { namespace Core { namespace Test {
       /// When getting the header connection: close from an HTTP response, the connection should not
       /// be moved back to the pool.
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there are nothing in the pool
-        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size(), 0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
       }
 
       // Use the same request for all connections.
@@ -662,13 +581,113 @@ namespace Azure { namespace Core { namespace Test {
 
       // Check that after the connection is gone, it is moved back to the pool
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
       }
     }
+
+    TEST(CurlConnectionPool, warmUpConnections)
+    {
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+      std::string const expectedConnectionKey(CreateConnectionKey(
+          AzureSdkHttpbinServer::Schema(),
+          AzureSdkHttpbinServer::Host(),
+          ",0,0,0,0,0,1,1,0,0,0,0"));
+
+      Azure::Core::Http::CurlTransport transport;
+      EXPECT_EQ(transport.WarmUpConnections(Azure::Core::Url(AzureSdkHttpbinServer::Get()), 2), 2);
+      EXPECT_EQ(
+          CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 2);
+
+      // The request re-uses one of the connections opened ahead of time.
+      auto const metricsBefore = Azure::Core::Http::CurlTransport::GetConnectionPoolMetrics();
+      {
+        Azure::Core::Http::Request req(
+            Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(AzureSdkHttpbinServer::Get()));
+        auto response = transport.Send(req, Azure::Core::Context{});
+        EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+      }
+      auto const metrics = Azure::Core::Http::CurlTransport::GetConnectionPoolMetrics();
+      EXPECT_EQ(metrics.Hits - metricsBefore.Hits, 1);
+      EXPECT_EQ(metrics.Misses - metricsBefore.Misses, 0);
+
+      // Connections to a host that can't be reached are not counted.
+      EXPECT_EQ(transport.WarmUpConnections(Azure::Core::Url("http://localhost:1"), 2), 0);
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+    }
+
+    TEST(CurlConnectionPool, perHostLimits)
+    {
+      using ::testing::_;
+      using ::testing::Return;
+      using ::testing::ReturnRef;
+
+      auto& pool = CurlConnectionPool::g_curlConnectionPool;
+      pool.Clear();
+      auto const metricsBefore = Azure::Core::Http::CurlTransport::GetConnectionPoolMetrics();
+
+      Azure::Core::Http::Request req(
+          Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost"));
+      std::string const connectionKey(
+          CreateConnectionKey("http", "localhost", ",0,0,0,0,0,1,1,0,0,0,0"));
+
+      // Move 3 connections to a pool limited to 2 idle connections. The least recently used
+      // connection is evicted.
+      for (size_t count = 0; count < 3; count++)
+      {
+        auto curlMock = std::make_unique<MockCurlNetworkConnection>();
+        EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+        EXPECT_CALL(*curlMock, UpdateLastUsageTime()).WillRepeatedly(Return());
+        EXPECT_CALL(*curlMock, IsExpired()).WillRepeatedly(Return(false));
+        EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _)).WillRepeatedly(Return(count));
+        EXPECT_CALL(*curlMock, DestructObj());
+
+        pool.MoveConnectionBackToPool(std::move(curlMock), true, 2);
+      }
+      EXPECT_EQ(pool.ConnectionsOnPool(connectionKey), 2);
+      auto metrics = Azure::Core::Http::CurlTransport::GetConnectionPoolMetrics();
+      EXPECT_EQ(metrics.Evictions - metricsBefore.Evictions, 1);
+      EXPECT_EQ(metrics.IdleConnections, 2);
+
+      // Simulate a connection opened by the pool, so the host is at its connection limit.
+      Azure::Core::Http::CurlTransportOptions options;
+      options.MaxConnectionsPerHost = 1;
+      {
+        auto& shard = pool.GetShard(connectionKey);
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        shard.OpenConnections[connectionKey] = 1;
+      }
+
+      // The connections in the pool are still re-used, the most recently used one first.
+      {
+        auto connection = pool.ExtractOrCreateCurlConnection(req, options);
+        EXPECT_EQ(connection->ReadFromSocket(nullptr, 0, Context{}), 2);
+        connection = pool.ExtractOrCreateCurlConnection(req, options);
+        EXPECT_EQ(connection->ReadFromSocket(nullptr, 0, Context{}), 1);
+      }
+      metrics = Azure::Core::Http::CurlTransport::GetConnectionPoolMetrics();
+      EXPECT_EQ(metrics.Hits - metricsBefore.Hits, 2);
+      EXPECT_EQ(metrics.Misses - metricsBefore.Misses, 0);
+      EXPECT_EQ(metrics.IdleConnections, 0);
+
+      // Once the pool is empty, getting a connection waits for another one to be released.
+      auto cancelled = Azure::Core::Context{}.WithDeadline(
+          std::chrono::system_clock::now() - std::chrono::seconds(1));
+      EXPECT_THROW(
+          pool.ExtractOrCreateCurlConnection(req, options, false, cancelled),
+          Azure::Core::OperationCancelledException);
+      metrics = Azure::Core::Http::CurlTransport::GetConnectionPoolMetrics();
+      EXPECT_GT(metrics.WaitTime, metricsBefore.WaitTime);
+      EXPECT_EQ(metrics.Misses - metricsBefore.Misses, 0);
+
+      pool.ReleaseConnection(connectionKey);
+      {
+        auto& shard = pool.GetShard(connectionKey);
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        EXPECT_EQ(shard.OpenConnections.count(connectionKey), 0);
+      }
+    }
 #endif
 }}} // namespace Azure::Core::Test
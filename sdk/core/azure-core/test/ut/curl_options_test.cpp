@@ -18,6 +18,7 @@
 
 #include "transport_adapter_base_test.hpp"
 
+#include <future>
 #include <string>
 #include <vector>
 
@@ -93,8 +94,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
   }
 
   class CurlDerived : public Azure::Core::Http::CurlTransport {
@@ -231,8 +231,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
   }
 
   TEST(CurlTransportOptions, setCADirectory)
@@ -275,8 +274,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
 #else
     EXPECT_THROW(
         pipeline.Send(request, Azure::Core::Context{}), Azure::Core::Http::TransportException);
@@ -323,8 +321,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
   }
 
   TEST(CurlTransportOptions, disableKeepAlive)
@@ -360,8 +357,7 @@ namespace Azure { namespace Core { namespace Test {
     }
     // Make sure there are no connections in the pool
     EXPECT_EQ(
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .size(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
         0);
   }
 
@@ -398,8 +394,74 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
+  }
+
+  TEST(CurlTransportOptions, eventLoopCancelledContext)
+  {
+    Azure::Core::Http::CurlTransportOptions curlOptions;
+    curlOptions.EventLoopThreadCount = 2;
+    Azure::Core::Http::CurlTransport transport(curlOptions);
+
+    Azure::Core::Url url(AzureSdkHttpbinServer::Get());
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    auto context = Azure::Core::Context{}.WithDeadline(
+        std::chrono::system_clock::now() - std::chrono::seconds(1));
+    EXPECT_THROW(transport.Send(request, context), Azure::Core::OperationCancelledException);
+  }
+
+  TEST(CurlTransportOptions, eventLoopConnectionRefused)
+  {
+    Azure::Core::Http::CurlTransportOptions curlOptions;
+    curlOptions.EventLoopThreadCount = 1;
+    Azure::Core::Http::CurlTransport transport(curlOptions);
+
+    // Nothing is expected to listen on the port 1 of the local host.
+    Azure::Core::Url url("http://127.0.0.1:1/");
+    std::vector<Azure::Core::Http::Request> requests(
+        4, Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url));
+    std::vector<std::future<std::unique_ptr<Azure::Core::Http::RawResponse>>> responses;
+    for (auto& request : requests)
+    {
+      responses.emplace_back(transport.SendAsync(request, Azure::Core::Context{}));
+    }
+    for (auto& response : responses)
+    {
+      EXPECT_THROW(response.get(), Azure::Core::Http::TransportException);
+    }
+  }
+
+  TEST(CurlTransportOptions, http2)
+  {
+    Azure::Core::Http::CurlTransportOptions curlOptions;
+    curlOptions.EnableHttp2 = true;
+    Azure::Core::Http::CurlTransport transport(curlOptions);
+
+    // HTTP/2 is only negotiated when libcurl supports it.
+    bool const isHttp2Supported
+        = (curl_version_info(CURLVERSION_NOW)->features & CURL_VERSION_HTTP2) != 0;
+
+    // The requests are sent at the same time so they can share a connection.
+    Azure::Core::Url url(AzureSdkHttpbinServer::Get());
+    std::vector<Azure::Core::Http::Request> requests(
+        4, Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url));
+    std::vector<std::future<std::unique_ptr<Azure::Core::Http::RawResponse>>> responses;
+    for (auto& request : requests)
+    {
+      responses.emplace_back(transport.SendAsync(request, Azure::Core::Context{}));
+    }
+    for (auto& response : responses)
+    {
+      auto rawResponse = response.get();
+      EXPECT_EQ(
+          static_cast<typename std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+              rawResponse->GetStatusCode()),
+          static_cast<typename std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+              Azure::Core::Http::HttpStatusCode::Ok));
+      EXPECT_EQ(rawResponse->GetMajorVersion(), isHttp2Supported ? 2 : 1);
+      EXPECT_NO_THROW(rawResponse->ExtractBodyStream()->ReadToEnd(Azure::Core::Context{}));
+    }
   }
 
 }}} // namespace Azure::Core::Test
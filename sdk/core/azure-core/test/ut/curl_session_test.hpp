@@ -50,6 +50,13 @@ namespace Azure { namespace Core { namespace Test {
         SendBuffer,
         (uint8_t const* buffer, size_t bufferSize, Context const& context),
         (override));
+#if defined(AZ_PLATFORM_LINUX)
+    MOCK_METHOD(
+        CURLcode,
+        SendFile,
+        (int fileDescriptor, int64_t offset, int64_t length, Context const& context),
+        (override));
+#endif
 
     /* This is a way to test we are calling the destructor
      *  Adding an extra mock method that is called from the destructor
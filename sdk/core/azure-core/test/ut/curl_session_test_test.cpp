@@ -9,6 +9,8 @@
 #include <http/curl/curl_connection_private.hpp>
 #include <http/curl/curl_session_private.hpp>
 
+#include <vector>
+
 using ::testing::_;
 using ::testing::DoAll;
 using ::testing::Return;
@@ -86,8 +88,7 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, chunkBadFormatResponse)
@@ -137,8 +138,7 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_THROW(bodyS->ReadToEnd(Azure::Core::Context{}), Azure::Core::Http::TransportException);
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, invalidHeader)
@@ -317,14 +317,332 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(bodyS->ReadToEnd(Azure::Core::Context{}));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, smallReadsUseInnerBuffer)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 10\r\n\r\n");
+    std::string body("0123456789");
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    int32_t const bodySize = static_cast<int32_t>(body.size());
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    // The body is pulled from the wire once, and never beyond the content-length
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, body.size(), _))
+        .WillOnce(
+            DoAll(SetArrayArgument<0>(body.data(), body.data() + bodySize), Return(bodySize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
+      auto response = session->ExtractResponse();
+      response->SetBodyStream(std::move(session));
+      auto bodyS = response->ExtractBodyStream();
+
+      // Read the body one byte at a time
+      std::string readBody;
+      uint8_t data = 0;
+      while (bodyS->Read(&data, 1, Azure::Core::Context{}) == 1)
+      {
+        readBody.push_back(static_cast<char>(data));
+      }
+      EXPECT_EQ(readBody, body);
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, largeReadsBypassInnerBuffer)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 64\r\n\r\n");
+    std::string body(64, 'x');
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    int32_t const bodySize = static_cast<int32_t>(body.size());
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    // Status line and headers are read with the configured buffer size
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, 128, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    // The body is read straight into the caller's buffer
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, body.size(), _))
+        .WillOnce(
+            DoAll(SetArrayArgument<0>(body.data(), body.data() + bodySize), Return(bodySize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      transportOptions.ReceiveBufferSize = 128;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
+      auto response = session->ExtractResponse();
+      response->SetBodyStream(std::move(session));
+      auto bodyS = response->ExtractBodyStream();
+
+      std::vector<uint8_t> readBody(256);
+      EXPECT_EQ(
+          bodyS->ReadToCount(readBody.data(), readBody.size(), Azure::Core::Context{}),
+          body.size());
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, adaptiveInnerBufferGrowsToContentLength)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 20000\r\n\r\n");
+    std::string body(20000, 'x');
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    int32_t const bodySize = static_cast<int32_t>(body.size());
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(
+        *curlMock, ReadFromSocket(_, Azure::Core::Http::_detail::DefaultLibcurlReaderSize, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    // A single read from the wire fills the grown buffer with the whole body
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, body.size(), _))
+        .WillOnce(
+            DoAll(SetArrayArgument<0>(body.data(), body.data() + bodySize), Return(bodySize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
+      auto response = session->ExtractResponse();
+      response->SetBodyStream(std::move(session));
+      auto bodyS = response->ExtractBodyStream();
+
+      // Read the body in chunks smaller than the default buffer
+      std::vector<uint8_t> chunk(1024);
+      size_t totalRead = 0;
+      for (size_t read = 1; read != 0; totalRead += read)
+      {
+        read = bodyS->Read(chunk.data(), chunk.size(), Azure::Core::Context{});
+      }
+      EXPECT_EQ(totalRead, body.size());
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+#if defined(AZ_CORE_RTTI)
+  TEST_F(CurlSession, memoryBodyUploadWithoutCopy)
+  {
+    std::string response("HTTP/1.1 201 Created\r\ncontent-length: 0\r\n\r\n");
+    std::vector<uint8_t> body(1024 * 1024, 'x');
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    // The request line and headers
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    // The body is sent at once, from the buffer of the stream
+    EXPECT_CALL(*curlMock, SendBuffer(static_cast<uint8_t const*>(body.data()), body.size(), _))
+        .WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::IO::MemoryBodyStream bodyStream(body);
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Post, url, &bodyStream);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_EQ(session->Perform(Azure::Core::Context{}), CURLE_OK);
+    }
+    // The stream is consumed as if it was read
+    uint8_t data = 0;
+    EXPECT_EQ(bodyStream.Read(&data, 1), 0);
+
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+#if defined(AZ_PLATFORM_LINUX)
+  TEST_F(CurlSession, fileBodyUploadWithSendFile)
+  {
+    std::string response("HTTP/1.1 201 Created\r\ncontent-length: 0\r\n\r\n");
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    Azure::Core::IO::FileBodyStream bodyStream(std::string(AZURE_TEST_DATA_PATH) + "/fileData");
+    // Skip the first byte, the rest of the file is sent
+    uint8_t data = 0;
+    ASSERT_EQ(bodyStream.Read(&data, 1), 1);
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    // The request line and headers
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    // The body is sent at once, from the file
+    EXPECT_CALL(*curlMock, SendFile(_, 1, bodyStream.Length() - 1, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Post, url, &bodyStream);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_EQ(session->Perform(Azure::Core::Context{}), CURLE_OK);
+    }
+    // The stream is consumed as if it was read
+    EXPECT_EQ(bodyStream.Read(&data, 1), 0);
+
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, fileBodyUploadWithoutSendFile)
+  {
+    std::string response("HTTP/1.1 201 Created\r\ncontent-length: 0\r\n\r\n");
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    Azure::Core::IO::FileBodyStream bodyStream(std::string(AZURE_TEST_DATA_PATH) + "/fileData");
+    auto const fileContent = bodyStream.ReadToEnd();
+    bodyStream.Rewind();
+    std::vector<uint8_t> sentBody;
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    // The connection can't send the file directly (e.g. over TLS), so the file is read and sent
+    // from a buffer.
+    EXPECT_CALL(*curlMock, SendFile(_, 0, bodyStream.Length(), _))
+        .WillOnce(Return(CURLE_NOT_BUILT_IN));
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _))
+        .WillOnce(Return(CURLE_OK))
+        .WillRepeatedly([&sentBody](uint8_t const* buffer, size_t bufferSize, Context const&) {
+          sentBody.insert(sentBody.end(), buffer, buffer + bufferSize);
+          return CURLE_OK;
+        });
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Post, url, &bodyStream);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_EQ(session->Perform(Azure::Core::Context{}), CURLE_OK);
+    }
+    EXPECT_EQ(sentBody, fileContent);
+
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
+#endif
+#endif
 
   TEST_F(CurlSession, DoNotReuseConnectionIfDownloadFail)
   {
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
     // Can't mock the curlMock directly from a unique ptr, heap allocate it first and then make a
     // unique ptr for it
     MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
@@ -351,8 +669,7 @@ namespace Azure { namespace Core { namespace Test {
     }
     // Check connection pool is empty (connection was not moved to the pool)
     EXPECT_EQ(
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .size(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
         0);
   }
 }}} // namespace Azure::Core::Test
@@ -179,6 +179,34 @@ namespace Azure { namespace Core { namespace Test {
     }
   }
 
+  TEST(TestHttp, RequestHeadersView)
+  {
+    Http::Request req(Http::HttpMethod::Get, Url("http://test.com"));
+    req.SetHeader("x-ms-client-request-id", "id");
+    req.SetHeader("Custom-Header", "value");
+    req.SetHeader("Accept", "text/plain");
+    req.SetHeader("X-MS-Client-Request-Id", "other");
+
+    auto const headers = req.GetHeadersView();
+    std::vector<std::pair<std::string, std::string>> const expected{
+        {"x-ms-client-request-id", "other"}, {"custom-header", "value"}, {"accept", "text/plain"}};
+    std::vector<std::pair<std::string, std::string>> actual;
+    for (auto const& header : headers)
+    {
+      actual.emplace_back(header.first, header.second);
+    }
+    EXPECT_EQ(actual, expected);
+
+    EXPECT_NE(headers.find("CUSTOM-HEADER"), headers.end());
+    EXPECT_EQ(headers.find("missing"), headers.end());
+
+    // The view reflects the changes to the headers.
+    req.RemoveHeader("Custom-Header");
+    EXPECT_EQ(headers.size(), 2);
+    EXPECT_EQ(headers.find("custom-header"), headers.end());
+    EXPECT_EQ(req.GetHeaders().size(), 2);
+  }
+
   TEST(TestHttp, RequestStartTry)
   {
     {
@@ -205,6 +233,17 @@ namespace Azure { namespace Core { namespace Test {
 
       EXPECT_FALSE(headers.count("name"));
 
+      // A header set before the first try is restored by the next try.
+      Http::Request req2(httpMethod, url);
+      req2.SetHeader("Name", "value");
+      req2.StartTry();
+      req2.SetHeader("name", "retryValue");
+      req2.SetHeader("other", "retryValue");
+      EXPECT_EQ(req2.GetHeader("name").Value(), "retryValue");
+      req2.StartTry();
+      EXPECT_EQ(req2.GetHeader("name").Value(), "value");
+      EXPECT_EQ(req2.GetHeadersView().size(), 1);
+
 #if defined(AZ_CORE_RTTI)
       d = dynamic_cast<Azure::Core::IO::_internal::NullBodyStream*>(req.GetBodyStream());
       EXPECT_TRUE(d);
@@ -2,8 +2,16 @@
 // Licensed under the MIT License.
 
 #include <azure/core/http/policies/policy.hpp>
+#include <azure/core/http/transport.hpp>
+#include <azure/core/io/body_stream.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -145,3 +153,208 @@ TEST(Pipeline, AdditionalPolicies)
   EXPECT_EQ(perRetryPolicyCloneCount, 4);
   EXPECT_EQ(perRetryClientPolicyCloneCount, 5);
 }
+
+namespace {
+class TestTransport final : public Azure::Core::Http::HttpTransport {
+  std::vector<Azure::Core::Http::HttpStatusCode> m_statusCodes;
+  size_t m_nextStatusCode = 0;
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> Respond()
+  {
+    if (m_nextStatusCode == m_statusCodes.size())
+    {
+      throw Azure::Core::Http::TransportException("No more responses.");
+    }
+    auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+        1, 1, m_statusCodes[m_nextStatusCode++], "");
+    response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(nullptr, 0));
+    return response;
+  }
+
+public:
+  int SendCount = 0;
+  int SendAsyncCount = 0;
+
+  explicit TestTransport(std::vector<Azure::Core::Http::HttpStatusCode> statusCodes)
+      : m_statusCodes(std::move(statusCodes))
+  {
+  }
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+      Azure::Core::Http::Request&,
+      Azure::Core::Context const&) override
+  {
+    ++SendCount;
+    return Respond();
+  }
+
+  std::future<std::unique_ptr<Azure::Core::Http::RawResponse>> SendAsync(
+      Azure::Core::Http::Request&,
+      Azure::Core::Context const&) override
+  {
+    ++SendAsyncCount;
+    return std::async(std::launch::async, [this]() { return Respond(); });
+  }
+};
+
+Azure::Core::Http::_internal::HttpPipeline CreateTestPipeline(
+    std::shared_ptr<TestTransport> transport)
+{
+  Azure::Core::Http::Policies::RetryOptions retryOptions;
+  retryOptions.RetryDelay = std::chrono::milliseconds(1);
+  Azure::Core::Http::Policies::TransportOptions transportOptions;
+  transportOptions.Transport = transport;
+
+  std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+  policies.push_back(
+      std::make_unique<Azure::Core::Http::Policies::_internal::RetryPolicy>(retryOptions));
+  policies.push_back(
+      std::make_unique<Azure::Core::Http::Policies::_internal::TransportPolicy>(transportOptions));
+  return Azure::Core::Http::_internal::HttpPipeline(policies);
+}
+} // namespace
+
+TEST(Pipeline, SendAsync)
+{
+  auto transport = std::make_shared<TestTransport>(
+      std::vector<Azure::Core::Http::HttpStatusCode>{Azure::Core::Http::HttpStatusCode::Ok});
+  auto pipeline = CreateTestPipeline(transport);
+
+  Azure::Core::Http::Request request(
+      Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  auto response = pipeline.SendAsync(request, Azure::Core::Context()).get();
+
+  EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+  EXPECT_EQ(transport->SendAsyncCount, 1);
+  EXPECT_EQ(transport->SendCount, 0);
+}
+
+TEST(Pipeline, SendAsyncRetries)
+{
+  // The first try is sent asynchronously, the retries are sent by the thread waiting for the
+  // response.
+  auto transport = std::make_shared<TestTransport>(std::vector<Azure::Core::Http::HttpStatusCode>{
+      Azure::Core::Http::HttpStatusCode::ServiceUnavailable,
+      Azure::Core::Http::HttpStatusCode::Ok});
+  auto pipeline = CreateTestPipeline(transport);
+
+  Azure::Core::Http::Request request(
+      Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  auto response = pipeline.SendAsync(request, Azure::Core::Context()).get();
+
+  EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+  EXPECT_EQ(transport->SendAsyncCount, 1);
+  EXPECT_EQ(transport->SendCount, 1);
+}
+
+TEST(Pipeline, SendAsyncException)
+{
+  // The transport fails every try.
+  auto transport
+      = std::make_shared<TestTransport>(std::vector<Azure::Core::Http::HttpStatusCode>{});
+  auto pipeline = CreateTestPipeline(transport);
+
+  Azure::Core::Http::Request request(
+      Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  auto response = pipeline.SendAsync(request, Azure::Core::Context());
+
+  EXPECT_THROW(response.get(), Azure::Core::Http::TransportException);
+  EXPECT_EQ(transport->SendAsyncCount, 1);
+  EXPECT_EQ(transport->SendCount, 3);
+}
+
+namespace {
+class SendOnlyPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
+public:
+  std::unique_ptr<HttpPolicy> Clone() const override
+  {
+    return std::make_unique<SendOnlyPolicy>(*this);
+  }
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+      Azure::Core::Http::Request& request,
+      Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+      Azure::Core::Context const& context) const override
+  {
+    return nextPolicy.Send(request, context);
+  }
+};
+
+class BlockingTransport final : public Azure::Core::Http::HttpTransport {
+  std::mutex m_mutex;
+  std::condition_variable m_released;
+  bool m_release = false;
+
+public:
+  std::atomic<int> SendCount{0};
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+      Azure::Core::Http::Request&,
+      Azure::Core::Context const&) override
+  {
+    ++SendCount;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_released.wait(lock, [this]() { return m_release; });
+    return std::make_unique<Azure::Core::Http::RawResponse>(
+        1, 1, Azure::Core::Http::HttpStatusCode::Ok, "");
+  }
+
+  void Release()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_release = true;
+    }
+    m_released.notify_all();
+  }
+};
+} // namespace
+
+TEST(Pipeline, SendAsyncSendOnlyPolicy)
+{
+  // A policy which only provides Send sends the request synchronously, through the synchronous
+  // path of the policies after it and of the transport.
+  auto transport = std::make_shared<TestTransport>(
+      std::vector<Azure::Core::Http::HttpStatusCode>{Azure::Core::Http::HttpStatusCode::Ok});
+  Azure::Core::Http::Policies::TransportOptions transportOptions;
+  transportOptions.Transport = transport;
+  std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+  policies.push_back(std::make_unique<SendOnlyPolicy>());
+  policies.push_back(
+      std::make_unique<Azure::Core::Http::Policies::_internal::TransportPolicy>(transportOptions));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+  Azure::Core::Http::Request request(
+      Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  auto response = pipeline.SendAsync(request, Azure::Core::Context());
+
+  EXPECT_EQ(response.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_EQ(transport->SendCount, 1);
+  EXPECT_EQ(transport->SendAsyncCount, 0);
+  EXPECT_EQ(response.get()->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+}
+
+TEST(Pipeline, DefaultTransportSendAsyncThreads)
+{
+  // The default SendAsync of a transport starts a bounded number of threads, the other requests
+  // are sent by the thread waiting for their response.
+  constexpr int RequestCount = 100;
+  auto transport = std::make_shared<BlockingTransport>();
+  Azure::Core::Http::Request request(
+      Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  std::vector<std::future<std::unique_ptr<Azure::Core::Http::RawResponse>>> responses;
+  for (int i = 0; i < RequestCount; ++i)
+  {
+    responses.push_back(transport->SendAsync(request, Azure::Core::Context()));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_GT(transport->SendCount, 0);
+  EXPECT_LT(transport->SendCount, RequestCount);
+
+  transport->Release();
+  for (auto& response : responses)
+  {
+    EXPECT_EQ(response.get()->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+  }
+  EXPECT_EQ(transport->SendCount, RequestCount);
+}
@@ -33,6 +33,16 @@ namespace Azure { namespace Core { namespace Test {
       return TransportAdaptersTestParameter(std::move(suffix), options);
     }
 
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+    // Produces a libcurl transport which multiplexes the requests on event loop threads.
+    static std::shared_ptr<Azure::Core::Http::HttpTransport> GetCurlEventLoopTransport()
+    {
+      Azure::Core::Http::CurlTransportOptions curlOptions;
+      curlOptions.EventLoopThreadCount = 2;
+      return std::make_shared<Azure::Core::Http::CurlTransport>(curlOptions);
+    }
+#endif
+
     // When adding more than one parameter, this function should return a unique string.
     static std::string GetSuffix(const testing::TestParamInfo<TransportAdapter::ParamType>& info)
     {
@@ -72,7 +82,8 @@ namespace Azure { namespace Core { namespace Test {
       Test,
       TransportAdapter,
       testing::Values(
-          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>())),
+          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>()),
+          GetTransportOptions("libCurlEventLoop", GetCurlEventLoopTransport())),
       GetSuffix);
 #else
   /* Custom adapter. Not adding tests */
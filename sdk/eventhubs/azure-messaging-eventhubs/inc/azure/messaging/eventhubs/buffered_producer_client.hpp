@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "models/event_data.hpp"
+#include "producer_client.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/credentials/credentials.hpp>
+#include <azure/core/datetime.hpp>
+#include <azure/core/nullable.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Messaging { namespace EventHubs {
+  namespace _detail {
+    class BufferedPartitionPublisher;
+  } // namespace _detail
+
+  /**@brief Contains options for the BufferedProducerClient creation.
+   */
+  struct BufferedProducerClientOptions final
+  {
+    /**@brief The options of the ProducerClient used to send the events.
+     */
+    ProducerClientOptions ProducerOptions{};
+
+    /**@brief MaxWaitTime is how long an event waits in the buffer for more events to be batched
+     * with it, before its batch is sent even though it is not full. The default value is 250
+     * milliseconds.
+     */
+    Azure::DateTime::duration MaxWaitTime{std::chrono::milliseconds(250)};
+
+    /**@brief MaxBytes overrides the max size (in bytes) of the batches sent to each partition.
+     * By default the max message size provided by the service is used.
+     */
+    Azure::Nullable<std::uint64_t> MaxBytes;
+
+    /**@brief The maximum number of events buffered for a partition. When it is reached, Enqueue
+     * blocks until a batch has been sent to that partition. The default value is 1500 events.
+     */
+    std::uint32_t MaxBufferedEventsPerPartition{1500};
+
+    /**@brief Called from a background thread after a batch of events has been sent to a
+     * partition.
+     */
+    std::function<
+        void(std::string const& partitionId, std::vector<Models::EventData> const& events)>
+        SendSucceeded;
+
+    /**@brief Called from a background thread when a batch of events could not be sent to a
+     * partition, after the sends have been retried according to the
+     * ProducerClientOptions::RetryOptions. The events are not sent again.
+     */
+    std::function<void(
+        std::string const& partitionId,
+        std::vector<Models::EventData> const& events,
+        std::exception_ptr error)>
+        SendFailed;
+  };
+
+  /**@brief EnqueueEventOptions contains the optional parameters of
+   * BufferedProducerClient::Enqueue.
+   *
+   * @remark If both PartitionKey and PartitionId are empty, the events are spread over the
+   * partitions of the Event Hub in turn.
+   */
+  struct EnqueueEventOptions final
+  {
+    /**@brief PartitionKey is hashed by the client to choose the partition of the event, so that
+     * the events with the same PartitionKey are sent to the same partition.
+     * Note that if you use this option then PartitionId cannot be set.
+     */
+    std::string PartitionKey;
+
+    /**@brief PartitionId is the ID of the partition to send the event to.
+     * Note that if you use this option then PartitionKey cannot be set.
+     */
+    std::string PartitionId;
+  };
+
+  /**@brief BufferedProducerClient sends individual events to an Event Hub, batching them per
+   * partition.
+   *
+   * @remark The events are buffered per partition until the batch of the partition is full, or
+   * until the first of them has waited for BufferedProducerClientOptions::MaxWaitTime. The batches
+   * of the different partitions are sent concurrently, from background threads. The outcome of
+   * each send is reported through BufferedProducerClientOptions::SendSucceeded and
+   * BufferedProducerClientOptions::SendFailed.
+   */
+  class BufferedProducerClient final {
+  public:
+    /**@brief Constructs a new BufferedProducerClient instance.
+     *
+     * @param fullyQualifiedNamespace Fully qualified namespace name
+     * @param eventHub Event hub name
+     * @param credential Credential to use for authentication
+     * @param options Additional options for creating the client
+     */
+    BufferedProducerClient(
+        std::string const& fullyQualifiedNamespace,
+        std::string const& eventHub,
+        std::shared_ptr<const Azure::Core::Credentials::TokenCredential> credential,
+        BufferedProducerClientOptions options = {});
+
+    BufferedProducerClient(BufferedProducerClient const& other) = delete;
+    BufferedProducerClient& operator=(BufferedProducerClient const& other) = delete;
+    BufferedProducerClient(BufferedProducerClient&& other) = delete;
+    BufferedProducerClient& operator=(BufferedProducerClient&& other) = delete;
+
+    /** @brief Sends the buffered events, then closes the client. */
+    ~BufferedProducerClient();
+
+    /**@brief Add an event to the buffer of its partition.
+     *
+     * @remark The event is sent later, from a background thread.
+     *
+     * @param eventData The event to send.
+     * @param options The partition key or partition ID of the event.
+     * @param context Context for the operation can be used for request cancellation.
+     */
+    void Enqueue(
+        Models::EventData const& eventData,
+        EnqueueEventOptions const& options = {},
+        Azure::Core::Context const& context = {});
+
+    /**@brief Send all the buffered events, and wait for them to be sent.
+     *
+     * @param context Context for the operation can be used for request cancellation.
+     */
+    void Flush(Azure::Core::Context const& context = {});
+
+    /**@brief Send all the buffered events, then close the connections.
+     *
+     * @param context Context for the operation can be used for request cancellation.
+     */
+    void Close(Azure::Core::Context const& context = {});
+
+    /**@brief Get the number of events which are buffered and not sent yet.
+     */
+    std::size_t GetBufferedEventCount() const;
+
+    /** Get the name of the Event Hub. */
+    std::string const& GetEventHubName() const { return m_eventHub; }
+
+  private:
+    std::string m_eventHub;
+    BufferedProducerClientOptions m_options;
+    std::unique_ptr<ProducerClient> m_producer;
+
+    // Protects m_partitionIds, m_nextPartition, m_publishers and m_closed.
+    mutable std::mutex m_publishersLock;
+    // Fetched once, then shared with the enqueues which resolve the partition of their event.
+    std::shared_ptr<std::vector<std::string> const> m_partitionIds;
+    std::size_t m_nextPartition{0};
+    std::map<std::string, std::shared_ptr<_detail::BufferedPartitionPublisher>> m_publishers;
+    bool m_closed{false};
+
+    std::string ResolvePartitionId(
+        EnqueueEventOptions const& options,
+        Azure::Core::Context const& context);
+    std::shared_ptr<_detail::BufferedPartitionPublisher> GetPublisher(
+        std::string const& partitionId,
+        Azure::Core::Context const& context);
+  };
+}}} // namespace Azure::Messaging::EventHubs
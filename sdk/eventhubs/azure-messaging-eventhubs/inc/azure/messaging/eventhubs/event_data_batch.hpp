@@ -57,7 +57,10 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     std::string m_partitionId;
     std::string m_partitionKey;
     Azure::Nullable<std::uint64_t> m_maxBytes;
-    std::vector<std::vector<uint8_t>> m_marshalledMessages;
+    // The serialized messages, one after the other, and the end offset of each of them in
+    // m_marshalledMessages.
+    std::vector<uint8_t> m_marshalledMessages;
+    std::vector<size_t> m_marshalledMessageEnds;
     // Annotation properties
     const uint32_t BatchedMessageFormat = 0x80013700;
 
@@ -73,6 +76,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         // Copy constructor cannot be defaulted because of m_rwMutex.
         : m_rwMutex{}, m_partitionId{other.m_partitionId}, m_partitionKey{other.m_partitionKey},
           m_maxBytes{other.m_maxBytes}, m_marshalledMessages{other.m_marshalledMessages},
+          m_marshalledMessageEnds{other.m_marshalledMessageEnds},
           m_batchEnvelope{other.m_batchEnvelope}, m_currentSize(other.m_currentSize){};
 
     /** Copy an EventDataBatch to another EventDataBatch */
@@ -85,6 +89,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         m_partitionKey = other.m_partitionKey;
         m_maxBytes = other.m_maxBytes;
         m_marshalledMessages = other.m_marshalledMessages;
+        m_marshalledMessageEnds = other.m_marshalledMessageEnds;
         m_batchEnvelope = other.m_batchEnvelope;
         m_currentSize = other.m_currentSize;
       }
@@ -134,7 +139,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     size_t NumberOfEvents()
     {
       std::lock_guard<std::mutex> lock(m_rwMutex);
-      return m_marshalledMessages.size();
+      return m_marshalledMessageEnds.size();
     }
 
     /** @brief Serializes the EventDataBatch to a single AmqpMessage to be sent to the EventHubs
@@ -148,16 +153,16 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     bool TryAddAmqpMessage(
         std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage const> const& message);
 
-    static size_t CalculateActualSizeForPayload(std::vector<uint8_t> const& payload)
+    static size_t CalculateActualSizeForPayload(size_t payloadSize)
     {
       const size_t vbin8Overhead = 5;
       const size_t vbin32Overhead = 8;
 
-      if (payload.size() < 256)
+      if (payloadSize < 256)
       {
-        return payload.size() + vbin8Overhead;
+        return payloadSize + vbin8Overhead;
       }
-      return payload.size() + vbin32Overhead;
+      return payloadSize + vbin32Overhead;
     }
 
     Azure::Core::Amqp::Models::AmqpMessage CreateBatchEnvelope(
@@ -177,7 +182,8 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
     EventDataBatch(EventDataBatchOptions const& options = {})
         : m_partitionId{options.PartitionId}, m_partitionKey{options.PartitionKey},
-          m_maxBytes{options.MaxBytes}, m_marshalledMessages{}, m_batchEnvelope{}, m_currentSize{0}
+          m_maxBytes{options.MaxBytes}, m_marshalledMessages{}, m_marshalledMessageEnds{},
+          m_batchEnvelope{}, m_currentSize{0}
     {
       if (!options.PartitionId.empty() && !options.PartitionKey.empty())
       {
@@ -185,4 +185,75 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Models {
     }
   };
   std::ostream& operator<<(std::ostream&, ReceivedEventData const&);
+
+  /** @brief A view of an event received from the Azure Event Hubs service.
+   *
+   * ReceivedEventData copies the body of an event and converts all of its properties and
+   * annotations when the event is received. A ReceivedEventView instead holds on to the received
+   * AMQP message: the body is a view over the received buffer, and every other field is converted
+   * from the message when, and each time, it is read.
+   */
+  class ReceivedEventView final {
+  public:
+    /** @brief Construct a ReceivedEventView from a view of an AMQP Message.
+     *
+     * This constructor is used internally during the receive operation.
+     */
+    ReceivedEventView(Azure::Core::Amqp::Models::AmqpMessageView const& message)
+        : m_message{message}
+    {
+    }
+
+    /** @brief Returns the body of the event.
+     *
+     * The returned view refers to the buffer of the received message, and is valid for as long as
+     * this ReceivedEventView is alive. If the body of the message is not a single binary data
+     * section, the returned view is empty.
+     */
+    Azure::Core::Amqp::Models::AmqpBinaryDataView GetBody() const;
+
+    /** @brief Returns the MIME ContentType of the event data. */
+    Azure::Nullable<std::string> GetContentType() const;
+
+    /** @brief Returns the correlation identifier of the event. */
+    Azure::Core::Amqp::Models::AmqpValue GetCorrelationId() const;
+
+    /** @brief Returns the message identifier of the event. */
+    Azure::Core::Amqp::Models::AmqpValue GetMessageId() const;
+
+    /** @brief Returns the set of free-form event properties. */
+    std::map<std::string, Azure::Core::Amqp::Models::AmqpValue> GetProperties() const;
+
+    /** @brief Returns the date and time, in UTC, that the event was enqueued. */
+    Azure::Nullable<Azure::DateTime> GetEnqueuedTime() const;
+
+    /** @brief Returns the offset of the event data within the partition. */
+    Azure::Nullable<std::string> GetOffset() const;
+
+    /** @brief Returns the partition key which was used to send the event. */
+    Azure::Nullable<std::string> GetPartitionKey() const;
+
+    /** @brief Returns the sequence number of the event within its partition. */
+    Azure::Nullable<std::int64_t> GetSequenceNumber() const;
+
+    /** @brief Returns the set of system properties populated by the Event Hubs service.
+     *
+     * As with ReceivedEventData::SystemProperties, the enqueued time, offset, partition key and
+     * sequence number are not included.
+     */
+    std::map<std::string, Azure::Core::Amqp::Models::AmqpValue> GetSystemProperties() const;
+
+    /** @brief Get the raw AMQP message.
+     *
+     * Returns a view of the underlying AMQP message that was received from the Event Hubs
+     * service.
+     */
+    Azure::Core::Amqp::Models::AmqpMessageView GetRawAmqpMessage() const { return m_message; }
+
+    /** @brief Converts the whole event to a ReceivedEventData. */
+    ReceivedEventData ToReceivedEventData() const;
+
+  private:
+    Azure::Core::Amqp::Models::AmqpMessageView m_message;
+  };
 }}}} // namespace Azure::Messaging::EventHubs::Models
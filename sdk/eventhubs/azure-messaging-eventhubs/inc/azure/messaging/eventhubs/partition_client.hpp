@@ -83,6 +83,19 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         uint32_t maxMessages,
         Core::Context const& context = {});
 
+    /** Receive views of events from the partition.
+     *
+     * @param maxMessages The maximum number of messages to receive.
+     * @param context A context to control the request lifetime.
+     * @return A vector of views of the received events.
+     *
+     * @remarks Unlike ReceiveEvents, the received events are not copied or converted when they are
+     * received; each ReceivedEventView decodes only the fields which are read from it.
+     */
+    std::vector<Models::ReceivedEventView> ReceiveEventViews(
+        uint32_t maxMessages,
+        Core::Context const& context = {});
+
     /** @brief Closes the connection to the Event Hub service.
      */
     void Close(Core::Context const& context) { m_receiver.Close(context); }
@@ -43,6 +43,17 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       return m_partitionClient->ReceiveEvents(maxBatchSize, context);
     }
 
+    /** Receives views of Events from the partition.
+     * @param maxBatchSize The maximum number of events to receive in a single call to the service.
+     * @param context The context to pass to the receive operation.
+     */
+    std::vector<Models::ReceivedEventView> ReceiveEventViews(
+        uint32_t maxBatchSize,
+        Core::Context const& context = {})
+    {
+      return m_partitionClient->ReceiveEventViews(maxBatchSize, context);
+    }
+
     /**
      * @brief Updates the checkpoint for this partition using the given event data.
      *
@@ -55,6 +66,18 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         std::shared_ptr<const Models::ReceivedEventData> const& eventData,
         Core::Context const& context = {});
 
+    /**
+     * @brief Updates the checkpoint for this partition using the given event view.
+     *
+     * Subsequent partition client reads will start from this event.
+     *
+     * @param eventView The view of the event to use for updating the checkpoint.
+     * @param context The context to pass to the update checkpoint operation.
+     */
+    void UpdateCheckpoint(
+        Models::ReceivedEventView const& eventView,
+        Core::Context const& context = {});
+
     /// Returns the partition ID associated with this ProcessorPartitionClient.
     std::string PartitionId() const { return m_partitionId; }
 
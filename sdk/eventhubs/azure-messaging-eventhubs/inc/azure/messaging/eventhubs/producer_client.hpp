@@ -13,11 +13,13 @@
 #include <azure/core/credentials/credentials.hpp>
 #include <azure/core/http/policies/policy.hpp>
 
+#include <future>
 #include <iostream>
 
 namespace Azure { namespace Messaging { namespace EventHubs {
   namespace _detail {
     class EventHubsPropertiesClient;
+    class SendWindow;
   } // namespace _detail
 
   class ProducerClient;
@@ -43,6 +45,14 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
     Azure::Nullable<std::uint64_t> MaxMessageSize{};
 
+    /**@brief  The maximum number of batches sent to a partition with ProducerClient::SendAsync
+     * which can wait to be settled by the service at the same time.
+     *
+     * @remark When this limit is reached, SendAsync blocks until one of the batches sent to the
+     * partition is settled.
+     */
+    std::uint32_t MaxPendingSendsPerPartition{16};
+
   private:
     // The friend declaration is needed so that ProducerClient could access CppStandardVersion,
     // and it is not a struct's public field like the ones above to be set non-programmatically.
@@ -124,6 +134,23 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
     void Send(EventDataBatch const& eventDataBatch, Core::Context const& context = {});
 
+    /**@brief Send an EventDataBatch to the remote Event Hub without waiting for it to be
+     * settled.
+     *
+     * @remark Several batches can be sent to the same partition without waiting for each other,
+     * up to ProducerClientOptions::MaxPendingSendsPerPartition; beyond that, this method blocks
+     * until one of them is settled. Unlike #Send, a failed send is not retried.
+     *
+     * @param eventDataBatch Batch to send
+     * @param context Request context
+     *
+     * @return A future which becomes ready when the batch is settled, and holds an
+     * EventHubsException if the service rejected it.
+     */
+    std::future<void> SendAsync(
+        EventDataBatch const& eventDataBatch,
+        Core::Context const& context = {});
+
     /**@brief Send an EventData to the remote Event Hub.
      *
      * @remark This method will create a new EventDataBatch and add the event to it. If the event
@@ -201,6 +228,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     std::mutex m_sendersLock;
     std::map<std::string, Azure::Core::Amqp::_internal::Connection> m_connections{};
     std::map<std::string, Azure::Core::Amqp::_internal::MessageSender> m_senders{};
+    std::map<std::string, std::shared_ptr<_detail::SendWindow>> m_sendWindows{};
 
     Azure::Core::Amqp::_internal::Connection CreateConnection(
         Azure::Core::Context const& context) const;
@@ -221,6 +249,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         Azure::Core::Context const& context);
 
     Azure::Core::Amqp::_internal::MessageSender GetSender(std::string const& partitionId);
+    std::shared_ptr<_detail::SendWindow> GetSendWindow(std::string const& partitionId);
     Azure::Core::Amqp::_internal::Session GetSession(std::string const& partitionId);
   };
 }}} // namespace Azure::Messaging::EventHubs
@@ -0,0 +1,411 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/messaging/eventhubs/buffered_producer_client.hpp"
+
+#include "azure/messaging/eventhubs/event_data_batch.hpp"
+#include "private/eventhubs_constants.hpp"
+#include "private/eventhubs_utilities.hpp"
+#include "private/partition_resolver.hpp"
+
+#include <azure/core/diagnostics/logger.hpp>
+#include <azure/core/internal/diagnostics/log.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <stdexcept>
+#include <thread>
+
+using namespace Azure::Core::Diagnostics::_internal;
+using namespace Azure::Core::Diagnostics;
+
+namespace {
+// Context cancellation cannot be waited on, so waits wake up at this interval to check it.
+constexpr std::chrono::milliseconds CancellationCheckInterval{10};
+} // namespace
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+  /** @brief Buffers the events of a partition, and sends them in batches from a background
+   * thread.
+   */
+  class BufferedPartitionPublisher final {
+    struct PendingBatch final
+    {
+      EventDataBatch Batch;
+      std::vector<Models::EventData> Events;
+    };
+
+    ProducerClient& m_producer;
+    std::string m_partitionId;
+    BufferedProducerClientOptions const& m_options;
+    EventDataBatchOptions m_batchOptions;
+
+    mutable std::mutex m_mutex;
+    // Wakes up the publishing thread.
+    std::condition_variable m_publish;
+    // Wakes up the threads waiting for events to be sent.
+    std::condition_variable m_sent;
+    // The batch being filled, and when it must be sent even though it is not full.
+    std::unique_ptr<PendingBatch> m_current;
+    std::chrono::steady_clock::time_point m_currentDeadline;
+    // The batches which are full, in the order they must be sent.
+    std::deque<std::unique_ptr<PendingBatch>> m_full;
+    // The events of m_current, m_full, and the batch being sent.
+    std::size_t m_bufferedEvents{0};
+    bool m_flushing{false};
+    bool m_stopping{false};
+    std::thread m_thread;
+
+    // Creates the batch which the next events are added to.
+    std::unique_ptr<PendingBatch> CreatePendingBatch()
+    {
+      m_currentDeadline = std::chrono::steady_clock::now()
+          + std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_options.MaxWaitTime);
+      return std::unique_ptr<PendingBatch>(
+          new PendingBatch{EventDataBatchFactory::CreateEventDataBatch(m_batchOptions), {}});
+    }
+
+    void SendBatch(PendingBatch& batch)
+    {
+      std::exception_ptr error;
+      try
+      {
+        m_producer.Send(batch.Batch);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+
+      try
+      {
+        if (!error && m_options.SendSucceeded)
+        {
+          m_options.SendSucceeded(m_partitionId, batch.Events);
+        }
+        else if (error && m_options.SendFailed)
+        {
+          m_options.SendFailed(m_partitionId, batch.Events, error);
+        }
+        else if (error)
+        {
+          Log::Stream(Logger::Level::Error)
+              << "Could not send " << batch.Events.size() << " events to partition "
+              << m_partitionId << ".";
+        }
+      }
+      catch (std::exception const& ex)
+      {
+        Log::Stream(Logger::Level::Error) << "Send notification threw an exception: " << ex.what();
+      }
+    }
+
+    void PublishLoop()
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (true)
+      {
+        if (m_full.empty() && m_current
+            && (m_flushing || m_stopping || std::chrono::steady_clock::now() >= m_currentDeadline))
+        {
+          m_full.push_back(std::move(m_current));
+        }
+
+        if (!m_full.empty())
+        {
+          auto batch = std::move(m_full.front());
+          m_full.pop_front();
+          lock.unlock();
+          SendBatch(*batch);
+          lock.lock();
+          m_bufferedEvents -= batch->Events.size();
+          if (m_bufferedEvents == 0)
+          {
+            m_flushing = false;
+          }
+          m_sent.notify_all();
+          continue;
+        }
+
+        if (m_stopping)
+        {
+          return;
+        }
+        if (m_current)
+        {
+          m_publish.wait_until(lock, m_currentDeadline);
+        }
+        else
+        {
+          m_publish.wait(lock);
+        }
+      }
+    }
+
+  public:
+    BufferedPartitionPublisher(
+        ProducerClient& producer,
+        std::string const& partitionId,
+        BufferedProducerClientOptions const& options,
+        Azure::Core::Context const& context)
+        : m_producer{producer}, m_partitionId{partitionId}, m_options{options}
+    {
+      m_batchOptions.PartitionId = partitionId;
+      m_batchOptions.MaxBytes = options.MaxBytes;
+      // Creating a batch opens the sender to the partition, and provides its max message size.
+      m_batchOptions.MaxBytes = m_producer.CreateBatch(m_batchOptions, context).GetMaxBytes();
+
+      m_thread = std::thread([this]() { PublishLoop(); });
+    }
+
+    ~BufferedPartitionPublisher() { Stop(); }
+
+    BufferedPartitionPublisher(BufferedPartitionPublisher const&) = delete;
+    BufferedPartitionPublisher& operator=(BufferedPartitionPublisher const&) = delete;
+
+    void Enqueue(Models::EventData const& eventData, Azure::Core::Context const& context)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (!m_sent.wait_for(lock, CancellationCheckInterval, [this]() {
+        return m_stopping || m_bufferedEvents < m_options.MaxBufferedEventsPerPartition;
+      }))
+      {
+        context.ThrowIfCancelled();
+      }
+      context.ThrowIfCancelled();
+      if (m_stopping)
+      {
+        throw std::runtime_error("The buffered producer client is closed.");
+      }
+
+      bool const wasEmpty = !m_current;
+      if (!m_current)
+      {
+        m_current = CreatePendingBatch();
+      }
+      if (!m_current->Batch.TryAdd(eventData))
+      {
+        if (m_current->Events.empty())
+        {
+          m_current.reset();
+          throw std::runtime_error("The event is too large to be sent to the Event Hub.");
+        }
+        // The batch is full: send it, and start a new one with this event.
+        m_full.push_back(std::move(m_current));
+        m_publish.notify_one();
+        m_current = CreatePendingBatch();
+        if (!m_current->Batch.TryAdd(eventData))
+        {
+          m_current.reset();
+          throw std::runtime_error("The event is too large to be sent to the Event Hub.");
+        }
+      }
+      else if (wasEmpty)
+      {
+        // The publishing thread must wait for the deadline of the new batch.
+        m_publish.notify_one();
+      }
+      m_current->Events.push_back(eventData);
+      ++m_bufferedEvents;
+    }
+
+    void Flush(Azure::Core::Context const& context)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (m_bufferedEvents == 0)
+      {
+        return;
+      }
+      m_flushing = true;
+      m_publish.notify_one();
+      while (!m_sent.wait_for(
+          lock, CancellationCheckInterval, [this]() { return m_bufferedEvents == 0; }))
+      {
+        context.ThrowIfCancelled();
+      }
+    }
+
+    void Stop()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+      }
+      m_publish.notify_one();
+      m_sent.notify_all();
+      if (m_thread.joinable())
+      {
+        m_thread.join();
+      }
+    }
+
+    std::size_t GetBufferedEventCount() const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_bufferedEvents;
+    }
+  };
+}}}} // namespace Azure::Messaging::EventHubs::_detail
+
+namespace Azure { namespace Messaging { namespace EventHubs {
+
+  BufferedProducerClient::BufferedProducerClient(
+      std::string const& fullyQualifiedNamespace,
+      std::string const& eventHub,
+      std::shared_ptr<const Azure::Core::Credentials::TokenCredential> credential,
+      BufferedProducerClientOptions options)
+      : m_eventHub{eventHub}, m_options{std::move(options)},
+        m_producer{std::make_unique<ProducerClient>(
+            fullyQualifiedNamespace,
+            eventHub,
+            credential,
+            m_options.ProducerOptions)}
+  {
+  }
+
+  BufferedProducerClient::~BufferedProducerClient() { Close(); }
+
+  void BufferedProducerClient::Enqueue(
+      Models::EventData const& eventData,
+      EnqueueEventOptions const& options,
+      Azure::Core::Context const& context)
+  {
+    auto publisher{GetPublisher(ResolvePartitionId(options, context), context)};
+    if (options.PartitionKey.empty())
+    {
+      publisher->Enqueue(eventData, context);
+      return;
+    }
+
+    // The partition batches mix the events of different keys, so the key is stamped on the event
+    // rather than on its batch.
+    auto message{std::make_shared<Azure::Core::Amqp::Models::AmqpMessage>(
+        *eventData.GetRawAmqpMessage())};
+    message->MessageAnnotations.emplace(
+        _detail::PartitionKeyAnnotation,
+        Azure::Core::Amqp::Models::AmqpValue(options.PartitionKey));
+    publisher->Enqueue(Models::EventData{message}, context);
+  }
+
+  void BufferedProducerClient::Flush(Azure::Core::Context const& context)
+  {
+    std::vector<std::shared_ptr<_detail::BufferedPartitionPublisher>> publishers;
+    {
+      std::lock_guard<std::mutex> lock(m_publishersLock);
+      for (auto const& publisher : m_publishers)
+      {
+        publishers.push_back(publisher.second);
+      }
+    }
+    // The partitions are sent to concurrently, so this waits for the slowest of them.
+    for (auto const& publisher : publishers)
+    {
+      publisher->Flush(context);
+    }
+  }
+
+  void BufferedProducerClient::Close(Azure::Core::Context const& context)
+  {
+    Log::Stream(Logger::Level::Verbose) << "Close buffered producer client.";
+    std::map<std::string, std::shared_ptr<_detail::BufferedPartitionPublisher>> publishers;
+    {
+      std::lock_guard<std::mutex> lock(m_publishersLock);
+      m_closed = true;
+      publishers.swap(m_publishers);
+    }
+    // Stopping a publisher sends its buffered events first.
+    for (auto const& publisher : publishers)
+    {
+      publisher.second->Stop();
+    }
+    m_producer->Close(context);
+  }
+
+  std::size_t BufferedProducerClient::GetBufferedEventCount() const
+  {
+    std::lock_guard<std::mutex> lock(m_publishersLock);
+    std::size_t count = 0;
+    for (auto const& publisher : m_publishers)
+    {
+      count += publisher.second->GetBufferedEventCount();
+    }
+    return count;
+  }
+
+  std::string BufferedProducerClient::ResolvePartitionId(
+      EnqueueEventOptions const& options,
+      Azure::Core::Context const& context)
+  {
+    if (!options.PartitionId.empty())
+    {
+      if (!options.PartitionKey.empty())
+      {
+        throw std::runtime_error("Either PartitionID or PartitionKey can be set, but not both.");
+      }
+      return options.PartitionId;
+    }
+
+    std::shared_ptr<std::vector<std::string> const> partitionIds;
+    {
+      std::lock_guard<std::mutex> lock(m_publishersLock);
+      partitionIds = m_partitionIds;
+    }
+    if (!partitionIds)
+    {
+      // The properties are fetched without the lock, so that the enqueues to the partitions
+      // already known are not blocked by the request.
+      auto fetched{std::make_shared<std::vector<std::string> const>(
+          m_producer->GetEventHubProperties(context).PartitionIds)};
+      if (fetched->empty())
+      {
+        throw std::runtime_error("The Event Hub has no partitions.");
+      }
+      std::lock_guard<std::mutex> lock(m_publishersLock);
+      if (!m_partitionIds)
+      {
+        m_partitionIds = std::move(fetched);
+      }
+      partitionIds = m_partitionIds;
+    }
+
+    if (!options.PartitionKey.empty())
+    {
+      return (*partitionIds)[_detail::PartitionResolver::FindPartitionIndex(
+          options.PartitionKey, partitionIds->size())];
+    }
+    // Spread the events without a partition over the partitions in turn.
+    std::lock_guard<std::mutex> lock(m_publishersLock);
+    return (*partitionIds)[m_nextPartition++ % partitionIds->size()];
+  }
+
+  std::shared_ptr<_detail::BufferedPartitionPublisher> BufferedProducerClient::GetPublisher(
+      std::string const& partitionId,
+      Azure::Core::Context const& context)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_publishersLock);
+      if (m_closed)
+      {
+        throw std::runtime_error("The buffered producer client is closed.");
+      }
+      auto publisher = m_publishers.find(partitionId);
+      if (publisher != m_publishers.end())
+      {
+        return publisher->second;
+      }
+    }
+
+    // Creating the publisher opens the sender to the partition, which is done without the lock so
+    // that the enqueues to the other partitions are not blocked.
+    auto created{std::make_shared<_detail::BufferedPartitionPublisher>(
+        *m_producer, partitionId, m_options, context)};
+    std::lock_guard<std::mutex> lock(m_publishersLock);
+    if (m_closed)
+    {
+      throw std::runtime_error("The buffered producer client is closed.");
+    }
+    // Another thread may have created the publisher of the partition meanwhile, in which case
+    // that one is used and this one is stopped when it goes out of scope.
+    return m_publishers.emplace(partitionId, created).first->second;
+  }
+}}} // namespace Azure::Messaging::EventHubs
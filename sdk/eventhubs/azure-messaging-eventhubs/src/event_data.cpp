@@ -15,6 +15,25 @@ using namespace Azure::Core::Diagnostics::_internal;
 using namespace Azure::Core::Diagnostics;
 
 namespace Azure { namespace Messaging { namespace EventHubs { namespace Models {
+  namespace {
+    Azure::DateTime EnqueuedTimeFromAnnotation(Azure::Core::Amqp::Models::AmqpValue const& value)
+    {
+      auto timePoint = static_cast<std::chrono::milliseconds>(value.AsTimestamp());
+      return Azure::DateTime{Azure::DateTime::time_point{timePoint}};
+    }
+
+    Azure::Nullable<std::string> OffsetFromAnnotation(
+        Azure::Core::Amqp::Models::AmqpValue const& value)
+    {
+      switch (value.GetType())
+      {
+        case Azure::Core::Amqp::Models::AmqpValueType::String:
+          return static_cast<std::string>(value);
+        default:
+          return {};
+      }
+    }
+  } // namespace
 
   EventData::EventData(std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage const> const& message)
       : // Promote the specific message properties into ReceivedEventData.
@@ -49,23 +68,14 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Models {
       {
         continue;
       }
-      auto key = item.first;
+      auto const& key = item.first;
       if (key == _detail::EnqueuedTimeAnnotation)
       {
-        auto timePoint = static_cast<std::chrono::milliseconds>(item.second.AsTimestamp());
-        auto dateTime = Azure::DateTime{Azure::DateTime::time_point{timePoint}};
-        EnqueuedTime = dateTime;
+        EnqueuedTime = EnqueuedTimeFromAnnotation(item.second);
       }
       else if (key == _detail::OffsetAnnotation)
       {
-        switch (item.second.GetType())
-        {
-          case Azure::Core::Amqp::Models::AmqpValueType::String:
-            Offset = static_cast<std::string>(item.second);
-            break;
-          default:
-            break;
-        }
+        Offset = OffsetFromAnnotation(item.second);
       }
       else if (key == _detail::PartitionKeyAnnotation)
       {
@@ -91,6 +101,99 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Models {
     }
   }
 
+  Azure::Core::Amqp::Models::AmqpBinaryDataView ReceivedEventView::GetBody() const
+  {
+    // As with EventData::Body, only a body made of a single binary value is returned.
+    if (m_message.GetBodyType() == Azure::Core::Amqp::Models::MessageBodyType::Data)
+    {
+      auto binaryData = m_message.GetBodyAsBinary();
+      if (binaryData.size() == 1)
+      {
+        return binaryData[0];
+      }
+    }
+    return {};
+  }
+
+  Azure::Nullable<std::string> ReceivedEventView::GetContentType() const
+  {
+    return m_message.GetProperties().ContentType;
+  }
+
+  Azure::Core::Amqp::Models::AmqpValue ReceivedEventView::GetCorrelationId() const
+  {
+    return m_message.GetProperties().CorrelationId;
+  }
+
+  Azure::Core::Amqp::Models::AmqpValue ReceivedEventView::GetMessageId() const
+  {
+    return m_message.GetProperties().MessageId;
+  }
+
+  std::map<std::string, Azure::Core::Amqp::Models::AmqpValue> ReceivedEventView::GetProperties()
+      const
+  {
+    return m_message.GetApplicationProperties();
+  }
+
+  Azure::Nullable<Azure::DateTime> ReceivedEventView::GetEnqueuedTime() const
+  {
+    auto value{m_message.GetMessageAnnotation(_detail::EnqueuedTimeAnnotation)};
+    if (value.IsNull())
+    {
+      return {};
+    }
+    return EnqueuedTimeFromAnnotation(value);
+  }
+
+  Azure::Nullable<std::string> ReceivedEventView::GetOffset() const
+  {
+    return OffsetFromAnnotation(m_message.GetMessageAnnotation(_detail::OffsetAnnotation));
+  }
+
+  Azure::Nullable<std::string> ReceivedEventView::GetPartitionKey() const
+  {
+    auto value{m_message.GetMessageAnnotation(_detail::PartitionKeyAnnotation)};
+    if (value.IsNull())
+    {
+      return {};
+    }
+    return static_cast<std::string>(value);
+  }
+
+  Azure::Nullable<std::int64_t> ReceivedEventView::GetSequenceNumber() const
+  {
+    auto value{m_message.GetMessageAnnotation(_detail::SequenceNumberAnnotation)};
+    if (value.IsNull())
+    {
+      return {};
+    }
+    return static_cast<std::int64_t>(value);
+  }
+
+  std::map<std::string, Azure::Core::Amqp::Models::AmqpValue>
+  ReceivedEventView::GetSystemProperties() const
+  {
+    std::map<std::string, Azure::Core::Amqp::Models::AmqpValue> rv;
+    for (auto const& item : m_message.GetMessageAnnotations())
+    {
+      auto const& key = item.first;
+      if (key.GetType() != Azure::Core::Amqp::Models::AmqpValueType::Symbol
+          || key == _detail::EnqueuedTimeAnnotation || key == _detail::OffsetAnnotation
+          || key == _detail::PartitionKeyAnnotation || key == _detail::SequenceNumberAnnotation)
+      {
+        continue;
+      }
+      rv.emplace(static_cast<std::string>(key), item.second);
+    }
+    return rv;
+  }
+
+  ReceivedEventData ReceivedEventView::ToReceivedEventData() const
+  {
+    return ReceivedEventData{m_message.ToAmqpMessage()};
+  }
+
   std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage const> EventData::GetRawAmqpMessage() const
   {
     // If the underlying message is already populated, return it. This will typically happen when a
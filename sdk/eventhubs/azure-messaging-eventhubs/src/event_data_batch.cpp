@@ -9,6 +9,8 @@
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
 
+#include <memory>
+
 using namespace Azure::Core::Diagnostics::_internal;
 using namespace Azure::Core::Diagnostics;
 
@@ -22,7 +24,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
   Azure::Core::Amqp::Models::AmqpMessage EventDataBatch::ToAmqpMessage() const
   {
     Azure::Core::Amqp::Models::AmqpMessage returnValue{m_batchEnvelope};
-    if (m_marshalledMessages.empty())
+    if (m_marshalledMessageEnds.empty())
     {
       throw std::runtime_error("No messages added to the batch.");
     }
@@ -35,10 +37,13 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     }
 
     std::vector<Azure::Core::Amqp::Models::AmqpBinaryData> messageList;
-    for (auto const& marshalledMessage : m_marshalledMessages)
+    messageList.reserve(m_marshalledMessageEnds.size());
+    size_t messageStart = 0;
+    for (auto const messageEnd : m_marshalledMessageEnds)
     {
-      Azure::Core::Amqp::Models::AmqpBinaryData data(marshalledMessage);
-      messageList.push_back(data);
+      messageList.emplace_back(std::vector<uint8_t>(
+          m_marshalledMessages.begin() + messageStart, m_marshalledMessages.begin() + messageEnd));
+      messageStart = messageEnd;
     }
 
     returnValue.SetBody(messageList);
@@ -48,42 +53,61 @@ namespace Azure { namespace Messaging { namespace EventHubs {
   bool EventDataBatch::TryAddAmqpMessage(
       std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage const> const& message)
   {
-    Azure::Core::Amqp::Models::AmqpMessage messageToSend{*message};
-
-    // Fix up some properties in the message to send if they have not been already set.
-    if (message->Properties.MessageId.IsNull())
+    // Fix up some properties in the message to send if they have not been already set. The
+    // message is only copied when it needs to be changed.
+    std::unique_ptr<Azure::Core::Amqp::Models::AmqpMessage> fixedUpMessage;
+    if (message->Properties.MessageId.IsNull() || !m_partitionKey.empty())
     {
-      messageToSend.Properties.MessageId
-          = Azure::Core::Amqp::Models::AmqpValue(Azure::Core::Uuid::CreateUuid().ToString());
+      fixedUpMessage = std::make_unique<Azure::Core::Amqp::Models::AmqpMessage>(*message);
+      if (message->Properties.MessageId.IsNull())
+      {
+        fixedUpMessage->Properties.MessageId
+            = Azure::Core::Amqp::Models::AmqpValue(Azure::Core::Uuid::CreateUuid().ToString());
+      }
+      if (!m_partitionKey.empty())
+      {
+        fixedUpMessage->MessageAnnotations.emplace(
+            _detail::PartitionKeyAnnotation,
+            Azure::Core::Amqp::Models::AmqpValue(m_partitionKey));
+      }
     }
+    Azure::Core::Amqp::Models::AmqpMessage const& messageToSend
+        = fixedUpMessage ? *fixedUpMessage : *message;
 
-    if (!m_partitionKey.empty())
+    std::lock_guard<std::mutex> lock(m_rwMutex);
+
+    // Serialize the message directly after the messages already in the batch, it is removed
+    // below if it does not fit.
+    auto const messageStart = m_marshalledMessages.size();
+    try
     {
-      messageToSend.MessageAnnotations.emplace(
-          _detail::PartitionKeyAnnotation, Azure::Core::Amqp::Models::AmqpValue(m_partitionKey));
+      Azure::Core::Amqp::Models::AmqpMessage::Serialize(messageToSend, m_marshalledMessages);
     }
+    catch (...)
+    {
+      m_marshalledMessages.resize(messageStart);
+      throw;
+    }
+    auto const serializedSize = m_marshalledMessages.size() - messageStart;
 
-    auto serializedMessage = Azure::Core::Amqp::Models::AmqpMessage::Serialize(messageToSend);
-
-    std::lock_guard<std::mutex> lock(m_rwMutex);
-
-    if (m_marshalledMessages.empty())
+    if (m_marshalledMessageEnds.empty())
     {
       // The first message is special - we use its properties and annotations on the envelope for
       // the batch message.
       m_batchEnvelope = CreateBatchEnvelope(message);
-      m_currentSize = serializedMessage.size();
+      m_currentSize = serializedSize;
     }
-    auto actualPayloadSize = CalculateActualSizeForPayload(serializedMessage);
+    auto actualPayloadSize = CalculateActualSizeForPayload(serializedSize);
     if (m_currentSize + actualPayloadSize > m_maxBytes.Value())
     {
+      m_marshalledMessages.resize(messageStart);
       Log::Stream(Logger::Level::Informational)
           << "Batch is full. Cannot add more messages. "
           << "Message size: " << actualPayloadSize << " size: " << m_currentSize
           << " Max size: " << m_maxBytes.Value() << std::endl;
       // If we don't have any messages and we can't add this one, then we can't add it at all.
       // Discard the contents of the batch.
-      if (m_marshalledMessages.empty())
+      if (m_marshalledMessageEnds.empty())
       {
         m_currentSize = 0;
         m_batchEnvelope = nullptr;
@@ -92,7 +116,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     }
 
     m_currentSize += actualPayloadSize;
-    m_marshalledMessages.push_back(serializedMessage);
+    m_marshalledMessageEnds.push_back(m_marshalledMessages.size());
     return true;
   }
 
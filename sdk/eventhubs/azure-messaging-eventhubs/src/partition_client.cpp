@@ -270,4 +270,46 @@ namespace Azure { namespace Messaging { namespace EventHubs {
 
     return messages;
   }
+
+  std::vector<Models::ReceivedEventView> PartitionClient::ReceiveEventViews(
+      uint32_t maxMessages,
+      Core::Context const& context)
+  {
+    std::vector<Models::ReceivedEventView> messages;
+
+    while (messages.size() < maxMessages && !context.IsCancelled())
+    {
+      // TryWaitForIncomingMessageView will return two empty values if there is no data available.
+      auto result = m_receiver.TryWaitForIncomingMessageView();
+      if (result.first)
+      {
+        messages.emplace_back(result.first);
+      }
+      else if (result.second)
+      {
+        throw _detail::EventHubsExceptionFactory::CreateEventHubsException(result.second);
+      }
+      // If we haven't gotten *any* messages, we're done. Otherwise, we'll wait for more.
+      else if (!messages.empty())
+      {
+        break;
+      }
+      else
+      {
+        result = m_receiver.WaitForIncomingMessageView(context);
+        if (result.first)
+        {
+          messages.emplace_back(result.first);
+        }
+        else
+        {
+          throw _detail::EventHubsExceptionFactory::CreateEventHubsException(result.second);
+        }
+      }
+    }
+    Log::Stream(Logger::Level::Verbose)
+        << "Receive Event Views. Return " << messages.size() << " messages.";
+
+    return messages;
+  }
 }}} // namespace Azure::Messaging::EventHubs
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "private/partition_resolver.hpp"
+
+#include <cstdlib>
+
+namespace {
+constexpr std::uint32_t Rotate(std::uint32_t value, int count)
+{
+  return (value << count) | (value >> (32 - count));
+}
+
+std::uint32_t ReadUInt32(std::uint8_t const* data)
+{
+  return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8)
+      | (static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+// Bob Jenkins' lookup3 hashlittle2: computes two 32 bit hashes of the data at once.
+void ComputeHash(
+    std::uint8_t const* data,
+    std::size_t length,
+    std::uint32_t& hash1,
+    std::uint32_t& hash2)
+{
+  std::uint32_t a = 0xdeadbeef + static_cast<std::uint32_t>(length) + hash1;
+  std::uint32_t b = a;
+  std::uint32_t c = a + hash2;
+
+  while (length > 12)
+  {
+    a += ReadUInt32(data);
+    b += ReadUInt32(data + 4);
+    c += ReadUInt32(data + 8);
+
+    a -= c;
+    a ^= Rotate(c, 4);
+    c += b;
+    b -= a;
+    b ^= Rotate(a, 6);
+    a += c;
+    c -= b;
+    c ^= Rotate(b, 8);
+    b += a;
+    a -= c;
+    a ^= Rotate(c, 16);
+    c += b;
+    b -= a;
+    b ^= Rotate(a, 19);
+    a += c;
+    c -= b;
+    c ^= Rotate(b, 4);
+    b += a;
+
+    length -= 12;
+    data += 12;
+  }
+
+  if (length == 0)
+  {
+    hash1 = c;
+    hash2 = b;
+    return;
+  }
+
+  // The last block is zero padded.
+  std::uint8_t tail[12] = {};
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    tail[i] = data[i];
+  }
+  a += ReadUInt32(tail);
+  b += ReadUInt32(tail + 4);
+  c += ReadUInt32(tail + 8);
+
+  c ^= b;
+  c -= Rotate(b, 14);
+  a ^= c;
+  a -= Rotate(c, 11);
+  b ^= a;
+  b -= Rotate(a, 25);
+  c ^= b;
+  c -= Rotate(b, 16);
+  a ^= c;
+  a -= Rotate(c, 4);
+  b ^= a;
+  b -= Rotate(a, 14);
+  c ^= b;
+  c -= Rotate(b, 24);
+
+  hash1 = c;
+  hash2 = b;
+}
+} // namespace
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+  std::int16_t PartitionResolver::GenerateHashCode(std::string const& partitionKey)
+  {
+    std::uint32_t hash1 = 0;
+    std::uint32_t hash2 = 0;
+    ComputeHash(
+        reinterpret_cast<std::uint8_t const*>(partitionKey.data()),
+        partitionKey.size(),
+        hash1,
+        hash2);
+    return static_cast<std::int16_t>(hash1 ^ hash2);
+  }
+
+  std::size_t PartitionResolver::FindPartitionIndex(
+      std::string const& partitionKey,
+      std::size_t partitionCount)
+  {
+    auto const hashCode = GenerateHashCode(partitionKey);
+    return static_cast<std::size_t>(std::abs(hashCode % static_cast<int>(partitionCount)));
+  }
+}}}} // namespace Azure::Messaging::EventHubs::_detail
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+  /**
+   * @brief Assigns partition keys to partitions on the client.
+   *
+   * @remark The key is hashed with Jenkins' lookup3 hash, like the other Event Hubs client
+   * libraries do, so that the events with the same key always go to the same partition.
+   */
+  class PartitionResolver final {
+  public:
+    /**
+     * @brief Compute the 16 bit hash code of a partition key.
+     *
+     * @param partitionKey The partition key.
+     */
+    static std::int16_t GenerateHashCode(std::string const& partitionKey);
+
+    /**
+     * @brief Find the index of the partition to which a partition key is assigned.
+     *
+     * @param partitionKey The partition key.
+     * @param partitionCount The number of partitions of the Event Hub, which must not be 0.
+     *
+     * @return The index of the partition in [0, partitionCount).
+     */
+    static std::size_t FindPartitionIndex(
+        std::string const& partitionKey,
+        std::size_t partitionCount);
+  };
+}}}} // namespace Azure::Messaging::EventHubs::_detail
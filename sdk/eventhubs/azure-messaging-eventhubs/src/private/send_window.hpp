@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <azure/core/context.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+  /**
+   * @brief Limits the number of sends to a partition which wait to be settled by the service.
+   *
+   * @remark A send acquires a slot in the window before it is started, and releases it once it is
+   * settled. When all the slots are taken, the next send waits for one of them to be released.
+   */
+  class SendWindow final {
+  public:
+    /**
+     * @brief Construct a new SendWindow.
+     *
+     * @param size The number of sends which can wait to be settled at the same time. A size of 0
+     * is treated as 1.
+     */
+    explicit SendWindow(std::uint32_t size) : m_size{size == 0 ? 1 : size} {}
+
+    SendWindow(SendWindow const&) = delete;
+    SendWindow& operator=(SendWindow const&) = delete;
+
+    /**
+     * @brief Take a slot in the window, waiting for one to be released if they are all taken.
+     *
+     * @param context The context used to cancel the wait.
+     *
+     * @throw Azure::Core::OperationCancelledException if the context is cancelled before a slot is
+     * available.
+     */
+    void Acquire(Azure::Core::Context const& context);
+
+    /**
+     * @brief Release a slot taken by #Acquire.
+     *
+     */
+    void Release();
+
+    /**
+     * @brief Wait until all the slots are released.
+     *
+     * @param context The context used to cancel the wait.
+     *
+     * @return true if all the slots were released, false if the context was cancelled first.
+     */
+    bool WaitForAll(Azure::Core::Context const& context);
+
+    /**
+     * @brief Get the number of slots currently taken.
+     *
+     */
+    std::uint32_t GetPendingCount() const;
+
+  private:
+    mutable std::mutex m_mutex;
+    std::condition_variable m_released;
+    std::uint32_t const m_size;
+    std::uint32_t m_pending{0};
+  };
+}}}} // namespace Azure::Messaging::EventHubs::_detail
@@ -90,4 +90,24 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     m_checkpointStore->UpdateCheckpoint(checkpoint, context);
   }
 
+  void ProcessorPartitionClient::UpdateCheckpoint(
+      Models::ReceivedEventView const& eventView,
+      Core::Context const& context)
+  {
+    auto sequenceNumber{eventView.GetSequenceNumber()};
+    if (!sequenceNumber.HasValue())
+    {
+      throw std::runtime_error("Event does not have a sequence number.");
+    }
+
+    Models::Checkpoint checkpoint;
+    checkpoint.ConsumerGroup = m_consumerClientDetails.ConsumerGroup;
+    checkpoint.FullyQualifiedNamespaceName = m_consumerClientDetails.FullyQualifiedNamespace;
+    checkpoint.PartitionId = m_partitionId;
+    checkpoint.EventHubName = m_consumerClientDetails.EventHubName;
+    checkpoint.SequenceNumber = sequenceNumber;
+    checkpoint.Offset = eventView.GetOffset();
+    m_checkpointStore->UpdateCheckpoint(checkpoint, context);
+  }
+
 }}} // namespace Azure::Messaging::EventHubs
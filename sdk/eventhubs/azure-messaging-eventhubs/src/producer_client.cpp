@@ -8,6 +8,7 @@
 #include "private/eventhubs_constants.hpp"
 #include "private/eventhubs_utilities.hpp"
 #include "private/retry_operation.hpp"
+#include "private/send_window.hpp"
 
 #include <azure/core/amqp.hpp>
 #include <azure/core/amqp/internal/message_sender.hpp>
@@ -44,6 +45,13 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         m_propertiesClient.reset();
       }
     }
+    Log::Stream(Logger::Level::Verbose) << "Waiting for pending sends.";
+    for (auto& window : m_sendWindows)
+    {
+      window.second->WaitForAll(context);
+    }
+    m_sendWindows.clear();
+
     Log::Stream(Logger::Level::Verbose) << "Closing message senders.";
     for (auto& sender : m_senders)
     {
@@ -112,6 +120,59 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     });
   }
 
+  std::future<void> ProducerClient::SendAsync(
+      EventDataBatch const& eventDataBatch,
+      Core::Context const& context)
+  {
+    auto message = eventDataBatch.ToAmqpMessage();
+    auto promise = std::make_shared<std::promise<void>>();
+    auto result = promise->get_future();
+
+#if ENABLE_UAMQP
+    auto window = GetSendWindow(eventDataBatch.GetPartitionId());
+    window->Acquire(context);
+    try
+    {
+      GetSender(eventDataBatch.GetPartitionId())
+          .SendAsync(
+              message,
+              [window, promise](
+                  Azure::Core::Amqp::_internal::MessageSendStatus sendStatus,
+                  Azure::Core::Amqp::Models::_internal::AmqpError const& error) {
+                if (sendStatus == Azure::Core::Amqp::_internal::MessageSendStatus::Ok)
+                {
+                  promise->set_value();
+                }
+                else
+                {
+                  promise->set_exception(std::make_exception_ptr(
+                      Azure::Messaging::EventHubs::_detail::EventHubsExceptionFactory::
+                          CreateEventHubsException(error)));
+                }
+                window->Release();
+              },
+              context);
+    }
+    catch (...)
+    {
+      window->Release();
+      throw;
+    }
+#elif ENABLE_RUST_AMQP
+    // The Rust AMQP message sender can only send synchronously.
+    try
+    {
+      Send(eventDataBatch, context);
+      promise->set_value();
+    }
+    catch (...)
+    {
+      promise->set_exception(std::current_exception());
+    }
+#endif
+    return result;
+  }
+
   void ProducerClient::Send(Models::EventData const& eventData, Core::Context const& context)
   {
     auto batch = CreateBatch(EventDataBatchOptions{}, context);
@@ -225,14 +286,26 @@ namespace Azure { namespace Messaging { namespace EventHubs {
             CreateEventHubsException(openResult);
       }
       m_senders.emplace(partitionId, std::move(sender));
+      m_sendWindows.emplace(
+          partitionId,
+          std::make_shared<_detail::SendWindow>(
+              m_producerClientOptions.MaxPendingSendsPerPartition));
     }
   }
   Azure::Core::Amqp::_internal::MessageSender ProducerClient::GetSender(
       std::string const& partitionId)
   {
+    std::unique_lock<std::mutex> lock(m_sendersLock);
     return m_senders.at(partitionId);
   }
 
+  std::shared_ptr<_detail::SendWindow> ProducerClient::GetSendWindow(
+      std::string const& partitionId)
+  {
+    std::unique_lock<std::mutex> lock(m_sendersLock);
+    return m_sendWindows.at(partitionId);
+  }
+
   Azure::Core::Amqp::_internal::Session ProducerClient::CreateSession(
       std::string const& partitionId,
       Azure::Core::Context const& context)
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "private/send_window.hpp"
+
+#include <chrono>
+
+namespace {
+// Context cancellation cannot be waited on, so waits wake up at this interval to check it.
+constexpr std::chrono::milliseconds CancellationCheckInterval{10};
+} // namespace
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+  void SendWindow::Acquire(Azure::Core::Context const& context)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_released.wait_for(
+        lock, CancellationCheckInterval, [this]() { return m_pending < m_size; }))
+    {
+      context.ThrowIfCancelled();
+    }
+    context.ThrowIfCancelled();
+    ++m_pending;
+  }
+
+  void SendWindow::Release()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      --m_pending;
+    }
+    m_released.notify_all();
+  }
+
+  bool SendWindow::WaitForAll(Azure::Core::Context const& context)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_released.wait_for(
+        lock, CancellationCheckInterval, [this]() { return m_pending == 0; }))
+    {
+      if (context.IsCancelled())
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::uint32_t SendWindow::GetPendingCount() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending;
+  }
+}}}} // namespace Azure::Messaging::EventHubs::_detail
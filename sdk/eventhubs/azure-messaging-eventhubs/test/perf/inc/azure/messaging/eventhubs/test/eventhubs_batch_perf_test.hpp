@@ -16,6 +16,8 @@
 #include <azure/messaging/eventhubs/producer_client.hpp>
 #include <azure/perf.hpp>
 
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -38,6 +40,7 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace PerfTest
     uint64_t m_rounds;
     uint32_t m_paddingBytes{};
     uint32_t m_maxDeadlineExceeded{};
+    uint32_t m_maxPendingSends{};
 
     std::shared_ptr<const Azure::Core::Credentials::TokenCredential> m_credential;
     std::unique_ptr<Azure::Messaging::EventHubs::ProducerClient> m_client;
@@ -65,12 +68,18 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace PerfTest
       m_paddingBytes = m_options.GetOptionOrDefault<uint32_t>("PaddingBytes", 1024);
       m_partitionId = m_options.GetOptionOrDefault<std::string>("PartitionId", "0");
       m_maxDeadlineExceeded = m_options.GetOptionOrDefault<uint32_t>("MaxTimeouts", 10);
+      m_maxPendingSends = m_options.GetOptionOrDefault<uint32_t>("MaxPendingSends", 0);
 
       {
         m_credential = GetTestCredential();
 
+        Azure::Messaging::EventHubs::ProducerClientOptions producerOptions;
+        if (m_maxPendingSends > 0)
+        {
+          producerOptions.MaxPendingSendsPerPartition = m_maxPendingSends;
+        }
         m_client = std::make_unique<Azure::Messaging::EventHubs::ProducerClient>(
-            m_eventHubHost, m_eventHubName, m_credential);
+            m_eventHubHost, m_eventHubName, m_credential, producerOptions);
       }
     }
 
@@ -132,6 +141,24 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace PerfTest
       Azure::Messaging::EventHubs::EventDataBatchOptions batchOptions;
       batchOptions.PartitionId = m_partitionId;
       Azure::Messaging::EventHubs::EventDataBatch batch{m_client->CreateBatch(batchOptions)};
+
+      // When MaxPendingSends is set, full batches are sent without waiting for the previous ones
+      // to be settled.
+      std::vector<std::future<void>> pendingSends;
+      size_t batchCount = 0;
+      auto sendBatch = [&]() {
+        ++batchCount;
+        if (m_maxPendingSends > 0)
+        {
+          pendingSends.push_back(m_client->SendAsync(batch, context));
+        }
+        else
+        {
+          m_client->Send(batch, context);
+        }
+      };
+
+      auto const sendStart = std::chrono::steady_clock::now();
       for (uint32_t j = 0; j < m_numberToSend; ++j)
       {
 
@@ -143,10 +170,23 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace PerfTest
         AddEndProperty(event, m_numberToSend);
         if (!batch.TryAdd(event))
         {
-          throw std::runtime_error("Could not add message to batch.");
+          sendBatch();
+          batch = m_client->CreateBatch(batchOptions);
+          if (!batch.TryAdd(event))
+          {
+            throw std::runtime_error("Could not add message to batch.");
+          }
         }
       }
-      m_client->Send(batch, context);
+      sendBatch();
+      for (auto& pendingSend : pendingSends)
+      {
+        pendingSend.get();
+      }
+      auto const sendDuration = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - sendStart);
+      std::cout << "Sent " << m_numberToSend << " events in " << batchCount << " batches in "
+                << sendDuration.count() << " ms" << std::endl;
 
       auto afterSendProps = m_client->GetPartitionProperties(m_partitionId, context);
 
@@ -238,6 +278,12 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace PerfTest
            1,
            false},
           {"MaxTimeouts", {"--maxTimeouts"}, "The max number of timeouts.", 1, false},
+          {"MaxPendingSends",
+           {"--maxPendingSends"},
+           "The number of batches sent without waiting for the previous ones to be settled. 0 "
+           "sends each batch synchronously.",
+           1,
+           false},
           {"TenantId", {"--tenantId"}, "The tenant Id for the authentication.", 1, false},
           {"ClientId", {"--clientId"}, "The client Id for the authentication.", 1, false},
           {"Secret", {"--secret"}, "The secret for authentication.", 1, false, true}};
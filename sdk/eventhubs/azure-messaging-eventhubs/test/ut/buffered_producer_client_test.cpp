@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "eventhubs_test_base.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/identity.hpp>
+#include <azure/messaging/eventhubs.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
+
+  class BufferedProducerClientTest : public EventHubsTestBase {
+  protected:
+    std::atomic<size_t> m_sentEvents{0};
+    std::atomic<size_t> m_sentBatches{0};
+    std::atomic<size_t> m_failedEvents{0};
+    std::mutex m_partitionsLock;
+    std::map<std::string, size_t> m_eventsPerPartition;
+    std::vector<Models::EventData> m_events;
+
+    std::unique_ptr<BufferedProducerClient> CreateBufferedProducerClient(
+        BufferedProducerClientOptions options = {})
+    {
+      options.SendSucceeded = [this](
+                                  std::string const& partitionId,
+                                  std::vector<Models::EventData> const& events) {
+        m_sentEvents += events.size();
+        ++m_sentBatches;
+        std::lock_guard<std::mutex> lock(m_partitionsLock);
+        m_eventsPerPartition[partitionId] += events.size();
+        m_events.insert(m_events.end(), events.begin(), events.end());
+      };
+      options.SendFailed = [this](
+                               std::string const&,
+                               std::vector<Models::EventData> const& events,
+                               std::exception_ptr) { m_failedEvents += events.size(); };
+      return std::make_unique<BufferedProducerClient>(
+          GetEnv("EVENTHUBS_HOST"), GetEnv("EVENTHUB_NAME"), GetTestCredential(), options);
+    }
+  };
+
+  TEST_F(BufferedProducerClientTest, EnqueueAndFlush_LIVEONLY_)
+  {
+    BufferedProducerClientOptions options;
+    options.MaxWaitTime = std::chrono::minutes(1);
+    auto client{CreateBufferedProducerClient(options)};
+
+    EnqueueEventOptions enqueueOptions;
+    enqueueOptions.PartitionId = "1";
+    for (int i = 0; i < 100; i++)
+    {
+      client->Enqueue(Models::EventData{"Event " + std::to_string(i)}, enqueueOptions);
+    }
+    // The batch is neither full nor expired, so it waits for more events.
+    EXPECT_EQ(client->GetBufferedEventCount(), 100u);
+
+    client->Flush();
+    EXPECT_EQ(client->GetBufferedEventCount(), 0u);
+    EXPECT_EQ(m_sentEvents, 100u);
+    EXPECT_EQ(m_sentBatches, 1u);
+    EXPECT_EQ(m_failedEvents, 0u);
+    EXPECT_EQ(m_eventsPerPartition["1"], 100u);
+  }
+
+  TEST_F(BufferedProducerClientTest, MaxWaitTime_LIVEONLY_)
+  {
+    BufferedProducerClientOptions options;
+    options.MaxWaitTime = std::chrono::milliseconds(100);
+    auto client{CreateBufferedProducerClient(options)};
+
+    EnqueueEventOptions enqueueOptions;
+    enqueueOptions.PartitionKey = "key";
+    client->Enqueue(Models::EventData{"Event"}, enqueueOptions);
+
+    for (int i = 0; i < 100 && m_sentEvents == 0; i++)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    EXPECT_EQ(m_sentEvents, 1u);
+
+    // The partition key is sent with the event, so that consumers can read it.
+    std::lock_guard<std::mutex> lock(m_partitionsLock);
+    ASSERT_EQ(m_events.size(), 1u);
+    auto annotations{m_events[0].GetRawAmqpMessage()->MessageAnnotations};
+    auto partitionKey{annotations.find("x-opt-partition-key")};
+    ASSERT_TRUE(partitionKey != annotations.end());
+    EXPECT_EQ(static_cast<std::string>(partitionKey->second), "key");
+  }
+
+  TEST_F(BufferedProducerClientTest, FullBatchesAndPartitions_LIVEONLY_)
+  {
+    BufferedProducerClientOptions options;
+    options.MaxBytes = 1024;
+    auto client{CreateBufferedProducerClient(options)};
+
+    // Without partition key nor ID, the events are spread over the partitions.
+    for (int i = 0; i < 200; i++)
+    {
+      client->Enqueue(Models::EventData{std::string(100, 'a')});
+    }
+    EnqueueEventOptions enqueueOptions;
+    enqueueOptions.PartitionId = "0";
+    enqueueOptions.PartitionKey = "key";
+    EXPECT_THROW(client->Enqueue(Models::EventData{"Event"}, enqueueOptions), std::runtime_error);
+
+    // Closing the client sends the buffered events.
+    client->Close();
+    EXPECT_EQ(m_sentEvents, 200u);
+    EXPECT_GT(m_sentBatches, m_eventsPerPartition.size());
+    EXPECT_GT(m_eventsPerPartition.size(), 1u);
+    EXPECT_THROW(client->Enqueue(Models::EventData{"Event"}), std::runtime_error);
+  }
+}}}} // namespace Azure::Messaging::EventHubs::Test
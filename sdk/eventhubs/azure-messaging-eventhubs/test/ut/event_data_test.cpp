@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "../src/private/eventhubs_constants.hpp"
+#include "../src/private/eventhubs_utilities.hpp"
 #include "azure/messaging/eventhubs.hpp"
 #include "eventhubs_test_base.hpp"
 
@@ -241,4 +242,99 @@ TEST_F(EventDataTest, ReceivedEventData)
     EXPECT_FALSE(receivedEventData.EnqueuedTime);
     EXPECT_FALSE(receivedEventData.PartitionKey);
   }
-}
\ No newline at end of file
+}
+TEST_F(EventDataTest, ReceivedEventView)
+{
+  Azure::Core::Amqp::Models::AmqpMessage message;
+  message.SetBody(Azure::Core::Amqp::Models::AmqpBinaryData{1, 2, 3, 4});
+  message.Properties.ContentType = "application/binary";
+  message.Properties.MessageId = "MessageId";
+  message.ApplicationProperties["prop"] = "value";
+
+  Azure::DateTime timeNow{
+      std::chrono::time_point_cast<std::chrono::milliseconds>(Azure::DateTime::clock::now())};
+  message.MessageAnnotations[Azure::Core::Amqp::Models::AmqpSymbol{
+      Azure::Messaging::EventHubs::_detail::EnqueuedTimeAnnotation}
+                                 .AsAmqpValue()]
+      = Azure::Core::Amqp::Models::AmqpTimestamp{
+          std::chrono::duration_cast<std::chrono::milliseconds>(timeNow.time_since_epoch())}
+            .AsAmqpValue();
+  message.MessageAnnotations[Azure::Core::Amqp::Models::AmqpSymbol{
+      Azure::Messaging::EventHubs::_detail::SequenceNumberAnnotation}
+                                 .AsAmqpValue()]
+      = static_cast<int64_t>(235);
+  message.MessageAnnotations[Azure::Core::Amqp::Models::AmqpSymbol{
+      Azure::Messaging::EventHubs::_detail::OffsetAnnotation}
+                                 .AsAmqpValue()]
+      = "54644";
+  message.MessageAnnotations[Azure::Core::Amqp::Models::AmqpSymbol{"x-opt-custom"}.AsAmqpValue()]
+      = 17;
+
+  Azure::Messaging::EventHubs::Models::ReceivedEventView eventView{
+      Azure::Core::Amqp::Models::AmqpMessageView{message}};
+
+  auto body = eventView.GetBody();
+  EXPECT_EQ(std::vector<uint8_t>(body.begin(), body.end()), (std::vector<uint8_t>{1, 2, 3, 4}));
+  EXPECT_EQ(eventView.GetContentType().Value(), "application/binary");
+  EXPECT_EQ(eventView.GetMessageId(), Azure::Core::Amqp::Models::AmqpValue{"MessageId"});
+  EXPECT_TRUE(eventView.GetCorrelationId().IsNull());
+  EXPECT_EQ(eventView.GetProperties(), message.ApplicationProperties);
+  ASSERT_TRUE(eventView.GetEnqueuedTime());
+  EXPECT_EQ(eventView.GetEnqueuedTime().Value(), timeNow);
+  ASSERT_TRUE(eventView.GetSequenceNumber());
+  EXPECT_EQ(eventView.GetSequenceNumber().Value(), 235);
+  ASSERT_TRUE(eventView.GetOffset());
+  EXPECT_EQ(eventView.GetOffset().Value(), "54644");
+  EXPECT_FALSE(eventView.GetPartitionKey());
+
+  // The view decodes the same fields as the eagerly decoded ReceivedEventData.
+  Azure::Messaging::EventHubs::Models::ReceivedEventData receivedEventData{
+      std::make_shared<Azure::Core::Amqp::Models::AmqpMessage>(message)};
+  EXPECT_EQ(eventView.GetSystemProperties(), receivedEventData.SystemProperties);
+  EXPECT_EQ(eventView.GetSystemProperties().size(), 1ul);
+
+  auto converted = eventView.ToReceivedEventData();
+  EXPECT_EQ(converted.Body, receivedEventData.Body);
+  EXPECT_EQ(converted.SequenceNumber.Value(), receivedEventData.SequenceNumber.Value());
+  EXPECT_EQ(converted.Offset.Value(), receivedEventData.Offset.Value());
+  EXPECT_EQ(*converted.GetRawAmqpMessage(), message);
+
+  // The body is only exposed when it is a single binary data section.
+  message.SetBody(Azure::Core::Amqp::Models::AmqpBinaryData{5, 6});
+  EXPECT_TRUE(Azure::Messaging::EventHubs::Models::ReceivedEventView{
+      Azure::Core::Amqp::Models::AmqpMessageView{message}}
+                  .GetBody()
+                  .empty());
+}
+
+TEST_F(EventDataTest, EventDataBatch)
+{
+  Azure::Messaging::EventHubs::EventDataBatchOptions options;
+  options.MaxBytes = 1024;
+  auto batch{
+      Azure::Messaging::EventHubs::_detail::EventDataBatchFactory::CreateEventDataBatch(options)};
+
+  size_t eventCount = 0;
+  while (batch.TryAdd(EventData{std::string(100, static_cast<char>('a' + eventCount))}))
+  {
+    eventCount += 1;
+  }
+  EXPECT_GT(eventCount, 1u);
+  EXPECT_EQ(batch.NumberOfEvents(), eventCount);
+
+  // A rejected event does not change the content of the batch.
+  EXPECT_FALSE(batch.TryAdd(EventData{std::string(2000, 'z')}));
+  EXPECT_EQ(batch.NumberOfEvents(), eventCount);
+
+  auto batchMessage = batch.ToAmqpMessage();
+  auto const& messages = batchMessage.GetBodyAsBinary();
+  ASSERT_EQ(messages.size(), eventCount);
+  for (size_t i = 0; i < eventCount; i++)
+  {
+    auto message = AmqpMessage::Deserialize(messages[i].data(), messages[i].size());
+    EXPECT_FALSE(message.Properties.MessageId.IsNull());
+    ASSERT_EQ(message.GetBodyAsBinary().size(), 1u);
+    EXPECT_EQ(
+        message.GetBodyAsBinary()[0], std::vector<uint8_t>(100, static_cast<uint8_t>('a' + i)));
+  }
+}
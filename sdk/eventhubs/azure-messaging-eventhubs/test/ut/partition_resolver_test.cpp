@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../src/private/partition_resolver.hpp"
+
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using Azure::Messaging::EventHubs::_detail::PartitionResolver;
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
+
+  TEST(PartitionResolverTest, HashCode)
+  {
+    // lookup3 hashes "Four score and seven years ago" to 0x17770551 and 0xce7226e6.
+    EXPECT_EQ(PartitionResolver::GenerateHashCode("Four score and seven years ago"), 0x23b7);
+    // The empty key is hashed to 0xdeadbeef twice.
+    EXPECT_EQ(PartitionResolver::GenerateHashCode(""), 0);
+    EXPECT_EQ(PartitionResolver::GenerateHashCode("a"), -16220);
+  }
+
+  TEST(PartitionResolverTest, FindPartitionIndex)
+  {
+    EXPECT_EQ(PartitionResolver::FindPartitionIndex("a", 32), 28u);
+    EXPECT_EQ(PartitionResolver::FindPartitionIndex("partition-key", 32), 5u);
+    EXPECT_EQ(PartitionResolver::FindPartitionIndex("partition-key", 1), 0u);
+
+    // The same key always goes to the same partition, and the keys are spread over the
+    // partitions.
+    std::set<std::size_t> partitions;
+    for (int i = 0; i < 100; ++i)
+    {
+      auto const key = "key" + std::to_string(i);
+      auto const index = PartitionResolver::FindPartitionIndex(key, 4);
+      EXPECT_LT(index, 4u);
+      EXPECT_EQ(index, PartitionResolver::FindPartitionIndex(key, 4));
+      partitions.insert(index);
+    }
+    EXPECT_EQ(partitions.size(), 4u);
+  }
+}}}} // namespace Azure::Messaging::EventHubs::Test
@@ -9,7 +9,9 @@
 #include <azure/identity.hpp>
 #include <azure/messaging/eventhubs.hpp>
 
+#include <future>
 #include <numeric>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -79,6 +81,36 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
     }
   }
 
+  TEST_P(ProducerClientTest, SendAsync_LIVEONLY_)
+  {
+    Azure::Messaging::EventHubs::ProducerClientOptions producerOptions;
+    producerOptions.Name = "sender-link";
+    producerOptions.ApplicationID = "some";
+    producerOptions.MaxPendingSendsPerPartition = 4;
+
+    auto client{CreateProducerClient("", producerOptions)};
+
+    Azure::Messaging::EventHubs::EventDataBatchOptions edboptions;
+    edboptions.PartitionId = "1";
+    Azure::Messaging::EventHubs::EventDataBatch eventBatch{client->CreateBatch(edboptions)};
+    EXPECT_TRUE(eventBatch.TryAdd(Azure::Messaging::EventHubs::Models::EventData{"Hello"}));
+
+    // More sends than the window size, so that some of them wait for earlier ones to settle.
+    std::vector<std::future<void>> sends;
+    for (int i = 0; i < 10; i++)
+    {
+      sends.push_back(client->SendAsync(eventBatch));
+    }
+    for (auto& send : sends)
+    {
+      EXPECT_NO_THROW(send.get());
+    }
+
+    Azure::Core::Context cancelled;
+    cancelled.Cancel();
+    EXPECT_THROW(client->SendAsync(eventBatch, cancelled), Azure::Core::OperationCancelledException);
+  }
+
   TEST_P(ProducerClientTest, EventHubRawMessageSend_LIVEONLY_)
   {
     Azure::Messaging::EventHubs::ProducerClientOptions producerOptions;
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../src/private/send_window.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/exception.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using Azure::Messaging::EventHubs::_detail::SendWindow;
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
+
+  TEST(SendWindowTest, AcquireUpToSize)
+  {
+    SendWindow window(3);
+    Azure::Core::Context context;
+    window.Acquire(context);
+    window.Acquire(context);
+    window.Acquire(context);
+    EXPECT_EQ(window.GetPendingCount(), 3u);
+
+    window.Release();
+    EXPECT_EQ(window.GetPendingCount(), 2u);
+    window.Acquire(context);
+    EXPECT_EQ(window.GetPendingCount(), 3u);
+  }
+
+  TEST(SendWindowTest, ZeroSize)
+  {
+    SendWindow window(0);
+    Azure::Core::Context context;
+    window.Acquire(context);
+    EXPECT_EQ(window.GetPendingCount(), 1u);
+  }
+
+  TEST(SendWindowTest, AcquireWaitsForRelease)
+  {
+    SendWindow window(1);
+    Azure::Core::Context context;
+    window.Acquire(context);
+
+    std::atomic<bool> acquired{false};
+    std::thread waiter([&]() {
+      window.Acquire(context);
+      acquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(acquired);
+
+    window.Release();
+    waiter.join();
+    EXPECT_TRUE(acquired);
+    EXPECT_EQ(window.GetPendingCount(), 1u);
+  }
+
+  TEST(SendWindowTest, AcquireCancelled)
+  {
+    SendWindow window(1);
+    Azure::Core::Context context;
+    window.Acquire(context);
+
+    auto cancelled = context.WithDeadline(
+        std::chrono::system_clock::now() + std::chrono::milliseconds(50));
+    EXPECT_THROW(window.Acquire(cancelled), Azure::Core::OperationCancelledException);
+    EXPECT_EQ(window.GetPendingCount(), 1u);
+  }
+
+  TEST(SendWindowTest, WaitForAll)
+  {
+    SendWindow window(2);
+    Azure::Core::Context context;
+    EXPECT_TRUE(window.WaitForAll(context));
+
+    window.Acquire(context);
+    window.Acquire(context);
+    auto cancelled = context.WithDeadline(
+        std::chrono::system_clock::now() + std::chrono::milliseconds(50));
+    EXPECT_FALSE(window.WaitForAll(cancelled));
+
+    std::thread releaser([&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      window.Release();
+      window.Release();
+    });
+    EXPECT_TRUE(window.WaitForAll(context));
+    releaser.join();
+  }
+}}}} // namespace Azure::Messaging::EventHubs::Test
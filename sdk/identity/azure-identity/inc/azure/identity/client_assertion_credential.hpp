@@ -44,6 +44,15 @@ namespace Azure { namespace Identity {
      * for any tenant in which the application is installed.
      */
     std::vector<std::string> AdditionallyAllowedTenants;
+
+    /**
+     * @brief The fraction of a token's lifetime after which the credential gets a new token on a
+     * background thread, while the cached token keeps being returned, for example `0.5`.
+     *
+     * @note Defaults to 0, which disables the background refresh: a new token is then obtained by
+     * the caller that finds the cached token about to expire.
+     */
+    double TokenRefreshRatio = 0;
   };
 
   /**
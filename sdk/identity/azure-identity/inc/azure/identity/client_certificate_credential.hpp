@@ -69,6 +69,15 @@ namespace Azure { namespace Identity {
      */
     std::vector<std::string> AdditionallyAllowedTenants;
 
+    /**
+     * @brief The fraction of a token's lifetime after which the credential gets a new token on a
+     * background thread, while the cached token keeps being returned, for example `0.5`.
+     *
+     * @note Defaults to 0, which disables the background refresh: a new token is then obtained by
+     * the caller that finds the cached token about to expire.
+     */
+    double TokenRefreshRatio = 0;
+
     /**
      * @brief SendCertificateChain controls whether the credential sends the public certificate
      * chain in the x5c header of each token request's JWT. This is required for Subject Name/Issuer
@@ -87,13 +96,15 @@ namespace Azure { namespace Identity {
    */
   class ClientCertificateCredential final : public Core::Credentials::TokenCredential {
   private:
-    _detail::TokenCache m_tokenCache;
     _detail::ClientCredentialCore m_clientCredentialCore;
     std::unique_ptr<_detail::TokenCredentialImpl> m_tokenCredentialImpl;
     std::string m_requestBody;
     std::string m_tokenPayloadStaticPart;
     std::string m_tokenHeaderEncoded;
     _detail::UniquePrivateKey m_pkey;
+    // Declared last, so that it gets destroyed first, and waits for the background token refreshes
+    // that use the other members.
+    _detail::TokenCache m_tokenCache;
 
     explicit ClientCertificateCredential(
         std::string tenantId,
@@ -102,6 +113,7 @@ namespace Azure { namespace Identity {
         std::string const& authorityHost,
         std::vector<std::string> additionallyAllowedTenants,
         bool sendCertificateChain,
+        double tokenRefreshRatio,
         Core::Credentials::TokenCredentialOptions const& options);
 
     explicit ClientCertificateCredential(
@@ -112,6 +124,7 @@ namespace Azure { namespace Identity {
         std::string const& authorityHost,
         std::vector<std::string> additionallyAllowedTenants,
         bool sendCertificateChain,
+        double tokenRefreshRatio,
         Core::Credentials::TokenCredentialOptions const& options);
 
   public:
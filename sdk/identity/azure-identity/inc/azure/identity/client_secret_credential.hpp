@@ -48,6 +48,15 @@ namespace Azure { namespace Identity {
      * for any tenant in which the application is installed.
      */
     std::vector<std::string> AdditionallyAllowedTenants;
+
+    /**
+     * @brief The fraction of a token's lifetime after which the credential gets a new token on a
+     * background thread, while the cached token keeps being returned, for example `0.5`.
+     *
+     * @note Defaults to 0, which disables the background refresh: a new token is then obtained by
+     * the caller that finds the cached token about to expire.
+     */
+    double TokenRefreshRatio = 0;
   };
 
   /**
@@ -57,10 +66,12 @@ namespace Azure { namespace Identity {
    */
   class ClientSecretCredential final : public Core::Credentials::TokenCredential {
   private:
-    _detail::TokenCache m_tokenCache;
     _detail::ClientCredentialCore m_clientCredentialCore;
     std::unique_ptr<_detail::TokenCredentialImpl> m_tokenCredentialImpl;
     std::string m_requestBody;
+    // Declared last, so that it gets destroyed first, and waits for the background token refreshes
+    // that use the other members.
+    _detail::TokenCache m_tokenCache;
 
     ClientSecretCredential(
         std::string tenantId,
@@ -68,6 +79,7 @@ namespace Azure { namespace Identity {
         std::string const& clientSecret,
         std::string const& authorityHost,
         std::vector<std::string> additionallyAllowedTenants,
+        double tokenRefreshRatio,
         Core::Credentials::TokenCredentialOptions const& options);
 
   public:
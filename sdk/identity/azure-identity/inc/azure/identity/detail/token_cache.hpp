@@ -9,12 +9,17 @@
 
 #pragma once
 
+#include <azure/core/context.hpp>
 #include <azure/core/credentials/credentials.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <tuple>
@@ -58,11 +63,24 @@ namespace Azure { namespace Identity { namespace _detail {
     {
       Core::Credentials::AccessToken AccessToken;
       std::shared_timed_mutex ElementMutex;
+
+      // A point in time after which the token gets refreshed in the background. Guarded by
+      // ElementMutex.
+      std::chrono::system_clock::time_point RefreshOn
+          = (std::chrono::system_clock::time_point::max)();
+
+      // Set while the token is being refreshed in the background.
+      std::atomic<bool> Refreshing{false};
     };
 
     mutable std::map<CacheKey, std::shared_ptr<CacheValue>, CacheKeyComparator> m_cache;
     mutable std::shared_timed_mutex m_cacheMutex;
 
+    double m_refreshRatio = 0;
+    Core::Context m_refreshContext;
+    mutable std::mutex m_refreshesMutex;
+    mutable std::list<std::future<void>> m_refreshes;
+
   private:
     TokenCache(TokenCache const&) = delete;
     TokenCache& operator=(TokenCache const&) = delete;
@@ -78,9 +96,48 @@ namespace Azure { namespace Identity { namespace _detail {
         CacheKey const& key,
         DateTime::duration minimumExpiration) const;
 
+    // Gets the point in time after which a token obtained at \p now gets refreshed in the
+    // background.
+    std::chrono::system_clock::time_point GetRefreshOn(
+        Core::Credentials::AccessToken const& token,
+        std::chrono::system_clock::time_point now) const;
+
+    // Calls refreshToken on a background thread, and puts its result into the item.
+    void StartRefresh(
+        std::shared_ptr<CacheValue> const& item,
+        std::function<Core::Credentials::AccessToken(Core::Context const&)> const& refreshToken)
+        const;
+
+    Core::Credentials::AccessToken GetCachedToken(
+        CacheKey const& key,
+        DateTime::duration minimumExpiration,
+        std::function<Core::Credentials::AccessToken()> const& getNewToken,
+        std::function<Core::Credentials::AccessToken(Core::Context const&)> const& refreshToken)
+        const;
+
   public:
+    /**
+     * @brief Constructs a cache that gets new tokens only when the cached ones are stale.
+     *
+     */
     TokenCache() = default;
-    ~TokenCache() = default;
+
+    /**
+     * @brief Constructs a cache that refreshes the tokens in the background.
+     *
+     * @param refreshRatio The fraction of a token's lifetime after which the token gets refreshed
+     * in the background, while it keeps being returned. Values outside of `(0, 1)` disable the
+     * background refresh.
+     *
+     */
+    explicit TokenCache(double refreshRatio) : m_refreshRatio(refreshRatio) {}
+
+    /**
+     * @brief Destructs `%TokenCache`, and waits for the background refreshes to complete after
+     * cancelling them.
+     *
+     */
+    ~TokenCache();
 
     /**
      * @brief Attempts to get token from cache, and if not found, gets the token using the function
@@ -100,5 +157,31 @@ namespace Azure { namespace Identity { namespace _detail {
         std::string const& tenantId,
         DateTime::duration minimumExpiration,
         std::function<Core::Credentials::AccessToken()> const& getNewToken) const;
+
+    /**
+     * @brief Attempts to get token from cache, and if not found, gets the token using the function
+     * provided, caches it, and returns its value. Once the cached token passes the refresh ratio of
+     * its lifetime, the function gets called on a background thread, and the cached token keeps
+     * being returned in the meantime.
+     *
+     * @param scopeString Authentication scopes (or resource) as string.
+     * @param tenantId TenantId for authentication.
+     * @param minimumExpiration Minimum token lifetime for the cached value to be returned.
+     * @param context A context to control the request lifetime, when the token is obtained on the
+     * calling thread.
+     * @param getNewToken Function to get the new token for the given \p scopeString. It may get
+     * called after this function returns, with a context that is cancelled when the cache gets
+     * destroyed, so it should not capture references to the caller's variables.
+     *
+     * @return Authentication token.
+     *
+     */
+    Core::Credentials::AccessToken GetToken(
+        std::string const& scopeString,
+        std::string const& tenantId,
+        DateTime::duration minimumExpiration,
+        Core::Context const& context,
+        std::function<Core::Credentials::AccessToken(Core::Context const&)> const& getNewToken)
+        const;
   };
 }}} // namespace Azure::Identity::_detail
@@ -31,7 +31,8 @@ ClientAssertionCredentialImpl::ClientAssertionCredentialImpl(
     std::function<std::string(Context const&)> assertionCallback,
     ClientAssertionCredentialOptions const& options)
     : m_assertionCallback(std::move(assertionCallback)),
-      m_clientCredentialCore(tenantId, options.AuthorityHost, options.AdditionallyAllowedTenants)
+      m_clientCredentialCore(tenantId, options.AuthorityHost, options.AdditionallyAllowedTenants),
+      m_tokenCache(options.TokenRefreshRatio)
 {
   bool isTenantIdValid = TenantIdResolver::IsValidTenantId(tenantId);
   if (!isTenantIdValid)
@@ -105,12 +106,14 @@ AccessToken ClientAssertionCredentialImpl::GetToken(
   auto const scopesStr
       = m_clientCredentialCore.GetScopesString(tenantId, tokenRequestContext.Scopes);
 
-  // TokenCache::GetToken() and m_tokenCredentialImpl->GetToken() can only use the lambda
-  // argument when they are being executed. They are not supposed to keep a reference to lambda
-  // argument to call it later. Therefore, any capture made here will outlive the possible time
-  // frame when the lambda might get called.
-  return m_tokenCache.GetToken(scopesStr, tenantId, tokenRequestContext.MinimumExpiration, [&]() {
-    return m_tokenCredentialImpl->GetToken(context, false, [&]() {
+  // TokenCache::GetToken() may call the outer lambda on a background thread after this function
+  // returns, to refresh the token ahead of its expiration. Therefore, the outer lambda captures
+  // copies of the local variables, and the context it is called with. The token cache is destroyed
+  // before the other members, so the captured 'this' stays valid. m_tokenCredentialImpl->GetToken()
+  // can only use its lambda argument when it is being executed, so the inner lambda captures by
+  // reference.
+  auto const getNewToken = [this, scopesStr, tenantId](Context const& tokenContext) {
+    return m_tokenCredentialImpl->GetToken(tokenContext, false, [&]() {
       auto body = m_requestBody;
       if (!scopesStr.empty())
       {
@@ -122,7 +125,7 @@ AccessToken ClientAssertionCredentialImpl::GetToken(
       // assertion callback if the authority host scheme is invalid.
       auto const requestUrl = m_clientCredentialCore.GetRequestUrl(tenantId);
 
-      const std::string assertion = m_assertionCallback(context);
+      const std::string assertion = m_assertionCallback(tokenContext);
 
       body += "&client_assertion=" + Azure::Core::Url::Encode(assertion);
 
@@ -133,7 +136,10 @@ AccessToken ClientAssertionCredentialImpl::GetToken(
 
       return request;
     });
-  });
+  };
+
+  return m_tokenCache.GetToken(
+      scopesStr, tenantId, tokenRequestContext.MinimumExpiration, context, getNewToken);
 }
 
 ClientAssertionCredential::ClientAssertionCredential(
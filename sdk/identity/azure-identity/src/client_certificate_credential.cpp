@@ -536,6 +536,7 @@ ClientCertificateCredential::ClientCertificateCredential(
     std::string const& authorityHost,
     std::vector<std::string> additionallyAllowedTenants,
     bool sendCertificateChain,
+    double tokenRefreshRatio,
     Core::Credentials::TokenCredentialOptions const& options)
     : TokenCredential("ClientCertificateCredential"),
       m_clientCredentialCore(tenantId, authorityHost, additionallyAllowedTenants),
@@ -548,7 +549,8 @@ ClientCertificateCredential::ClientCertificateCredential(
               "&client_id=")
           + Url::Encode(clientId)),
       m_tokenPayloadStaticPart(
-          "\",\"iss\":\"" + clientId + "\",\"sub\":\"" + clientId + "\",\"jti\":\"")
+          "\",\"iss\":\"" + clientId + "\",\"sub\":\"" + clientId + "\",\"jti\":\""),
+      m_tokenCache(tokenRefreshRatio)
 {
   CertificateThumbprint mdVec;
   try
@@ -593,6 +595,7 @@ ClientCertificateCredential::ClientCertificateCredential(
     std::string const& authorityHost,
     std::vector<std::string> additionallyAllowedTenants,
     bool sendCertificateChain,
+    double tokenRefreshRatio,
     Core::Credentials::TokenCredentialOptions const& options)
     : TokenCredential("ClientCertificateCredential"),
       m_clientCredentialCore(tenantId, authorityHost, additionallyAllowedTenants),
@@ -605,7 +608,8 @@ ClientCertificateCredential::ClientCertificateCredential(
               "&client_id=")
           + Url::Encode(clientId)),
       m_tokenPayloadStaticPart(
-          "\",\"iss\":\"" + clientId + "\",\"sub\":\"" + clientId + "\",\"jti\":\"")
+          "\",\"iss\":\"" + clientId + "\",\"sub\":\"" + clientId + "\",\"jti\":\""),
+      m_tokenCache(tokenRefreshRatio)
 {
 
   CertificateThumbprint mdVec;
@@ -635,6 +639,7 @@ ClientCertificateCredential::ClientCertificateCredential(
         options.AuthorityHost,
         options.AdditionallyAllowedTenants,
         options.SendCertificateChain,
+        options.TokenRefreshRatio,
         options)
 {
 }
@@ -651,6 +656,7 @@ ClientCertificateCredential::ClientCertificateCredential(
         ClientCertificateCredentialOptions{}.AuthorityHost,
         ClientCertificateCredentialOptions{}.AdditionallyAllowedTenants,
         false, // By default, we don't send the x5c property
+        ClientCertificateCredentialOptions{}.TokenRefreshRatio,
         options)
 {
 }
@@ -669,6 +675,7 @@ ClientCertificateCredential::ClientCertificateCredential(
         options.AuthorityHost,
         options.AdditionallyAllowedTenants,
         options.SendCertificateChain,
+        options.TokenRefreshRatio,
         options)
 {
 }
@@ -687,12 +694,14 @@ AccessToken ClientCertificateCredential::GetToken(
   auto const scopesStr
       = m_clientCredentialCore.GetScopesString(tenantId, tokenRequestContext.Scopes);
 
-  // TokenCache::GetToken() and m_tokenCredentialImpl->GetToken() can only use the lambda argument
-  // when they are being executed. They are not supposed to keep a reference to lambda argument to
-  // call it later. Therefore, any capture made here will outlive the possible time frame when the
-  // lambda might get called.
-  return m_tokenCache.GetToken(scopesStr, tenantId, tokenRequestContext.MinimumExpiration, [&]() {
-    return m_tokenCredentialImpl->GetToken(context, false, [&]() {
+  // TokenCache::GetToken() may call the outer lambda on a background thread after this function
+  // returns, to refresh the token ahead of its expiration. Therefore, the outer lambda captures
+  // copies of the local variables, and the context it is called with. The token cache is destroyed
+  // before the other members, so the captured 'this' stays valid. m_tokenCredentialImpl->GetToken()
+  // can only use its lambda argument when it is being executed, so the inner lambda captures by
+  // reference.
+  auto const getNewToken = [this, scopesStr, tenantId](Context const& tokenContext) {
+    return m_tokenCredentialImpl->GetToken(tokenContext, false, [&]() {
       auto body = m_requestBody;
       if (!scopesStr.empty())
       {
@@ -751,5 +760,8 @@ AccessToken ClientCertificateCredential::GetToken(
 
       return request;
     });
-  });
+  };
+
+  return m_tokenCache.GetToken(
+      scopesStr, tenantId, tokenRequestContext.MinimumExpiration, context, getNewToken);
 }
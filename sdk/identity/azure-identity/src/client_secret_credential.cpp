@@ -23,13 +23,15 @@ ClientSecretCredential::ClientSecretCredential(
     std::string const& clientSecret,
     std::string const& authorityHost,
     std::vector<std::string> additionallyAllowedTenants,
+    double tokenRefreshRatio,
     Core::Credentials::TokenCredentialOptions const& options)
     : TokenCredential("ClientSecretCredential"),
       m_clientCredentialCore(tenantId, authorityHost, additionallyAllowedTenants),
       m_tokenCredentialImpl(std::make_unique<TokenCredentialImpl>(options)),
       m_requestBody(
           std::string("grant_type=client_credentials&client_id=") + Url::Encode(clientId)
-          + "&client_secret=" + Url::Encode(clientSecret))
+          + "&client_secret=" + Url::Encode(clientSecret)),
+      m_tokenCache(tokenRefreshRatio)
 {
 }
 
@@ -44,6 +46,7 @@ ClientSecretCredential::ClientSecretCredential(
         clientSecret,
         options.AuthorityHost,
         options.AdditionallyAllowedTenants,
+        options.TokenRefreshRatio,
         options)
 {
 }
@@ -59,6 +62,7 @@ ClientSecretCredential::ClientSecretCredential(
         clientSecret,
         ClientSecretCredentialOptions{}.AuthorityHost,
         ClientSecretCredentialOptions{}.AdditionallyAllowedTenants,
+        ClientSecretCredentialOptions{}.TokenRefreshRatio,
         options)
 {
 }
@@ -78,12 +82,14 @@ AccessToken ClientSecretCredential::GetToken(
   auto const scopesStr
       = m_clientCredentialCore.GetScopesString(tenantId, tokenRequestContext.Scopes);
 
-  // TokenCache::GetToken() and m_tokenCredentialImpl->GetToken() can only use the lambda argument
-  // when they are being executed. They are not supposed to keep a reference to lambda argument to
-  // call it later. Therefore, any capture made here will outlive the possible time frame when the
-  // lambda might get called.
-  return m_tokenCache.GetToken(scopesStr, tenantId, tokenRequestContext.MinimumExpiration, [&]() {
-    return m_tokenCredentialImpl->GetToken(context, false, [&]() {
+  // TokenCache::GetToken() may call the outer lambda on a background thread after this function
+  // returns, to refresh the token ahead of its expiration. Therefore, the outer lambda captures
+  // copies of the local variables, and the context it is called with. The token cache is destroyed
+  // before the other members, so the captured 'this' stays valid. m_tokenCredentialImpl->GetToken()
+  // can only use its lambda argument when it is being executed, so the inner lambda captures by
+  // reference.
+  auto const getNewToken = [this, scopesStr, tenantId](Context const& tokenContext) {
+    return m_tokenCredentialImpl->GetToken(tokenContext, false, [&]() {
       auto body = m_requestBody;
 
       if (!scopesStr.empty())
@@ -100,5 +106,8 @@ AccessToken ClientSecretCredential::GetToken(
 
       return request;
     });
-  });
+  };
+
+  return m_tokenCache.GetToken(
+      scopesStr, tenantId, tokenRequestContext.MinimumExpiration, context, getNewToken);
 }
@@ -24,6 +24,9 @@ namespace Azure { namespace Identity { namespace _detail {
     _detail::ClientCredentialCore m_clientCredentialCore;
     std::unique_ptr<TokenCredentialImpl> m_tokenCredentialImpl;
     std::string m_requestBody;
+
+    // Declared last, so that it gets destroyed first, and waits for the background token refreshes
+    // that use the other members.
     _detail::TokenCache m_tokenCache;
 
   public:
@@ -3,16 +3,30 @@
 
 #include "azure/identity/detail/token_cache.hpp"
 
+#include "private/identity_log.hpp"
+
 #include <algorithm>
 #include <array>
+#include <exception>
 #include <limits>
 #include <mutex>
 
+using Azure::Identity::_detail::IdentityLog;
 using Azure::Identity::_detail::TokenCache;
 
 using Azure::DateTime;
+using Azure::Core::Context;
 using Azure::Core::Credentials::AccessToken;
 
+TokenCache::~TokenCache()
+{
+  m_refreshContext.Cancel();
+  for (auto& refresh : m_refreshes)
+  {
+    refresh.wait();
+  }
+}
+
 bool TokenCache::IsFresh(
     std::shared_ptr<TokenCache::CacheValue> const& item,
     DateTime::duration minimumExpiration,
@@ -86,19 +100,97 @@ std::shared_ptr<TokenCache::CacheValue> TokenCache::GetOrCreateValue(
   return m_cache[key] = std::make_shared<CacheValue>();
 }
 
-AccessToken TokenCache::GetToken(
-    std::string const& scopeString,
-    std::string const& tenantId,
+std::chrono::system_clock::time_point TokenCache::GetRefreshOn(
+    AccessToken const& token,
+    std::chrono::system_clock::time_point now) const
+{
+  auto const lifetime = token.ExpiresOn - DateTime(now);
+  if (m_refreshRatio <= 0 || m_refreshRatio >= 1 || lifetime <= DateTime::duration::zero())
+  {
+    return (std::chrono::system_clock::time_point::max)();
+  }
+
+  return now
+      + std::chrono::duration_cast<std::chrono::system_clock::duration>(lifetime * m_refreshRatio);
+}
+
+void TokenCache::StartRefresh(
+    std::shared_ptr<CacheValue> const& item,
+    std::function<AccessToken(Context const&)> const& refreshToken) const
+{
+  std::lock_guard<std::mutex> refreshesLock(m_refreshesMutex);
+
+  // Forget the refreshes that have completed.
+  m_refreshes.remove_if([](std::future<void> const& refresh) {
+    return refresh.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  });
+
+  try
+  {
+    m_refreshes.emplace_back(std::async(std::launch::async, [this, item, refreshToken]() {
+      AccessToken newToken;
+      bool refreshed = false;
+      try
+      {
+        newToken = refreshToken(m_refreshContext);
+        refreshed = true;
+      }
+      catch (std::exception const& e)
+      {
+        // The cached token keeps being returned until it gets stale, after which the caller gets
+        // the new token (or the error) on its own thread.
+        IdentityLog::Write(
+            IdentityLog::Level::Warning,
+            std::string("Background token refresh failed: ") + e.what());
+      }
+
+      {
+        std::unique_lock<std::shared_timed_mutex> itemWriteLock(item->ElementMutex);
+        auto const now = std::chrono::system_clock::now();
+        if (refreshed)
+        {
+          item->AccessToken = newToken;
+          item->RefreshOn = GetRefreshOn(newToken, now);
+        }
+        else
+        {
+          // Try again halfway to the expiration.
+          item->RefreshOn = now
+              + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                                (item->AccessToken.ExpiresOn - DateTime(now)) / 2);
+        }
+      }
+
+      item->Refreshing = false;
+    }));
+  }
+  catch (std::exception const&)
+  {
+    // No thread to refresh the token on; the token gets refreshed once it is stale.
+    item->Refreshing = false;
+  }
+}
+
+AccessToken TokenCache::GetCachedToken(
+    CacheKey const& key,
     DateTime::duration minimumExpiration,
-    std::function<AccessToken()> const& getNewToken) const
+    std::function<AccessToken()> const& getNewToken,
+    std::function<AccessToken(Context const&)> const& refreshToken) const
 {
-  auto const item = GetOrCreateValue({scopeString, tenantId}, minimumExpiration);
+  auto const item = GetOrCreateValue(key, minimumExpiration);
 
   {
     std::shared_lock<std::shared_timed_mutex> itemReadLock(item->ElementMutex);
 
-    if (IsFresh(item, minimumExpiration, std::chrono::system_clock::now()))
+    auto const now = std::chrono::system_clock::now();
+    if (IsFresh(item, minimumExpiration, now))
     {
+      // Only the first caller to see the token past its refresh point starts the refresh.
+      if (refreshToken && now >= item->RefreshOn && !item->Refreshing.exchange(true))
+      {
+        StartRefresh(item, refreshToken);
+      }
+
       return item->AccessToken;
     }
   }
@@ -118,9 +210,33 @@ AccessToken TokenCache::GetToken(
 
   auto const newToken = getNewToken();
   item->AccessToken = newToken;
+  item->RefreshOn = GetRefreshOn(newToken, std::chrono::system_clock::now());
   return newToken;
 }
 
+AccessToken TokenCache::GetToken(
+    std::string const& scopeString,
+    std::string const& tenantId,
+    DateTime::duration minimumExpiration,
+    std::function<AccessToken()> const& getNewToken) const
+{
+  return GetCachedToken({scopeString, tenantId}, minimumExpiration, getNewToken, nullptr);
+}
+
+AccessToken TokenCache::GetToken(
+    std::string const& scopeString,
+    std::string const& tenantId,
+    DateTime::duration minimumExpiration,
+    Context const& context,
+    std::function<AccessToken(Context const&)> const& getNewToken) const
+{
+  return GetCachedToken(
+      {scopeString, tenantId},
+      minimumExpiration,
+      [&]() { return getNewToken(context); },
+      getNewToken);
+}
+
 namespace {
 
 // Compile-time Fibonacci sequence computation.
@@ -4,7 +4,11 @@
 #include "azure/identity/client_secret_credential.hpp"
 #include "azure/identity/detail/token_cache.hpp"
 
+#include <atomic>
+#include <future>
 #include <mutex>
+#include <stdexcept>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -15,6 +19,8 @@ using Azure::Identity::_detail::TokenCache;
 namespace {
 class TestableTokenCache final : public TokenCache {
 public:
+  using TokenCache::TokenCache;
+
   using TokenCache::CacheValue;
   using TokenCache::m_cache;
   using TokenCache::m_cacheMutex;
@@ -372,6 +378,97 @@ TEST(TokenCache, MinimumExpiration)
   EXPECT_EQ(token2.Token, "T2");
 }
 
+TEST(TokenCache, RefreshAhead)
+{
+  TestableTokenCache tokenCache(0.5);
+  Azure::Core::Context const context;
+
+  auto const now = std::chrono::system_clock::now();
+  auto const token1 = tokenCache.GetToken(
+      "A", {}, 2min, context, [=](Azure::Core::Context const&) {
+        AccessToken result;
+        result.Token = "T1";
+        result.ExpiresOn = now + 1h;
+        return result;
+      });
+
+  EXPECT_EQ(token1.Token, "T1");
+
+  auto const item = tokenCache.m_cache[{"A", {}}];
+  EXPECT_GT(item->RefreshOn, now + 25min);
+  EXPECT_LT(item->RefreshOn, now + 35min);
+
+  // Once the token is past the refresh point, the cached token keeps being returned while the new
+  // one is obtained in the background, and only one refresh runs at a time.
+  item->RefreshOn = now;
+
+  std::promise<void> release;
+  auto const released = release.get_future().share();
+  std::atomic<int> refreshes{0};
+  auto const getNewToken = [&, released](Azure::Core::Context const&) {
+    ++refreshes;
+    released.wait();
+    AccessToken result;
+    result.Token = "T2";
+    result.ExpiresOn = now + 2h;
+    return result;
+  };
+
+  EXPECT_EQ(tokenCache.GetToken("A", {}, 2min, context, getNewToken).Token, "T1");
+  EXPECT_EQ(tokenCache.GetToken("A", {}, 2min, context, getNewToken).Token, "T1");
+
+  release.set_value();
+  while (item->Refreshing)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(refreshes, 1);
+  EXPECT_EQ(tokenCache.GetToken("A", {}, 2min, context, getNewToken).Token, "T2");
+  EXPECT_EQ(refreshes, 1);
+
+  // A failed refresh keeps the cached token, and gets retried later.
+  item->RefreshOn = now;
+  EXPECT_EQ(
+      tokenCache
+          .GetToken(
+              "A",
+              {},
+              2min,
+              context,
+              [](Azure::Core::Context const&) -> AccessToken {
+                throw std::runtime_error("refresh failed");
+              })
+          .Token,
+      "T2");
+
+  while (item->Refreshing)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(item->AccessToken.Token, "T2");
+  EXPECT_GT(item->RefreshOn, std::chrono::system_clock::now() + 30min);
+}
+
+TEST(TokenCache, NoRefreshAhead)
+{
+  TestableTokenCache tokenCache;
+
+  auto const now = std::chrono::system_clock::now();
+  auto const getNewToken = [=](Azure::Core::Context const&) {
+    AccessToken result;
+    result.Token = "T1";
+    result.ExpiresOn = now + 1h;
+    return result;
+  };
+
+  EXPECT_EQ(tokenCache.GetToken("A", {}, 2min, {}, getNewToken).Token, "T1");
+
+  auto const item = tokenCache.m_cache[{"A", {}}];
+  EXPECT_EQ(item->RefreshOn, (std::chrono::system_clock::time_point::max)());
+}
+
 TEST(TokenCache, MultithreadedAccess)
 {
   TestableTokenCache tokenCache;
@@ -36,6 +36,12 @@ namespace Azure {
      *
      */
     class CryptoClientInternalAccess;
+
+    /**
+     * @brief Runs the public key operations of the key in-process.
+     *
+     */
+    class LocalCryptographyProvider;
   } // namespace _detail
 
   /**
@@ -46,6 +52,7 @@ namespace Azure {
     Azure::Core::Url m_keyId;
     std::string m_apiVersion;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    std::shared_ptr<_detail::LocalCryptographyProvider> m_localProvider;
 
   private:
     // Provide private-access to the internal layer
@@ -61,6 +68,9 @@ namespace Azure {
         std::string const& payload,
         Azure::Core::Context const& context) const;
 
+    _detail::LocalCryptographyProvider const* GetLocalProvider(
+        Azure::Core::Context const& context) const;
+
     /**
      * @brief Construct a new Cryptography client that re-uses a pre-existing pipeline.
      *
@@ -112,6 +122,10 @@ namespace Azure {
      * @return An #Azure::Security::KeyVault::Keys::Cryptography::EncryptResult containing the
      * encrypted data along with all other information needed to decrypt it. This information should
      * be stored with the encrypted data.
+     *
+     * @remark With #CryptographyClientOptions::EnableLocalPublicKeyOperations, RSA encryption runs
+     * locally when possible, and then the `RawResponse` of the returned response is an empty
+     * `200 OK` response.
      */
     Azure::Response<EncryptResult> Encrypt(
         EncryptParameters const& parameters,
@@ -141,6 +155,10 @@ namespace Azure {
      * #Azure::Security::KeyVault::Keys::Cryptography::WrapResult contains the wrapped key along
      * with all other information needed to unwrap it. This information should be stored with the
      * wrapped key.
+     *
+     * @remark With #CryptographyClientOptions::EnableLocalPublicKeyOperations, RSA key wrapping
+     * runs locally when possible, and then the `RawResponse` of the returned response is an empty
+     * `200 OK` response.
      */
     Azure::Response<WrapResult> WrapKey(
         KeyWrapAlgorithm const& algorithm,
@@ -226,6 +244,10 @@ namespace Azure {
      * @return The result of the verify operation. If the signature is valid the
      * #VerifyResult.IsValid property of the returned
      * #Azure::Security::KeyVault::Keys::Cryptography::VerifyResult will be set to true.
+     *
+     * @remark With #CryptographyClientOptions::EnableLocalPublicKeyOperations, the signature is
+     * verified locally when possible, and then the `RawResponse` of the returned response is an
+     * empty `200 OK` response.
      */
     Azure::Response<VerifyResult> Verify(
         SignatureAlgorithm const& algorithm,
@@ -37,6 +37,17 @@ namespace Azure {
      */
     std::string Version;
 
+    /**
+     * @brief Run the encrypt, wrap key and verify operations of RSA and EC keys locally, with the
+     * public key fetched once from the service, instead of sending each operation to the service.
+     *
+     * @remark The other operations, and those the key can't run locally, are still sent to the
+     * service. Fetching the key requires the `keys/get` permission; without it, all the operations
+     * are sent to the service. Local operations are not supported on Windows yet.
+     *
+     */
+    bool EnableLocalPublicKeyOperations = false;
+
     /**
      * @brief Construct a new Key Client Options object.
      *
@@ -10,6 +10,7 @@
 #include "../private/key_verify_parameters.hpp"
 #include "../private/key_wrap_parameters.hpp"
 #include "../private/keyvault_protocol.hpp"
+#include "../private/local_cryptography_provider.hpp"
 #include "../private/package_version.hpp"
 #include "azure/keyvault/keys/key_client_models.hpp"
 
@@ -61,6 +62,13 @@ inline std::vector<uint8_t> CreateDigest(
   return hashAlgorithm->Final(data.data(), data.size());
 }
 
+// The operations which run locally have no response from the service, so their result comes with
+// an empty successful response.
+std::unique_ptr<RawResponse> CreateLocalRawResponse()
+{
+  return std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+}
+
 } // namespace
 
 Request CryptographyClient::CreateRequest(
@@ -91,6 +99,36 @@ std::unique_ptr<Azure::Core::Http::RawResponse> CryptographyClient::SendCryptoRe
       *m_pipeline, request, context);
 }
 
+LocalCryptographyProvider const* CryptographyClient::GetLocalProvider(
+    Azure::Core::Context const& context) const
+{
+  if (!m_localProvider)
+  {
+    return nullptr;
+  }
+
+  m_localProvider->EnsureLoaded([&]() -> std::unique_ptr<Azure::Core::Http::RawResponse> {
+    auto request = CreateRequest(HttpMethod::Get);
+    request.SetHeader(HttpShared::Accept, HttpShared::ApplicationJson);
+    try
+    {
+      return Azure::Security::KeyVault::_detail::KeyVaultKeysCommonRequest::SendRequest(
+          *m_pipeline, request, context);
+    }
+    catch (Azure::Core::RequestFailedException const& e)
+    {
+      // Without the permission to get the key, the operations are sent to the service. Other
+      // failures may be transient, and the key is fetched again later.
+      if (e.StatusCode == HttpStatusCode::Forbidden || e.StatusCode == HttpStatusCode::NotFound)
+      {
+        return nullptr;
+      }
+      throw;
+    }
+  });
+  return m_localProvider.get();
+}
+
 CryptographyClient::~CryptographyClient() = default;
 
 CryptographyClient::CryptographyClient(
@@ -116,12 +154,27 @@ CryptographyClient::CryptographyClient(
       PackageVersion::ToString(),
       std::move(perRetryPolicies),
       std::move(perCallPolicies));
+
+  if (options.EnableLocalPublicKeyOperations)
+  {
+    m_localProvider = std::make_shared<LocalCryptographyProvider>();
+  }
 }
 
 Azure::Response<EncryptResult> CryptographyClient::Encrypt(
     EncryptParameters const& parameters,
     Azure::Core::Context const& context)
 {
+  if (auto localProvider = GetLocalProvider(context))
+  {
+    auto localResult = localProvider->TryEncrypt(parameters);
+    if (localResult.HasValue())
+    {
+      return Azure::Response<EncryptResult>(
+          std::move(localResult.Value()), CreateLocalRawResponse());
+    }
+  }
+
   // Send and parse response
   auto rawResponse = SendCryptoRequest(
       {EncryptValue}, EncryptParametersSerializer::EncryptParametersSerialize(parameters), context);
@@ -147,6 +200,15 @@ Azure::Response<WrapResult> CryptographyClient::WrapKey(
     std::vector<uint8_t> const& key,
     Azure::Core::Context const& context)
 {
+  if (auto localProvider = GetLocalProvider(context))
+  {
+    auto localResult = localProvider->TryWrapKey(algorithm, key);
+    if (localResult.HasValue())
+    {
+      return Azure::Response<WrapResult>(std::move(localResult.Value()), CreateLocalRawResponse());
+    }
+  }
+
   // Send and parse response
   auto rawResponse = SendCryptoRequest(
       {WrapKeyValue},
@@ -212,6 +274,17 @@ Azure::Response<VerifyResult> CryptographyClient::Verify(
     std::vector<uint8_t> const& signature,
     Azure::Core::Context const& context)
 {
+  if (auto localProvider = GetLocalProvider(context))
+  {
+    auto localResult = localProvider->TryVerify(algorithm, digest, signature);
+    if (localResult.HasValue())
+    {
+      localResult.Value().KeyId = this->m_keyId.GetAbsoluteUrl();
+      return Azure::Response<VerifyResult>(
+          std::move(localResult.Value()), CreateLocalRawResponse());
+    }
+  }
+
   // Send and parse response
   auto rawResponse = SendCryptoRequest(
       {VerifyValue},
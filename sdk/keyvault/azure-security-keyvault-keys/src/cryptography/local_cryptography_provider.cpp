@@ -0,0 +1,655 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../private/local_cryptography_provider.hpp"
+
+#include "../private/key_constants.hpp"
+
+#include <azure/core/base64.hpp>
+#include <azure/core/exception.hpp>
+#include <azure/core/internal/json/json.hpp>
+#include <azure/core/platform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/objects.h>
+#include <openssl/rsa.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/param_build.h>
+#endif
+#endif
+
+using namespace Azure::Security::KeyVault::Keys;
+using namespace Azure::Security::KeyVault::Keys::Cryptography;
+using namespace Azure::Security::KeyVault::Keys::Cryptography::_detail;
+using namespace Azure::Core::_internal;
+using namespace Azure::Core::Json::_internal;
+
+namespace {
+Azure::Nullable<int64_t> GetPosixTimeValue(json const& jsonAttributes, char const* name)
+{
+  if (jsonAttributes.contains(name) && !jsonAttributes[name].is_null())
+  {
+    return jsonAttributes[name].is_string() ? std::stoll(jsonAttributes[name].get<std::string>())
+                                            : jsonAttributes[name].get<int64_t>();
+  }
+  return {};
+}
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+std::vector<uint8_t> GetBase64UrlValue(json const& jsonKey, char const* name)
+{
+  if (jsonKey.contains(name) && jsonKey[name].is_string())
+  {
+    return Base64Url::Base64UrlDecode(jsonKey[name].get<std::string>());
+  }
+  return {};
+}
+
+bool IsRsa(KeyVaultKeyType const& keyType)
+{
+  return keyType == KeyVaultKeyType::Rsa || keyType == KeyVaultKeyType::RsaHsm;
+}
+
+bool IsEc(KeyVaultKeyType const& keyType)
+{
+  return keyType == KeyVaultKeyType::Ec || keyType == KeyVaultKeyType::EcHsm;
+}
+
+template <typename> struct OpenSslHandleHelper;
+template <> struct OpenSslHandleHelper<EVP_PKEY_CTX>
+{
+  using type = BasicUniqueHandle<EVP_PKEY_CTX, EVP_PKEY_CTX_free>;
+};
+template <> struct OpenSslHandleHelper<BIGNUM>
+{
+  using type = BasicUniqueHandle<BIGNUM, BN_free>;
+};
+template <> struct OpenSslHandleHelper<ECDSA_SIG>
+{
+  using type = BasicUniqueHandle<ECDSA_SIG, ECDSA_SIG_free>;
+};
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+template <> struct OpenSslHandleHelper<OSSL_PARAM_BLD>
+{
+  using type = BasicUniqueHandle<OSSL_PARAM_BLD, OSSL_PARAM_BLD_free>;
+};
+template <> struct OpenSslHandleHelper<OSSL_PARAM>
+{
+  using type = BasicUniqueHandle<OSSL_PARAM, OSSL_PARAM_free>;
+};
+#else
+template <> struct OpenSslHandleHelper<RSA>
+{
+  using type = BasicUniqueHandle<RSA, RSA_free>;
+};
+template <> struct OpenSslHandleHelper<EC_KEY>
+{
+  using type = BasicUniqueHandle<EC_KEY, EC_KEY_free>;
+};
+#endif
+
+template <typename T>
+using OpenSslHandle = Azure::Core::_internal::UniqueHandle<T, OpenSslHandleHelper>;
+
+int GetCurveNid(KeyCurveName const& curveName)
+{
+  if (curveName == KeyCurveName::P256)
+  {
+    return NID_X9_62_prime256v1;
+  }
+  if (curveName == KeyCurveName::P256K)
+  {
+    return NID_secp256k1;
+  }
+  if (curveName == KeyCurveName::P384)
+  {
+    return NID_secp384r1;
+  }
+  if (curveName == KeyCurveName::P521)
+  {
+    return NID_secp521r1;
+  }
+  return NID_undef;
+}
+
+OpenSslHandle<BIGNUM> ToBigNum(std::vector<uint8_t> const& value)
+{
+  return OpenSslHandle<BIGNUM>(
+      BN_bin2bn(value.data(), static_cast<int>(value.size()), nullptr));
+}
+
+EVP_PKEY* CreateRsaPublicKey(std::vector<uint8_t> const& n, std::vector<uint8_t> const& e)
+{
+  auto modulus = ToBigNum(n);
+  auto exponent = ToBigNum(e);
+  if (!modulus || !exponent)
+  {
+    return nullptr;
+  }
+
+  EVP_PKEY* pkey = nullptr;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  OpenSslHandle<OSSL_PARAM_BLD> paramBuilder(OSSL_PARAM_BLD_new());
+  if (!paramBuilder
+      || OSSL_PARAM_BLD_push_BN(paramBuilder.get(), OSSL_PKEY_PARAM_RSA_N, modulus.get()) != 1
+      || OSSL_PARAM_BLD_push_BN(paramBuilder.get(), OSSL_PKEY_PARAM_RSA_E, exponent.get()) != 1)
+  {
+    return nullptr;
+  }
+  OpenSslHandle<OSSL_PARAM> params(OSSL_PARAM_BLD_to_param(paramBuilder.get()));
+  OpenSslHandle<EVP_PKEY_CTX> context(EVP_PKEY_CTX_new_from_name(nullptr, "RSA", nullptr));
+  if (!params || !context || EVP_PKEY_fromdata_init(context.get()) != 1
+      || EVP_PKEY_fromdata(context.get(), &pkey, EVP_PKEY_PUBLIC_KEY, params.get()) != 1)
+  {
+    return nullptr;
+  }
+#else
+  OpenSslHandle<RSA> rsa(RSA_new());
+  if (!rsa || RSA_set0_key(rsa.get(), modulus.get(), exponent.get(), nullptr) != 1)
+  {
+    return nullptr;
+  }
+  // The RSA key owns the numbers now.
+  modulus.release();
+  exponent.release();
+  pkey = EVP_PKEY_new();
+  if (pkey != nullptr && EVP_PKEY_assign_RSA(pkey, rsa.get()) == 1)
+  {
+    rsa.release();
+  }
+  else
+  {
+    EVP_PKEY_free(pkey);
+    pkey = nullptr;
+  }
+#endif
+  return pkey;
+}
+
+EVP_PKEY* CreateEcPublicKey(
+    KeyCurveName const& curveName,
+    std::vector<uint8_t> const& x,
+    std::vector<uint8_t> const& y)
+{
+  const int nid = GetCurveNid(curveName);
+  if (nid == NID_undef || x.empty() || x.size() != y.size())
+  {
+    return nullptr;
+  }
+
+  EVP_PKEY* pkey = nullptr;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  // The public key is the uncompressed point: 0x04, then X and Y.
+  std::vector<uint8_t> point;
+  point.reserve(1 + x.size() + y.size());
+  point.push_back(0x04);
+  point.insert(point.end(), x.begin(), x.end());
+  point.insert(point.end(), y.begin(), y.end());
+
+  OpenSslHandle<OSSL_PARAM_BLD> paramBuilder(OSSL_PARAM_BLD_new());
+  if (!paramBuilder
+      || OSSL_PARAM_BLD_push_utf8_string(
+             paramBuilder.get(), OSSL_PKEY_PARAM_GROUP_NAME, OBJ_nid2sn(nid), 0)
+          != 1
+      || OSSL_PARAM_BLD_push_octet_string(
+             paramBuilder.get(), OSSL_PKEY_PARAM_PUB_KEY, point.data(), point.size())
+          != 1)
+  {
+    return nullptr;
+  }
+  OpenSslHandle<OSSL_PARAM> params(OSSL_PARAM_BLD_to_param(paramBuilder.get()));
+  OpenSslHandle<EVP_PKEY_CTX> context(EVP_PKEY_CTX_new_from_name(nullptr, "EC", nullptr));
+  if (!params || !context || EVP_PKEY_fromdata_init(context.get()) != 1
+      || EVP_PKEY_fromdata(context.get(), &pkey, EVP_PKEY_PUBLIC_KEY, params.get()) != 1)
+  {
+    return nullptr;
+  }
+#else
+  OpenSslHandle<EC_KEY> ecKey(EC_KEY_new_by_curve_name(nid));
+  auto xValue = ToBigNum(x);
+  auto yValue = ToBigNum(y);
+  if (!ecKey || !xValue || !yValue
+      || EC_KEY_set_public_key_affine_coordinates(ecKey.get(), xValue.get(), yValue.get()) != 1)
+  {
+    return nullptr;
+  }
+  pkey = EVP_PKEY_new();
+  if (pkey != nullptr && EVP_PKEY_assign_EC_KEY(pkey, ecKey.get()) == 1)
+  {
+    ecKey.release();
+  }
+  else
+  {
+    EVP_PKEY_free(pkey);
+    pkey = nullptr;
+  }
+#endif
+  return pkey;
+}
+
+EVP_MD const* GetSignatureDigest(SignatureAlgorithm const& algorithm)
+{
+  if (algorithm == SignatureAlgorithm::RS256 || algorithm == SignatureAlgorithm::PS256
+      || algorithm == SignatureAlgorithm::ES256 || algorithm == SignatureAlgorithm::ES256K)
+  {
+    return EVP_sha256();
+  }
+  if (algorithm == SignatureAlgorithm::RS384 || algorithm == SignatureAlgorithm::PS384
+      || algorithm == SignatureAlgorithm::ES384)
+  {
+    return EVP_sha384();
+  }
+  if (algorithm == SignatureAlgorithm::RS512 || algorithm == SignatureAlgorithm::PS512
+      || algorithm == SignatureAlgorithm::ES512)
+  {
+    return EVP_sha512();
+  }
+  return nullptr;
+}
+
+// Returns the OAEP digest for RSA-OAEP algorithms, and sets oaep to false for RSA1_5.
+bool GetRsaEncryptionPadding(std::string const& algorithm, bool& oaep, EVP_MD const*& digest)
+{
+  if (algorithm == Azure::Security::KeyVault::Keys::_detail::Rsa15Value)
+  {
+    oaep = false;
+    digest = nullptr;
+    return true;
+  }
+  if (algorithm == Azure::Security::KeyVault::Keys::_detail::RsaOaepValue)
+  {
+    oaep = true;
+    digest = EVP_sha1();
+    return true;
+  }
+  if (algorithm == Azure::Security::KeyVault::Keys::_detail::RsaOaep256Value)
+  {
+    oaep = true;
+    digest = EVP_sha256();
+    return true;
+  }
+  return false;
+}
+
+Azure::Nullable<std::vector<uint8_t>> RsaEncrypt(
+    EVP_PKEY* pkey,
+    std::string const& algorithm,
+    std::vector<uint8_t> const& plaintext)
+{
+  bool oaep = false;
+  EVP_MD const* digest = nullptr;
+  if (!GetRsaEncryptionPadding(algorithm, oaep, digest))
+  {
+    return {};
+  }
+
+  OpenSslHandle<EVP_PKEY_CTX> context(EVP_PKEY_CTX_new(pkey, nullptr));
+  if (!context || EVP_PKEY_encrypt_init(context.get()) != 1
+      || EVP_PKEY_CTX_set_rsa_padding(
+             context.get(), oaep ? RSA_PKCS1_OAEP_PADDING : RSA_PKCS1_PADDING)
+          != 1)
+  {
+    return {};
+  }
+  if (oaep
+      && (EVP_PKEY_CTX_set_rsa_oaep_md(context.get(), digest) != 1
+          || EVP_PKEY_CTX_set_rsa_mgf1_md(context.get(), digest) != 1))
+  {
+    return {};
+  }
+
+  size_t size = 0;
+  if (EVP_PKEY_encrypt(context.get(), nullptr, &size, plaintext.data(), plaintext.size()) != 1)
+  {
+    return {};
+  }
+  std::vector<uint8_t> ciphertext(size);
+  if (EVP_PKEY_encrypt(context.get(), ciphertext.data(), &size, plaintext.data(), plaintext.size())
+      != 1)
+  {
+    return {};
+  }
+  ciphertext.resize(size);
+  return ciphertext;
+}
+
+// Key Vault returns EC signatures as R and S concatenated, while OpenSSL expects them DER encoded.
+std::vector<uint8_t> EcSignatureToDer(std::vector<uint8_t> const& signature)
+{
+  if (signature.empty() || signature.size() % 2 != 0)
+  {
+    return {};
+  }
+  const int half = static_cast<int>(signature.size() / 2);
+  OpenSslHandle<ECDSA_SIG> ecdsaSignature(ECDSA_SIG_new());
+  BIGNUM* r = BN_bin2bn(signature.data(), half, nullptr);
+  BIGNUM* s = BN_bin2bn(signature.data() + half, half, nullptr);
+  if (!ecdsaSignature || r == nullptr || s == nullptr
+      || ECDSA_SIG_set0(ecdsaSignature.get(), r, s) != 1)
+  {
+    BN_free(r);
+    BN_free(s);
+    return {};
+  }
+
+  const int size = i2d_ECDSA_SIG(ecdsaSignature.get(), nullptr);
+  if (size <= 0)
+  {
+    return {};
+  }
+  std::vector<uint8_t> der(static_cast<size_t>(size));
+  auto* output = der.data();
+  i2d_ECDSA_SIG(ecdsaSignature.get(), &output);
+  return der;
+}
+
+Azure::Nullable<bool> Verify(
+    EVP_PKEY* pkey,
+    bool isRsa,
+    SignatureAlgorithm const& algorithm,
+    std::vector<uint8_t> const& digest,
+    std::vector<uint8_t> const& signature)
+{
+  EVP_MD const* md = GetSignatureDigest(algorithm);
+  if (md == nullptr || digest.size() != static_cast<size_t>(EVP_MD_size(md)))
+  {
+    return {};
+  }
+
+  OpenSslHandle<EVP_PKEY_CTX> context(EVP_PKEY_CTX_new(pkey, nullptr));
+  if (!context || EVP_PKEY_verify_init(context.get()) != 1
+      || EVP_PKEY_CTX_set_signature_md(context.get(), md) != 1)
+  {
+    return {};
+  }
+
+  std::vector<uint8_t> encodedSignature;
+  if (isRsa)
+  {
+    const bool pss = algorithm == SignatureAlgorithm::PS256
+        || algorithm == SignatureAlgorithm::PS384 || algorithm == SignatureAlgorithm::PS512;
+    if (EVP_PKEY_CTX_set_rsa_padding(
+            context.get(), pss ? RSA_PKCS1_PSS_PADDING : RSA_PKCS1_PADDING)
+            != 1
+        || (pss && EVP_PKEY_CTX_set_rsa_pss_saltlen(context.get(), RSA_PSS_SALTLEN_DIGEST) != 1))
+    {
+      return {};
+    }
+    encodedSignature = signature;
+  }
+  else
+  {
+    encodedSignature = EcSignatureToDer(signature);
+    if (encodedSignature.empty())
+    {
+      // A signature of the wrong size can't be valid.
+      return false;
+    }
+  }
+
+  return EVP_PKEY_verify(
+             context.get(),
+             encodedSignature.data(),
+             encodedSignature.size(),
+             digest.data(),
+             digest.size())
+      == 1;
+}
+#endif
+} // namespace
+
+void Azure::Security::KeyVault::Keys::Cryptography::_detail::FreePublicKeyImpl(void* pkey)
+{
+#if !defined(AZ_PLATFORM_WINDOWS)
+  EVP_PKEY_free(static_cast<EVP_PKEY*>(pkey));
+#else
+  (void)pkey;
+#endif
+}
+
+LocalCryptographyProvider::LocalCryptographyProvider(std::chrono::milliseconds minLoadRetryDelay)
+    : m_loadRetryDelay(minLoadRetryDelay), m_minLoadRetryDelay(minLoadRetryDelay)
+{
+}
+
+void LocalCryptographyProvider::EnsureLoaded(
+    std::function<std::unique_ptr<Azure::Core::Http::RawResponse>()> const& getKey)
+{
+  auto const now = std::chrono::steady_clock::now().time_since_epoch().count();
+  if (m_loaded || now < m_nextLoadTime)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_loadMutex);
+  if (m_loaded || now < m_nextLoadTime)
+  {
+    return;
+  }
+  std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse;
+  try
+  {
+    rawResponse = getKey();
+  }
+  catch (Azure::Core::RequestFailedException const&)
+  {
+    // The operations run on the service until the key is fetched again after the backoff.
+    constexpr auto maxLoadRetryDelay = std::chrono::minutes(1);
+    m_nextLoadTime
+        = (std::chrono::steady_clock::now() + m_loadRetryDelay).time_since_epoch().count();
+    m_loadRetryDelay = (std::min)(
+        std::chrono::steady_clock::duration(m_loadRetryDelay * 2),
+        std::chrono::steady_clock::duration(maxLoadRetryDelay));
+    return;
+  }
+  if (rawResponse)
+  {
+    try
+    {
+      Load(*rawResponse);
+    }
+    catch (std::exception const&)
+    {
+      // The key can't be used locally, so the operations run on the service.
+    }
+  }
+  m_loadRetryDelay = m_minLoadRetryDelay;
+  m_loaded = true;
+}
+
+void LocalCryptographyProvider::Load(Azure::Core::Http::RawResponse const& rawResponse)
+{
+  // The key is parsed into locals, so that the provider isn't left with part of a key when the
+  // response can't be parsed.
+  auto const& body = rawResponse.GetBody();
+  auto const jsonRoot = json::parse(body);
+  if (!jsonRoot.contains("key") || !jsonRoot["key"].is_object())
+  {
+    return;
+  }
+  auto const& jsonKey = jsonRoot["key"];
+
+  std::string keyId;
+  KeyVaultKeyType keyType;
+  Azure::Nullable<KeyCurveName> curveName;
+  std::vector<KeyOperation> keyOperations;
+  bool enabled = true;
+  Azure::Nullable<int64_t> notBefore;
+  Azure::Nullable<int64_t> expiresOn;
+  UniquePublicKey publicKey;
+
+  if (jsonKey.contains("kid") && jsonKey["kid"].is_string())
+  {
+    keyId = jsonKey["kid"].get<std::string>();
+  }
+  if (jsonKey.contains("kty") && jsonKey["kty"].is_string())
+  {
+    keyType = KeyVaultKeyType(jsonKey["kty"].get<std::string>());
+  }
+  if (jsonKey.contains("crv") && jsonKey["crv"].is_string())
+  {
+    curveName = KeyCurveName(jsonKey["crv"].get<std::string>());
+  }
+  if (jsonKey.contains("key_ops") && jsonKey["key_ops"].is_array())
+  {
+    for (auto const& operation : jsonKey["key_ops"])
+    {
+      keyOperations.emplace_back(KeyOperation(operation.get<std::string>()));
+    }
+  }
+
+  if (jsonRoot.contains("attributes") && jsonRoot["attributes"].is_object())
+  {
+    auto const& jsonAttributes = jsonRoot["attributes"];
+    if (jsonAttributes.contains("enabled") && jsonAttributes["enabled"].is_boolean())
+    {
+      enabled = jsonAttributes["enabled"].get<bool>();
+    }
+    notBefore = GetPosixTimeValue(jsonAttributes, "nbf");
+    expiresOn = GetPosixTimeValue(jsonAttributes, "exp");
+  }
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+  if (IsRsa(keyType))
+  {
+    publicKey.reset(
+        CreateRsaPublicKey(GetBase64UrlValue(jsonKey, "n"), GetBase64UrlValue(jsonKey, "e")));
+  }
+  else if (IsEc(keyType) && curveName.HasValue())
+  {
+    publicKey.reset(CreateEcPublicKey(
+        curveName.Value(), GetBase64UrlValue(jsonKey, "x"), GetBase64UrlValue(jsonKey, "y")));
+  }
+#endif
+
+  m_keyId = std::move(keyId);
+  m_keyType = std::move(keyType);
+  m_curveName = std::move(curveName);
+  m_keyOperations = std::move(keyOperations);
+  m_enabled = enabled;
+  m_notBefore = notBefore;
+  m_expiresOn = expiresOn;
+  m_publicKey = std::move(publicKey);
+}
+
+bool LocalCryptographyProvider::CanRun(KeyOperation const& operation) const
+{
+  if (!m_loaded || !m_publicKey || !m_enabled
+      || std::find(m_keyOperations.begin(), m_keyOperations.end(), operation)
+          == m_keyOperations.end())
+  {
+    return false;
+  }
+
+  const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                       std::chrono::system_clock::now().time_since_epoch())
+                       .count();
+  return (!m_notBefore.HasValue() || m_notBefore.Value() <= now)
+      && (!m_expiresOn.HasValue() || now < m_expiresOn.Value());
+}
+
+Azure::Nullable<EncryptResult> LocalCryptographyProvider::TryEncrypt(
+    EncryptParameters const& parameters) const
+{
+#if !defined(AZ_PLATFORM_WINDOWS)
+  if (IsRsa(m_keyType) && CanRun(KeyOperation::Encrypt))
+  {
+    auto ciphertext = RsaEncrypt(
+        static_cast<EVP_PKEY*>(m_publicKey.get()),
+        parameters.Algorithm.ToString(),
+        parameters.Plaintext);
+    if (ciphertext.HasValue())
+    {
+      EncryptResult result;
+      result.KeyId = m_keyId;
+      result.Algorithm = parameters.Algorithm;
+      result.Ciphertext = std::move(ciphertext.Value());
+      return result;
+    }
+  }
+#else
+  (void)parameters;
+#endif
+  return {};
+}
+
+Azure::Nullable<WrapResult> LocalCryptographyProvider::TryWrapKey(
+    KeyWrapAlgorithm const& algorithm,
+    std::vector<uint8_t> const& key) const
+{
+#if !defined(AZ_PLATFORM_WINDOWS)
+  if (IsRsa(m_keyType) && CanRun(KeyOperation::WrapKey))
+  {
+    auto encryptedKey
+        = RsaEncrypt(static_cast<EVP_PKEY*>(m_publicKey.get()), algorithm.ToString(), key);
+    if (encryptedKey.HasValue())
+    {
+      WrapResult result;
+      result.KeyId = m_keyId;
+      result.Algorithm = algorithm;
+      result.EncryptedKey = std::move(encryptedKey.Value());
+      return result;
+    }
+  }
+#else
+  (void)algorithm;
+  (void)key;
+#endif
+  return {};
+}
+
+Azure::Nullable<VerifyResult> LocalCryptographyProvider::TryVerify(
+    SignatureAlgorithm const& algorithm,
+    std::vector<uint8_t> const& digest,
+    std::vector<uint8_t> const& signature) const
+{
+#if !defined(AZ_PLATFORM_WINDOWS)
+  const bool isRsa = IsRsa(m_keyType);
+  if (!CanRun(KeyOperation::Verify))
+  {
+    return {};
+  }
+  // The algorithm must match the type of the key, and for EC keys its curve.
+  if (isRsa)
+  {
+    if (algorithm.ToString().compare(0, 2, "RS") != 0
+        && algorithm.ToString().compare(0, 2, "PS") != 0)
+    {
+      return {};
+    }
+  }
+  else if (
+      !(algorithm == SignatureAlgorithm::ES256 && m_curveName.Value() == KeyCurveName::P256)
+      && !(algorithm == SignatureAlgorithm::ES256K && m_curveName.Value() == KeyCurveName::P256K)
+      && !(algorithm == SignatureAlgorithm::ES384 && m_curveName.Value() == KeyCurveName::P384)
+      && !(algorithm == SignatureAlgorithm::ES512 && m_curveName.Value() == KeyCurveName::P521))
+  {
+    return {};
+  }
+
+  auto isValid = Verify(
+      static_cast<EVP_PKEY*>(m_publicKey.get()), isRsa, algorithm, digest, signature);
+  if (isValid.HasValue())
+  {
+    VerifyResult result;
+    result.KeyId = m_keyId;
+    result.Algorithm = algorithm;
+    result.IsValid = isValid.Value();
+    return result;
+  }
+#else
+  (void)algorithm;
+  (void)digest;
+  (void)signature;
+#endif
+  return {};
+}
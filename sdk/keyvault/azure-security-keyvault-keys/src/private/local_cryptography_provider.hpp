@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Runs the public key operations of a key in-process.
+ *
+ */
+
+#pragma once
+
+#include "azure/keyvault/keys/cryptography/cryptography_client_models.hpp"
+#include "azure/keyvault/keys/key_client_models.hpp"
+
+#include <azure/core/http/raw_response.hpp>
+#include <azure/core/internal/unique_handle.hpp>
+#include <azure/core/nullable.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+
+    void FreePublicKeyImpl(void* pkey);
+
+    template <typename> struct UniquePublicKeyHelper;
+    template <> struct UniquePublicKeyHelper<void*>
+    {
+      static void FreePublicKey(void* pkey) { FreePublicKeyImpl(pkey); }
+      using type = Azure::Core::_internal::BasicUniqueHandle<void, FreePublicKey>;
+    };
+
+    using UniquePublicKey = Azure::Core::_internal::UniqueHandle<void*, UniquePublicKeyHelper>;
+
+    /**
+     * @brief Runs the encrypt, wrap key and verify operations of an RSA or EC key in-process,
+     * from the public key material fetched once from the service.
+     *
+     * @remark Each `Try` method returns a null value when the operation can't run locally, and
+     * then the operation is sent to the service. This is the case before the key is loaded, when
+     * the key can't be fetched, for other key types or algorithms, when the key doesn't permit the
+     * operation or isn't active, on platforms without a local implementation, or when the local
+     * operation fails, so that the service reports the error.
+     *
+     */
+    class LocalCryptographyProvider final {
+      std::mutex m_loadMutex;
+      std::atomic<bool> m_loaded{false};
+      // After a failure to fetch the key, the time at which it's fetched again, in ticks of
+      // std::chrono::steady_clock, and the delay before the following attempt.
+      std::atomic<std::chrono::steady_clock::rep> m_nextLoadTime{0};
+      std::chrono::steady_clock::duration m_loadRetryDelay;
+      std::chrono::steady_clock::duration const m_minLoadRetryDelay;
+
+      std::string m_keyId;
+      KeyVaultKeyType m_keyType;
+      Azure::Nullable<KeyCurveName> m_curveName;
+      std::vector<KeyOperation> m_keyOperations;
+      bool m_enabled = true;
+      Azure::Nullable<int64_t> m_notBefore;
+      Azure::Nullable<int64_t> m_expiresOn;
+      UniquePublicKey m_publicKey;
+
+      bool CanRun(KeyOperation const& operation) const;
+      void Load(Azure::Core::Http::RawResponse const& rawResponse);
+
+    public:
+      /**
+       * @brief Creates a provider without a key.
+       *
+       * @param minLoadRetryDelay The delay before the key is fetched again after a transient
+       * failure. It doubles after each failure, up to a minute.
+       */
+      explicit LocalCryptographyProvider(
+          std::chrono::milliseconds minLoadRetryDelay = std::chrono::seconds(1));
+
+      /**
+       * @brief Loads the key the first time it succeeds, from the response of \p getKey.
+       *
+       * @param getKey Gets the key from the service. It returns null when the key can't be
+       * fetched, such as without the permission to get it, and then the operations always run on
+       * the service. It throws `Azure::Core::RequestFailedException` when the request fails
+       * otherwise, and then the key is fetched again by a call after a backoff.
+       */
+      void EnsureLoaded(
+          std::function<std::unique_ptr<Azure::Core::Http::RawResponse>()> const& getKey);
+
+      Azure::Nullable<EncryptResult> TryEncrypt(EncryptParameters const& parameters) const;
+
+      Azure::Nullable<WrapResult> TryWrapKey(
+          KeyWrapAlgorithm const& algorithm,
+          std::vector<uint8_t> const& key) const;
+
+      Azure::Nullable<VerifyResult> TryVerify(
+          SignatureAlgorithm const& algorithm,
+          std::vector<uint8_t> const& digest,
+          std::vector<uint8_t> const& signature) const;
+    };
+
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
@@ -0,0 +1,302 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <azure/core/platform.hpp>
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+
+#include "private/local_cryptography_provider.hpp"
+
+#include <azure/core/base64.hpp>
+#include <azure/core/internal/json/json.hpp>
+#include <azure/keyvault/keys.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+
+using namespace Azure::Security::KeyVault::Keys;
+using namespace Azure::Security::KeyVault::Keys::Cryptography;
+using Azure::Core::_internal::Base64Url;
+using Azure::Core::Json::_internal::json;
+using Azure::Security::KeyVault::Keys::Cryptography::_detail::LocalCryptographyProvider;
+
+namespace {
+struct PkeyDeleter
+{
+  void operator()(EVP_PKEY* pkey) { EVP_PKEY_free(pkey); }
+};
+using UniquePkey = std::unique_ptr<EVP_PKEY, PkeyDeleter>;
+
+UniquePkey GenerateKey(int type, int parameter)
+{
+  auto* context = EVP_PKEY_CTX_new_id(type, nullptr);
+  EVP_PKEY* pkey = nullptr;
+  EVP_PKEY_keygen_init(context);
+  if (type == EVP_PKEY_RSA)
+  {
+    EVP_PKEY_CTX_set_rsa_keygen_bits(context, parameter);
+  }
+  else
+  {
+    EVP_PKEY_CTX_set_ec_paramgen_curve_nid(context, parameter);
+  }
+  EVP_PKEY_keygen(context, &pkey);
+  EVP_PKEY_CTX_free(context);
+  return UniquePkey(pkey);
+}
+
+std::string ToBase64Url(BIGNUM const* value, int size = 0)
+{
+  std::vector<uint8_t> bytes(size > 0 ? size : BN_num_bytes(value));
+  BN_bn2binpad(value, bytes.data(), static_cast<int>(bytes.size()));
+  return Base64Url::Base64UrlEncode(bytes);
+}
+
+std::string ToBase64Url(EVP_PKEY* pkey, char const* name, int size = 0)
+{
+  BIGNUM* value = nullptr;
+  EVP_PKEY_get_bn_param(pkey, name, &value);
+  auto encoded = ToBase64Url(value, size);
+  BN_free(value);
+  return encoded;
+}
+
+std::unique_ptr<Azure::Core::Http::RawResponse> CreateKeyResponse(json const& key)
+{
+  json body;
+  body["key"] = key;
+  body["attributes"]["enabled"] = true;
+  auto const content = body.dump();
+  auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+      1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+  response->SetBody(std::vector<uint8_t>(content.begin(), content.end()));
+  return response;
+}
+
+json RsaKey(EVP_PKEY* pkey)
+{
+  json key;
+  key["kid"] = "https://vault.azure.net/keys/rsa/1";
+  key["kty"] = "RSA";
+  key["key_ops"] = {"encrypt", "verify", "wrapKey"};
+  key["n"] = ToBase64Url(pkey, "n");
+  key["e"] = ToBase64Url(pkey, "e");
+  return key;
+}
+
+json EcKey(EVP_PKEY* pkey)
+{
+  json key;
+  key["kid"] = "https://vault.azure.net/keys/ec/1";
+  key["kty"] = "EC";
+  key["crv"] = "P-256";
+  key["key_ops"] = {"sign", "verify"};
+  key["x"] = ToBase64Url(pkey, "qx", 32);
+  key["y"] = ToBase64Url(pkey, "qy", 32);
+  return key;
+}
+
+std::vector<uint8_t> Sign(EVP_PKEY* pkey, std::vector<uint8_t> const& digest, int padding)
+{
+  auto* context = EVP_PKEY_CTX_new(pkey, nullptr);
+  EVP_PKEY_sign_init(context);
+  EVP_PKEY_CTX_set_signature_md(context, EVP_sha256());
+  if (padding != 0)
+  {
+    EVP_PKEY_CTX_set_rsa_padding(context, padding);
+  }
+  if (padding == RSA_PKCS1_PSS_PADDING)
+  {
+    // Key Vault uses a salt of the size of the digest.
+    EVP_PKEY_CTX_set_rsa_pss_saltlen(context, RSA_PSS_SALTLEN_DIGEST);
+  }
+  size_t size = 0;
+  EVP_PKEY_sign(context, nullptr, &size, digest.data(), digest.size());
+  std::vector<uint8_t> signature(size);
+  EVP_PKEY_sign(context, signature.data(), &size, digest.data(), digest.size());
+  signature.resize(size);
+  EVP_PKEY_CTX_free(context);
+  return signature;
+}
+
+std::vector<uint8_t> RsaDecrypt(EVP_PKEY* pkey, std::vector<uint8_t> const& ciphertext)
+{
+  auto* context = EVP_PKEY_CTX_new(pkey, nullptr);
+  EVP_PKEY_decrypt_init(context);
+  EVP_PKEY_CTX_set_rsa_padding(context, RSA_PKCS1_OAEP_PADDING);
+  EVP_PKEY_CTX_set_rsa_oaep_md(context, EVP_sha256());
+  EVP_PKEY_CTX_set_rsa_mgf1_md(context, EVP_sha256());
+  size_t size = 0;
+  EVP_PKEY_decrypt(context, nullptr, &size, ciphertext.data(), ciphertext.size());
+  std::vector<uint8_t> plaintext(size);
+  EVP_PKEY_decrypt(context, plaintext.data(), &size, ciphertext.data(), ciphertext.size());
+  plaintext.resize(size);
+  EVP_PKEY_CTX_free(context);
+  return plaintext;
+}
+} // namespace
+
+TEST(LocalCryptographyProvider, NotLoaded)
+{
+  LocalCryptographyProvider provider;
+  EXPECT_FALSE(provider.TryVerify(SignatureAlgorithm::RS256, {}, {}).HasValue());
+
+  // Without the key, the operations keep running on the service.
+  provider.EnsureLoaded([]() { return nullptr; });
+  EXPECT_FALSE(provider.TryVerify(SignatureAlgorithm::RS256, {}, {}).HasValue());
+  EXPECT_FALSE(provider.TryEncrypt(EncryptParameters::RsaOaep256Parameters({1, 2, 3})).HasValue());
+
+  // The key isn't fetched again.
+  int loads = 0;
+  provider.EnsureLoaded([&]() {
+    ++loads;
+    return nullptr;
+  });
+  EXPECT_EQ(loads, 0);
+}
+
+TEST(LocalCryptographyProvider, TransientFailure)
+{
+  auto pkey = GenerateKey(EVP_PKEY_EC, NID_X9_62_prime256v1);
+  LocalCryptographyProvider provider(std::chrono::milliseconds(50));
+  int loads = 0;
+  auto getKey = [&]() {
+    if (++loads == 1)
+    {
+      throw Azure::Core::RequestFailedException("Service unavailable");
+    }
+    return CreateKeyResponse(EcKey(pkey.get()));
+  };
+
+  // The failure isn't reported, and the key isn't fetched again until the backoff is over.
+  provider.EnsureLoaded(getKey);
+  provider.EnsureLoaded(getKey);
+  EXPECT_EQ(loads, 1);
+  EXPECT_FALSE(provider.TryVerify(SignatureAlgorithm::ES256, std::vector<uint8_t>(32), {})
+                   .HasValue());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(60));
+  provider.EnsureLoaded(getKey);
+  provider.EnsureLoaded(getKey);
+  EXPECT_EQ(loads, 2);
+  EXPECT_TRUE(provider.TryVerify(SignatureAlgorithm::ES256, std::vector<uint8_t>(32), {})
+                  .HasValue());
+}
+
+TEST(LocalCryptographyProvider, MalformedKey)
+{
+  // The key can't be parsed after its type and first operations, so none of it is used, and the
+  // operations run on the service.
+  auto pkey = GenerateKey(EVP_PKEY_EC, NID_X9_62_prime256v1);
+  auto key = EcKey(pkey.get());
+  key["key_ops"].push_back(1);
+  LocalCryptographyProvider provider;
+  int loads = 0;
+  auto getKey = [&]() {
+    ++loads;
+    return CreateKeyResponse(key);
+  };
+  EXPECT_NO_THROW(provider.EnsureLoaded(getKey));
+  EXPECT_NO_THROW(provider.EnsureLoaded(getKey));
+  EXPECT_EQ(loads, 1);
+  EXPECT_FALSE(provider.TryVerify(SignatureAlgorithm::ES256, std::vector<uint8_t>(32), {})
+                   .HasValue());
+
+  LocalCryptographyProvider notJsonProvider;
+  EXPECT_NO_THROW(notJsonProvider.EnsureLoaded([]() {
+    auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+        1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+    response->SetBody({'{'});
+    return response;
+  }));
+  EXPECT_FALSE(notJsonProvider.TryVerify(SignatureAlgorithm::ES256, std::vector<uint8_t>(32), {})
+                   .HasValue());
+}
+
+TEST(LocalCryptographyProvider, RsaKey)
+{
+  auto pkey = GenerateKey(EVP_PKEY_RSA, 2048);
+  LocalCryptographyProvider provider;
+  int loads = 0;
+  for (int i = 0; i < 2; ++i)
+  {
+    provider.EnsureLoaded([&]() {
+      ++loads;
+      return CreateKeyResponse(RsaKey(pkey.get()));
+    });
+  }
+  EXPECT_EQ(loads, 1);
+
+  const std::vector<uint8_t> digest(32, 0x5a);
+  for (auto padding : {RSA_PKCS1_PADDING, RSA_PKCS1_PSS_PADDING})
+  {
+    auto const& algorithm
+        = padding == RSA_PKCS1_PADDING ? SignatureAlgorithm::RS256 : SignatureAlgorithm::PS256;
+    auto signature = Sign(pkey.get(), digest, padding);
+    auto result = provider.TryVerify(algorithm, digest, signature);
+    ASSERT_TRUE(result.HasValue());
+    EXPECT_TRUE(result.Value().IsValid);
+    EXPECT_EQ(result.Value().Algorithm, algorithm);
+
+    signature[0] ^= 1;
+    result = provider.TryVerify(algorithm, digest, signature);
+    ASSERT_TRUE(result.HasValue());
+    EXPECT_FALSE(result.Value().IsValid);
+  }
+
+  // Digests of the wrong size and algorithms for other key types are left to the service.
+  EXPECT_FALSE(provider.TryVerify(SignatureAlgorithm::RS384, digest, {}).HasValue());
+  EXPECT_FALSE(provider.TryVerify(SignatureAlgorithm::ES256, digest, {}).HasValue());
+
+  const std::vector<uint8_t> plaintext{1, 2, 3, 4, 5};
+  auto encrypted = provider.TryEncrypt(EncryptParameters::RsaOaep256Parameters(plaintext));
+  ASSERT_TRUE(encrypted.HasValue());
+  EXPECT_EQ(encrypted.Value().KeyId, "https://vault.azure.net/keys/rsa/1");
+  EXPECT_EQ(RsaDecrypt(pkey.get(), encrypted.Value().Ciphertext), plaintext);
+
+  auto wrapped = provider.TryWrapKey(KeyWrapAlgorithm::RsaOaep256, plaintext);
+  ASSERT_TRUE(wrapped.HasValue());
+  EXPECT_EQ(RsaDecrypt(pkey.get(), wrapped.Value().EncryptedKey), plaintext);
+  EXPECT_FALSE(provider.TryWrapKey(KeyWrapAlgorithm::A256KW, plaintext).HasValue());
+}
+
+TEST(LocalCryptographyProvider, EcKey)
+{
+  auto pkey = GenerateKey(EVP_PKEY_EC, NID_X9_62_prime256v1);
+  LocalCryptographyProvider provider;
+  provider.EnsureLoaded([&]() { return CreateKeyResponse(EcKey(pkey.get())); });
+
+  // Key Vault signatures are R and S concatenated.
+  const std::vector<uint8_t> digest(32, 0x3c);
+  auto der = Sign(pkey.get(), digest, 0);
+  const unsigned char* input = der.data();
+  auto* ecdsaSignature = d2i_ECDSA_SIG(nullptr, &input, static_cast<long>(der.size()));
+  std::vector<uint8_t> signature(64);
+  BN_bn2binpad(ECDSA_SIG_get0_r(ecdsaSignature), signature.data(), 32);
+  BN_bn2binpad(ECDSA_SIG_get0_s(ecdsaSignature), signature.data() + 32, 32);
+  ECDSA_SIG_free(ecdsaSignature);
+
+  auto result = provider.TryVerify(SignatureAlgorithm::ES256, digest, signature);
+  ASSERT_TRUE(result.HasValue());
+  EXPECT_TRUE(result.Value().IsValid);
+
+  signature[40] ^= 1;
+  result = provider.TryVerify(SignatureAlgorithm::ES256, digest, signature);
+  ASSERT_TRUE(result.HasValue());
+  EXPECT_FALSE(result.Value().IsValid);
+
+  // The curve of the algorithm must match the key, and the key doesn't permit encryption.
+  EXPECT_FALSE(provider.TryVerify(SignatureAlgorithm::ES384, digest, signature).HasValue());
+  EXPECT_FALSE(provider.TryEncrypt(EncryptParameters::RsaOaepParameters({1})).HasValue());
+}
+
+#endif
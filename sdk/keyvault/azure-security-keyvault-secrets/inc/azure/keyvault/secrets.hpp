@@ -17,4 +17,5 @@
 #include "azure/keyvault/secrets/keyvault_secret_paged_response.hpp"
 #include "azure/keyvault/secrets/keyvault_secret_properties.hpp"
 #include "azure/keyvault/secrets/rtti.hpp"
+#include "azure/keyvault/secrets/secret_cache.hpp"
 #include "azure/keyvault/secrets/secret_client.hpp"
@@ -0,0 +1,157 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Defines an in-process cache of Key Vault secrets.
+ *
+ */
+
+#pragma once
+
+#include "azure/keyvault/secrets/keyvault_options.hpp"
+#include "azure/keyvault/secrets/keyvault_secret.hpp"
+#include "azure/keyvault/secrets/secret_client.hpp"
+
+#include <azure/core/context.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Secrets {
+  namespace _detail {
+    class SecretCacheImpl;
+  }
+
+  /**
+   * @brief Options for a #SecretCache.
+   *
+   */
+  struct SecretCacheOptions final
+  {
+    /**
+     * @brief How long a secret is served from the cache after it was fetched from the service.
+     *
+     */
+    std::chrono::milliseconds TimeToLive = std::chrono::minutes(5);
+
+    /**
+     * @brief How long before a secret expires from the cache it is fetched again in the
+     * background, so that readers don't wait for the service.
+     *
+     * @remark Only the secrets read since they were last fetched are refreshed; the others expire.
+     * When it's zero, or not shorter than #TimeToLive, the secrets are not refreshed in the
+     * background.
+     *
+     */
+    std::chrono::milliseconds RefreshBeforeExpiry = std::chrono::minutes(1);
+  };
+
+  /**
+   * @brief The hit and miss counters of a #SecretCache.
+   *
+   */
+  struct SecretCacheMetrics final
+  {
+    /**
+     * @brief The number of reads served from the cache.
+     *
+     */
+    int64_t Hits = 0;
+
+    /**
+     * @brief The number of reads that fetched the secret from the service, or waited for another
+     * read of the same secret to fetch it.
+     *
+     */
+    int64_t Misses = 0;
+
+    /**
+     * @brief The number of secrets fetched again in the background.
+     *
+     */
+    int64_t Refreshes = 0;
+
+    /**
+     * @brief The number of background fetches that failed. The secret is then served from the
+     * cache until it expires.
+     *
+     */
+    int64_t RefreshFailures = 0;
+  };
+
+  /**
+   * @brief An in-process cache of secrets read with a #SecretClient.
+   *
+   * @details A secret is fetched from the service on its first read, and then served from the
+   * cache for #SecretCacheOptions::TimeToLive. Concurrent reads of a secret that isn't cached wait
+   * for a single request to the service. Secrets that are read are fetched again in the
+   * background before they expire.
+   *
+   * @remark The cache doesn't see the changes made to the secrets until they are fetched again;
+   * call #Invalidate after changing a secret through the same process.
+   *
+   */
+  class SecretCache final {
+    std::unique_ptr<_detail::SecretCacheImpl> m_impl;
+
+  public:
+    /**
+     * @brief Construct a new SecretCache object.
+     *
+     * @param client The client used to fetch the secrets.
+     * @param options The options to customize the cache behavior.
+     */
+    explicit SecretCache(
+        SecretClient const& client,
+        SecretCacheOptions const& options = SecretCacheOptions());
+
+    SecretCache(SecretCache const&) = delete;
+    SecretCache& operator=(SecretCache const&) = delete;
+
+    /**
+     * @brief Destructs `%SecretCache`, and stops refreshing the secrets.
+     *
+     */
+    ~SecretCache();
+
+    /**
+     * @brief Get a secret from the cache, or from the service when it isn't cached or expired.
+     *
+     * @param name The name of the secret.
+     * @param options The optional parameters for this request. An empty version reads the latest
+     * version of the secret.
+     * @param context The context for the operation can be used for request cancellation.
+     * @return The secret.
+     */
+    KeyVaultSecret GetSecret(
+        std::string const& name,
+        GetSecretOptions const& options = GetSecretOptions(),
+        Azure::Core::Context const& context = Azure::Core::Context());
+
+    /**
+     * @brief Remove a secret from the cache, so that its next read fetches it from the service.
+     *
+     * @param name The name of the secret.
+     * @param options The version of the secret. An empty version removes the latest version.
+     */
+    void Invalidate(
+        std::string const& name,
+        GetSecretOptions const& options = GetSecretOptions());
+
+    /**
+     * @brief Remove all the secrets from the cache.
+     *
+     */
+    void Clear();
+
+    /**
+     * @brief Get the hit and miss counters of the cache.
+     *
+     * @return The counters since the cache was created.
+     */
+    SecretCacheMetrics GetMetrics() const;
+  };
+}}}} // namespace Azure::Security::KeyVault::Secrets
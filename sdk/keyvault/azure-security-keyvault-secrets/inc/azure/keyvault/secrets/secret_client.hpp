@@ -69,7 +69,11 @@ namespace Azure { namespace Security { namespace KeyVault { namespace Secrets {
      *
      * @param keyClient An existing key vault key client.
      */
-    explicit SecretClient(SecretClient const& keyClient) { m_client = keyClient.m_client; }
+    explicit SecretClient(SecretClient const& keyClient)
+        : m_client(keyClient.m_client), m_vaultUrl(keyClient.m_vaultUrl),
+          m_apiVersion(keyClient.m_apiVersion)
+    {
+    }
 
     ~SecretClient() = default;
 
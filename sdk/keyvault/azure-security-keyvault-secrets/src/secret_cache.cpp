@@ -0,0 +1,377 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/keyvault/secrets/secret_cache.hpp"
+
+#include <azure/core/context.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace Azure::Security::KeyVault::Secrets;
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Secrets { namespace _detail {
+  // The interval at which a read waiting for another read of the secret checks whether its own
+  // context is cancelled.
+  constexpr static std::chrono::milliseconds PendingWaitInterval = std::chrono::milliseconds(100);
+
+  class SecretCacheImpl final {
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry final
+    {
+      std::string Name;
+      std::string Version;
+      // Identifies the entry, so that a fetch doesn't update an entry invalidated meanwhile.
+      uint64_t Generation = 0;
+      std::shared_ptr<KeyVaultSecret const> Secret;
+      // Valid while the secret is fetched on a miss; the other reads wait for it.
+      std::shared_future<std::shared_ptr<KeyVaultSecret const>> Pending;
+      Clock::time_point ExpiresOn;
+      Clock::time_point RefreshOn;
+      bool ReadSinceFetched = false;
+      bool Refreshing = false;
+    };
+
+    SecretClient m_client;
+    SecretCacheOptions m_options;
+    bool m_backgroundRefresh;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_refreshCondition;
+    std::map<std::string, Entry> m_entries;
+    uint64_t m_generation = 0;
+    bool m_stopping = false;
+    Azure::Core::Context m_refreshContext;
+    std::thread m_refreshThread;
+
+    std::atomic<int64_t> m_hits{0};
+    std::atomic<int64_t> m_misses{0};
+    std::atomic<int64_t> m_refreshes{0};
+    std::atomic<int64_t> m_refreshFailures{0};
+
+    static std::string GetKey(std::string const& name, std::string const& version)
+    {
+      return name + '/' + version;
+    }
+
+    void SetSecret(Entry& entry, std::shared_ptr<KeyVaultSecret const> secret)
+    {
+      auto const now = Clock::now();
+      entry.Secret = std::move(secret);
+      entry.ExpiresOn = now + m_options.TimeToLive;
+      entry.RefreshOn = entry.ExpiresOn - m_options.RefreshBeforeExpiry;
+      entry.ReadSinceFetched = false;
+    }
+
+    void RefreshThread()
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (!m_stopping)
+      {
+        auto const now = Clock::now();
+        auto wakeOn = Clock::time_point::max();
+        std::vector<std::pair<std::string, uint64_t>> toRefresh;
+
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+          auto& entry = it->second;
+          if (!entry.Secret || entry.Pending.valid() || entry.Refreshing)
+          {
+            ++it;
+            continue;
+          }
+          if (entry.ExpiresOn <= now)
+          {
+            it = m_entries.erase(it);
+            continue;
+          }
+          if (entry.ReadSinceFetched && entry.RefreshOn <= now)
+          {
+            entry.Refreshing = true;
+            toRefresh.emplace_back(it->first, entry.Generation);
+          }
+          else
+          {
+            // An entry read later wakes this thread up.
+            wakeOn
+                = (std::min)(wakeOn, entry.ReadSinceFetched ? entry.RefreshOn : entry.ExpiresOn);
+          }
+          ++it;
+        }
+
+        if (toRefresh.empty())
+        {
+          if (wakeOn == Clock::time_point::max())
+          {
+            m_refreshCondition.wait(lock);
+          }
+          else
+          {
+            m_refreshCondition.wait_until(lock, wakeOn);
+          }
+          continue;
+        }
+
+        for (auto const& refresh : toRefresh)
+        {
+          auto it = m_entries.find(refresh.first);
+          if (m_stopping || it == m_entries.end())
+          {
+            continue;
+          }
+          if (it->second.Generation != refresh.second)
+          {
+            // A read fetched the secret meanwhile; the entry is scheduled again from its new
+            // expiry.
+            it->second.Refreshing = false;
+            continue;
+          }
+          GetSecretOptions options;
+          options.Version = it->second.Version;
+          auto const name = it->second.Name;
+
+          lock.unlock();
+          std::shared_ptr<KeyVaultSecret const> secret;
+          try
+          {
+            secret = std::make_shared<KeyVaultSecret const>(
+                m_client.GetSecret(name, options, m_refreshContext).Value);
+          }
+          catch (std::exception const&)
+          {
+            // The secret is served from the cache until it expires.
+          }
+          lock.lock();
+
+          it = m_entries.find(refresh.first);
+          if (it == m_entries.end())
+          {
+            continue;
+          }
+          // The entry is refreshed and evicted again even if a read fetched the secret meanwhile,
+          // for instance because this refresh took longer than the secret's time to live.
+          it->second.Refreshing = false;
+          if (it->second.Generation != refresh.second)
+          {
+            continue;
+          }
+          if (secret)
+          {
+            SetSecret(it->second, std::move(secret));
+            ++m_refreshes;
+          }
+          else
+          {
+            // Try again later, if the secret is still read by then.
+            it->second.RefreshOn = Clock::now()
+                + (std::max)(m_options.RefreshBeforeExpiry / 4, std::chrono::milliseconds(1));
+            ++m_refreshFailures;
+          }
+        }
+      }
+    }
+
+    // Fetches the secret for the entry at it, creating it if it's end(), while the other reads of
+    // the secret wait for it. Called with the lock held, which is released.
+    KeyVaultSecret FetchSecret(
+        std::map<std::string, Entry>::iterator it,
+        std::string const& key,
+        std::string const& name,
+        GetSecretOptions const& options,
+        Azure::Core::Context const& context,
+        std::unique_lock<std::mutex>& lock)
+    {
+      if (it == m_entries.end())
+      {
+        it = m_entries.emplace(key, Entry()).first;
+        it->second.Name = name;
+        it->second.Version = options.Version;
+      }
+      std::promise<std::shared_ptr<KeyVaultSecret const>> promise;
+      uint64_t const generation = ++m_generation;
+      it->second.Generation = generation;
+      it->second.Pending = promise.get_future().share();
+      lock.unlock();
+
+      std::shared_ptr<KeyVaultSecret const> secret;
+      try
+      {
+        secret = std::make_shared<KeyVaultSecret const>(
+            m_client.GetSecret(name, options, context).Value);
+      }
+      catch (...)
+      {
+        {
+          std::lock_guard<std::mutex> guard(m_mutex);
+          it = m_entries.find(key);
+          if (it != m_entries.end() && it->second.Generation == generation)
+          {
+            it->second.Pending = {};
+            if (!it->second.Secret)
+            {
+              m_entries.erase(it);
+            }
+          }
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+      }
+
+      {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        it = m_entries.find(key);
+        if (it != m_entries.end() && it->second.Generation == generation)
+        {
+          it->second.Pending = {};
+          SetSecret(it->second, secret);
+        }
+      }
+      m_refreshCondition.notify_one();
+      promise.set_value(secret);
+      return *secret;
+    }
+
+  public:
+    SecretCacheImpl(SecretClient const& client, SecretCacheOptions const& options)
+        : m_client(client), m_options(options),
+          m_backgroundRefresh(
+              options.RefreshBeforeExpiry.count() > 0
+              && options.RefreshBeforeExpiry < options.TimeToLive)
+    {
+      if (m_backgroundRefresh)
+      {
+        m_refreshThread = std::thread([this]() { RefreshThread(); });
+      }
+    }
+
+    ~SecretCacheImpl()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+      }
+      m_refreshContext.Cancel();
+      m_refreshCondition.notify_all();
+      if (m_refreshThread.joinable())
+      {
+        m_refreshThread.join();
+      }
+    }
+
+    KeyVaultSecret GetSecret(
+        std::string const& name,
+        GetSecretOptions const& options,
+        Azure::Core::Context const& context)
+    {
+      auto const key = GetKey(name, options.Version);
+      bool isMissCounted = false;
+      while (true)
+      {
+        std::shared_future<std::shared_ptr<KeyVaultSecret const>> pending;
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          auto it = m_entries.find(key);
+          if (it != m_entries.end())
+          {
+            auto& entry = it->second;
+            if (entry.Secret && Clock::now() < entry.ExpiresOn)
+            {
+              ++m_hits;
+              if (!entry.ReadSinceFetched)
+              {
+                entry.ReadSinceFetched = true;
+                if (m_backgroundRefresh)
+                {
+                  m_refreshCondition.notify_one();
+                }
+              }
+              return *entry.Secret;
+            }
+            pending = entry.Pending;
+          }
+          if (!isMissCounted)
+          {
+            ++m_misses;
+            isMissCounted = true;
+          }
+          if (!pending.valid())
+          {
+            return FetchSecret(it, key, name, options, context, lock);
+          }
+        }
+
+        // Another read is fetching the secret. This one waits for it, until its own context is
+        // cancelled.
+        while (pending.wait_for(PendingWaitInterval) != std::future_status::ready)
+        {
+          context.ThrowIfCancelled();
+        }
+        try
+        {
+          return *pending.get();
+        }
+        catch (Azure::Core::OperationCancelledException const&)
+        {
+          // The other read was cancelled, and this one fetches the secret unless it's cancelled.
+          context.ThrowIfCancelled();
+        }
+      }
+    }
+
+    void Invalidate(std::string const& name, std::string const& version)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries.erase(GetKey(name, version));
+    }
+
+    void Clear()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries.clear();
+    }
+
+    SecretCacheMetrics GetMetrics() const
+    {
+      SecretCacheMetrics metrics;
+      metrics.Hits = m_hits;
+      metrics.Misses = m_misses;
+      metrics.Refreshes = m_refreshes;
+      metrics.RefreshFailures = m_refreshFailures;
+      return metrics;
+    }
+  };
+}}}}} // namespace Azure::Security::KeyVault::Secrets::_detail
+
+SecretCache::SecretCache(SecretClient const& client, SecretCacheOptions const& options)
+    : m_impl(std::make_unique<_detail::SecretCacheImpl>(client, options))
+{
+}
+
+SecretCache::~SecretCache() = default;
+
+KeyVaultSecret SecretCache::GetSecret(
+    std::string const& name,
+    GetSecretOptions const& options,
+    Azure::Core::Context const& context)
+{
+  return m_impl->GetSecret(name, options, context);
+}
+
+void SecretCache::Invalidate(std::string const& name, GetSecretOptions const& options)
+{
+  m_impl->Invalidate(name, options.Version);
+}
+
+void SecretCache::Clear() { m_impl->Clear(); }
+
+SecretCacheMetrics SecretCache::GetMetrics() const { return m_impl->GetMetrics(); }
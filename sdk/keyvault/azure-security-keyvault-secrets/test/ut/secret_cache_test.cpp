@@ -0,0 +1,249 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <azure/core/credentials/credentials.hpp>
+#include <azure/core/http/transport.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/keyvault/secrets.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Security::KeyVault::Secrets;
+using namespace std::chrono_literals;
+
+namespace {
+class TestCredential final : public Azure::Core::Credentials::TokenCredential {
+public:
+  TestCredential() : TokenCredential("TestCredential") {}
+
+  Azure::Core::Credentials::AccessToken GetToken(
+      Azure::Core::Credentials::TokenRequestContext const&,
+      Azure::Core::Context const&) const override
+  {
+    Azure::Core::Credentials::AccessToken token;
+    token.Token = "token";
+    token.ExpiresOn = std::chrono::system_clock::now() + 1h;
+    return token;
+  }
+};
+
+// Returns the secret with the number of the request as value, after the given delay unless the
+// context is cancelled meanwhile.
+class TestTransport final : public Azure::Core::Http::HttpTransport {
+public:
+  std::atomic<int> Requests{0};
+  std::atomic<bool> Fail{false};
+  std::chrono::milliseconds Delay{0};
+  std::mutex BodiesMutex;
+  std::list<std::string> Bodies;
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+      Azure::Core::Http::Request& request,
+      Azure::Core::Context const& context) override
+  {
+    for (auto const end = std::chrono::steady_clock::now() + Delay;
+         std::chrono::steady_clock::now() < end;)
+    {
+      context.ThrowIfCancelled();
+      std::this_thread::sleep_for(1ms);
+    }
+    const auto number = ++Requests;
+    auto statusCode = Azure::Core::Http::HttpStatusCode::InternalServerError;
+    std::string body = "{}";
+    if (!Fail)
+    {
+      statusCode = Azure::Core::Http::HttpStatusCode::Ok;
+      body = "{\"value\":\"" + std::to_string(number) + "\",\"id\":\""
+          + request.GetUrl().GetAbsoluteUrl() + "\",\"attributes\":{\"enabled\":true}}";
+    }
+
+    auto response = std::make_unique<Azure::Core::Http::RawResponse>(1, 1, statusCode, "");
+    std::lock_guard<std::mutex> lock(BodiesMutex);
+    Bodies.emplace_back(std::move(body));
+    response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(
+        reinterpret_cast<uint8_t const*>(Bodies.back().data()), Bodies.back().size()));
+    return response;
+  }
+};
+
+SecretClientOptions CreateClientOptions(std::shared_ptr<TestTransport> transport)
+{
+  SecretClientOptions options;
+  options.Transport.Transport = std::move(transport);
+  options.Retry.MaxRetries = 0;
+  return options;
+}
+
+const std::string VaultUrl = "https://test.vault.azure.net";
+} // namespace
+
+TEST(SecretCache, HitsAndMisses)
+{
+  auto transport = std::make_shared<TestTransport>();
+  SecretCacheOptions options;
+  options.RefreshBeforeExpiry = 0ms;
+  SecretClient client(
+      VaultUrl, std::make_shared<TestCredential>(), CreateClientOptions(transport));
+  SecretCache cache(client, options);
+
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "1");
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "1");
+  GetSecretOptions version;
+  version.Version = "v1";
+  EXPECT_EQ(cache.GetSecret("name", version).Value.Value(), "2");
+  EXPECT_EQ(transport->Requests, 2);
+
+  auto metrics = cache.GetMetrics();
+  EXPECT_EQ(metrics.Hits, 1);
+  EXPECT_EQ(metrics.Misses, 2);
+
+  cache.Invalidate("name");
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "3");
+  EXPECT_EQ(cache.GetSecret("name", version).Value.Value(), "2");
+  cache.Clear();
+  EXPECT_EQ(cache.GetSecret("name", version).Value.Value(), "4");
+}
+
+TEST(SecretCache, Expiry)
+{
+  auto transport = std::make_shared<TestTransport>();
+  SecretCacheOptions options;
+  options.TimeToLive = 50ms;
+  options.RefreshBeforeExpiry = 0ms;
+  SecretClient client(
+      VaultUrl, std::make_shared<TestCredential>(), CreateClientOptions(transport));
+  SecretCache cache(client, options);
+
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "1");
+  std::this_thread::sleep_for(100ms);
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "2");
+
+  // A failed read isn't cached.
+  transport->Fail = true;
+  cache.Clear();
+  EXPECT_THROW(cache.GetSecret("name"), Azure::Core::RequestFailedException);
+  transport->Fail = false;
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "4");
+}
+
+TEST(SecretCache, SingleFlight)
+{
+  auto transport = std::make_shared<TestTransport>();
+  transport->Delay = 100ms;
+  SecretClient client(
+      VaultUrl, std::make_shared<TestCredential>(), CreateClientOptions(transport));
+  SecretCache cache(client);
+
+  std::vector<std::thread> readers;
+  std::atomic<int> matches{0};
+  for (int i = 0; i < 8; ++i)
+  {
+    readers.emplace_back([&]() {
+      if (cache.GetSecret("name").Value.Value() == "1")
+      {
+        ++matches;
+      }
+    });
+  }
+  for (auto& reader : readers)
+  {
+    reader.join();
+  }
+
+  EXPECT_EQ(matches, 8);
+  EXPECT_EQ(transport->Requests, 1);
+  EXPECT_EQ(cache.GetMetrics().Misses, 8);
+}
+
+TEST(SecretCache, SingleFlightCancellation)
+{
+  auto transport = std::make_shared<TestTransport>();
+  transport->Delay = 200ms;
+  SecretClient client(
+      VaultUrl, std::make_shared<TestCredential>(), CreateClientOptions(transport));
+  SecretCache cache(client);
+
+  // The read fetching the secret is cancelled. The other read fetches it again instead of
+  // failing, and a read whose own context is cancelled stops waiting.
+  Azure::Core::Context leaderContext;
+  std::thread leader([&]() {
+    EXPECT_THROW(
+        cache.GetSecret("name", {}, leaderContext), Azure::Core::OperationCancelledException);
+  });
+  std::this_thread::sleep_for(20ms);
+  std::string value;
+  std::thread waiter([&]() { value = cache.GetSecret("name").Value.Value(); });
+  auto const cancelledContext = Azure::Core::Context().WithDeadline(
+      std::chrono::system_clock::now() + std::chrono::milliseconds(50));
+  auto const start = std::chrono::steady_clock::now();
+  EXPECT_THROW(
+      cache.GetSecret("name", {}, cancelledContext), Azure::Core::OperationCancelledException);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 190ms);
+  leaderContext.Cancel();
+  leader.join();
+  waiter.join();
+
+  EXPECT_EQ(value, "1");
+  EXPECT_EQ(transport->Requests, 1);
+}
+
+TEST(SecretCache, BackgroundRefresh)
+{
+  auto transport = std::make_shared<TestTransport>();
+  SecretCacheOptions options;
+  options.TimeToLive = 1000ms;
+  options.RefreshBeforeExpiry = 900ms;
+  SecretClient client(
+      VaultUrl, std::make_shared<TestCredential>(), CreateClientOptions(transport));
+  SecretCache cache(client, options);
+
+  EXPECT_EQ(cache.GetSecret("read").Value.Value(), "1");
+  EXPECT_EQ(cache.GetSecret("unread").Value.Value(), "2");
+  EXPECT_EQ(cache.GetSecret("read").Value.Value(), "1");
+
+  // Only the secret read since it was fetched is refreshed, and reads don't wait for it.
+  std::this_thread::sleep_for(300ms);
+  EXPECT_EQ(transport->Requests, 3);
+  EXPECT_EQ(cache.GetMetrics().Refreshes, 1);
+  EXPECT_EQ(cache.GetSecret("read").Value.Value(), "3");
+  EXPECT_EQ(cache.GetSecret("unread").Value.Value(), "2");
+  EXPECT_EQ(cache.GetMetrics().Misses, 2);
+}
+
+TEST(SecretCache, RefreshSlowerThanTimeToLive)
+{
+  auto transport = std::make_shared<TestTransport>();
+  transport->Delay = 400ms;
+  SecretCacheOptions options;
+  options.TimeToLive = 200ms;
+  options.RefreshBeforeExpiry = 100ms;
+  SecretClient client(
+      VaultUrl, std::make_shared<TestCredential>(), CreateClientOptions(transport));
+  SecretCache cache(client, options);
+
+  // Fetched at 400ms, expires at 600ms, and is refreshed from 500ms to 900ms.
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "1");
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "1");
+
+  // The secret expires while it's refreshed, so this read fetches it again, until 1100ms.
+  std::this_thread::sleep_for(300ms);
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "3");
+  EXPECT_EQ(cache.GetMetrics().Refreshes, 0);
+
+  // The outdated refresh doesn't keep the entry from being refreshed again, from 1200ms to
+  // 1600ms.
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "3");
+  std::this_thread::sleep_for(600ms);
+  EXPECT_EQ(cache.GetMetrics().Refreshes, 1);
+  EXPECT_EQ(cache.GetSecret("name").Value.Value(), "4");
+  EXPECT_EQ(cache.GetMetrics().Misses, 2);
+}
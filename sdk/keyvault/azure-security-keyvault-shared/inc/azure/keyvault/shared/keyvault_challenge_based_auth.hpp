@@ -12,6 +12,8 @@
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/core/internal/credentials/authorization_challenge_parser.hpp>
 
+#include <future>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <stdexcept>
@@ -66,6 +68,19 @@ namespace Azure { namespace Security { namespace KeyVault { namespace _internal
       return nextPolicy.Send(request, context);
     }
 
+    std::future<std::unique_ptr<Core::Http::RawResponse>> AuthorizeAndSendRequestAsync(
+        Core::Http::Request& request,
+        Core::Http::Policies::NextHttpPolicy& nextPolicy,
+        Core::Context const& context) const override
+    {
+      {
+        std::shared_lock<std::shared_timed_mutex> readLock(m_tokenRequestContextMutex);
+        AuthenticateAndAuthorizeRequest(request, m_tokenRequestContext, context);
+      }
+
+      return nextPolicy.SendAsync(request, context);
+    }
+
     bool AuthorizeRequestOnChallenge(
         std::string const& challenge,
         Core::Http::Request& request,
@@ -8,9 +8,11 @@
 #include "azure/storage/blobs/dll_import_export.hpp"
 
 #include <azure/core/credentials/credentials.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
 #include <azure/storage/common/storage_credential.hpp>
 
 #include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -166,6 +168,21 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetBlobPropertiesOptions& options = GetBlobPropertiesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Sends the request of #GetProperties, and returns without waiting for the response.
+     *
+     * @details No thread waits for the response when the transport supports it, such as the
+     * libcurl transport with event loops. The future is deferred: the response is processed, and
+     * the request retried if needed, by the thread calling `get()` or `wait()` on it.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return The future of the BlobProperties, or of the exception thrown by the operation.
+     */
+    std::future<Azure::Response<Models::BlobProperties>> GetPropertiesAsync(
+        const GetBlobPropertiesOptions& options = GetBlobPropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Sets system properties on the blob.
      *
@@ -269,6 +286,39 @@ namespace Azure { namespace Storage { namespace Blobs {
         const DownloadBlobOptions& options = DownloadBlobOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Sends the request of #Download, and returns without waiting for the response.
+     *
+     * @details No thread waits for the response when the transport supports it, such as the
+     * libcurl transport with event loops. The future is deferred: the response headers are
+     * processed, and the request retried if needed, by the thread calling `get()` or `wait()` on
+     * it. The content is read from the body stream of the result.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return The future of the DownloadBlobResult, or of the exception thrown by the operation.
+     */
+    std::future<Azure::Response<Models::DownloadBlobResult>> DownloadAsync(
+        const DownloadBlobOptions& options = DownloadBlobOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Downloads a blob or a blob range from the service using parallel requests, and
+     * returns a stream reading it in order.
+     *
+     * @details The chunks following the position of the reader are downloaded ahead of it, up to
+     * OpenReadBlobOptions::TransferOptions.MaxBufferedBytes, so the content of a large blob can be
+     * processed while it's downloaded, without storing it.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A DownloadBlobResult describing the downloaded blob.
+     * DownloadBlobResult.BodyStream contains the blob's data.
+     */
+    Azure::Response<Models::DownloadBlobResult> OpenRead(
+        const OpenReadBlobOptions& options = OpenReadBlobOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Downloads a blob or a blob range from the service to a memory buffer using parallel
      * requests.
@@ -434,16 +484,20 @@ namespace Azure { namespace Storage { namespace Blobs {
     Azure::Nullable<EncryptionKey> m_customerProvidedKey;
     /** @brief Encryption scope. */
     Azure::Nullable<std::string> m_encryptionScope;
+    /** @brief Threads running the chunks of the parallel transfers. */
+    std::shared_ptr<Storage::_internal::ThreadPool> m_transferThreadPool;
 
   private:
     explicit BlobClient(
         Azure::Core::Url blobUrl,
         std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
         Azure::Nullable<EncryptionKey> customerProvidedKey = Azure::Nullable<EncryptionKey>(),
-        Azure::Nullable<std::string> encryptionScope = Azure::Nullable<std::string>())
+        Azure::Nullable<std::string> encryptionScope = Azure::Nullable<std::string>(),
+        std::shared_ptr<Storage::_internal::ThreadPool> transferThreadPool = nullptr)
         : m_blobUrl(std::move(blobUrl)), m_pipeline(std::move(pipeline)),
           m_customerProvidedKey(std::move(customerProvidedKey)),
-          m_encryptionScope(std::move(encryptionScope))
+          m_encryptionScope(std::move(encryptionScope)),
+          m_transferThreadPool(std::move(transferThreadPool))
     {
     }
 
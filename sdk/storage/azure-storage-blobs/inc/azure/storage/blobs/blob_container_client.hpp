@@ -6,8 +6,10 @@
 #include "azure/storage/blobs/blob_client.hpp"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Azure { namespace Storage { namespace Blobs {
 
@@ -229,6 +231,23 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobsOptions& options = ListBlobsOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Lists the blobs in this container with several requests in flight. The container is
+     * split into shards by its virtual directories, and the pages of the shards are listed
+     * concurrently, each shard requesting its next page as soon as it gets the previous one.
+     *
+     * @param onBlobs Called with the blobs of each page. The calls are serialized, but the pages of
+     * different shards are passed in no particular order.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @remark Once a request or \p onBlobs throws, no more page is requested, and the exception is
+     * rethrown after the requests in flight complete.
+     */
+    void ListBlobsParallel(
+        const std::function<void(std::vector<Models::BlobItem>)>& onBlobs,
+        const ListBlobsParallelOptions& options = ListBlobsParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Gets the permissions for this container. The permissions indicate whether
      * container data may be accessed publicly.
@@ -342,6 +361,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
     Azure::Nullable<EncryptionKey> m_customerProvidedKey;
     Azure::Nullable<std::string> m_encryptionScope;
+    std::shared_ptr<Storage::_internal::ThreadPool> m_transferThreadPool;
 
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_batchRequestPipeline;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_batchSubrequestPipeline;
@@ -14,6 +14,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -21,6 +22,10 @@
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace Models {
+    struct BlobItem;
+  } // namespace Models
+
   /**
    * @brief Audiences available for blob service
    *
@@ -210,6 +215,14 @@ namespace Azure { namespace Storage { namespace Blobs {
      * not set.
      */
     Azure::Nullable<BlobAudience> Audience;
+
+    /**
+     * The number of threads running the chunks of the parallel transfers, such as
+     * #Azure::Storage::Blobs::BlobClient::DownloadTo and
+     * #Azure::Storage::Blobs::BlockBlobClient::UploadFrom. The threads are shared by all the clients
+     * created with the same value. The number of processors, and at least 8, is used if it's 0.
+     */
+    int32_t TransferThreadPoolSize = 0;
   };
 
   /**
@@ -421,6 +434,55 @@ namespace Azure { namespace Storage { namespace Blobs {
      * @brief Specifies one or more datasets to include in the response.
      */
     Models::ListBlobsIncludeFlags Include = Models::ListBlobsIncludeFlags::None;
+
+    /**
+     * @brief If set, each blob of a page is passed to this callback as soon as it is parsed from
+     * the response body, and the page's Blobs are left empty. The memory used by a page then
+     * doesn't grow with the number of blobs it returns. The callback is called on the thread that
+     * requests the page. If the connection is lost while the page is received, the request fails
+     * after the blobs parsed so far have been passed to the callback; requesting the page again
+     * passes them again.
+     */
+    std::function<void(Models::BlobItem)> OnBlob;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::ListBlobsParallel.
+   */
+  struct ListBlobsParallelOptions final
+  {
+    /**
+     * @brief Specifies a string that filters the results to return only blobs whose
+     * name begins with the specified prefix.
+     */
+    Azure::Nullable<std::string> Prefix;
+
+    /**
+     * @brief Specifies the maximum number of blobs to return in each page.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief Specifies one or more datasets to include in the response.
+     */
+    Models::ListBlobsIncludeFlags Include = Models::ListBlobsIncludeFlags::None;
+
+    /**
+     * @brief The delimiter of the virtual directories the container is split into. Each virtual
+     * directory is listed independently of the others.
+     */
+    std::string Delimiter = "/";
+
+    /**
+     * @brief The number of levels of virtual directories listed by hierarchy to find the shards.
+     * The virtual directories found at that level are listed flat.
+     */
+    int32_t ShardDepth = 2;
+
+    /**
+     * @brief The maximum number of list requests in flight.
+     */
+    int32_t Concurrency = 5;
   };
 
   /**
@@ -712,6 +774,59 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief If true, the CRC64 of each chunk is computed by the thread downloading it, and the
+       * CRC64 of the downloaded range is returned in
+       * #Azure::Storage::Blobs::Models::DownloadBlobToResult::TransactionalContentHash.
+       */
+      bool ComputeCrc64 = false;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobClient::OpenRead.
+   */
+  struct OpenReadBlobOptions final
+  {
+    /**
+     * @brief Downloads only the bytes of the blob in the specified range.
+     */
+    Azure::Nullable<Core::Http::HttpRange> Range;
+
+    /**
+     * @brief Optional conditions that must be met by the first request. The following requests
+     * only succeed while the blob keeps the ETag returned by the first one, so a blob modified
+     * while it's read fails the read instead of returning mixed content.
+     */
+    BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The size of the first range request in bytes. The chunks following the first range
+       * are downloaded in parallel while it's read.
+       */
+      int64_t InitialChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of bytes in a single request.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of requests that may be sent at the same time.
+       */
+      int32_t Concurrency = 5;
+
+      /**
+       * @brief The maximum number of bytes downloaded ahead of the position of the reader. At
+       * least one chunk is downloaded ahead of the reader.
+       */
+      int64_t MaxBufferedBytes = 64 * 1024 * 1024;
     } TransferOptions;
   };
 
@@ -943,6 +1058,15 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief If true, the CRC64 of each block is computed by the thread uploading it and is
+       * validated by the service, and the CRC64 of the whole content is returned in
+       * #Azure::Storage::Blobs::Models::UploadBlockBlobResult::TransactionalContentHash. When
+       * uploading from a file, each block, or the whole file when it is uploaded in a single
+       * request, is read into memory once to be hashed and sent.
+       */
+      bool ComputeCrc64 = false;
     } TransferOptions;
 
     /**
@@ -6,6 +6,7 @@
 #include "azure/storage/blobs/blob_client.hpp"
 
 #include <cstdint>
+#include <future>
 #include <string>
 #include <vector>
 
@@ -187,6 +188,24 @@ namespace Azure { namespace Storage { namespace Blobs {
         const StageBlockOptions& options = StageBlockOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Sends the request of #StageBlock, and returns without waiting for the response. See
+     * #Azure::Storage::Blobs::BlobClient::GetPropertiesAsync.
+     *
+     * @param blockId A valid Base64 string value that identifies the block. Prior to encoding, the
+     * string must be less than or equal to 64 bytes in size.
+     * @param content A BodyStream containing the content to upload. It must stay valid until the
+     * future is waited for or destroyed.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return The future of the StageBlockResult, or of the exception thrown by the operation.
+     */
+    std::future<Azure::Response<Models::StageBlockResult>> StageBlockAsync(
+        const std::string& blockId,
+        Azure::Core::IO::BodyStream& content,
+        const StageBlockOptions& options = StageBlockOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a new block to be committed as part of a blob where the contents are read from
      * the sourceUri.
@@ -226,6 +245,21 @@ namespace Azure { namespace Storage { namespace Blobs {
         const CommitBlockListOptions& options = CommitBlockListOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Sends the request of #CommitBlockList, and returns without waiting for the response.
+     * See #Azure::Storage::Blobs::BlobClient::GetPropertiesAsync.
+     *
+     * @param blockIds Base64 encoded block IDs to indicate that make up the blob.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return The future of the CommitBlockListResult, or of the exception thrown by the
+     * operation.
+     */
+    std::future<Azure::Response<Models::CommitBlockListResult>> CommitBlockListAsync(
+        const std::vector<std::string>& blockIds,
+        const CommitBlockListOptions& options = CommitBlockListOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Retrieves the list of blocks that have been uploaded as part of a block blob. There
      * are two block lists maintained for a blob. The Committed Block list has blocks that have been
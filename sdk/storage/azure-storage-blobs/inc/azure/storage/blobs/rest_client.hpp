@@ -4,6 +4,13 @@
 //
 // Code generated by Microsoft (R) AutoRest C++ Code Generator.
 // Changes may cause incorrect behavior and will be lost if the code is regenerated.
+//
+// Edited by hand after generation. Re-apply these edits when regenerating:
+// - ListBlobContainerBlobsOptions and ListBlobContainerBlobsByHierarchyOptions have an OnBlobItem
+//   member. It implements the public ListBlobsOptions::OnBlob.
+// - BlobClient::Download, BlobClient::GetProperties, BlockBlobClient::StageBlock and
+//   BlockBlobClient::CommitBlockList have an Async variant sending the request with
+//   HttpPipeline::SendAsync.
 #pragma once
 
 #include <azure/core/case_insensitive_containers.hpp>
@@ -21,6 +28,8 @@
 #include <azure/storage/common/storage_common.hpp>
 
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -3474,6 +3483,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         Nullable<std::string> Marker;
         Nullable<std::int32_t> MaxResults;
         Nullable<Models::ListBlobsIncludeFlags> Include;
+        std::function<void(Models::_detail::BlobItem&&)> OnBlobItem;
       };
       static Response<Models::_detail::ListBlobsResult> ListBlobs(
           Core::Http::_internal::HttpPipeline& pipeline,
@@ -3488,6 +3498,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         Nullable<std::int32_t> MaxResults;
         Nullable<Models::ListBlobsIncludeFlags> Include;
         Nullable<std::string> ShowOnly;
+        std::function<void(Models::_detail::BlobItem&&)> OnBlobItem;
       };
       static Response<Models::_detail::ListBlobsByHierarchyResult> ListBlobsByHierarchy(
           Core::Http::_internal::HttpPipeline& pipeline,
@@ -3528,6 +3539,11 @@ namespace Azure { namespace Storage { namespace Blobs {
           const Core::Url& url,
           const DownloadBlobOptions& options,
           const Core::Context& context);
+      static std::future<Response<Models::DownloadBlobResult>> DownloadAsync(
+          std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+          const Core::Url& url,
+          const DownloadBlobOptions& options,
+          const Core::Context& context);
       struct GetBlobPropertiesOptions final
       {
         Nullable<std::string> Snapshot;
@@ -3548,6 +3564,11 @@ namespace Azure { namespace Storage { namespace Blobs {
           const Core::Url& url,
           const GetBlobPropertiesOptions& options,
           const Core::Context& context);
+      static std::future<Response<Models::BlobProperties>> GetPropertiesAsync(
+          std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+          const Core::Url& url,
+          const GetBlobPropertiesOptions& options,
+          const Core::Context& context);
       struct DeleteBlobOptions final
       {
         Nullable<std::string> Snapshot;
@@ -4272,6 +4293,12 @@ namespace Azure { namespace Storage { namespace Blobs {
           Core::IO::BodyStream& requestBody,
           const StageBlockBlobBlockOptions& options,
           const Core::Context& context);
+      static std::future<Response<Models::StageBlockResult>> StageBlockAsync(
+          std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+          const Core::Url& url,
+          Core::IO::BodyStream& requestBody,
+          const StageBlockBlobBlockOptions& options,
+          const Core::Context& context);
       struct StageBlockBlobBlockFromUriOptions final
       {
         std::string BlockId;
@@ -4329,6 +4356,11 @@ namespace Azure { namespace Storage { namespace Blobs {
           const Core::Url& url,
           const CommitBlockBlobBlockListOptions& options,
           const Core::Context& context);
+      static std::future<Response<Models::CommitBlockListResult>> CommitBlockListAsync(
+          std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+          const Core::Url& url,
+          const CommitBlockBlobBlockListOptions& options,
+          const Core::Context& context);
       struct GetBlockBlobBlockListOptions final
       {
         Nullable<std::string> Snapshot;
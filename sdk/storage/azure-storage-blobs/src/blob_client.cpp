@@ -14,6 +14,7 @@
 #include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
 #include <azure/storage/common/internal/file_io.hpp>
+#include <azure/storage/common/internal/parallel_download_stream.hpp>
 #include <azure/storage/common/internal/reliable_stream.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_bearer_token_auth.hpp>
@@ -24,6 +25,8 @@
 #include <azure/storage/common/storage_exception.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <future>
 
 namespace Azure { namespace Storage { namespace Blobs {
 
@@ -110,7 +113,8 @@ namespace Azure { namespace Storage { namespace Blobs {
 
   BlobClient::BlobClient(const std::string& blobUrl, const BlobClientOptions& options)
       : m_blobUrl(blobUrl), m_customerProvidedKey(options.CustomerProvidedKey),
-        m_encryptionScope(options.EncryptionScope)
+        m_encryptionScope(options.EncryptionScope),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -163,154 +167,294 @@ namespace Azure { namespace Storage { namespace Blobs {
     return newClient;
   }
 
-  Azure::Response<Models::DownloadBlobResult> BlobClient::Download(
-      const DownloadBlobOptions& options,
-      const Azure::Core::Context& context) const
-  {
-    _detail::BlobClient::DownloadBlobOptions protocolLayerOptions;
-    if (options.Range.HasValue())
+  namespace {
+    _detail::BlobClient::DownloadBlobOptions GetDownloadProtocolLayerOptions(
+        const DownloadBlobOptions& options,
+        const Azure::Nullable<EncryptionKey>& customerProvidedKey,
+        const Azure::Core::Context& context)
     {
-      std::string rangeStr = "bytes=" + std::to_string(options.Range.Value().Offset) + "-";
-      if (options.Range.Value().Length.HasValue())
+      _detail::BlobClient::DownloadBlobOptions protocolLayerOptions;
+      if (options.Range.HasValue())
       {
-        rangeStr += std::to_string(
-            options.Range.Value().Offset + options.Range.Value().Length.Value() - 1);
+        std::string rangeStr = "bytes=" + std::to_string(options.Range.Value().Offset) + "-";
+        if (options.Range.Value().Length.HasValue())
+        {
+          rangeStr += std::to_string(
+              options.Range.Value().Offset + options.Range.Value().Length.Value() - 1);
+        }
+        protocolLayerOptions.Range = rangeStr;
       }
-      protocolLayerOptions.Range = rangeStr;
-    }
-    if (options.RangeHashAlgorithm.HasValue())
-    {
-      if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Md5)
+      if (options.RangeHashAlgorithm.HasValue())
       {
-        protocolLayerOptions.RangeGetContentMD5 = true;
+        if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Md5)
+        {
+          protocolLayerOptions.RangeGetContentMD5 = true;
+        }
+        else if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Crc64)
+        {
+          protocolLayerOptions.RangeGetContentCRC64 = true;
+        }
       }
-      else if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Crc64)
+      protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+      protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
+      protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
+      protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
+      protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
+      protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
       {
-        protocolLayerOptions.RangeGetContentCRC64 = true;
+        bool includeUserPrincipalName = false;
+        if (context.TryGetValue(
+                _detail::DataLakeInteroperabilityExtraOptionsKey, includeUserPrincipalName))
+        {
+          protocolLayerOptions.UserPrincipalName = includeUserPrincipalName;
+        }
       }
-    }
-    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
-    protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
-    protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
-    protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
-    protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
-    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
-    {
-      bool includeUserPrincipalName = false;
-      if (context.TryGetValue(
-              _detail::DataLakeInteroperabilityExtraOptionsKey, includeUserPrincipalName))
+      if (customerProvidedKey.HasValue())
       {
-        protocolLayerOptions.UserPrincipalName = includeUserPrincipalName;
+        protocolLayerOptions.EncryptionKey = customerProvidedKey.Value().Key;
+        protocolLayerOptions.EncryptionKeySha256 = customerProvidedKey.Value().KeyHash;
+        protocolLayerOptions.EncryptionAlgorithm = customerProvidedKey.Value().Algorithm.ToString();
       }
-    }
-    if (m_customerProvidedKey.HasValue())
-    {
-      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
-      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
-      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm.ToString();
+      return protocolLayerOptions;
     }
 
-    auto downloadResponse = _detail::BlobClient::Download(
-        *m_pipeline, m_blobUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
-
+    // Fills the fields of the result which aren't read by the protocol layer. The body stream
+    // calls download to resume reading after a network failure.
+    void CompleteDownloadResult(
+        Azure::Response<Models::DownloadBlobResult>& downloadResponse,
+        const DownloadBlobOptions& options,
+        std::function<Azure::Response<Models::DownloadBlobResult>(
+            const DownloadBlobOptions&,
+            const Azure::Core::Context&)> download)
     {
-      // In case network failure during reading the body
-      const Azure::ETag eTag = downloadResponse.Value.Details.ETag;
-      const std::string client_request_id
-          = downloadResponse.RawResponse->GetHeaders().find(_internal::HttpHeaderClientRequestId)
-              == downloadResponse.RawResponse->GetHeaders().end()
-          ? std::string()
-          : downloadResponse.RawResponse->GetHeaders().at(_internal::HttpHeaderClientRequestId);
-      auto retryFunction =
-          [this, options, eTag, client_request_id](
-              int64_t retryOffset,
-              const Azure::Core::Context& context) -> std::unique_ptr<Azure::Core::IO::BodyStream> {
-        DownloadBlobOptions newOptions = options;
-        newOptions.Range = Core::Http::HttpRange();
-        newOptions.Range.Value().Offset
-            = (options.Range.HasValue() ? options.Range.Value().Offset : 0) + retryOffset;
-        if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+      {
+        // In case network failure during reading the body
+        const Azure::ETag eTag = downloadResponse.Value.Details.ETag;
+        const std::string client_request_id
+            = downloadResponse.RawResponse->GetHeaders().find(_internal::HttpHeaderClientRequestId)
+                == downloadResponse.RawResponse->GetHeaders().end()
+            ? std::string()
+            : downloadResponse.RawResponse->GetHeaders().at(_internal::HttpHeaderClientRequestId);
+        auto retryFunction = [download, options, eTag, client_request_id](
+                                 int64_t retryOffset, const Azure::Core::Context& context)
+            -> std::unique_ptr<Azure::Core::IO::BodyStream> {
+          DownloadBlobOptions newOptions = options;
+          newOptions.Range = Core::Http::HttpRange();
+          newOptions.Range.Value().Offset
+              = (options.Range.HasValue() ? options.Range.Value().Offset : 0) + retryOffset;
+          if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+          {
+            newOptions.Range.Value().Length = options.Range.Value().Length.Value() - retryOffset;
+          }
+          newOptions.AccessConditions.IfMatch = eTag;
+          return std::move(
+              download(
+                  newOptions,
+                  context.WithValue(_internal::ReliableStreamClientRequestIdKey, client_request_id))
+                  .Value.BodyStream);
+        };
+
+        _internal::ReliableStreamOptions reliableStreamOptions;
+        reliableStreamOptions.MaxRetryRequests = _internal::ReliableStreamRetryCount;
+        downloadResponse.Value.BodyStream = std::make_unique<_internal::ReliableStream>(
+            std::move(downloadResponse.Value.BodyStream), reliableStreamOptions, retryFunction);
+      }
+      if (downloadResponse.RawResponse->GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
+      {
+        downloadResponse.Value.BlobSize = std::stoll(
+            downloadResponse.RawResponse->GetHeaders().at(_internal::HttpHeaderContentLength));
+        downloadResponse.Value.ContentRange.Offset = 0;
+        downloadResponse.Value.ContentRange.Length = downloadResponse.Value.BlobSize;
+      }
+      else if (
+          downloadResponse.RawResponse->GetStatusCode()
+          == Azure::Core::Http::HttpStatusCode::PartialContent)
+      {
+        const std::string& contentRange
+            = downloadResponse.RawResponse->GetHeaders().at(_internal::HttpHeaderContentRange);
+        auto bytes_pos = contentRange.find("bytes ");
+        auto dash_pos = contentRange.find("-", bytes_pos + 6);
+        auto slash_pos = contentRange.find("/", dash_pos + 1);
+        const int64_t rangeStartOffset = std::stoll(
+            std::string(contentRange.begin() + bytes_pos + 6, contentRange.begin() + dash_pos));
+        const int64_t rangeEndOffset = std::stoll(
+            std::string(contentRange.begin() + dash_pos + 1, contentRange.begin() + slash_pos));
+        downloadResponse.Value.ContentRange
+            = Azure::Core::Http::HttpRange{rangeStartOffset, rangeEndOffset - rangeStartOffset + 1};
+        downloadResponse.Value.BlobSize = std::stoll(contentRange.substr(slash_pos + 1));
+      }
+      if (downloadResponse.Value.BlobType == Models::BlobType::AppendBlob
+          && !downloadResponse.Value.Details.IsSealed.HasValue())
+      {
+        downloadResponse.Value.Details.IsSealed = false;
+      }
+      if (downloadResponse.Value.Details.VersionId.HasValue()
+          && !downloadResponse.Value.Details.IsCurrentVersion.HasValue())
+      {
+        downloadResponse.Value.Details.IsCurrentVersion = false;
+      }
+      {
+        std::map<std::string, std::vector<Models::ObjectReplicationRule>> orPropertiesMap;
+        for (auto i = downloadResponse.RawResponse->GetHeaders().lower_bound("x-ms-or-");
+             i != downloadResponse.RawResponse->GetHeaders().end()
+             && i->first.substr(0, 8) == "x-ms-or-";
+             ++i)
         {
-          newOptions.Range.Value().Length = options.Range.Value().Length.Value() - retryOffset;
+          const std::string& header = i->first;
+          auto underscorePos = header.find('_', 8);
+          if (underscorePos == std::string::npos)
+          {
+            continue;
+          }
+          std::string policyId = std::string(header.begin() + 8, header.begin() + underscorePos);
+          std::string ruleId = header.substr(underscorePos + 1);
+
+          Models::ObjectReplicationRule rule;
+          rule.RuleId = std::move(ruleId);
+          rule.ReplicationStatus = Models::ObjectReplicationStatus(i->second);
+          orPropertiesMap[policyId].emplace_back(std::move(rule));
         }
-        newOptions.AccessConditions.IfMatch = eTag;
-        return std::move(
-            Download(
-                newOptions,
-                context.WithValue(_internal::ReliableStreamClientRequestIdKey, client_request_id))
-                .Value.BodyStream);
-      };
-
-      _internal::ReliableStreamOptions reliableStreamOptions;
-      reliableStreamOptions.MaxRetryRequests = _internal::ReliableStreamRetryCount;
-      downloadResponse.Value.BodyStream = std::make_unique<_internal::ReliableStream>(
-          std::move(downloadResponse.Value.BodyStream), reliableStreamOptions, retryFunction);
-    }
-    if (downloadResponse.RawResponse->GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-    {
-      downloadResponse.Value.BlobSize = std::stoll(
-          downloadResponse.RawResponse->GetHeaders().at(_internal::HttpHeaderContentLength));
-      downloadResponse.Value.ContentRange.Offset = 0;
-      downloadResponse.Value.ContentRange.Length = downloadResponse.Value.BlobSize;
-    }
-    else if (
-        downloadResponse.RawResponse->GetStatusCode()
-        == Azure::Core::Http::HttpStatusCode::PartialContent)
-    {
-      const std::string& contentRange
-          = downloadResponse.RawResponse->GetHeaders().at(_internal::HttpHeaderContentRange);
-      auto bytes_pos = contentRange.find("bytes ");
-      auto dash_pos = contentRange.find("-", bytes_pos + 6);
-      auto slash_pos = contentRange.find("/", dash_pos + 1);
-      const int64_t rangeStartOffset = std::stoll(
-          std::string(contentRange.begin() + bytes_pos + 6, contentRange.begin() + dash_pos));
-      const int64_t rangeEndOffset = std::stoll(
-          std::string(contentRange.begin() + dash_pos + 1, contentRange.begin() + slash_pos));
-      downloadResponse.Value.ContentRange
-          = Azure::Core::Http::HttpRange{rangeStartOffset, rangeEndOffset - rangeStartOffset + 1};
-      downloadResponse.Value.BlobSize = std::stoll(contentRange.substr(slash_pos + 1));
-    }
-    if (downloadResponse.Value.BlobType == Models::BlobType::AppendBlob
-        && !downloadResponse.Value.Details.IsSealed.HasValue())
-    {
-      downloadResponse.Value.Details.IsSealed = false;
-    }
-    if (downloadResponse.Value.Details.VersionId.HasValue()
-        && !downloadResponse.Value.Details.IsCurrentVersion.HasValue())
-    {
-      downloadResponse.Value.Details.IsCurrentVersion = false;
-    }
-    {
-      std::map<std::string, std::vector<Models::ObjectReplicationRule>> orPropertiesMap;
-      for (auto i = downloadResponse.RawResponse->GetHeaders().lower_bound("x-ms-or-");
-           i != downloadResponse.RawResponse->GetHeaders().end()
-           && i->first.substr(0, 8) == "x-ms-or-";
-           ++i)
-      {
-        const std::string& header = i->first;
-        auto underscorePos = header.find('_', 8);
-        if (underscorePos == std::string::npos)
+        for (auto& property : orPropertiesMap)
         {
-          continue;
+          Models::ObjectReplicationPolicy policy;
+          policy.PolicyId = property.first;
+          policy.Rules = std::move(property.second);
+          downloadResponse.Value.Details.ObjectReplicationSourceProperties.emplace_back(
+              std::move(policy));
         }
-        std::string policyId = std::string(header.begin() + 8, header.begin() + underscorePos);
-        std::string ruleId = header.substr(underscorePos + 1);
+      }
+    }
+  } // namespace
 
-        Models::ObjectReplicationRule rule;
-        rule.RuleId = std::move(ruleId);
-        rule.ReplicationStatus = Models::ObjectReplicationStatus(i->second);
-        orPropertiesMap[policyId].emplace_back(std::move(rule));
+  Azure::Response<Models::DownloadBlobResult> BlobClient::Download(
+      const DownloadBlobOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto downloadResponse = _detail::BlobClient::Download(
+        *m_pipeline,
+        m_blobUrl,
+        GetDownloadProtocolLayerOptions(options, m_customerProvidedKey, context),
+        _internal::WithReplicaStatus(context));
+    CompleteDownloadResult(
+        downloadResponse,
+        options,
+        [this](const DownloadBlobOptions& options, const Azure::Core::Context& context) {
+          return Download(options, context);
+        });
+    return downloadResponse;
+  }
+
+  std::future<Azure::Response<Models::DownloadBlobResult>> BlobClient::DownloadAsync(
+      const DownloadBlobOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto pendingResponse = _detail::BlobClient::DownloadAsync(
+        m_pipeline,
+        m_blobUrl,
+        GetDownloadProtocolLayerOptions(options, m_customerProvidedKey, context),
+        _internal::WithReplicaStatus(context));
+    // The body stream resumes reading with a copy of this client.
+    return std::async(
+        std::launch::deferred,
+        [client = *this, options, pendingResponse = std::move(pendingResponse)]() mutable {
+          auto downloadResponse = pendingResponse.get();
+          CompleteDownloadResult(
+              downloadResponse,
+              options,
+              [client](const DownloadBlobOptions& options, const Azure::Core::Context& context) {
+                return client.Download(options, context);
+              });
+          return downloadResponse;
+        });
+  }
+
+  Azure::Response<Models::DownloadBlobResult> BlobClient::OpenRead(
+      const OpenReadBlobOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    // The first request gets the size of the blob, and the chunks following the first one are
+    // downloaded while it's read.
+    const int64_t firstChunkOffset = options.Range.HasValue() ? options.Range.Value().Offset : 0;
+    int64_t firstChunkLength = options.TransferOptions.InitialChunkSize;
+    if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+    {
+      firstChunkLength = (std::min)(firstChunkLength, options.Range.Value().Length.Value());
+    }
+
+    DownloadBlobOptions firstChunkOptions;
+    firstChunkOptions.Range = Core::Http::HttpRange();
+    firstChunkOptions.Range.Value().Offset = firstChunkOffset;
+    firstChunkOptions.Range.Value().Length = firstChunkLength;
+    firstChunkOptions.AccessConditions = options.AccessConditions;
+
+    auto firstChunk = [&]() {
+      try
+      {
+        return Download(firstChunkOptions, context);
       }
-      for (auto& property : orPropertiesMap)
+      catch (StorageException& e)
       {
-        Models::ObjectReplicationPolicy policy;
-        policy.PolicyId = property.first;
-        policy.Rules = std::move(property.second);
-        downloadResponse.Value.Details.ObjectReplicationSourceProperties.emplace_back(
-            std::move(policy));
+        // An empty blob doesn't satisfy any range.
+        if (options.Range.HasValue()
+            || e.StatusCode != Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable)
+        {
+          throw;
+        }
       }
+      firstChunkOptions.Range.Reset();
+      return Download(firstChunkOptions, context);
+    }();
+    const Azure::ETag eTag = firstChunk.Value.Details.ETag;
+
+    const int64_t blobSize = firstChunk.Value.BlobSize;
+    int64_t blobRangeSize = blobSize - firstChunkOffset;
+    if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+    {
+      blobRangeSize = (std::min)(blobRangeSize, options.Range.Value().Length.Value());
     }
-    return downloadResponse;
+    firstChunkLength = (std::min)(firstChunkLength, blobRangeSize);
+
+    const int64_t remainingOffset = firstChunkOffset + firstChunkLength;
+    const int64_t remainingSize = blobRangeSize - firstChunkLength;
+
+    // The stream may outlive this client. The ETag of the blob implies the other conditions.
+    auto downloadChunkFunc = [blobClient = *this,
+                              eTag,
+                              leaseId = options.AccessConditions.LeaseId,
+                              tagConditions = options.AccessConditions.TagConditions](
+                                 int64_t offset,
+                                 int64_t length,
+                                 const Azure::Core::Context& context) {
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      chunkOptions.AccessConditions.LeaseId = leaseId;
+      chunkOptions.AccessConditions.TagConditions = tagConditions;
+      return std::move(blobClient.Download(chunkOptions, context).Value.BodyStream);
+    };
+
+    _internal::ParallelDownloadStreamOptions streamOptions;
+    streamOptions.ChunkSize = options.TransferOptions.ChunkSize;
+    streamOptions.Concurrency = options.TransferOptions.Concurrency;
+    streamOptions.MaxBufferedBytes = options.TransferOptions.MaxBufferedBytes;
+    firstChunk.Value.BodyStream = std::make_unique<_internal::ParallelDownloadStream>(
+        std::move(firstChunk.Value.BodyStream),
+        firstChunkLength,
+        remainingOffset,
+        remainingSize,
+        std::move(downloadChunkFunc),
+        streamOptions,
+        m_transferThreadPool,
+        context);
+    firstChunk.Value.ContentRange.Offset = firstChunkOffset;
+    firstChunk.Value.ContentRange.Length = blobRangeSize;
+    if (remainingSize != 0)
+    {
+      firstChunk.Value.TransactionalContentHash.Reset();
+    }
+    return firstChunk;
   }
 
   Azure::Response<Models::DownloadBlobToResult> BlobClient::DownloadTo(
@@ -382,6 +526,20 @@ namespace Azure { namespace Storage { namespace Blobs {
     };
     auto ret = returnTypeConverter(firstChunk);
 
+    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
+    int64_t remainingSize = blobRangeSize - firstChunkLength;
+
+    // The CRC64 of the first chunk, followed by the chunks downloaded in parallel.
+    std::unique_ptr<_internal::ChunkedCrc64Hash> crc64;
+    if (options.TransferOptions.ComputeCrc64)
+    {
+      crc64 = std::make_unique<_internal::ChunkedCrc64Hash>(
+          1
+          + (remainingSize + options.TransferOptions.ChunkSize - 1)
+              / options.TransferOptions.ChunkSize);
+      crc64->Append(0, buffer, static_cast<size_t>(firstChunkLength));
+    }
+
     // Keep downloading the remaining in parallel
     auto downloadChunkFunc
         = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
@@ -399,6 +557,11 @@ namespace Azure { namespace Storage { namespace Blobs {
             {
               throw Azure::Core::RequestFailedException("Error when reading body stream.");
             }
+            if (crc64)
+            {
+              crc64->Append(
+                  chunkId + 1, buffer + (offset - firstChunkOffset), static_cast<size_t>(length));
+            }
 
             if (chunkId == numChunks - 1)
             {
@@ -407,17 +570,22 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
           };
 
-    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
-    int64_t remainingSize = blobRangeSize - firstChunkLength;
-
     _internal::ConcurrentTransfer(
         remainingOffset,
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        m_transferThreadPool);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = blobRangeSize;
+    if (crc64)
+    {
+      ContentHash hash;
+      hash.Algorithm = HashAlgorithm::Crc64;
+      hash.Value = crc64->Final();
+      ret.Value.TransactionalContentHash = std::move(hash);
+    }
     return ret;
   }
 
@@ -462,155 +630,206 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
     firstChunkLength = (std::min)(firstChunkLength, blobRangeSize);
 
-    auto bodyStreamToFile = [](Azure::Core::IO::BodyStream& stream,
-                               _internal::FileWriter& fileWriter,
-                               int64_t offset,
-                               int64_t length,
-                               const Azure::Core::Context& context) {
-      constexpr size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
-      while (length > 0)
+    const int64_t remainingOffset = firstChunkOffset + firstChunkLength;
+    const int64_t remainingSize = blobRangeSize - firstChunkLength;
+
+    // The response of the last chunk is returned, as when each chunk was written by the thread
+    // downloading it.
+    auto lastChunk
+        = std::make_shared<std::unique_ptr<Azure::Response<Models::DownloadBlobResult>>>();
+    const int64_t lastChunkEnd = remainingOffset + remainingSize;
+    auto downloadChunkFunc = [blobClient = *this, eTag, lastChunk, lastChunkEnd](
+                                 int64_t offset,
+                                 int64_t length,
+                                 const Azure::Core::Context& context) {
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      auto chunk = blobClient.Download(chunkOptions, context);
+      auto bodyStream = std::move(chunk.Value.BodyStream);
+      if (offset + length == lastChunkEnd)
       {
-        size_t readSize = static_cast<size_t>(std::min<int64_t>(bufferSize, length));
-        size_t bytesRead = stream.ReadToCount(buffer.data(), readSize, context);
-        if (bytesRead != readSize)
-        {
-          throw Azure::Core::RequestFailedException("Error when reading body stream.");
-        }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
-        length -= bytesRead;
-        offset += bytesRead;
+        *lastChunk
+            = std::make_unique<Azure::Response<Models::DownloadBlobResult>>(std::move(chunk));
       }
+      return bodyStream;
     };
 
     _internal::FileWriter fileWriter(fileName);
-    bodyStreamToFile(*(firstChunk.Value.BodyStream), fileWriter, 0, firstChunkLength, context);
-    firstChunk.Value.BodyStream.reset();
-
-    auto returnTypeConverter = [](Azure::Response<Models::DownloadBlobResult>& response) {
-      Models::DownloadBlobToResult ret;
-      ret.BlobType = std::move(response.Value.BlobType);
-      ret.ContentRange = std::move(response.Value.ContentRange);
-      ret.BlobSize = response.Value.BlobSize;
-      ret.TransactionalContentHash = std::move(response.Value.TransactionalContentHash);
-      ret.Details = std::move(response.Value.Details);
-      return Azure::Response<Models::DownloadBlobToResult>(
-          std::move(ret), std::move(response.RawResponse));
-    };
-    auto ret = returnTypeConverter(firstChunk);
 
-    // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadBlobOptions chunkOptions;
-            chunkOptions.Range = Core::Http::HttpRange();
-            chunkOptions.Range.Value().Offset = offset;
-            chunkOptions.Range.Value().Length = length;
-            chunkOptions.AccessConditions.IfMatch = eTag;
-            auto chunk = Download(chunkOptions, context);
-            bodyStreamToFile(
-                *(chunk.Value.BodyStream),
-                fileWriter,
-                offset - firstChunkOffset,
-                chunkOptions.Range.Value().Length.Value(),
-                context);
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-              ret.Value.TransactionalContentHash.Reset();
-            }
-          };
-
-    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
-    int64_t remainingSize = blobRangeSize - firstChunkLength;
-
-    _internal::ConcurrentTransfer(
+    // The remaining chunks are downloaded in parallel while the calling thread writes the content
+    // to the file in order.
+    _internal::ParallelDownloadStreamOptions streamOptions;
+    streamOptions.ChunkSize = options.TransferOptions.ChunkSize;
+    streamOptions.Concurrency = options.TransferOptions.Concurrency;
+    streamOptions.MaxBufferedBytes = options.TransferOptions.ChunkSize
+        * (std::max)(options.TransferOptions.Concurrency, 1) * 2;
+    streamOptions.ComputeCrc64 = options.TransferOptions.ComputeCrc64;
+    _internal::ParallelDownloadStream stream(
+        std::move(firstChunk.Value.BodyStream),
+        firstChunkLength,
         remainingOffset,
         remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
-    ret.Value.ContentRange.Offset = firstChunkOffset;
-    ret.Value.ContentRange.Length = blobRangeSize;
-    return ret;
-  }
-
-  Azure::Response<Models::BlobProperties> BlobClient::GetProperties(
-      const GetBlobPropertiesOptions& options,
-      const Azure::Core::Context& context) const
-  {
-    _detail::BlobClient::GetBlobPropertiesOptions protocolLayerOptions;
-    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
-    protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
-    protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
-    protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
-    protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
-    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
+        std::move(downloadChunkFunc),
+        streamOptions,
+        m_transferThreadPool,
+        context);
     {
-      bool includeUserPrincipalName = false;
-      if (context.TryGetValue(
-              _detail::DataLakeInteroperabilityExtraOptionsKey, includeUserPrincipalName))
+      constexpr size_t bufferSize = 4 * 1024 * 1024;
+      std::vector<uint8_t> buffer(bufferSize);
+      int64_t fileOffset = 0;
+      while (true)
       {
-        protocolLayerOptions.UserPrincipalName = includeUserPrincipalName;
+        size_t bytesRead = stream.Read(buffer.data(), bufferSize, context);
+        if (bytesRead == 0)
+        {
+          break;
+        }
+        fileWriter.Write(buffer.data(), bytesRead, fileOffset);
+        fileOffset += bytesRead;
+      }
+      if (fileOffset != blobRangeSize)
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
       }
     }
-    if (m_customerProvidedKey.HasValue())
-    {
-      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
-      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
-      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm.ToString();
-    }
-    auto response = _detail::BlobClient::GetProperties(
-        *m_pipeline, m_blobUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
-    if (response.Value.AccessTier.HasValue() && !response.Value.IsAccessTierInferred.HasValue())
-    {
-      response.Value.IsAccessTierInferred = false;
-    }
-    if (response.Value.VersionId.HasValue() && !response.Value.IsCurrentVersion.HasValue())
-    {
-      response.Value.IsCurrentVersion = false;
-    }
-    if (response.Value.CopyStatus.HasValue() && !response.Value.IsIncrementalCopy.HasValue())
+
+    // The last chunk has been read, so the thread that downloaded it is done with it.
+    auto& response = *lastChunk ? **lastChunk : firstChunk;
+    Models::DownloadBlobToResult ret;
+    ret.BlobType = std::move(response.Value.BlobType);
+    ret.ContentRange.Offset = firstChunkOffset;
+    ret.ContentRange.Length = blobRangeSize;
+    ret.BlobSize = response.Value.BlobSize;
+    if (options.TransferOptions.ComputeCrc64)
     {
-      response.Value.IsIncrementalCopy = false;
+      ContentHash hash;
+      hash.Algorithm = HashAlgorithm::Crc64;
+      hash.Value = stream.FinalCrc64();
+      ret.TransactionalContentHash = std::move(hash);
     }
-    if (response.Value.BlobType == Models::BlobType::AppendBlob
-        && !response.Value.IsSealed.HasValue())
+    else if (remainingSize == 0)
     {
-      response.Value.IsSealed = false;
+      ret.TransactionalContentHash = std::move(response.Value.TransactionalContentHash);
     }
+    ret.Details = std::move(response.Value.Details);
+    return Azure::Response<Models::DownloadBlobToResult>(
+        std::move(ret), std::move(response.RawResponse));
+  }
+
+  namespace {
+    _detail::BlobClient::GetBlobPropertiesOptions GetPropertiesProtocolLayerOptions(
+        const GetBlobPropertiesOptions& options,
+        const Azure::Nullable<EncryptionKey>& customerProvidedKey,
+        const Azure::Core::Context& context)
     {
-      std::map<std::string, std::vector<Models::ObjectReplicationRule>> orPropertiesMap;
-      for (auto i = response.RawResponse->GetHeaders().lower_bound("x-ms-or-");
-           i != response.RawResponse->GetHeaders().end() && i->first.substr(0, 8) == "x-ms-or-";
-           ++i)
+      _detail::BlobClient::GetBlobPropertiesOptions protocolLayerOptions;
+      protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+      protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
+      protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
+      protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
+      protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
+      protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
       {
-        const std::string& header = i->first;
-        auto underscorePos = header.find('_', 8);
-        if (underscorePos == std::string::npos)
+        bool includeUserPrincipalName = false;
+        if (context.TryGetValue(
+                _detail::DataLakeInteroperabilityExtraOptionsKey, includeUserPrincipalName))
         {
-          continue;
+          protocolLayerOptions.UserPrincipalName = includeUserPrincipalName;
         }
-        std::string policyId = std::string(header.begin() + 8, header.begin() + underscorePos);
-        std::string ruleId = header.substr(underscorePos + 1);
+      }
+      if (customerProvidedKey.HasValue())
+      {
+        protocolLayerOptions.EncryptionKey = customerProvidedKey.Value().Key;
+        protocolLayerOptions.EncryptionKeySha256 = customerProvidedKey.Value().KeyHash;
+        protocolLayerOptions.EncryptionAlgorithm = customerProvidedKey.Value().Algorithm.ToString();
+      }
+      return protocolLayerOptions;
+    }
 
-        Models::ObjectReplicationRule rule;
-        rule.RuleId = std::move(ruleId);
-        rule.ReplicationStatus = Models::ObjectReplicationStatus(i->second);
-        orPropertiesMap[policyId].emplace_back(std::move(rule));
+    // Fills the fields of the result which aren't read by the protocol layer.
+    void CompletePropertiesResult(Azure::Response<Models::BlobProperties>& response)
+    {
+      if (response.Value.AccessTier.HasValue() && !response.Value.IsAccessTierInferred.HasValue())
+      {
+        response.Value.IsAccessTierInferred = false;
       }
-      for (auto& property : orPropertiesMap)
+      if (response.Value.VersionId.HasValue() && !response.Value.IsCurrentVersion.HasValue())
       {
-        Models::ObjectReplicationPolicy policy;
-        policy.PolicyId = property.first;
-        policy.Rules = std::move(property.second);
-        response.Value.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
+        response.Value.IsCurrentVersion = false;
+      }
+      if (response.Value.CopyStatus.HasValue() && !response.Value.IsIncrementalCopy.HasValue())
+      {
+        response.Value.IsIncrementalCopy = false;
+      }
+      if (response.Value.BlobType == Models::BlobType::AppendBlob
+          && !response.Value.IsSealed.HasValue())
+      {
+        response.Value.IsSealed = false;
+      }
+      {
+        std::map<std::string, std::vector<Models::ObjectReplicationRule>> orPropertiesMap;
+        for (auto i = response.RawResponse->GetHeaders().lower_bound("x-ms-or-");
+             i != response.RawResponse->GetHeaders().end() && i->first.substr(0, 8) == "x-ms-or-";
+             ++i)
+        {
+          const std::string& header = i->first;
+          auto underscorePos = header.find('_', 8);
+          if (underscorePos == std::string::npos)
+          {
+            continue;
+          }
+          std::string policyId = std::string(header.begin() + 8, header.begin() + underscorePos);
+          std::string ruleId = header.substr(underscorePos + 1);
+
+          Models::ObjectReplicationRule rule;
+          rule.RuleId = std::move(ruleId);
+          rule.ReplicationStatus = Models::ObjectReplicationStatus(i->second);
+          orPropertiesMap[policyId].emplace_back(std::move(rule));
+        }
+        for (auto& property : orPropertiesMap)
+        {
+          Models::ObjectReplicationPolicy policy;
+          policy.PolicyId = property.first;
+          policy.Rules = std::move(property.second);
+          response.Value.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
+        }
       }
     }
+  } // namespace
+
+  Azure::Response<Models::BlobProperties> BlobClient::GetProperties(
+      const GetBlobPropertiesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto response = _detail::BlobClient::GetProperties(
+        *m_pipeline,
+        m_blobUrl,
+        GetPropertiesProtocolLayerOptions(options, m_customerProvidedKey, context),
+        _internal::WithReplicaStatus(context));
+    CompletePropertiesResult(response);
     return response;
   }
 
+  std::future<Azure::Response<Models::BlobProperties>> BlobClient::GetPropertiesAsync(
+      const GetBlobPropertiesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto pendingResponse = _detail::BlobClient::GetPropertiesAsync(
+        m_pipeline,
+        m_blobUrl,
+        GetPropertiesProtocolLayerOptions(options, m_customerProvidedKey, context),
+        _internal::WithReplicaStatus(context));
+    return std::async(
+        std::launch::deferred, [pendingResponse = std::move(pendingResponse)]() mutable {
+          auto response = pendingResponse.get();
+          CompletePropertiesResult(response);
+          return response;
+        });
+  }
+
   Azure::Response<Models::SetBlobHttpHeadersResult> BlobClient::SetHttpHeaders(
       Models::BlobHttpHeaders httpHeaders,
       const SetBlobHttpHeadersOptions& options,
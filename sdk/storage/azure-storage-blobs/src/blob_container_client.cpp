@@ -20,6 +20,13 @@
 #include <azure/storage/common/storage_common.hpp>
 #include <azure/storage/common/storage_exception.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
 namespace Azure { namespace Storage { namespace Blobs {
 
   namespace {
@@ -101,6 +108,164 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       return blobItem;
     }
+
+    // A prefix of the container, listed one page at a time. Shards above the shard depth are
+    // listed by hierarchy, and each of their virtual directories becomes a shard.
+    struct ListBlobsShard final
+    {
+      std::string Prefix;
+      int32_t Depth = 0;
+      Azure::Nullable<std::string> ContinuationToken;
+    };
+
+    // The shards of a parallel listing, shared by the calling thread and the tasks of the thread
+    // pool.
+    struct ParallelListingState final : public std::enable_shared_from_this<ParallelListingState>
+    {
+      const BlobContainerClient* Client = nullptr;
+      std::function<void(std::vector<Models::BlobItem>)> OnBlobs;
+      ListBlobsParallelOptions Options;
+      Azure::Core::Context Context;
+      _internal::ThreadPool* ThreadPool = nullptr;
+
+      std::mutex Mutex;
+      std::condition_variable ShardsChanged;
+      // Guarded by Mutex.
+      std::deque<ListBlobsShard> PendingShards;
+      int32_t NumShardsInProgress = 0;
+      int32_t NumTasks = 0;
+      std::exception_ptr Error;
+
+      // Serializes the calls to OnBlobs.
+      std::mutex OnBlobsMutex;
+
+      bool HasPendingShards() const { return !Error && !PendingShards.empty(); }
+      bool IsComplete() const
+      {
+        return NumShardsInProgress == 0 && (Error || PendingShards.empty());
+      }
+
+      // Queues the shards, and submits tasks to list them, up to the concurrency. The next page
+      // of a shard is queued first, so that the shards in progress keep their requests in flight.
+      void AddShards(Azure::Nullable<ListBlobsShard> nextPage, std::vector<ListBlobsShard> shards)
+      {
+        int32_t numNewTasks = 0;
+        {
+          std::lock_guard<std::mutex> guard(Mutex);
+          if (nextPage.HasValue())
+          {
+            PendingShards.push_front(std::move(nextPage.Value()));
+          }
+          for (auto& shard : shards)
+          {
+            PendingShards.push_back(std::move(shard));
+          }
+          // The calling thread lists shards too.
+          numNewTasks = static_cast<int32_t>((std::min)(
+              static_cast<size_t>((std::max)(Options.Concurrency - 1 - NumTasks, 0)),
+              PendingShards.size()));
+          NumTasks += numNewTasks;
+        }
+        ShardsChanged.notify_all();
+        for (int32_t i = 0; i < numNewTasks; ++i)
+        {
+          ThreadPool->Submit(RunTask(this));
+        }
+      }
+
+      // Lists the next page of a pending shard, if any, and returns whether there was one.
+      bool ListNextShard()
+      {
+        ListBlobsShard shard;
+        {
+          std::lock_guard<std::mutex> guard(Mutex);
+          if (!HasPendingShards())
+          {
+            return false;
+          }
+          shard = std::move(PendingShards.front());
+          PendingShards.pop_front();
+          ++NumShardsInProgress;
+        }
+        std::exception_ptr error;
+        try
+        {
+          ListBlobsOptions listOptions;
+          if (!shard.Prefix.empty())
+          {
+            listOptions.Prefix = shard.Prefix;
+          }
+          listOptions.ContinuationToken = shard.ContinuationToken;
+          listOptions.PageSizeHint = Options.PageSizeHint;
+          listOptions.Include = Options.Include;
+
+          std::vector<Models::BlobItem> blobs;
+          std::vector<ListBlobsShard> newShards;
+          Azure::Nullable<std::string> nextPageToken;
+          if (shard.Depth < Options.ShardDepth)
+          {
+            auto page = Client->ListBlobsByHierarchy(Options.Delimiter, listOptions, Context);
+            blobs = std::move(page.Blobs);
+            nextPageToken = std::move(page.NextPageToken);
+            for (auto& prefix : page.BlobPrefixes)
+            {
+              ListBlobsShard newShard;
+              newShard.Prefix = std::move(prefix);
+              newShard.Depth = shard.Depth + 1;
+              newShards.push_back(std::move(newShard));
+            }
+          }
+          else
+          {
+            auto page = Client->ListBlobs(listOptions, Context);
+            blobs = std::move(page.Blobs);
+            nextPageToken = std::move(page.NextPageToken);
+          }
+
+          Azure::Nullable<ListBlobsShard> nextPage;
+          if (nextPageToken.HasValue() && !nextPageToken.Value().empty())
+          {
+            shard.ContinuationToken = std::move(nextPageToken);
+            nextPage = std::move(shard);
+          }
+          // The next requests are in flight while the blobs are handed over.
+          AddShards(std::move(nextPage), std::move(newShards));
+
+          if (!blobs.empty())
+          {
+            std::lock_guard<std::mutex> guard(OnBlobsMutex);
+            OnBlobs(std::move(blobs));
+          }
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+        {
+          std::lock_guard<std::mutex> guard(Mutex);
+          --NumShardsInProgress;
+          if (error && !Error)
+          {
+            Error = error;
+          }
+        }
+        ShardsChanged.notify_all();
+        return true;
+      }
+
+      // The tasks only use the client and the callback while a shard is in progress, which keeps
+      // the calling thread waiting, so they only need to keep the state alive.
+      static std::function<void()> RunTask(ParallelListingState* state)
+      {
+        return [state = state->shared_from_this()]() {
+          while (state->ListNextShard())
+          {
+          }
+          std::lock_guard<std::mutex> guard(state->Mutex);
+          --state->NumTasks;
+        };
+      }
+    };
   } // namespace
 
   BlobContainerClient BlobContainerClient::CreateFromConnectionString(
@@ -198,7 +363,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       const std::string& blobContainerUrl,
       const BlobClientOptions& options)
       : m_blobContainerUrl(blobContainerUrl), m_customerProvidedKey(options.CustomerProvidedKey),
-        m_encryptionScope(options.EncryptionScope)
+        m_encryptionScope(options.EncryptionScope),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -225,7 +391,12 @@ namespace Azure { namespace Storage { namespace Blobs {
   {
     auto blobUrl = m_blobContainerUrl;
     blobUrl.AppendPath(_internal::UrlEncodePath(blobName));
-    return BlobClient(std::move(blobUrl), m_pipeline, m_customerProvidedKey, m_encryptionScope);
+    return BlobClient(
+        std::move(blobUrl),
+        m_pipeline,
+        m_customerProvidedKey,
+        m_encryptionScope,
+        m_transferThreadPool);
   }
 
   BlockBlobClient BlobContainerClient::GetBlockBlobClient(const std::string& blobName) const
@@ -349,20 +520,28 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.Marker = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
+    ListBlobsPagedResponse pagedResponse;
+    // Convert the items as they're parsed from the response body so that the raw items of a page
+    // are never held all at once.
+    protocolLayerOptions.OnBlobItem = [&pagedResponse, &options](Models::_detail::BlobItem&& item) {
+      if (options.OnBlob)
+      {
+        options.OnBlob(BlobItemConversion(item));
+      }
+      else
+      {
+        pagedResponse.Blobs.push_back(BlobItemConversion(item));
+      }
+    };
     auto response = _detail::BlobContainerClient::ListBlobs(
         *m_pipeline,
         m_blobContainerUrl,
         protocolLayerOptions,
         _internal::WithReplicaStatus(context));
 
-    ListBlobsPagedResponse pagedResponse;
     pagedResponse.ServiceEndpoint = std::move(response.Value.ServiceEndpoint);
     pagedResponse.BlobContainerName = std::move(response.Value.BlobContainerName);
     pagedResponse.Prefix = std::move(response.Value.Prefix);
-    for (auto& i : response.Value.Items)
-    {
-      pagedResponse.Blobs.push_back(BlobItemConversion(i));
-    }
     pagedResponse.m_blobContainerClient = std::make_shared<BlobContainerClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
@@ -383,22 +562,27 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.Marker = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
+    ListBlobsByHierarchyPagedResponse pagedResponse;
+    protocolLayerOptions.OnBlobItem = [&pagedResponse, &options](Models::_detail::BlobItem&& item) {
+      if (options.OnBlob)
+      {
+        options.OnBlob(BlobItemConversion(item));
+      }
+      else
+      {
+        pagedResponse.Blobs.push_back(BlobItemConversion(item));
+      }
+    };
     auto response = _detail::BlobContainerClient::ListBlobsByHierarchy(
         *m_pipeline,
         m_blobContainerUrl,
         protocolLayerOptions,
         _internal::WithReplicaStatus(context));
 
-    ListBlobsByHierarchyPagedResponse pagedResponse;
-
     pagedResponse.ServiceEndpoint = std::move(response.Value.ServiceEndpoint);
     pagedResponse.BlobContainerName = std::move(response.Value.BlobContainerName);
     pagedResponse.Prefix = std::move(response.Value.Prefix);
     pagedResponse.Delimiter = std::move(response.Value.Delimiter);
-    for (auto& i : response.Value.Items)
-    {
-      pagedResponse.Blobs.push_back(BlobItemConversion(i));
-    }
     for (auto& i : response.Value.BlobPrefixes)
     {
       if (i.Encoded)
@@ -420,6 +604,48 @@ namespace Azure { namespace Storage { namespace Blobs {
     return pagedResponse;
   }
 
+  void BlobContainerClient::ListBlobsParallel(
+      const std::function<void(std::vector<Models::BlobItem>)>& onBlobs,
+      const ListBlobsParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto state = std::make_shared<ParallelListingState>();
+    state->Client = this;
+    state->OnBlobs = onBlobs;
+    state->Options = options;
+    state->Context = context;
+    auto threadPool = m_transferThreadPool;
+    if (!threadPool)
+    {
+      threadPool = _internal::ThreadPool::GetShared();
+    }
+    state->ThreadPool = threadPool.get();
+
+    ListBlobsShard rootShard;
+    rootShard.Prefix = options.Prefix.ValueOr(std::string());
+    state->AddShards(std::move(rootShard), {});
+
+    // The calling thread lists shards too, so the listing completes even when all the threads of
+    // the pool are busy.
+    std::unique_lock<std::mutex> guard(state->Mutex);
+    while (true)
+    {
+      state->ShardsChanged.wait(
+          guard, [&state]() { return state->HasPendingShards() || state->IsComplete(); });
+      if (state->IsComplete())
+      {
+        break;
+      }
+      guard.unlock();
+      state->ListNextShard();
+      guard.lock();
+    }
+    if (state->Error)
+    {
+      std::rethrow_exception(state->Error);
+    }
+  }
+
   Azure::Response<Models::BlobContainerAccessPolicy> BlobContainerClient::GetAccessPolicy(
       const GetBlobContainerAccessPolicyOptions& options,
       const Azure::Core::Context& context) const
@@ -171,7 +171,19 @@ namespace Azure { namespace Storage { namespace Blobs {
       uploadBlockBlobOptions.AccessTier = options.AccessTier;
       uploadBlockBlobOptions.ImmutabilityPolicy = options.ImmutabilityPolicy;
       uploadBlockBlobOptions.HasLegalHold = options.HasLegalHold;
-      return Upload(contentStream, uploadBlockBlobOptions, context);
+      if (options.TransferOptions.ComputeCrc64)
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Crc64Hash().Final(buffer, bufferSize);
+        uploadBlockBlobOptions.TransactionalContentHash = std::move(hash);
+      }
+      auto response = Upload(contentStream, uploadBlockBlobOptions, context);
+      if (options.TransferOptions.ComputeCrc64)
+      {
+        response.Value.TransactionalContentHash = uploadBlockBlobOptions.TransactionalContentHash;
+      }
+      return response;
     }
 
     int64_t chunkSize;
@@ -199,9 +211,24 @@ namespace Azure { namespace Storage { namespace Blobs {
           std::vector<uint8_t>(blockId.begin(), blockId.end()));
     };
 
+    std::unique_ptr<_internal::ChunkedCrc64Hash> crc64;
+    if (options.TransferOptions.ComputeCrc64)
+    {
+      crc64 = std::make_unique<_internal::ChunkedCrc64Hash>(
+          (static_cast<int64_t>(bufferSize) + chunkSize - 1) / chunkSize);
+    }
+
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
       Azure::Core::IO::MemoryBodyStream contentStream(buffer + offset, static_cast<size_t>(length));
       StageBlockOptions chunkOptions;
+      if (crc64)
+      {
+        crc64->Append(chunkId, buffer + offset, static_cast<size_t>(length));
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = crc64->ChunkFinal(chunkId);
+        chunkOptions.TransactionalContentHash = std::move(hash);
+      }
       auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
       if (chunkId == numChunks - 1)
       {
@@ -210,7 +237,12 @@ namespace Azure { namespace Storage { namespace Blobs {
     };
 
     _internal::ConcurrentTransfer(
-        0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadBlockFunc);
+        0,
+        bufferSize,
+        chunkSize,
+        options.TransferOptions.Concurrency,
+        uploadBlockFunc,
+        m_transferThreadPool);
 
     for (size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -232,6 +264,13 @@ namespace Azure { namespace Storage { namespace Blobs {
     ret.IsServerEncrypted = commitBlockListResponse.Value.IsServerEncrypted;
     ret.EncryptionKeySha256 = std::move(commitBlockListResponse.Value.EncryptionKeySha256);
     ret.EncryptionScope = std::move(commitBlockListResponse.Value.EncryptionScope);
+    if (crc64)
+    {
+      ContentHash hash;
+      hash.Algorithm = HashAlgorithm::Crc64;
+      hash.Value = crc64->Final();
+      ret.TransactionalContentHash = std::move(hash);
+    }
     return Azure::Response<Models::UploadBlockBlobFromResult>(
         std::move(ret), std::move(commitBlockListResponse.RawResponse));
   }
@@ -258,7 +297,22 @@ namespace Azure { namespace Storage { namespace Blobs {
         uploadBlockBlobOptions.AccessTier = options.AccessTier;
         uploadBlockBlobOptions.ImmutabilityPolicy = options.ImmutabilityPolicy;
         uploadBlockBlobOptions.HasLegalHold = options.HasLegalHold;
-        return Upload(contentStream, uploadBlockBlobOptions, context);
+        if (!options.TransferOptions.ComputeCrc64)
+        {
+          return Upload(contentStream, uploadBlockBlobOptions, context);
+        }
+        // The content is read once, then hashed and sent from memory.
+        const auto content = contentStream.ReadToEnd(context);
+        _internal::ChunkedCrc64Hash crc64(1);
+        crc64.Append(0, content.data(), content.size());
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = crc64.Final();
+        uploadBlockBlobOptions.TransactionalContentHash = std::move(hash);
+        Azure::Core::IO::MemoryBodyStream contentInMemory(content);
+        auto response = Upload(contentInMemory, uploadBlockBlobOptions, context);
+        response.Value.TransactionalContentHash = uploadBlockBlobOptions.TransactionalContentHash;
+        return response;
       }
     }
 
@@ -273,11 +327,28 @@ namespace Azure { namespace Storage { namespace Blobs {
 
     _internal::FileReader fileReader(fileName);
 
+    std::unique_ptr<_internal::ChunkedCrc64Hash> crc64;
+
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
       Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
           fileReader.GetHandle(), offset, length);
       StageBlockOptions chunkOptions;
-      auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+      if (!crc64)
+      {
+        StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+      }
+      else
+      {
+        // The block is read once, then hashed and sent from memory.
+        const auto content = contentStream.ReadToEnd(context);
+        crc64->Append(chunkId, content.data(), content.size());
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = crc64->ChunkFinal(chunkId);
+        chunkOptions.TransactionalContentHash = std::move(hash);
+        Azure::Core::IO::MemoryBodyStream contentInMemory(content);
+        StageBlock(getBlockId(chunkId), contentInMemory, chunkOptions, context);
+      }
       if (chunkId == numChunks - 1)
       {
         blockIds.resize(static_cast<size_t>(numChunks));
@@ -300,12 +371,19 @@ namespace Azure { namespace Storage { namespace Blobs {
       throw Azure::Core::RequestFailedException("Block size is too big.");
     }
 
+    if (options.TransferOptions.ComputeCrc64)
+    {
+      crc64 = std::make_unique<_internal::ChunkedCrc64Hash>(
+          (fileReader.GetFileSize() + chunkSize - 1) / chunkSize);
+    }
+
     _internal::ConcurrentTransfer(
         0,
         fileReader.GetFileSize(),
         chunkSize,
         options.TransferOptions.Concurrency,
-        uploadBlockFunc);
+        uploadBlockFunc,
+        m_transferThreadPool);
 
     for (size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -327,6 +405,13 @@ namespace Azure { namespace Storage { namespace Blobs {
     result.IsServerEncrypted = commitBlockListResponse.Value.IsServerEncrypted;
     result.EncryptionKeySha256 = commitBlockListResponse.Value.EncryptionKeySha256;
     result.EncryptionScope = commitBlockListResponse.Value.EncryptionScope;
+    if (crc64)
+    {
+      ContentHash hash;
+      hash.Algorithm = HashAlgorithm::Crc64;
+      hash.Value = crc64->Final();
+      result.TransactionalContentHash = std::move(hash);
+    }
     return Azure::Response<Models::UploadBlockBlobFromResult>(
         std::move(result), std::move(commitBlockListResponse.RawResponse));
   }
@@ -389,37 +474,68 @@ namespace Azure { namespace Storage { namespace Blobs {
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
   }
 
-  Azure::Response<Models::StageBlockResult> BlockBlobClient::StageBlock(
-      const std::string& blockId,
-      Azure::Core::IO::BodyStream& content,
-      const StageBlockOptions& options,
-      const Azure::Core::Context& context) const
-  {
-    _detail::BlockBlobClient::StageBlockBlobBlockOptions protocolLayerOptions;
-    protocolLayerOptions.BlockId = blockId;
-    if (options.TransactionalContentHash.HasValue())
+  namespace {
+    _detail::BlockBlobClient::StageBlockBlobBlockOptions GetStageBlockProtocolLayerOptions(
+        const std::string& blockId,
+        const StageBlockOptions& options,
+        const Azure::Nullable<EncryptionKey>& customerProvidedKey,
+        const Azure::Nullable<std::string>& encryptionScope)
     {
-      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      _detail::BlockBlobClient::StageBlockBlobBlockOptions protocolLayerOptions;
+      protocolLayerOptions.BlockId = blockId;
+      if (options.TransactionalContentHash.HasValue())
       {
-        protocolLayerOptions.TransactionalContentMD5
-            = options.TransactionalContentHash.Value().Value;
+        if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+        {
+          protocolLayerOptions.TransactionalContentMD5
+              = options.TransactionalContentHash.Value().Value;
+        }
+        else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+        {
+          protocolLayerOptions.TransactionalContentCrc64
+              = options.TransactionalContentHash.Value().Value;
+        }
       }
-      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+      if (customerProvidedKey.HasValue())
       {
-        protocolLayerOptions.TransactionalContentCrc64
-            = options.TransactionalContentHash.Value().Value;
+        protocolLayerOptions.EncryptionKey = customerProvidedKey.Value().Key;
+        protocolLayerOptions.EncryptionKeySha256 = customerProvidedKey.Value().KeyHash;
+        protocolLayerOptions.EncryptionAlgorithm = customerProvidedKey.Value().Algorithm.ToString();
       }
+      protocolLayerOptions.EncryptionScope = encryptionScope;
+      return protocolLayerOptions;
     }
-    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
-    if (m_customerProvidedKey.HasValue())
-    {
-      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
-      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
-      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm.ToString();
-    }
-    protocolLayerOptions.EncryptionScope = m_encryptionScope;
+  } // namespace
+
+  Azure::Response<Models::StageBlockResult> BlockBlobClient::StageBlock(
+      const std::string& blockId,
+      Azure::Core::IO::BodyStream& content,
+      const StageBlockOptions& options,
+      const Azure::Core::Context& context) const
+  {
     return _detail::BlockBlobClient::StageBlock(
-        *m_pipeline, m_blobUrl, content, protocolLayerOptions, context);
+        *m_pipeline,
+        m_blobUrl,
+        content,
+        GetStageBlockProtocolLayerOptions(
+            blockId, options, m_customerProvidedKey, m_encryptionScope),
+        context);
+  }
+
+  std::future<Azure::Response<Models::StageBlockResult>> BlockBlobClient::StageBlockAsync(
+      const std::string& blockId,
+      Azure::Core::IO::BodyStream& content,
+      const StageBlockOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    return _detail::BlockBlobClient::StageBlockAsync(
+        m_pipeline,
+        m_blobUrl,
+        content,
+        GetStageBlockProtocolLayerOptions(
+            blockId, options, m_customerProvidedKey, m_encryptionScope),
+        context);
   }
 
   Azure::Response<Models::StageBlockFromUriResult> BlockBlobClient::StageBlockFromUri(
@@ -474,45 +590,75 @@ namespace Azure { namespace Storage { namespace Blobs {
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
   }
 
+  namespace {
+    _detail::BlockBlobClient::CommitBlockBlobBlockListOptions
+    GetCommitBlockListProtocolLayerOptions(
+        const std::vector<std::string>& blockIds,
+        const CommitBlockListOptions& options,
+        const Azure::Nullable<EncryptionKey>& customerProvidedKey,
+        const Azure::Nullable<std::string>& encryptionScope)
+    {
+      _detail::BlockBlobClient::CommitBlockBlobBlockListOptions protocolLayerOptions;
+      protocolLayerOptions.Blocks.Latest = blockIds;
+      protocolLayerOptions.BlobContentType = options.HttpHeaders.ContentType;
+      protocolLayerOptions.BlobContentEncoding = options.HttpHeaders.ContentEncoding;
+      protocolLayerOptions.BlobContentLanguage = options.HttpHeaders.ContentLanguage;
+      protocolLayerOptions.BlobContentMD5 = options.HttpHeaders.ContentHash.Value;
+      protocolLayerOptions.BlobContentDisposition = options.HttpHeaders.ContentDisposition;
+      protocolLayerOptions.BlobCacheControl = options.HttpHeaders.CacheControl;
+      protocolLayerOptions.Metadata
+          = std::map<std::string, std::string>(options.Metadata.begin(), options.Metadata.end());
+      protocolLayerOptions.BlobTagsString = _detail::TagsToString(options.Tags);
+      protocolLayerOptions.Tier = options.AccessTier;
+      protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+      protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
+      protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
+      protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
+      protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
+      protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
+      if (customerProvidedKey.HasValue())
+      {
+        protocolLayerOptions.EncryptionKey = customerProvidedKey.Value().Key;
+        protocolLayerOptions.EncryptionKeySha256 = customerProvidedKey.Value().KeyHash;
+        protocolLayerOptions.EncryptionAlgorithm = customerProvidedKey.Value().Algorithm.ToString();
+      }
+      protocolLayerOptions.EncryptionScope = encryptionScope;
+      if (options.ImmutabilityPolicy.HasValue())
+      {
+        protocolLayerOptions.ImmutabilityPolicyExpiry
+            = options.ImmutabilityPolicy.Value().ExpiresOn;
+        protocolLayerOptions.ImmutabilityPolicyMode = options.ImmutabilityPolicy.Value().PolicyMode;
+      }
+      protocolLayerOptions.LegalHold = options.HasLegalHold;
+      return protocolLayerOptions;
+    }
+  } // namespace
+
   Azure::Response<Models::CommitBlockListResult> BlockBlobClient::CommitBlockList(
       const std::vector<std::string>& blockIds,
       const CommitBlockListOptions& options,
       const Azure::Core::Context& context) const
   {
-    _detail::BlockBlobClient::CommitBlockBlobBlockListOptions protocolLayerOptions;
-    protocolLayerOptions.Blocks.Latest = blockIds;
-    protocolLayerOptions.BlobContentType = options.HttpHeaders.ContentType;
-    protocolLayerOptions.BlobContentEncoding = options.HttpHeaders.ContentEncoding;
-    protocolLayerOptions.BlobContentLanguage = options.HttpHeaders.ContentLanguage;
-    protocolLayerOptions.BlobContentMD5 = options.HttpHeaders.ContentHash.Value;
-    protocolLayerOptions.BlobContentDisposition = options.HttpHeaders.ContentDisposition;
-    protocolLayerOptions.BlobCacheControl = options.HttpHeaders.CacheControl;
-    protocolLayerOptions.Metadata
-        = std::map<std::string, std::string>(options.Metadata.begin(), options.Metadata.end());
-    protocolLayerOptions.BlobTagsString = _detail::TagsToString(options.Tags);
-    protocolLayerOptions.Tier = options.AccessTier;
-    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
-    protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
-    protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
-    protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
-    protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
-    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
-    if (m_customerProvidedKey.HasValue())
-    {
-      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
-      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
-      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm.ToString();
-    }
-    protocolLayerOptions.EncryptionScope = m_encryptionScope;
-    if (options.ImmutabilityPolicy.HasValue())
-    {
-      protocolLayerOptions.ImmutabilityPolicyExpiry = options.ImmutabilityPolicy.Value().ExpiresOn;
-      protocolLayerOptions.ImmutabilityPolicyMode = options.ImmutabilityPolicy.Value().PolicyMode;
-    }
-    protocolLayerOptions.LegalHold = options.HasLegalHold;
-
     return _detail::BlockBlobClient::CommitBlockList(
-        *m_pipeline, m_blobUrl, protocolLayerOptions, context);
+        *m_pipeline,
+        m_blobUrl,
+        GetCommitBlockListProtocolLayerOptions(
+            blockIds, options, m_customerProvidedKey, m_encryptionScope),
+        context);
+  }
+
+  std::future<Azure::Response<Models::CommitBlockListResult>>
+  BlockBlobClient::CommitBlockListAsync(
+      const std::vector<std::string>& blockIds,
+      const CommitBlockListOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    return _detail::BlockBlobClient::CommitBlockListAsync(
+        m_pipeline,
+        m_blobUrl,
+        GetCommitBlockListProtocolLayerOptions(
+            blockIds, options, m_customerProvidedKey, m_encryptionScope),
+        context);
   }
 
   Azure::Response<Models::GetBlockListResult> BlockBlobClient::GetBlockList(
@@ -4,6 +4,16 @@
 //
 // Code generated by Microsoft (R) AutoRest C++ Code Generator.
 // Changes may cause incorrect behavior and will be lost if the code is regenerated.
+//
+// Edited by hand after generation. Re-apply these edits when regenerating:
+// - The xml deserializers keep their element name maps in static storage.
+// - ListBlobs, ListBlobsByHierarchy, FindBlobsByTags, GetPageRanges and GetPageRangesDiff send
+//   unbuffered requests and parse the response body stream. The list blobs deserializers pass
+//   each item to OnBlobItem instead of storing it when the option is set.
+// - Download, GetProperties, StageBlock and CommitBlockList build the request and parse the
+//   response in functions shared with their Async variant, which sends the request with
+//   HttpPipeline::SendAsync.
+// test/ut/xml_deserialization_test.cpp checks that every element reaches its field.
 #include <azure/core/base64.hpp>
 #include <azure/core/context.hpp>
 #include <azure/core/datetime.hpp>
@@ -20,7 +30,9 @@
 #include <azure/storage/common/storage_common.hpp>
 #include <azure/storage/common/storage_exception.hpp>
 
+#include <future>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -195,6 +207,34 @@ namespace Azure { namespace Storage { namespace Blobs {
     const BlockListType BlockListType::All("all");
   } // namespace Models
   namespace _detail {
+    namespace {
+      // A request sent with HttpPipeline::SendAsync and what it refers to. The members are
+      // destroyed in reverse order, so the request and its body outlive the pending response.
+      struct PendingRequest final
+      {
+        std::shared_ptr<Core::Http::_internal::HttpPipeline> Pipeline;
+        std::string Body;
+        std::unique_ptr<Core::IO::MemoryBodyStream> BodyStream;
+        std::unique_ptr<Core::Http::Request> Request;
+        std::future<std::unique_ptr<Core::Http::RawResponse>> RawResponse;
+      };
+
+      // The response is parsed by the thread waiting for the future.
+      template <class T>
+      std::future<Response<T>> SendAsync(
+          std::unique_ptr<PendingRequest> pendingRequest,
+          const Core::Context& context,
+          Response<T> (*parseResponse)(std::unique_ptr<Core::Http::RawResponse>))
+      {
+        pendingRequest->RawResponse
+            = pendingRequest->Pipeline->SendAsync(*pendingRequest->Request, context);
+        return std::async(
+            std::launch::deferred,
+            [pendingRequest = std::move(pendingRequest), parseResponse]() {
+              return parseResponse(pendingRequest->RawResponse.get());
+            });
+      }
+    } // namespace
     Response<Models::SetServicePropertiesResult> ServiceClient::SetProperties(
         Core::Http::_internal::HttpPipeline& pipeline,
         const Core::Url& url,
@@ -440,7 +480,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kErrorDocument404Path,
           kDefaultIndexDocumentPath,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"StorageServiceProperties", XmlTagEnum::kStorageServiceProperties},
             {"Logging", XmlTagEnum::kLogging},
             {"Version", XmlTagEnum::kVersion},
@@ -715,7 +755,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kStatus,
           kLastSyncTime,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"StorageServiceStats", XmlTagEnum::kStorageServiceStats},
             {"GeoReplication", XmlTagEnum::kGeoReplication},
             {"Status", XmlTagEnum::kStatus},
@@ -833,7 +873,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kImmutableStorageWithVersioningEnabled,
           kMetadata,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Prefix", XmlTagEnum::kPrefix},
             {"NextMarker", XmlTagEnum::kNextMarker},
@@ -1103,7 +1143,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kSignedVersion,
           kValue,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"UserDelegationKey", XmlTagEnum::kUserDelegationKey},
             {"SignedOid", XmlTagEnum::kSignedOid},
             {"SignedTid", XmlTagEnum::kSignedTid},
@@ -1243,7 +1283,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         const FindServiceBlobsByTagsOptions& options,
         const Core::Context& context)
     {
-      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, false);
       request.GetUrl().AppendQueryParameter("comp", "blobs");
       request.SetHeader("x-ms-version", "2025-07-05");
       if (options.Where.HasValue() && !options.Where.Value().empty())
@@ -1269,9 +1309,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       Models::_detail::FindBlobsByTagsResult response;
       {
-        const auto& responseBody = pRawResponse->GetBody();
-        _internal::XmlReader reader(
-            reinterpret_cast<const char*>(responseBody.data()), responseBody.size());
+        auto responseBody = pRawResponse->ExtractBodyStream();
+        _internal::XmlReader reader(*responseBody, context);
         enum class XmlTagEnum
         {
           kUnknown,
@@ -1287,7 +1326,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kValue,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Blobs", XmlTagEnum::kBlobs},
             {"Blob", XmlTagEnum::kBlob},
@@ -1600,7 +1639,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kExpiry,
           kPermission,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"SignedIdentifiers", XmlTagEnum::kSignedIdentifiers},
             {"SignedIdentifier", XmlTagEnum::kSignedIdentifier},
             {"Id", XmlTagEnum::kId},
@@ -1852,7 +1891,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         const FindBlobContainerBlobsByTagsOptions& options,
         const Core::Context& context)
     {
-      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, false);
       request.GetUrl().AppendQueryParameter("restype", "container");
       request.GetUrl().AppendQueryParameter("comp", "blobs");
       request.SetHeader("x-ms-version", "2025-07-05");
@@ -1879,9 +1918,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       Models::_detail::FindBlobsByTagsResult response;
       {
-        const auto& responseBody = pRawResponse->GetBody();
-        _internal::XmlReader reader(
-            reinterpret_cast<const char*>(responseBody.data()), responseBody.size());
+        auto responseBody = pRawResponse->ExtractBodyStream();
+        _internal::XmlReader reader(*responseBody, context);
         enum class XmlTagEnum
         {
           kUnknown,
@@ -1897,7 +1935,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kValue,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Blobs", XmlTagEnum::kBlobs},
             {"Blob", XmlTagEnum::kBlob},
@@ -2213,7 +2251,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobContainerBlobsOptions& options,
         const Core::Context& context)
     {
-      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, false);
       request.GetUrl().AppendQueryParameter("restype", "container");
       request.GetUrl().AppendQueryParameter("comp", "list");
       if (options.Prefix.HasValue() && !options.Prefix.Value().empty())
@@ -2248,9 +2286,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       Models::_detail::ListBlobsResult response;
       {
-        const auto& responseBody = pRawResponse->GetBody();
-        _internal::XmlReader reader(
-            reinterpret_cast<const char*>(responseBody.data()), responseBody.size());
+        auto responseBody = pRawResponse->ExtractBodyStream();
+        _internal::XmlReader reader(*responseBody, context);
         enum class XmlTagEnum
         {
           kUnknown,
@@ -2314,7 +2351,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kBlobType,
           kDeletionId,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Prefix", XmlTagEnum::kPrefix},
             {"NextMarker", XmlTagEnum::kNextMarker},
@@ -2871,7 +2908,14 @@ namespace Azure { namespace Storage { namespace Blobs {
                 xmlPath.size() == 3 && xmlPath[0] == XmlTagEnum::kEnumerationResults
                 && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob)
             {
-              response.Items.push_back(std::move(vectorElement1));
+              if (options.OnBlobItem)
+              {
+                options.OnBlobItem(std::move(vectorElement1));
+              }
+              else
+              {
+                response.Items.push_back(std::move(vectorElement1));
+              }
               vectorElement1 = Models::_detail::BlobItem();
             }
             xmlPath.pop_back();
@@ -2887,7 +2931,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobContainerBlobsByHierarchyOptions& options,
         const Core::Context& context)
     {
-      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, false);
       request.GetUrl().AppendQueryParameter("restype", "container");
       request.GetUrl().AppendQueryParameter("comp", "list");
       if (options.Prefix.HasValue() && !options.Prefix.Value().empty())
@@ -2932,9 +2976,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       Models::_detail::ListBlobsByHierarchyResult response;
       {
-        const auto& responseBody = pRawResponse->GetBody();
-        _internal::XmlReader reader(
-            reinterpret_cast<const char*>(responseBody.data()), responseBody.size());
+        auto responseBody = pRawResponse->ExtractBodyStream();
+        _internal::XmlReader reader(*responseBody, context);
         enum class XmlTagEnum
         {
           kUnknown,
@@ -3000,7 +3043,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kDeletionId,
           kBlobPrefix,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Prefix", XmlTagEnum::kPrefix},
             {"Delimiter", XmlTagEnum::kDelimiter},
@@ -3580,7 +3623,14 @@ namespace Azure { namespace Storage { namespace Blobs {
                 xmlPath.size() == 3 && xmlPath[0] == XmlTagEnum::kEnumerationResults
                 && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob)
             {
-              response.Items.push_back(std::move(vectorElement1));
+              if (options.OnBlobItem)
+              {
+                options.OnBlobItem(std::move(vectorElement1));
+              }
+              else
+              {
+                response.Items.push_back(std::move(vectorElement1));
+              }
               vectorElement1 = Models::_detail::BlobItem();
             }
             else if (
@@ -3623,11 +3673,9 @@ namespace Azure { namespace Storage { namespace Blobs {
           = pRawResponse->GetHeaders().at("x-ms-is-hns-enabled") == std::string("true");
       return Response<Models::AccountInfo>(std::move(response), std::move(pRawResponse));
     }
-    Response<Models::DownloadBlobResult> BlobClient::Download(
-        Core::Http::_internal::HttpPipeline& pipeline,
+    static Core::Http::Request DownloadRequest(
         const Core::Url& url,
-        const DownloadBlobOptions& options,
-        const Core::Context& context)
+        const BlobClient::DownloadBlobOptions& options)
     {
       auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, false);
       if (options.Snapshot.HasValue() && !options.Snapshot.Value().empty())
@@ -3703,7 +3751,11 @@ namespace Azure { namespace Storage { namespace Blobs {
       {
         request.SetHeader("x-ms-upn", options.UserPrincipalName.Value() ? "true" : "false");
       }
-      auto pRawResponse = pipeline.Send(request, context);
+      return request;
+    }
+    static Response<Models::DownloadBlobResult> DownloadResponse(
+        std::unique_ptr<Core::Http::RawResponse> pRawResponse)
+    {
       auto httpStatusCode = pRawResponse->GetStatusCode();
       if (!(httpStatusCode == Core::Http::HttpStatusCode::Ok
             || httpStatusCode == Core::Http::HttpStatusCode::PartialContent))
@@ -3918,11 +3970,30 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       return Response<Models::DownloadBlobResult>(std::move(response), std::move(pRawResponse));
     }
-    Response<Models::BlobProperties> BlobClient::GetProperties(
+    Response<Models::DownloadBlobResult> BlobClient::Download(
         Core::Http::_internal::HttpPipeline& pipeline,
         const Core::Url& url,
-        const GetBlobPropertiesOptions& options,
+        const DownloadBlobOptions& options,
+        const Core::Context& context)
+    {
+      auto request = DownloadRequest(url, options);
+      return DownloadResponse(pipeline.Send(request, context));
+    }
+    std::future<Response<Models::DownloadBlobResult>> BlobClient::DownloadAsync(
+        std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+        const Core::Url& url,
+        const DownloadBlobOptions& options,
         const Core::Context& context)
+    {
+      auto pendingRequest = std::make_unique<PendingRequest>();
+      pendingRequest->Pipeline = std::move(pipeline);
+      pendingRequest->Request
+          = std::make_unique<Core::Http::Request>(DownloadRequest(url, options));
+      return SendAsync(std::move(pendingRequest), context, &DownloadResponse);
+    }
+    static Core::Http::Request GetPropertiesRequest(
+        const Core::Url& url,
+        const BlobClient::GetBlobPropertiesOptions& options)
     {
       auto request = Core::Http::Request(Core::Http::HttpMethod::Head, url);
       if (options.Snapshot.HasValue() && !options.Snapshot.Value().empty())
@@ -3983,7 +4054,11 @@ namespace Azure { namespace Storage { namespace Blobs {
       {
         request.SetHeader("x-ms-upn", options.UserPrincipalName.Value() ? "true" : "false");
       }
-      auto pRawResponse = pipeline.Send(request, context);
+      return request;
+    }
+    static Response<Models::BlobProperties> GetPropertiesResponse(
+        std::unique_ptr<Core::Http::RawResponse> pRawResponse)
+    {
       auto httpStatusCode = pRawResponse->GetStatusCode();
       if (httpStatusCode != Core::Http::HttpStatusCode::Ok)
       {
@@ -4195,6 +4270,27 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       return Response<Models::BlobProperties>(std::move(response), std::move(pRawResponse));
     }
+    Response<Models::BlobProperties> BlobClient::GetProperties(
+        Core::Http::_internal::HttpPipeline& pipeline,
+        const Core::Url& url,
+        const GetBlobPropertiesOptions& options,
+        const Core::Context& context)
+    {
+      auto request = GetPropertiesRequest(url, options);
+      return GetPropertiesResponse(pipeline.Send(request, context));
+    }
+    std::future<Response<Models::BlobProperties>> BlobClient::GetPropertiesAsync(
+        std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+        const Core::Url& url,
+        const GetBlobPropertiesOptions& options,
+        const Core::Context& context)
+    {
+      auto pendingRequest = std::make_unique<PendingRequest>();
+      pendingRequest->Pipeline = std::move(pipeline);
+      pendingRequest->Request
+          = std::make_unique<Core::Http::Request>(GetPropertiesRequest(url, options));
+      return SendAsync(std::move(pendingRequest), context, &GetPropertiesResponse);
+    }
     Response<Models::DeleteBlobResult> BlobClient::Delete(
         Core::Http::_internal::HttpPipeline& pipeline,
         const Core::Url& url,
@@ -5721,7 +5817,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kKey,
           kValue,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"Tags", XmlTagEnum::kTags},
             {"TagSet", XmlTagEnum::kTagSet},
             {"Tag", XmlTagEnum::kTag},
@@ -6422,7 +6518,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetPageBlobPageRangesOptions& options,
         const Core::Context& context)
     {
-      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, false);
       request.GetUrl().AppendQueryParameter("comp", "pagelist");
       if (options.Snapshot.HasValue() && !options.Snapshot.Value().empty())
       {
@@ -6480,9 +6576,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       Models::_detail::GetPageRangesResult response;
       {
-        const auto& responseBody = pRawResponse->GetBody();
-        _internal::XmlReader reader(
-            reinterpret_cast<const char*>(responseBody.data()), responseBody.size());
+        auto responseBody = pRawResponse->ExtractBodyStream();
+        _internal::XmlReader reader(*responseBody, context);
         enum class XmlTagEnum
         {
           kUnknown,
@@ -6493,7 +6588,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kClearRange,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"PageList", XmlTagEnum::kPageList},
             {"PageRange", XmlTagEnum::kPageRange},
             {"Start", XmlTagEnum::kStart},
@@ -6591,7 +6686,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetPageBlobPageRangesDiffOptions& options,
         const Core::Context& context)
     {
-      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+      auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, false);
       request.GetUrl().AppendQueryParameter("comp", "pagelist");
       if (options.Snapshot.HasValue() && !options.Snapshot.Value().empty())
       {
@@ -6658,9 +6753,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       Models::_detail::GetPageRangesDiffResult response;
       {
-        const auto& responseBody = pRawResponse->GetBody();
-        _internal::XmlReader reader(
-            reinterpret_cast<const char*>(responseBody.data()), responseBody.size());
+        auto responseBody = pRawResponse->ExtractBodyStream();
+        _internal::XmlReader reader(*responseBody, context);
         enum class XmlTagEnum
         {
           kUnknown,
@@ -6671,7 +6765,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kClearRange,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"PageList", XmlTagEnum::kPageList},
             {"PageRange", XmlTagEnum::kPageRange},
             {"Start", XmlTagEnum::kStart},
@@ -7805,12 +7899,10 @@ namespace Azure { namespace Storage { namespace Blobs {
       return Response<Models::UploadBlockBlobFromUriResult>(
           std::move(response), std::move(pRawResponse));
     }
-    Response<Models::StageBlockResult> BlockBlobClient::StageBlock(
-        Core::Http::_internal::HttpPipeline& pipeline,
+    static Core::Http::Request StageBlockRequest(
         const Core::Url& url,
         Core::IO::BodyStream& requestBody,
-        const StageBlockBlobBlockOptions& options,
-        const Core::Context& context)
+        const BlockBlobClient::StageBlockBlobBlockOptions& options)
     {
       auto request = Core::Http::Request(Core::Http::HttpMethod::Put, url, &requestBody);
       request.GetUrl().AppendQueryParameter("comp", "block");
@@ -7857,7 +7949,11 @@ namespace Azure { namespace Storage { namespace Blobs {
         request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
       }
       request.SetHeader("x-ms-version", "2025-07-05");
-      auto pRawResponse = pipeline.Send(request, context);
+      return request;
+    }
+    static Response<Models::StageBlockResult> StageBlockResponse(
+        std::unique_ptr<Core::Http::RawResponse> pRawResponse)
+    {
       auto httpStatusCode = pRawResponse->GetStatusCode();
       if (httpStatusCode != Core::Http::HttpStatusCode::Created)
       {
@@ -7891,6 +7987,29 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       return Response<Models::StageBlockResult>(std::move(response), std::move(pRawResponse));
     }
+    Response<Models::StageBlockResult> BlockBlobClient::StageBlock(
+        Core::Http::_internal::HttpPipeline& pipeline,
+        const Core::Url& url,
+        Core::IO::BodyStream& requestBody,
+        const StageBlockBlobBlockOptions& options,
+        const Core::Context& context)
+    {
+      auto request = StageBlockRequest(url, requestBody, options);
+      return StageBlockResponse(pipeline.Send(request, context));
+    }
+    std::future<Response<Models::StageBlockResult>> BlockBlobClient::StageBlockAsync(
+        std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+        const Core::Url& url,
+        Core::IO::BodyStream& requestBody,
+        const StageBlockBlobBlockOptions& options,
+        const Core::Context& context)
+    {
+      auto pendingRequest = std::make_unique<PendingRequest>();
+      pendingRequest->Pipeline = std::move(pipeline);
+      pendingRequest->Request
+          = std::make_unique<Core::Http::Request>(StageBlockRequest(url, requestBody, options));
+      return SendAsync(std::move(pendingRequest), context, &StageBlockResponse);
+    }
     Response<Models::StageBlockFromUriResult> BlockBlobClient::StageBlockFromUri(
         Core::Http::_internal::HttpPipeline& pipeline,
         const Core::Url& url,
@@ -8017,11 +8136,8 @@ namespace Azure { namespace Storage { namespace Blobs {
       return Response<Models::StageBlockFromUriResult>(
           std::move(response), std::move(pRawResponse));
     }
-    Response<Models::CommitBlockListResult> BlockBlobClient::CommitBlockList(
-        Core::Http::_internal::HttpPipeline& pipeline,
-        const Core::Url& url,
-        const CommitBlockBlobBlockListOptions& options,
-        const Core::Context& context)
+    static std::string CommitBlockListBody(
+        const BlockBlobClient::CommitBlockBlobBlockListOptions& options)
     {
       std::string xmlBody;
       {
@@ -8043,8 +8159,13 @@ namespace Azure { namespace Storage { namespace Blobs {
         writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
         xmlBody = writer.GetDocument();
       }
-      Core::IO::MemoryBodyStream requestBody(
-          reinterpret_cast<const uint8_t*>(xmlBody.data()), xmlBody.length());
+      return xmlBody;
+    }
+    static Core::Http::Request CommitBlockListRequest(
+        const Core::Url& url,
+        Core::IO::BodyStream& requestBody,
+        const BlockBlobClient::CommitBlockBlobBlockListOptions& options)
+    {
       auto request = Core::Http::Request(Core::Http::HttpMethod::Put, url, &requestBody);
       request.SetHeader("Content-Type", "application/xml; charset=UTF-8");
       request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
@@ -8164,7 +8285,11 @@ namespace Azure { namespace Storage { namespace Blobs {
       {
         request.SetHeader("x-ms-legal-hold", options.LegalHold.Value() ? "true" : "false");
       }
-      auto pRawResponse = pipeline.Send(request, context);
+      return request;
+    }
+    static Response<Models::CommitBlockListResult> CommitBlockListResponse(
+        std::unique_ptr<Core::Http::RawResponse> pRawResponse)
+    {
       auto httpStatusCode = pRawResponse->GetStatusCode();
       if (httpStatusCode != Core::Http::HttpStatusCode::Created)
       {
@@ -8205,6 +8330,34 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       return Response<Models::CommitBlockListResult>(std::move(response), std::move(pRawResponse));
     }
+    Response<Models::CommitBlockListResult> BlockBlobClient::CommitBlockList(
+        Core::Http::_internal::HttpPipeline& pipeline,
+        const Core::Url& url,
+        const CommitBlockBlobBlockListOptions& options,
+        const Core::Context& context)
+    {
+      const std::string xmlBody = CommitBlockListBody(options);
+      Core::IO::MemoryBodyStream requestBody(
+          reinterpret_cast<const uint8_t*>(xmlBody.data()), xmlBody.length());
+      auto request = CommitBlockListRequest(url, requestBody, options);
+      return CommitBlockListResponse(pipeline.Send(request, context));
+    }
+    std::future<Response<Models::CommitBlockListResult>> BlockBlobClient::CommitBlockListAsync(
+        std::shared_ptr<Core::Http::_internal::HttpPipeline> pipeline,
+        const Core::Url& url,
+        const CommitBlockBlobBlockListOptions& options,
+        const Core::Context& context)
+    {
+      auto pendingRequest = std::make_unique<PendingRequest>();
+      pendingRequest->Pipeline = std::move(pipeline);
+      pendingRequest->Body = CommitBlockListBody(options);
+      pendingRequest->BodyStream = std::make_unique<Core::IO::MemoryBodyStream>(
+          reinterpret_cast<const uint8_t*>(pendingRequest->Body.data()),
+          pendingRequest->Body.length());
+      pendingRequest->Request = std::make_unique<Core::Http::Request>(
+          CommitBlockListRequest(url, *pendingRequest->BodyStream, options));
+      return SendAsync(std::move(pendingRequest), context, &CommitBlockListResponse);
+    }
     Response<Models::GetBlockListResult> BlockBlobClient::GetBlockList(
         Core::Http::_internal::HttpPipeline& pipeline,
         const Core::Url& url,
@@ -8253,7 +8406,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           kSize,
           kUncommittedBlocks,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"BlockList", XmlTagEnum::kBlockList},
             {"CommittedBlocks", XmlTagEnum::kCommittedBlocks},
             {"Block", XmlTagEnum::kBlock},
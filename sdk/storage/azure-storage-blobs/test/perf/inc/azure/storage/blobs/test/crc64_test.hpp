@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the performance of computing the CRC64 used for transactional validation.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/storage/common/crypt.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure computing the CRC64 of a buffer, with the hardware accelerated or the
+   * table-driven implementation.
+   *
+   */
+  class Crc64Test : public Azure::Perf::PerfTest {
+  private:
+    std::vector<uint8_t> m_buffer;
+    bool m_software = false;
+
+  public:
+    /**
+     * @brief Construct a new Crc64Test test.
+     *
+     * @param options The test options.
+     */
+    Crc64Test(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief The size of the buffer is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+      m_software = m_options.GetOptionOrDefault<bool>("Software", false);
+
+      m_buffer.resize(static_cast<size_t>(size));
+      for (size_t i = 0; i < m_buffer.size(); ++i)
+      {
+        m_buffer[i] = static_cast<uint8_t>(i * 7 + i / 256);
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      if (m_software)
+      {
+        _detail::Crc64Software(0, m_buffer.data(), m_buffer.size());
+      }
+      else
+      {
+        Crc64Hash crc64;
+        crc64.Final(m_buffer.data(), m_buffer.size());
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size"}, "Size of the buffer (in bytes)", 1, true},
+          {"Software",
+           {"--software"},
+           "Whether to use the table-driven implementation instead of the hardware accelerated "
+           "one",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "Crc64",
+          "Compute the CRC64 of a buffer. No service is used.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::Crc64Test>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
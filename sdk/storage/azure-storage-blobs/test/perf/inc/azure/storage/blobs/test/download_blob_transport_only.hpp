@@ -16,6 +16,7 @@
 #include <azure/core/io/body_stream.hpp>
 #include <azure/perf.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -27,12 +28,17 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
    * @brief A test to measure downloading a blob using SaS token and with transport adapter
    * directly.
    *
+   * @remark Use `--read-size` with different `--receive-buffer-size` values, and with or without
+   * `--adaptive-buffer`, to compare the cost of reading the body in small chunks: every read
+   * that the receive buffer can't serve is a call to the network.
+   *
    */
   class DownloadBlobWithTransportOnly : public Azure::Storage::Blobs::Test::BlobsTest {
   private:
     std::unique_ptr<std::vector<uint8_t>> m_downloadBuffer;
     std::unique_ptr<Azure::Core::Http::CurlTransport> m_curlTransport;
     bool m_bufferResponse = false;
+    size_t m_readSize = 0;
     std::unique_ptr<Azure::Core::Http::Request> m_request;
 
   public:
@@ -55,6 +61,8 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
       long size = m_options.GetMandatoryOption<long>("Size");
       m_bufferResponse = m_options.GetMandatoryOption<bool>("Buffer");
 
+      m_readSize = m_options.GetOptionOrDefault<size_t>("ReadSize", 0);
+
       m_downloadBuffer = std::make_unique<std::vector<uint8_t>>(size);
 
       auto rawData = std::make_unique<std::vector<uint8_t>>(size);
@@ -63,7 +71,12 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
 
       auto requestUrl = m_blobClient->GetUrl() + GetSasToken();
 
-      m_curlTransport = std::make_unique<Azure::Core::Http::CurlTransport>();
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.ReceiveBufferSize
+          = m_options.GetOptionOrDefault<size_t>("ReceiveBufferSize", 0);
+      transportOptions.EnableAdaptiveReceiveBuffer
+          = m_options.GetOptionOrDefault<bool>("AdaptiveBuffer", true);
+      m_curlTransport = std::make_unique<Azure::Core::Http::CurlTransport>(transportOptions);
       m_request = std::make_unique<Azure::Core::Http::Request>(
           Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(requestUrl), m_bufferResponse);
     }
@@ -81,6 +94,21 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
         // if test request the response stream to be read completely.
         *m_downloadBuffer = response->ExtractBodyStream()->ReadToEnd();
       }
+      else if (m_readSize > 0)
+      {
+        // read the response stream in chunks of the requested size.
+        auto bodyStream = response->ExtractBodyStream();
+        for (size_t offset = 0; offset < m_downloadBuffer->size();)
+        {
+          auto const toRead = (std::min)(m_readSize, m_downloadBuffer->size() - offset);
+          auto const read = bodyStream->Read(m_downloadBuffer->data() + offset, toRead, context);
+          if (read == 0)
+          {
+            break;
+          }
+          offset += read;
+        }
+      }
     }
 
     /**
@@ -93,7 +121,22 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
       // TODO: Merge with base options
       return {
           {"Size", {"--size"}, "Size of payload (in bytes)", 1, true},
-          {"Buffer", {"--buffer"}, "Whether to buffer the response", 1, true}};
+          {"Buffer", {"--buffer"}, "Whether to buffer the response", 1, true},
+          {"ReadSize",
+           {"--read-size"},
+           "Read the response in chunks of this size (in bytes) when not buffered",
+           1,
+           false},
+          {"ReceiveBufferSize",
+           {"--receive-buffer-size"},
+           "Size of the transport receive buffer (in bytes)",
+           1,
+           false},
+          {"AdaptiveBuffer",
+           {"--adaptive-buffer"},
+           "Whether the receive buffer grows for large responses",
+           1,
+           false}};
     }
 
     /**
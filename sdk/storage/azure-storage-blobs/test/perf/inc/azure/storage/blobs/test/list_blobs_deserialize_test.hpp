@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the performance of deserializing a list blobs response.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/raw_response.hpp>
+#include <azure/core/http/transport.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/perf.hpp>
+#include <azure/storage/blobs.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  namespace _detail {
+    /**
+     * @brief A transport replying to every request with the same list blobs response.
+     *
+     */
+    class ListBlobsReplayTransport final : public Azure::Core::Http::HttpTransport {
+    public:
+      explicit ListBlobsReplayTransport(const std::vector<uint8_t>& body) : m_body(body) {}
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request&,
+          Azure::Core::Context const&) override
+      {
+        auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+            1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+        response->SetHeader("Content-Type", "application/xml");
+        response->SetHeader("Content-Length", std::to_string(m_body.size()));
+        response->SetHeader("x-ms-request-id", "00000000-0000-0000-0000-000000000000");
+        response->SetHeader("x-ms-version", "2025-07-05");
+        response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(m_body));
+        return response;
+      }
+
+    private:
+      const std::vector<uint8_t>& m_body;
+    };
+  } // namespace _detail
+
+  /**
+   * @brief A test to measure deserializing a page of a list blobs response. The response is either
+   * read from a file, such as the body of a recorded response, or generated with the properties
+   * and metadata the service returns. No service is used.
+   *
+   */
+  class ListBlobsDeserializeTest : public Azure::Perf::PerfTest {
+  private:
+    std::vector<uint8_t> m_body;
+    std::unique_ptr<Azure::Storage::Blobs::BlobContainerClient> m_containerClient;
+
+    static std::vector<uint8_t> GenerateBody(int count)
+    {
+      std::string body = "\xef\xbb\xbf<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+                         "<EnumerationResults ServiceEndpoint=\"https://account.blob.core."
+                         "windows.net/\" ContainerName=\"container\"><MaxResults>5000</MaxResults>"
+                         "<Blobs>";
+      for (int i = 0; i < count; ++i)
+      {
+        const std::string index = std::to_string(i);
+        body += "<Blob><Name>folder/subfolder/blob" + index
+            + "</Name><VersionId>2025-01-01T00:00:00.0000000Z</VersionId>"
+              "<IsCurrentVersion>true</IsCurrentVersion><Properties>"
+              "<Creation-Time>Wed, 01 Jan 2025 00:00:00 GMT</Creation-Time>"
+              "<Last-Modified>Wed, 01 Jan 2025 00:00:00 GMT</Last-Modified>"
+              "<Etag>0x8DD2A1B2C3D4E5F</Etag><Content-Length>"
+            + index
+            + "</Content-Length><Content-Type>application/octet-stream</Content-Type>"
+              "<Content-Encoding /><Content-Language /><Content-CRC64 />"
+              "<Content-MD5>1B2M2Y8AsgTpgAmY7PhCfg==</Content-MD5><Cache-Control />"
+              "<Content-Disposition /><BlobType>BlockBlob</BlobType>"
+              "<AccessTier>Hot</AccessTier><AccessTierInferred>true</AccessTierInferred>"
+              "<LeaseStatus>unlocked</LeaseStatus><LeaseState>available</LeaseState>"
+              "<ServerEncrypted>true</ServerEncrypted></Properties><Metadata>"
+              "<project>listing</project><owner>team" + index + "</owner></Metadata>"
+              "<OrMetadata /></Blob>";
+      }
+      body += "</Blobs><NextMarker>2!100!MDAwMDE2IWJsb2I1MDAwITAwMDAyOCE5OTk5LTEyLTMxVDIzOjU5"
+              "OjU5Ljk5OTk5OTlaIQ--</NextMarker></EnumerationResults>";
+      return std::vector<uint8_t>(body.begin(), body.end());
+    }
+
+  public:
+    /**
+     * @brief Construct a new ListBlobsDeserializeTest test.
+     *
+     * @param options The test options.
+     */
+    ListBlobsDeserializeTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Read or generate the response body.
+     *
+     */
+    void Setup() override
+    {
+      const auto file = m_options.GetOptionOrDefault<std::string>("File", std::string());
+      if (file.empty())
+      {
+        m_body = GenerateBody(m_options.GetOptionOrDefault<int>("Count", 5000));
+      }
+      else
+      {
+        std::ifstream stream(file, std::ios::binary);
+        if (!stream)
+        {
+          throw std::runtime_error("Failed to open " + file + ".");
+        }
+        m_body.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+      }
+
+      Azure::Storage::Blobs::BlobClientOptions clientOptions;
+      clientOptions.Transport.Transport
+          = std::make_shared<_detail::ListBlobsReplayTransport>(m_body);
+      m_containerClient = std::make_unique<Azure::Storage::Blobs::BlobContainerClient>(
+          "https://account.blob.core.windows.net/container", clientOptions);
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_containerClient->ListBlobs(Azure::Storage::Blobs::ListBlobsOptions(), context);
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Count", {"--count"}, "Number of blobs in the generated response", 1, false},
+          {"File",
+           {"--file"},
+           "File containing the body of a list blobs response to use instead of a generated one",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "ListBlobsDeserialize",
+          "Deserialize a page of a list blobs response. No service is used.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::ListBlobsDeserializeTest>(
+                options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
@@ -9,6 +9,7 @@
 #include <azure/storage/common/crypt.hpp>
 
 #include <chrono>
+#include <stdexcept>
 #include <thread>
 
 namespace Azure { namespace Storage { namespace Blobs { namespace Models {
@@ -369,6 +370,94 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_EQ(items, blobs);
   }
 
+  TEST_F(BlobContainerClientTest, ListBlobsOnBlob_LIVEONLY_)
+  {
+    auto containerClient = *m_blobContainerClient;
+
+    const std::string prefix = RandomString();
+    std::set<std::string> blobs;
+    for (int i = 0; i < 5; ++i)
+    {
+      std::string blobName = prefix + "/" + std::to_string(i);
+      auto blobClient = containerClient.GetBlockBlobClient(blobName);
+      auto emptyContent = Azure::Core::IO::MemoryBodyStream(nullptr, 0);
+      blobClient.Upload(emptyContent);
+      blobs.insert(blobName);
+    }
+
+    Azure::Storage::Blobs::ListBlobsOptions options;
+    options.Prefix = prefix;
+    options.PageSizeHint = 2;
+    std::set<std::string> listedBlobs;
+    options.OnBlob
+        = [&listedBlobs](Blobs::Models::BlobItem blob) { listedBlobs.insert(blob.Name); };
+    int numPages = 0;
+    for (auto pageResult = containerClient.ListBlobs(options); pageResult.HasPage();
+         pageResult.MoveToNextPage())
+    {
+      ++numPages;
+      EXPECT_TRUE(pageResult.Blobs.empty());
+    }
+    EXPECT_EQ(numPages, 3);
+    EXPECT_EQ(listedBlobs, blobs);
+
+    listedBlobs.clear();
+    options.Prefix = prefix + "/";
+    for (auto pageResult = containerClient.ListBlobsByHierarchy("/", options);
+         pageResult.HasPage();
+         pageResult.MoveToNextPage())
+    {
+      EXPECT_TRUE(pageResult.Blobs.empty());
+      EXPECT_TRUE(pageResult.BlobPrefixes.empty());
+    }
+    EXPECT_EQ(listedBlobs, blobs);
+  }
+
+  TEST_F(BlobContainerClientTest, ListBlobsParallel_LIVEONLY_)
+  {
+    auto containerClient = *m_blobContainerClient;
+
+    const std::string prefix = RandomString();
+    std::set<std::string> blobs;
+    for (const auto& blobName :
+         {prefix + "/a",
+          prefix + "/b/c",
+          prefix + "/b/d/e",
+          prefix + "/b/d/f",
+          prefix + "/g/h",
+          prefix + "-i"})
+    {
+      auto blobClient = containerClient.GetBlockBlobClient(blobName);
+      auto emptyContent = Azure::Core::IO::MemoryBodyStream(nullptr, 0);
+      blobClient.Upload(emptyContent);
+      blobs.insert(blobName);
+    }
+
+    Blobs::ListBlobsParallelOptions options;
+    options.Prefix = prefix;
+    options.PageSizeHint = 1;
+    for (int32_t shardDepth = 0; shardDepth < 4; ++shardDepth)
+    {
+      options.ShardDepth = shardDepth;
+      std::set<std::string> items;
+      containerClient.ListBlobsParallel(
+          [&items](std::vector<Blobs::Models::BlobItem> page) {
+            for (const auto& blob : page)
+            {
+              EXPECT_TRUE(items.insert(blob.Name).second);
+            }
+          },
+          options);
+      EXPECT_EQ(items, blobs);
+    }
+
+    EXPECT_THROW(
+        containerClient.ListBlobsParallel(
+            [](std::vector<Blobs::Models::BlobItem>) { throw std::runtime_error("stop"); },
+            options),
+        std::runtime_error);
+  }
+
   TEST_F(BlobContainerClientTest, ListBlobsOtherStuff)
   {
     // NOTE: This test Requires storage account with versioning enabled!
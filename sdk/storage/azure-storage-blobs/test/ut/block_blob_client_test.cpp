@@ -7,6 +7,7 @@
 #include <azure/storage/common/crypt.hpp>
 #include <azure/storage/files/shares.hpp>
 
+#include <algorithm>
 #include <future>
 #include <random>
 #include <vector>
@@ -870,6 +871,50 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_TRUE(res.Value.UncommittedBlocks.empty());
   }
 
+  TEST_F(BlockBlobClientTest, AsyncOperations_LIVEONLY_)
+  {
+    auto blobClient = GetBlockBlobClientForTest(RandomString());
+
+    const size_t numBlocks = 16;
+    std::vector<std::vector<uint8_t>> blockContents;
+    std::vector<Azure::Core::IO::MemoryBodyStream> blockStreams;
+    std::vector<std::string> blockIds;
+    blockContents.reserve(numBlocks);
+    blockStreams.reserve(numBlocks);
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+      blockContents.push_back(RandomBuffer(100));
+      blockStreams.emplace_back(blockContents.back().data(), blockContents.back().size());
+      blockIds.push_back(Base64EncodeText(std::to_string(100 + i)));
+    }
+
+    // The blocks are staged concurrently.
+    std::vector<std::future<Azure::Response<Blobs::Models::StageBlockResult>>> stagedBlocks;
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+      stagedBlocks.push_back(blobClient.StageBlockAsync(blockIds[i], blockStreams[i]));
+    }
+    for (auto& stagedBlock : stagedBlocks)
+    {
+      EXPECT_NO_THROW(stagedBlock.get());
+    }
+    auto committed = blobClient.CommitBlockListAsync(blockIds).get();
+    EXPECT_TRUE(committed.Value.ETag.HasValue());
+
+    auto properties = blobClient.GetPropertiesAsync().get();
+    EXPECT_EQ(properties.Value.BlobSize, static_cast<int64_t>(numBlocks * 100));
+    EXPECT_EQ(properties.Value.ETag, committed.Value.ETag);
+
+    auto downloaded = blobClient.DownloadAsync().get();
+    auto content = downloaded.Value.BodyStream->ReadToEnd();
+    EXPECT_EQ(content.size(), numBlocks * 100);
+    EXPECT_TRUE(std::equal(blockContents[0].begin(), blockContents[0].end(), content.begin()));
+
+    // The exceptions of the operations are rethrown by the futures.
+    auto missingBlob = GetBlockBlobClientForTest(RandomString()).GetPropertiesAsync();
+    EXPECT_THROW(missingBlob.get(), StorageException);
+  }
+
   TEST_F(BlockBlobClientTest, StageBlockFromUriRange)
   {
     auto srcBlobClient = *m_blockBlobClient;
@@ -1964,6 +2009,49 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlockBlobClientTest, OpenRead_LIVEONLY_)
+  {
+    auto blobClient = *m_blockBlobClient;
+    const auto blobContent = RandomBuffer(static_cast<size_t>(1_MB));
+    blobClient.UploadFrom(blobContent.data(), blobContent.size());
+
+    Blobs::OpenReadBlobOptions options;
+    options.TransferOptions.InitialChunkSize = 8_KB;
+    options.TransferOptions.ChunkSize = 4_KB;
+    options.TransferOptions.Concurrency = 2;
+    options.TransferOptions.MaxBufferedBytes = 8_KB;
+    {
+      auto res = blobClient.OpenRead(options);
+      EXPECT_EQ(res.Value.BlobSize, static_cast<int64_t>(blobContent.size()));
+      EXPECT_EQ(res.Value.BodyStream->Length(), blobContent.size());
+      EXPECT_EQ(res.Value.BodyStream->ReadToEnd(), blobContent);
+    }
+    {
+      options.Range = Core::Http::HttpRange();
+      options.Range.Value().Offset = 100;
+      options.Range.Value().Length = 50_KB;
+      auto res = blobClient.OpenRead(options);
+      EXPECT_EQ(
+          res.Value.BodyStream->ReadToEnd(),
+          std::vector<uint8_t>(
+              blobContent.begin() + 100, blobContent.begin() + 100 + static_cast<size_t>(50_KB)));
+      options.Range.Reset();
+    }
+
+    // The access conditions apply to the first request.
+    options.AccessConditions.IfMatch = DummyETag;
+    EXPECT_THROW(blobClient.OpenRead(options), StorageException);
+    options.AccessConditions.IfMatch = blobClient.GetProperties().Value.ETag;
+
+    // The blob is modified while it's read, so the chunks following the ones already downloaded
+    // don't match the ETag of the first response.
+    auto res = blobClient.OpenRead(options);
+    std::vector<uint8_t> buffer(static_cast<size_t>(4_KB));
+    EXPECT_EQ(res.Value.BodyStream->ReadToCount(buffer.data(), buffer.size()), buffer.size());
+    blobClient.UploadFrom(blobContent.data(), blobContent.size());
+    EXPECT_THROW(res.Value.BodyStream->ReadToEnd(), StorageException);
+  }
+
   TEST_F(BlockBlobClientTest, ConcurrentUpload_LIVEONLY_)
   {
 
@@ -0,0 +1,276 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test/ut/test_base.hpp"
+
+#include <azure/storage/blobs.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    // Answers every request with the same XML body, buffered and as a stream.
+    class XmlResponsePolicy final : public Core::Http::Policies::HttpPolicy {
+    public:
+      explicit XmlResponsePolicy(std::string body)
+          : m_body(std::make_shared<std::string>(std::move(body)))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<XmlResponsePolicy>(*this);
+      }
+
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Http::Request& request,
+          Core::Http::Policies::NextHttpPolicy nextPolicy,
+          Core::Context const& context) const override
+      {
+        (void)request;
+        (void)nextPolicy;
+        (void)context;
+        auto response = std::make_unique<Core::Http::RawResponse>(
+            1, 1, Core::Http::HttpStatusCode::Ok, "OK");
+        response->SetHeader("content-type", "application/xml");
+        response->SetHeader("x-ms-request-id", "request-id");
+        response->SetHeader("x-ms-version", Blobs::_detail::ApiVersion);
+        response->SetBody(std::vector<uint8_t>(m_body->begin(), m_body->end()));
+        response->SetBodyStream(std::make_unique<Core::IO::MemoryBodyStream>(
+            reinterpret_cast<const uint8_t*>(m_body->data()), m_body->size()));
+        return response;
+      }
+
+    private:
+      std::shared_ptr<std::string> m_body;
+    };
+
+    Blobs::BlobClientOptions OptionsWithResponse(std::string body)
+    {
+      Blobs::BlobClientOptions options;
+      options.PerRetryPolicies.push_back(std::make_unique<XmlResponsePolicy>(std::move(body)));
+      return options;
+    }
+  } // namespace
+
+  // The xml deserializers in rest_client.cpp classify element names with code that is edited by
+  // hand after generation. These tests feed every element a deserializer reads and check that
+  // each one reaches its field.
+
+  TEST(XmlDeserializationTest, ListBlobs)
+  {
+    const std::string body
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+          "<EnumerationResults ServiceEndpoint=\"https://a.blob.core.windows.net/\" "
+          "ContainerName=\"c\"><Prefix>p</Prefix><Blobs><Blob>"
+          "<Name Encoded=\"true\">p%2Fblob</Name>"
+          "<Deleted>true</Deleted>"
+          "<Snapshot>snapshot</Snapshot>"
+          "<VersionId>version</VersionId>"
+          "<IsCurrentVersion>true</IsCurrentVersion>"
+          "<Properties>"
+          "<Creation-Time>Mon, 01 Jan 2024 00:00:01 GMT</Creation-Time>"
+          "<Last-Modified>Mon, 01 Jan 2024 00:00:02 GMT</Last-Modified>"
+          "<Etag>0x1</Etag>"
+          "<Content-Length>1024</Content-Length>"
+          "<Content-Type>type</Content-Type>"
+          "<Content-Encoding>encoding</Content-Encoding>"
+          "<Content-Language>language</Content-Language>"
+          "<Content-MD5>AQI=</Content-MD5>"
+          "<Content-Disposition>disposition</Content-Disposition>"
+          "<Cache-Control>cache</Cache-Control>"
+          "<x-ms-blob-sequence-number>7</x-ms-blob-sequence-number>"
+          "<BlobType>PageBlob</BlobType>"
+          "<LeaseStatus>locked</LeaseStatus>"
+          "<LeaseState>leased</LeaseState>"
+          "<LeaseDuration>infinite</LeaseDuration>"
+          "<CopyId>copy-id</CopyId>"
+          "<CopyStatus>success</CopyStatus>"
+          "<CopySource>copy-source</CopySource>"
+          "<CopyProgress>1/1</CopyProgress>"
+          "<CopyCompletionTime>Mon, 01 Jan 2024 00:00:03 GMT</CopyCompletionTime>"
+          "<CopyStatusDescription>copy-description</CopyStatusDescription>"
+          "<ServerEncrypted>true</ServerEncrypted>"
+          "<IncrementalCopy>true</IncrementalCopy>"
+          "<CopyDestinationSnapshot>destination</CopyDestinationSnapshot>"
+          "<DeletedTime>Mon, 01 Jan 2024 00:00:04 GMT</DeletedTime>"
+          "<RemainingRetentionDays>3</RemainingRetentionDays>"
+          "<AccessTier>Cool</AccessTier>"
+          "<AccessTierInferred>true</AccessTierInferred>"
+          "<ArchiveStatus>rehydrate-pending-to-hot</ArchiveStatus>"
+          "<CustomerProvidedKeySha256>AwQ=</CustomerProvidedKeySha256>"
+          "<EncryptionScope>scope</EncryptionScope>"
+          "<AccessTierChangeTime>Mon, 01 Jan 2024 00:00:05 GMT"
+          "</AccessTierChangeTime>"
+          "<Expiry-Time>Mon, 01 Jan 2024 00:00:06 GMT</Expiry-Time>"
+          "<Sealed>true</Sealed>"
+          "<RehydratePriority>High</RehydratePriority>"
+          "<LastAccessTime>Mon, 01 Jan 2024 00:00:07 GMT</LastAccessTime>"
+          "<ImmutabilityPolicyUntilDate>Mon, 01 Jan 2024 00:00:08 GMT"
+          "</ImmutabilityPolicyUntilDate>"
+          "<ImmutabilityPolicyMode>locked</ImmutabilityPolicyMode>"
+          "<LegalHold>true</LegalHold>"
+          "</Properties>"
+          "<Metadata><key1>value1</key1><key2>value2</key2></Metadata>"
+          "<Tags><TagSet><Tag><Key>tag1</Key><Value>value3</Value></Tag>"
+          "</TagSet></Tags>"
+          "<OrMetadata><or-policy_rule>complete</or-policy_rule></OrMetadata>"
+          "<HasVersionsOnly>true</HasVersionsOnly>"
+          "</Blob></Blobs><NextMarker>next</NextMarker></EnumerationResults>";
+    Blobs::BlobContainerClient containerClient(
+        "https://a.blob.core.windows.net/c", OptionsWithResponse(body));
+    auto page = containerClient.ListBlobs();
+
+    EXPECT_EQ(page.ServiceEndpoint, "https://a.blob.core.windows.net/");
+    EXPECT_EQ(page.BlobContainerName, "c");
+    EXPECT_EQ(page.Prefix, "p");
+    EXPECT_EQ(page.NextPageToken.Value(), "next");
+    ASSERT_EQ(page.Blobs.size(), 1U);
+    const auto& blob = page.Blobs[0];
+    EXPECT_EQ(blob.Name, "p/blob");
+    EXPECT_TRUE(blob.IsDeleted);
+    EXPECT_EQ(blob.Snapshot, "snapshot");
+    EXPECT_EQ(blob.VersionId.Value(), "version");
+    EXPECT_TRUE(blob.IsCurrentVersion.Value());
+    EXPECT_TRUE(blob.HasVersionsOnly.Value());
+    EXPECT_EQ(blob.BlobSize, 1024);
+    EXPECT_EQ(blob.BlobType, Blobs::Models::BlobType::PageBlob);
+    const auto& details = blob.Details;
+    EXPECT_EQ(
+        details.CreatedOn,
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:01 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(
+        details.LastModified,
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:02 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(details.ETag, ETag("0x1"));
+    EXPECT_EQ(details.HttpHeaders.ContentType, "type");
+    EXPECT_EQ(details.HttpHeaders.ContentEncoding, "encoding");
+    EXPECT_EQ(details.HttpHeaders.ContentLanguage, "language");
+    EXPECT_EQ(details.HttpHeaders.ContentHash.Value, (std::vector<uint8_t>{1, 2}));
+    EXPECT_EQ(details.HttpHeaders.ContentDisposition, "disposition");
+    EXPECT_EQ(details.HttpHeaders.CacheControl, "cache");
+    EXPECT_EQ(details.SequenceNumber.Value(), 7);
+    EXPECT_EQ(details.LeaseStatus, Blobs::Models::LeaseStatus::Locked);
+    EXPECT_EQ(details.LeaseState, Blobs::Models::LeaseState::Leased);
+    EXPECT_EQ(details.LeaseDuration.Value(), Blobs::Models::LeaseDurationType::Infinite);
+    EXPECT_EQ(details.CopyId.Value(), "copy-id");
+    EXPECT_EQ(details.CopyStatus.Value(), Blobs::Models::CopyStatus::Success);
+    EXPECT_EQ(details.CopySource.Value(), "copy-source");
+    EXPECT_EQ(details.CopyProgress.Value(), "1/1");
+    EXPECT_EQ(
+        details.CopyCompletedOn.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:03 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(details.CopyStatusDescription.Value(), "copy-description");
+    EXPECT_TRUE(details.IsServerEncrypted);
+    EXPECT_TRUE(details.IsIncrementalCopy.Value());
+    EXPECT_EQ(details.IncrementalCopyDestinationSnapshot.Value(), "destination");
+    EXPECT_EQ(
+        details.DeletedOn.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:04 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(details.RemainingRetentionDays.Value(), 3);
+    EXPECT_EQ(details.AccessTier.Value(), Blobs::Models::AccessTier::Cool);
+    EXPECT_TRUE(details.IsAccessTierInferred.Value());
+    EXPECT_EQ(details.ArchiveStatus.Value(), Blobs::Models::ArchiveStatus::RehydratePendingToHot);
+    EXPECT_EQ(details.EncryptionKeySha256.Value(), (std::vector<uint8_t>{3, 4}));
+    EXPECT_EQ(details.EncryptionScope.Value(), "scope");
+    EXPECT_EQ(
+        details.AccessTierChangedOn.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:05 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(
+        details.ExpiresOn.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:06 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_TRUE(details.IsSealed.Value());
+    EXPECT_EQ(details.RehydratePriority.Value(), Blobs::Models::RehydratePriority::High);
+    EXPECT_EQ(
+        details.LastAccessedOn.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:07 GMT", DateTime::DateFormat::Rfc1123));
+    ASSERT_TRUE(details.ImmutabilityPolicy.HasValue());
+    EXPECT_EQ(
+        details.ImmutabilityPolicy.Value().ExpiresOn,
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:08 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(
+        details.ImmutabilityPolicy.Value().PolicyMode,
+        Blobs::Models::BlobImmutabilityPolicyMode::Locked);
+    EXPECT_TRUE(details.HasLegalHold);
+    EXPECT_EQ(details.Metadata.size(), 2U);
+    EXPECT_EQ(details.Metadata.at("key1"), "value1");
+    EXPECT_EQ(details.Metadata.at("key2"), "value2");
+    EXPECT_EQ(details.Tags, (std::map<std::string, std::string>{{"tag1", "value3"}}));
+    ASSERT_EQ(details.ObjectReplicationSourceProperties.size(), 1U);
+    EXPECT_EQ(details.ObjectReplicationSourceProperties[0].PolicyId, "policy");
+    ASSERT_EQ(details.ObjectReplicationSourceProperties[0].Rules.size(), 1U);
+    EXPECT_EQ(details.ObjectReplicationSourceProperties[0].Rules[0].RuleId, "rule");
+    EXPECT_EQ(
+        details.ObjectReplicationSourceProperties[0].Rules[0].ReplicationStatus,
+        Blobs::Models::ObjectReplicationStatus::Complete);
+  }
+
+  TEST(XmlDeserializationTest, GetServiceProperties)
+  {
+    const std::string body
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+          "<StorageServiceProperties>"
+          "<Logging><Version>1.0</Version><Delete>true</Delete>"
+          "<Read>true</Read><Write>true</Write>"
+          "<RetentionPolicy><Enabled>true</Enabled><Days>1</Days>"
+          "</RetentionPolicy></Logging>"
+          "<HourMetrics><Version>2.0</Version><Enabled>true</Enabled>"
+          "<IncludeAPIs>true</IncludeAPIs>"
+          "<RetentionPolicy><Enabled>true</Enabled><Days>2</Days>"
+          "</RetentionPolicy></HourMetrics>"
+          "<MinuteMetrics><Version>3.0</Version><Enabled>true</Enabled>"
+          "<IncludeAPIs>false</IncludeAPIs>"
+          "<RetentionPolicy><Enabled>true</Enabled><Days>3</Days>"
+          "</RetentionPolicy></MinuteMetrics>"
+          "<Cors><CorsRule><AllowedOrigins>origins</AllowedOrigins>"
+          "<AllowedMethods>GET</AllowedMethods>"
+          "<AllowedHeaders>allowed</AllowedHeaders>"
+          "<ExposedHeaders>exposed</ExposedHeaders>"
+          "<MaxAgeInSeconds>60</MaxAgeInSeconds></CorsRule></Cors>"
+          "<DefaultServiceVersion>2025-07-05</DefaultServiceVersion>"
+          "<DeleteRetentionPolicy><Enabled>true</Enabled><Days>4</Days>"
+          "</DeleteRetentionPolicy>"
+          "<StaticWebsite><Enabled>true</Enabled>"
+          "<IndexDocument>index.html</IndexDocument>"
+          "<ErrorDocument404Path>404.html</ErrorDocument404Path>"
+          "<DefaultIndexDocumentPath>default.html</DefaultIndexDocumentPath>"
+          "</StaticWebsite></StorageServiceProperties>";
+    Blobs::BlobServiceClient serviceClient(
+        "https://a.blob.core.windows.net/", OptionsWithResponse(body));
+    auto properties = serviceClient.GetProperties().Value;
+
+    EXPECT_EQ(properties.Logging.Version, "1.0");
+    EXPECT_TRUE(properties.Logging.Delete);
+    EXPECT_TRUE(properties.Logging.Read);
+    EXPECT_TRUE(properties.Logging.Write);
+    EXPECT_TRUE(properties.Logging.RetentionPolicy.IsEnabled);
+    EXPECT_EQ(properties.Logging.RetentionPolicy.Days.Value(), 1);
+    EXPECT_EQ(properties.HourMetrics.Version, "2.0");
+    EXPECT_TRUE(properties.HourMetrics.IsEnabled);
+    EXPECT_TRUE(properties.HourMetrics.IncludeApis.Value());
+    EXPECT_TRUE(properties.HourMetrics.RetentionPolicy.IsEnabled);
+    EXPECT_EQ(properties.HourMetrics.RetentionPolicy.Days.Value(), 2);
+    EXPECT_EQ(properties.MinuteMetrics.Version, "3.0");
+    EXPECT_TRUE(properties.MinuteMetrics.IsEnabled);
+    EXPECT_FALSE(properties.MinuteMetrics.IncludeApis.Value());
+    EXPECT_TRUE(properties.MinuteMetrics.RetentionPolicy.IsEnabled);
+    EXPECT_EQ(properties.MinuteMetrics.RetentionPolicy.Days.Value(), 3);
+    ASSERT_EQ(properties.Cors.size(), 1U);
+    EXPECT_EQ(properties.Cors[0].AllowedOrigins, "origins");
+    EXPECT_EQ(properties.Cors[0].AllowedMethods, "GET");
+    EXPECT_EQ(properties.Cors[0].AllowedHeaders, "allowed");
+    EXPECT_EQ(properties.Cors[0].ExposedHeaders, "exposed");
+    EXPECT_EQ(properties.Cors[0].MaxAgeInSeconds, 60);
+    EXPECT_EQ(properties.DefaultServiceVersion.Value(), "2025-07-05");
+    EXPECT_TRUE(properties.DeleteRetentionPolicy.IsEnabled);
+    EXPECT_EQ(properties.DeleteRetentionPolicy.Days.Value(), 4);
+    EXPECT_TRUE(properties.StaticWebsite.IsEnabled);
+    EXPECT_EQ(properties.StaticWebsite.IndexDocument.Value(), "index.html");
+    EXPECT_EQ(properties.StaticWebsite.ErrorDocument404Path.Value(), "404.html");
+    EXPECT_EQ(properties.StaticWebsite.DefaultIndexDocumentPath.Value(), "default.html");
+  }
+
+}}} // namespace Azure::Storage::Test
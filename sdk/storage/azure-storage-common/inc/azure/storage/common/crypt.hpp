@@ -7,6 +7,7 @@
 #include <azure/core/cryptography/hash.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -37,7 +38,59 @@ namespace Azure { namespace Storage {
     std::vector<uint8_t> OnFinal(const uint8_t* data, size_t length) override;
   };
 
+  namespace _detail {
+    /**
+     * @brief Returns whether the CPU supports the carry-less multiplication instructions used to
+     * compute CRC64 (PCLMULQDQ on x86-64, PMULL on ARMv8).
+     */
+    bool IsCrc64HardwareAccelerated();
+
+    /**
+     * @brief Computes the CRC64 of \p crc, the CRC64 of some data, followed by \p data, with the
+     * table-driven implementation.
+     */
+    uint64_t Crc64Software(uint64_t crc, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Computes the CRC64 of \p crc, the CRC64 of some data, followed by \p data, with
+     * carry-less multiplication if the CPU supports it, or with the table-driven implementation
+     * otherwise.
+     */
+    uint64_t Crc64Hardware(uint64_t crc, const uint8_t* data, size_t length);
+  } // namespace _detail
+
   namespace _internal {
+    /**
+     * @brief The CRC64 of data transferred in chunks. The CRC64 of different chunks can be computed
+     * by different threads, and are combined in order.
+     */
+    class ChunkedCrc64Hash final {
+    public:
+      /**
+       * @brief Constructs the CRC64 of \p numChunks chunks.
+       */
+      explicit ChunkedCrc64Hash(int64_t numChunks);
+
+      /**
+       * @brief Appends data to the chunk \p chunkId.
+       */
+      void Append(int64_t chunkId, const uint8_t* data, size_t length);
+
+      /**
+       * @brief Returns the CRC64 of the chunk \p chunkId.
+       */
+      std::vector<uint8_t> ChunkFinal(int64_t chunkId) const;
+
+      /**
+       * @brief Returns the CRC64 of all the chunks. It must be called after the chunks are
+       * complete.
+       */
+      std::vector<uint8_t> Final() const;
+
+    private:
+      std::vector<std::unique_ptr<Crc64Hash>> m_chunks;
+    };
+
     std::vector<uint8_t> HmacSha256(
         const std::vector<uint8_t>& data,
         const std::vector<uint8_t>& key);
@@ -3,65 +3,153 @@
 
 #pragma once
 
+#include "azure/storage/common/internal/thread_pool.hpp"
+
 #include <algorithm>
-#include <atomic>
+#include <condition_variable>
 #include <cstdlib>
+#include <exception>
 #include <functional>
-#include <future>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
 namespace Azure { namespace Storage { namespace _internal {
 
-  inline void ConcurrentTransfer(
-      int64_t offset,
-      int64_t length,
-      int64_t chunkSize,
-      int concurrency,
+  namespace _detail {
+    // The chunks of a transfer, shared by the calling thread and the tasks of the thread pool.
+    struct ConcurrentTransferState final
+    {
       // offset, length, chunk ID, number of chunks
-      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc)
-  {
-    std::atomic<int> numWorkingThreads{concurrency};
-    std::atomic<int> nextChunkId{0};
-    std::atomic<bool> failed{false};
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> TransferFunc;
+      int64_t Offset = 0;
+      int64_t Length = 0;
+      int64_t ChunkSize = 0;
+      int64_t NumChunks = 0;
 
-    const auto numChunks = (length + chunkSize - 1) / chunkSize;
+      std::mutex Mutex;
+      std::condition_variable ChunkCompleted;
+      // Guarded by Mutex.
+      int64_t NextChunkId = 0;
+      int64_t NumChunksInProgress = 0;
+      std::exception_ptr Error;
 
-    auto threadFunc = [&]() {
-      while (true)
+      bool HasMoreChunks() const { return !Error && NextChunkId < NumChunks; }
+
+      // Transfers the next chunk, if any, and returns whether the thread should transfer the next
+      // one. When there are more chunks, yieldThread is called with the state locked and returns
+      // whether the thread was given to another task.
+      bool TransferNextChunk(std::function<bool()> const& yieldThread)
       {
-        int chunkId = nextChunkId.fetch_add(1);
-        if (chunkId >= numChunks || failed)
+        int64_t chunkId;
         {
-          break;
+          std::lock_guard<std::mutex> guard(Mutex);
+          if (!HasMoreChunks())
+          {
+            return false;
+          }
+          chunkId = NextChunkId++;
+          ++NumChunksInProgress;
         }
-        int64_t chunkOffset = offset + chunkSize * chunkId;
-        int64_t chunkLength = (std::min)(length - chunkSize * chunkId, chunkSize);
+        std::exception_ptr error;
         try
         {
-          transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
+          int64_t chunkOffset = Offset + ChunkSize * chunkId;
+          int64_t chunkLength = (std::min)(Length - ChunkSize * chunkId, ChunkSize);
+          TransferFunc(chunkOffset, chunkLength, chunkId, NumChunks);
         }
-        catch (const std::exception&)
+        catch (...)
         {
-          if (failed.exchange(true) == false)
-          {
-            numWorkingThreads.fetch_sub(1);
-            throw;
-          }
+          error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> guard(Mutex);
+        --NumChunksInProgress;
+        if (error && !Error)
+        {
+          Error = error;
         }
+        const bool transferNextChunk = HasMoreChunks() && !yieldThread();
+        if (NumChunksInProgress == 0)
+        {
+          ChunkCompleted.notify_all();
+        }
+        return transferNextChunk;
       }
-      numWorkingThreads.fetch_sub(1);
     };
 
-    std::vector<std::future<void>> threadHandles;
-    for (int i = 0; i < std::min<int64_t>(concurrency, numChunks) - 1; ++i)
+    // Transfers chunks as long as no other task waits for a thread of the pool. Otherwise, the
+    // task is queued again, so the chunks of the transfers sharing the pool are interleaved.
+    inline void RunConcurrentTransferTask(
+        std::shared_ptr<ConcurrentTransferState> state,
+        ThreadPool* threadPool)
+    {
+      const std::function<bool()> yieldThread = [&state, threadPool]() {
+        if (!threadPool->HasQueuedTasks())
+        {
+          return false;
+        }
+        threadPool->Submit(
+            [state, threadPool]() { RunConcurrentTransferTask(state, threadPool); });
+        return true;
+      };
+      while (state->TransferNextChunk(yieldThread))
+      {
+      }
+    }
+  } // namespace _detail
+
+  /**
+   * @brief Transfers a range in chunks, using up to \p concurrency threads: the calling thread and
+   * threads of \p threadPool.
+   *
+   * @param threadPool The thread pool to use, or `nullptr` for the default shared thread pool.
+   */
+  inline void ConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int concurrency,
+      // offset, length, chunk ID, number of chunks
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      std::shared_ptr<ThreadPool> threadPool = nullptr)
+  {
+    auto state = std::make_shared<_detail::ConcurrentTransferState>();
+    state->TransferFunc = std::move(transferFunc);
+    state->Offset = offset;
+    state->Length = length;
+    state->ChunkSize = chunkSize;
+    state->NumChunks = (length + chunkSize - 1) / chunkSize;
+
+    const int64_t numTasks = std::min<int64_t>(concurrency, state->NumChunks) - 1;
+    if (numTasks > 0)
+    {
+      if (!threadPool)
+      {
+        threadPool = ThreadPool::GetShared();
+      }
+      // The tasks only use the thread pool while the transfer isn't complete, so they don't need
+      // to keep it alive.
+      for (int64_t i = 0; i < numTasks; ++i)
+      {
+        threadPool->Submit([state, pool = threadPool.get()]() {
+          _detail::RunConcurrentTransferTask(state, pool);
+        });
+      }
+    }
+
+    // The calling thread transfers chunks too, so the transfer completes even when all the threads
+    // of the pool are busy.
+    const std::function<bool()> keepThread = []() { return false; };
+    while (state->TransferNextChunk(keepThread))
     {
-      threadHandles.emplace_back(std::async(std::launch::async, threadFunc));
     }
-    threadFunc();
-    for (auto& handle : threadHandles)
+
+    std::unique_lock<std::mutex> guard(state->Mutex);
+    state->ChunkCompleted.wait(guard, [&state]() { return state->NumChunksInProgress == 0; });
+    if (state->Error)
     {
-      handle.get();
+      std::rethrow_exception(state->Error);
     }
   }
 
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/storage/common/crypt.hpp"
+#include "azure/storage/common/internal/thread_pool.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace _detail {
+    struct ParallelDownloadState;
+  } // namespace _detail
+
+  // Options used by the parallel download stream
+  struct ParallelDownloadStreamOptions final
+  {
+    // The size of the chunks downloaded in parallel.
+    int64_t ChunkSize = 4 * 1024 * 1024;
+    // The maximum number of chunks downloaded at the same time.
+    int32_t Concurrency = 5;
+    // The maximum number of bytes downloaded ahead of the reader. At least one chunk is downloaded
+    // ahead of the reader.
+    int64_t MaxBufferedBytes = 64 * 1024 * 1024;
+    // Whether to compute the CRC64 of the chunks while they're downloaded.
+    bool ComputeCrc64 = false;
+  };
+
+  /**
+   * @brief A body stream reading a range in order, while the chunks following the read position
+   * are downloaded in parallel.
+   *
+   * @details The chunks are downloaded by the threads of a #ThreadPool into a ring of buffers, so
+   * they can complete out of order and the memory used is bounded by
+   * ParallelDownloadStreamOptions::MaxBufferedBytes. The range starts with a chunk which is already
+   * downloading, such as the response to the request which got the size of the range, and which is
+   * read without being buffered.
+   *
+   * @remark Destroying the stream cancels the chunks being downloaded, and waits for them to
+   * stop.
+   */
+  class ParallelDownloadStream final : public Azure::Core::IO::BodyStream {
+  public:
+    /**
+     * @brief Downloads \p length bytes at \p offset and returns the body of the response.
+     */
+    using ChunkDownloader = std::function<std::unique_ptr<Azure::Core::IO::BodyStream>(
+        int64_t offset,
+        int64_t length,
+        const Azure::Core::Context& context)>;
+
+    /**
+     * @brief Starts downloading the chunks following the first chunk.
+     *
+     * @param firstChunk The body of the first chunk.
+     * @param firstChunkLength The length of the first chunk.
+     * @param offset The offset of the range following the first chunk.
+     * @param length The length of the range following the first chunk.
+     * @param chunkDownloader Downloads the chunks following the first chunk.
+     * @param options Options of the stream.
+     * @param threadPool The thread pool downloading the chunks, or `nullptr` for the default
+     * shared thread pool.
+     * @param context A context to control the lifetime of the chunk downloads.
+     */
+    explicit ParallelDownloadStream(
+        std::unique_ptr<Azure::Core::IO::BodyStream> firstChunk,
+        int64_t firstChunkLength,
+        int64_t offset,
+        int64_t length,
+        ChunkDownloader chunkDownloader,
+        const ParallelDownloadStreamOptions& options,
+        std::shared_ptr<ThreadPool> threadPool,
+        const Azure::Core::Context& context);
+
+    ~ParallelDownloadStream() override;
+
+    int64_t Length() const override { return m_length; }
+
+    /**
+     * @brief Returns the CRC64 of the range. It must be called after the whole range is read, with
+     * ParallelDownloadStreamOptions::ComputeCrc64 set.
+     */
+    std::vector<uint8_t> FinalCrc64() const;
+
+  private:
+    std::unique_ptr<Azure::Core::IO::BodyStream> m_firstChunk;
+    int64_t m_firstChunkRemaining;
+    int64_t m_length;
+    std::shared_ptr<_detail::ParallelDownloadState> m_state;
+    std::shared_ptr<ThreadPool> m_threadPool;
+    // The position of the reader in the buffered chunk it's reading.
+    size_t m_chunkReadOffset = 0;
+
+    size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context& context) override;
+    void StartDownloads();
+  };
+
+}}} // namespace Azure::Storage::_internal
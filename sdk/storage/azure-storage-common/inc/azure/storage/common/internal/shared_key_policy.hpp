@@ -7,6 +7,7 @@
 
 #include <azure/core/http/policies/policy.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 
@@ -36,6 +37,16 @@ namespace Azure { namespace Storage { namespace _internal {
       return nextPolicy.Send(request, context);
     }
 
+    std::future<std::unique_ptr<Core::Http::RawResponse>> SendAsync(
+        Core::Http::Request& request,
+        Core::Http::Policies::NextHttpPolicy nextPolicy,
+        Core::Context const& context) const override
+    {
+      request.SetHeader(
+          "Authorization", "SharedKey " + m_credential->AccountName + ":" + GetSignature(request));
+      return nextPolicy.SendAsync(request, context);
+    }
+
   private:
     std::string GetSignature(const Core::Http::Request& request) const;
 
@@ -5,6 +5,8 @@
 
 #include <azure/core/http/policies/policy.hpp>
 
+#include <future>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 
@@ -71,6 +73,11 @@ namespace Azure { namespace Storage { namespace _internal {
         Azure::Core::Http::Policies::NextHttpPolicy& nextPolicy,
         Azure::Core::Context const& context) const override;
 
+    std::future<std::unique_ptr<Azure::Core::Http::RawResponse>> AuthorizeAndSendRequestAsync(
+        Azure::Core::Http::Request& request,
+        Azure::Core::Http::Policies::NextHttpPolicy& nextPolicy,
+        Azure::Core::Context const& context) const override;
+
     bool AuthorizeRequestOnChallenge(
         std::string const& challenge,
         Azure::Core::Http ::Request& request,
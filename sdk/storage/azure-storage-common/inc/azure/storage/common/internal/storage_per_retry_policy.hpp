@@ -5,6 +5,7 @@
 
 #include <azure/core/http/policies/policy.hpp>
 
+#include <future>
 #include <memory>
 
 namespace Azure { namespace Storage { namespace _internal {
@@ -22,6 +23,14 @@ namespace Azure { namespace Storage { namespace _internal {
         Core::Http::Request& request,
         Core::Http::Policies::NextHttpPolicy nextPolicy,
         Core::Context const& context) const override;
+
+    std::future<std::unique_ptr<Core::Http::RawResponse>> SendAsync(
+        Core::Http::Request& request,
+        Core::Http::Policies::NextHttpPolicy nextPolicy,
+        Core::Context const& context) const override;
+
+  private:
+    void PrepareRequest(Core::Http::Request& request, Core::Context const& context) const;
   };
 
 }}} // namespace Azure::Storage::_internal
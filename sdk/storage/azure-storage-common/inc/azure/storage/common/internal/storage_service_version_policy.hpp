@@ -5,6 +5,7 @@
 
 #include <azure/core/http/policies/policy.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 
@@ -34,6 +35,18 @@ namespace Azure { namespace Storage { namespace _internal {
       return nextPolicy.Send(request, context);
     }
 
+    std::future<std::unique_ptr<Azure::Core::Http::RawResponse>> SendAsync(
+        Azure::Core::Http::Request& request,
+        Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+        const Azure::Core::Context& context) const override
+    {
+      if (!m_apiVersion.empty())
+      {
+        request.SetHeader(HttpHeaderXMsVersion, m_apiVersion);
+      }
+      return nextPolicy.SendAsync(request, context);
+    }
+
   private:
     std::string m_apiVersion;
   };
@@ -7,6 +7,7 @@
 
 #include <azure/core/http/policies/policy.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 
@@ -36,7 +37,26 @@ namespace Azure { namespace Storage { namespace _internal {
         Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
         const Azure::Core::Context& context) const override;
 
+    std::future<std::unique_ptr<Azure::Core::Http::RawResponse>> SendAsync(
+        Azure::Core::Http::Request& request,
+        Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+        const Azure::Core::Context& context) const override;
+
   private:
+    // Switches the host of a retry of a read request, and returns whether the secondary host is
+    // considered.
+    bool PrepareRequest(
+        Azure::Core::Http::Request& request,
+        const Azure::Core::Context& context,
+        std::shared_ptr<bool>& replicaStatus) const;
+    // Returns true, after switching the request back to the primary host, if the secondary host
+    // doesn't have the resource yet.
+    bool SwitchBackToPrimary(
+        Azure::Core::Http::Request& request,
+        const Azure::Core::Http::RawResponse& response,
+        bool considerSecondary,
+        const std::shared_ptr<bool>& replicaStatus) const;
+
     std::string m_primaryHost;
     std::string m_secondaryHost;
   };
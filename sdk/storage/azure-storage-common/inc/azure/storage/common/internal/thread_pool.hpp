@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief A fixed-size pool of threads running the chunks of the parallel transfers.
+   *
+   * @details Each thread owns a queue. A task submitted from outside the pool is queued to the
+   * threads in turn, and a task submitted from a thread of the pool is queued to the back of the
+   * queue of that thread. A thread runs the tasks of its queue in order, and takes the last task of
+   * another queue when its own queue is empty.
+   *
+   * @remark Tasks must not throw.
+   */
+  class ThreadPool final {
+  public:
+    /**
+     * @brief Creates a pool of \p threadCount threads. The threads are started when the first
+     * task is submitted.
+     *
+     * @param threadCount The number of threads, or 0 for #DefaultThreadCount().
+     */
+    explicit ThreadPool(size_t threadCount);
+
+    /**
+     * @brief Stops the threads. Tasks which are not started are discarded.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queues \p task to be run by a thread of the pool.
+     */
+    void Submit(std::function<void()> task);
+
+    /**
+     * @brief Checks whether there are submitted tasks that no thread has started yet.
+     */
+    bool HasQueuedTasks();
+
+    /**
+     * @brief The number of threads of the pool.
+     */
+    size_t ThreadCount() const { return m_queues.size(); }
+
+    /**
+     * @brief The number of threads used when no size is specified: the number of processors, and
+     * at least 8.
+     */
+    static size_t DefaultThreadCount();
+
+    /**
+     * @brief Returns the pool with \p threadCount threads shared by the clients of the process.
+     * The pool is created if needed, and destroyed once no client uses it.
+     *
+     * @param threadCount The number of threads, or 0 or less for #DefaultThreadCount().
+     */
+    static std::shared_ptr<ThreadPool> GetShared(int32_t threadCount = 0);
+
+  private:
+    struct TaskQueue final
+    {
+      std::mutex Mutex;
+      std::deque<std::function<void()>> Tasks;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::once_flag m_startThreads;
+    std::atomic<size_t> m_nextQueue{0};
+
+    // The number of queued tasks which no thread has claimed. A task is counted once it is queued,
+    // and a thread takes a task from the queues only after claiming one.
+    std::atomic<size_t> m_queuedTaskCount{0};
+    std::atomic<size_t> m_idleThreadCount{0};
+    std::atomic<bool> m_stopRequested{false};
+
+    // Only used to put idle threads to sleep and to wake them up.
+    std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+
+    void Run(size_t index);
+    bool TryClaimTask();
+    bool TryTakeTask(size_t index, std::function<void()>& task);
+  };
+
+}}} // namespace Azure::Storage::_internal
@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/storage/common/internal/xml_wrapper.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief A node of an xml document as scanned by #XmlScanner. Name and Value point into the
+   * scanner's input and are only valid until the next call to #XmlScanner::Scan.
+   */
+  struct XmlToken final
+  {
+    XmlNodeType Type = XmlNodeType::End;
+    const char* Name = nullptr;
+    size_t NameLength = 0;
+    const char* Value = nullptr;
+    size_t ValueLength = 0;
+    bool HasValue = false;
+    /**
+     * @brief Whether Value contains entity references or line breaks to be normalized, so that it
+     * must be decoded with #XmlScanner::DecodeValue.
+     */
+    bool NeedsDecoding = false;
+  };
+
+  /**
+   * @brief A pull-based xml reader which scans UTF-8 input in place and only decodes values when
+   * asked to. It reports the same nodes as #XmlReader for the documents the storage services
+   * return. Comments and processing instructions are skipped, CDATA sections are reported as text
+   * and document type declarations aren't supported.
+   */
+  class XmlScanner final {
+  public:
+    /**
+     * @brief Scans a document in memory. The data must outlive the scanner.
+     */
+    explicit XmlScanner(const char* data, size_t length);
+
+    /**
+     * @brief Scans a document as it's read from a stream. Only the part of the document containing
+     * the current node is buffered. The stream must outlive the scanner.
+     */
+    explicit XmlScanner(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context);
+
+    XmlScanner(const XmlScanner& other) = delete;
+    XmlScanner& operator=(const XmlScanner& other) = delete;
+    XmlScanner(XmlScanner&& other) = default;
+    XmlScanner& operator=(XmlScanner&& other) = default;
+    ~XmlScanner() = default;
+
+    /**
+     * @brief Scans the next node.
+     */
+    XmlToken Scan();
+
+    /**
+     * @brief Scans the next node and copies it out of the input.
+     */
+    XmlNode Read();
+
+    /**
+     * @brief Returns the value of \p token with the entity references decoded and the line breaks
+     * normalized.
+     */
+    static std::string DecodeValue(const XmlToken& token);
+
+  private:
+    struct Attribute final
+    {
+      size_t NameOffset;
+      size_t NameLength;
+      size_t ValueOffset;
+      size_t ValueLength;
+      bool NeedsDecoding;
+    };
+
+    enum class ScanResult
+    {
+      Token,
+      Skipped,
+      NeedMoreData,
+    };
+
+    const char* m_data = nullptr;
+    size_t m_length = 0;
+    size_t m_position = 0;
+
+    Azure::Core::IO::BodyStream* m_stream = nullptr;
+    Azure::Core::Context m_context;
+    std::vector<char> m_buffer;
+    bool m_endOfStream = true;
+    bool m_byteOrderMarkChecked = false;
+
+    // Names of the open elements, concatenated, and where each of them starts.
+    std::string m_openElements;
+    std::vector<size_t> m_openElementOffsets;
+    bool m_rootSeen = false;
+
+    // The attributes of the start tag last returned, relative to m_data.
+    std::vector<Attribute> m_attributes;
+    size_t m_nextAttribute = 0;
+    bool m_pendingEndTag = false;
+
+    bool FillBuffer();
+    ScanResult ScanText(XmlToken& token);
+    ScanResult ScanMarkup(XmlToken& token);
+    ScanResult ScanStartTag(XmlToken& token);
+    ScanResult ScanEndTag(XmlToken& token);
+    ScanResult SkipUntil(size_t from, const char* terminator, size_t terminatorLength);
+  };
+
+}}} // namespace Azure::Storage::_internal
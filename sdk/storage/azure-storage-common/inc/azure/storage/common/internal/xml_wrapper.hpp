@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <azure/core/context.hpp>
+#include <azure/core/io/body_stream.hpp>
+
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -39,6 +42,9 @@ namespace Azure { namespace Storage { namespace _internal {
   class XmlReader final {
   public:
     explicit XmlReader(const char* data, size_t length);
+    // Parses the document incrementally as it's read from the stream. The stream must outlive the
+    // reader.
+    explicit XmlReader(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context);
     XmlReader(const XmlReader& other) = delete;
     XmlReader& operator=(const XmlReader& other) = delete;
     XmlReader(XmlReader&& other) noexcept;
@@ -29,6 +29,31 @@
 #include <stdexcept>
 #include <vector>
 
+// CRC64 is computed with carry-less multiplication on x86-64 and ARMv8 when the CPU supports it,
+// which is detected at runtime.
+#if defined(__x86_64__) || defined(_M_X64)
+#define AZ_STORAGE_CRC64_CLMUL
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define AZ_STORAGE_CRC64_CLMUL_TARGET
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#define AZ_STORAGE_CRC64_CLMUL_TARGET __attribute__((target("pclmul,sse2")))
+#endif
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define AZ_STORAGE_CRC64_CLMUL
+#include <arm_neon.h>
+#define AZ_STORAGE_CRC64_CLMUL_TARGET
+#elif defined(__aarch64__) && defined(__linux__) && defined(__GNUC__) && !defined(__clang__)
+// The instructions are enabled for the functions using them only.
+#define AZ_STORAGE_CRC64_CLMUL
+#include <arm_neon.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#define AZ_STORAGE_CRC64_CLMUL_TARGET __attribute__((target("+crypto")))
+#endif
+
 namespace Azure { namespace Storage {
 
   namespace _internal {
@@ -855,12 +880,10 @@ namespace Azure { namespace Storage {
     return vr[0] ^ vr[1];
   }
 
-  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  // Computes the CRC64 with 8 KiB of lookup tables, 32 bytes at a time. The CRC is complemented
+  // before and after.
+  static uint64_t Crc64Tables(uint64_t uCrc, const uint8_t* data, size_t length)
   {
-    m_length += length;
-
-    uint64_t uCrc = m_context ^ ~0ULL;
-
     uint64_t pData = 0;
 
     size_t uStop = length - (length % 32);
@@ -1000,7 +1023,185 @@ namespace Azure { namespace Storage {
     {
       uCrc = (uCrc >> 8) ^ Crc64MU1[(uCrc ^ data[pData]) & 0xff];
     }
-    m_context = uCrc ^ ~0ULL;
+    return uCrc;
+  }
+
+#if defined(AZ_STORAGE_CRC64_CLMUL)
+  static bool IsCpuClmulSupported()
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    // CPUID leaf 1: ECX bit 1 is PCLMULQDQ, EDX bit 26 is SSE2.
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    const unsigned int ecx = static_cast<unsigned int>(info[2]);
+    const unsigned int edx = static_cast<unsigned int>(info[3]);
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+      return false;
+    }
+#endif
+    return (ecx & (1U << 1)) != 0 && (edx & (1U << 26)) != 0;
+#elif defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+    return true;
+#else
+    return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+#endif
+  }
+
+  /*
+   * Folds the data 16 bytes at a time with carry-less multiplication, see "Fast CRC Computation for
+   * Generic Polynomials Using PCLMULQDQ Instruction" by Intel. A block holds a polynomial of degree
+   * less than 128, in the bit-reflected order of the CRC: its first 8 bytes hold the coefficients
+   * of x^127 to x^64. Folding the block by D bits multiplies its halves by x^(D+64) mod P and
+   * x^D mod P, which gives a polynomial of degree less than 128 congruent to the block times x^D.
+   * The product of two bit-reflected 64-bit values is shifted by one bit, so the constants are
+   * x^(D+63) mod P and x^(D-1) mod P.
+   */
+
+  // x^(128+63) mod P and x^(128-1) mod P, bit-reflected.
+  static constexpr uint64_t Crc64Fold128[] = {0xeadc41fd2ba3d420ULL, 0x21e9761e252621acULL};
+  // x^(512+63) mod P and x^(512-1) mod P, bit-reflected.
+  static constexpr uint64_t Crc64Fold512[] = {0x0c32cdb31e18a84aULL, 0x62242240ace5045aULL};
+
+#if defined(__x86_64__) || defined(_M_X64)
+  using Crc64Block = __m128i;
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block Crc64Load(const uint8_t* data)
+  {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block Crc64Constants(const uint64_t* k)
+  {
+    return _mm_set_epi64x(static_cast<long long>(k[1]), static_cast<long long>(k[0]));
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block
+  Crc64Fold(Crc64Block x, Crc64Block k, Crc64Block next)
+  {
+    return _mm_xor_si128(
+        _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), next);
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block Crc64Xor(Crc64Block x, uint64_t value)
+  {
+    return _mm_xor_si128(x, _mm_cvtsi64_si128(static_cast<long long>(value)));
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline void Crc64Store(uint8_t* data, Crc64Block x)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), x);
+  }
+#else
+  using Crc64Block = uint64x2_t;
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block Crc64Load(const uint8_t* data)
+  {
+    return vreinterpretq_u64_u8(vld1q_u8(data));
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block Crc64Constants(const uint64_t* k)
+  {
+    return vld1q_u64(k);
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block
+  Crc64Fold(Crc64Block x, Crc64Block k, Crc64Block next)
+  {
+    const poly128_t low = vmull_p64(
+        static_cast<poly64_t>(vgetq_lane_u64(x, 0)), static_cast<poly64_t>(vgetq_lane_u64(k, 0)));
+    const poly128_t high = vmull_p64(
+        static_cast<poly64_t>(vgetq_lane_u64(x, 1)), static_cast<poly64_t>(vgetq_lane_u64(k, 1)));
+    return veorq_u64(veorq_u64(vreinterpretq_u64_p128(low), vreinterpretq_u64_p128(high)), next);
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline Crc64Block Crc64Xor(Crc64Block x, uint64_t value)
+  {
+    return veorq_u64(x, vcombine_u64(vcreate_u64(value), vcreate_u64(0)));
+  }
+
+  AZ_STORAGE_CRC64_CLMUL_TARGET static inline void Crc64Store(uint8_t* data, Crc64Block x)
+  {
+    vst1q_u8(data, vreinterpretq_u8_u64(x));
+  }
+#endif
+
+  // The length of the data below which the lookup tables are faster.
+  constexpr static size_t Crc64ClmulMinLength = 64;
+
+  // Same as Crc64Tables(), for at least Crc64ClmulMinLength bytes.
+  AZ_STORAGE_CRC64_CLMUL_TARGET static uint64_t
+  Crc64Clmul(uint64_t uCrc, const uint8_t* data, size_t length)
+  {
+    const uint8_t* const end = data + length;
+
+    // Folds four blocks at a time, so the multiplications don't wait for each other.
+    Crc64Block x0 = Crc64Xor(Crc64Load(data), uCrc);
+    Crc64Block x1 = Crc64Load(data + 16);
+    Crc64Block x2 = Crc64Load(data + 32);
+    Crc64Block x3 = Crc64Load(data + 48);
+    data += 64;
+    const Crc64Block k512 = Crc64Constants(Crc64Fold512);
+    for (; end - data >= 64; data += 64)
+    {
+      x0 = Crc64Fold(x0, k512, Crc64Load(data));
+      x1 = Crc64Fold(x1, k512, Crc64Load(data + 16));
+      x2 = Crc64Fold(x2, k512, Crc64Load(data + 32));
+      x3 = Crc64Fold(x3, k512, Crc64Load(data + 48));
+    }
+
+    const Crc64Block k128 = Crc64Constants(Crc64Fold128);
+    Crc64Block x = Crc64Fold(x0, k128, x1);
+    x = Crc64Fold(x, k128, x2);
+    x = Crc64Fold(x, k128, x3);
+    for (; end - data >= 16; data += 16)
+    {
+      x = Crc64Fold(x, k128, Crc64Load(data));
+    }
+
+    // The CRC of the data is the CRC of the folded block, followed by the remaining bytes.
+    uint8_t folded[16];
+    Crc64Store(folded, x);
+    uCrc = Crc64Tables(0, folded, sizeof(folded));
+    return Crc64Tables(uCrc, data, static_cast<size_t>(end - data));
+  }
+#endif
+
+  namespace _detail {
+    bool IsCrc64HardwareAccelerated()
+    {
+#if defined(AZ_STORAGE_CRC64_CLMUL)
+      static const bool isSupported = IsCpuClmulSupported();
+      return isSupported;
+#else
+      return false;
+#endif
+    }
+
+    uint64_t Crc64Software(uint64_t crc, const uint8_t* data, size_t length)
+    {
+      return Crc64Tables(crc ^ ~0ULL, data, length) ^ ~0ULL;
+    }
+
+    uint64_t Crc64Hardware(uint64_t crc, const uint8_t* data, size_t length)
+    {
+#if defined(AZ_STORAGE_CRC64_CLMUL)
+      if (length >= Crc64ClmulMinLength && IsCrc64HardwareAccelerated())
+      {
+        return Crc64Clmul(crc ^ ~0ULL, data, length) ^ ~0ULL;
+      }
+#endif
+      return Crc64Software(crc, data, length);
+    }
+  } // namespace _detail
+
+  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  {
+    m_length += length;
+    m_context = _detail::Crc64Hardware(m_context, data, length);
   }
 
   void Crc64Hash::Concatenate(const Crc64Hash& other)
@@ -1044,4 +1245,38 @@ namespace Azure { namespace Storage {
     return binary;
   }
 
+  namespace _internal {
+    ChunkedCrc64Hash::ChunkedCrc64Hash(int64_t numChunks)
+    {
+      // The chunks are allocated first, so they can be appended concurrently.
+      m_chunks.reserve(static_cast<size_t>(numChunks));
+      for (int64_t i = 0; i < numChunks; ++i)
+      {
+        m_chunks.push_back(std::make_unique<Crc64Hash>());
+      }
+    }
+
+    void ChunkedCrc64Hash::Append(int64_t chunkId, const uint8_t* data, size_t length)
+    {
+      m_chunks[static_cast<size_t>(chunkId)]->Append(data, length);
+    }
+
+    std::vector<uint8_t> ChunkedCrc64Hash::ChunkFinal(int64_t chunkId) const
+    {
+      Crc64Hash crc64;
+      crc64.Concatenate(*m_chunks[static_cast<size_t>(chunkId)]);
+      return crc64.Final();
+    }
+
+    std::vector<uint8_t> ChunkedCrc64Hash::Final() const
+    {
+      Crc64Hash crc64;
+      for (const auto& chunk : m_chunks)
+      {
+        crc64.Concatenate(*chunk);
+      }
+      return crc64.Final();
+    }
+  } // namespace _internal
+
 }} // namespace Azure::Storage
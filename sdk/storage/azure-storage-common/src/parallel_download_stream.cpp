@@ -0,0 +1,248 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/internal/parallel_download_stream.hpp"
+
+#include <azure/core/datetime.hpp>
+#include <azure/core/exception.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace _detail {
+    // The interval used by the reader to check whether its context is cancelled while it waits
+    // for a chunk.
+    constexpr static std::chrono::milliseconds ChunkWaitInterval = std::chrono::milliseconds(100);
+
+    struct ParallelDownloadState final
+    {
+      ParallelDownloadStream::ChunkDownloader ChunkDownloader;
+      Azure::Core::Context DownloadContext;
+      int64_t Offset = 0;
+      int64_t Length = 0;
+      int64_t ChunkSize = 0;
+      int64_t NumChunks = 0;
+      int64_t NumBuffers = 0;
+      int32_t Concurrency = 0;
+      // The CRC64 of the first chunk, followed by the CRC64 of the chunks downloaded in parallel.
+      std::unique_ptr<ChunkedCrc64Hash> Crc64;
+
+      std::mutex Mutex;
+      std::condition_variable ChunkDownloaded;
+      // Guarded by Mutex. A buffer belongs to the thread downloading a chunk to it until the chunk
+      // is downloaded, then to the reader until the chunk is read.
+      std::vector<std::vector<uint8_t>> Buffers;
+      std::vector<bool> IsChunkDownloaded;
+      int64_t NextChunkId = 0;
+      int64_t ReadChunkId = 0;
+      int32_t NumDownloadTasks = 0;
+      bool IsClosed = false;
+      std::exception_ptr Error;
+
+      bool CanDownloadChunk() const
+      {
+        return !IsClosed && !Error && NextChunkId < NumChunks
+            && NextChunkId < ReadChunkId + NumBuffers;
+      }
+    };
+
+    void DownloadChunks(std::shared_ptr<ParallelDownloadState> state)
+    {
+      while (true)
+      {
+        int64_t chunkId;
+        std::vector<uint8_t>* buffer;
+        {
+          std::lock_guard<std::mutex> guard(state->Mutex);
+          if (!state->CanDownloadChunk())
+          {
+            --state->NumDownloadTasks;
+            state->ChunkDownloaded.notify_all();
+            return;
+          }
+          chunkId = state->NextChunkId++;
+          buffer = &state->Buffers[static_cast<size_t>(chunkId % state->NumBuffers)];
+        }
+
+        try
+        {
+          const int64_t chunkOffset = state->ChunkSize * chunkId;
+          const size_t chunkLength
+              = static_cast<size_t>((std::min)(state->Length - chunkOffset, state->ChunkSize));
+          buffer->resize(chunkLength);
+          auto stream = state->ChunkDownloader(
+              state->Offset + chunkOffset,
+              static_cast<int64_t>(chunkLength),
+              state->DownloadContext);
+          if (stream->ReadToCount(buffer->data(), chunkLength, state->DownloadContext)
+              != chunkLength)
+          {
+            throw Azure::Core::RequestFailedException("Error when reading body stream.");
+          }
+          if (state->Crc64)
+          {
+            state->Crc64->Append(chunkId + 1, buffer->data(), chunkLength);
+          }
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> guard(state->Mutex);
+          if (!state->Error)
+          {
+            state->Error = std::current_exception();
+          }
+          --state->NumDownloadTasks;
+          state->ChunkDownloaded.notify_all();
+          return;
+        }
+
+        std::lock_guard<std::mutex> guard(state->Mutex);
+        state->IsChunkDownloaded[static_cast<size_t>(chunkId % state->NumBuffers)] = true;
+        state->ChunkDownloaded.notify_all();
+      }
+    }
+  } // namespace _detail
+
+  ParallelDownloadStream::ParallelDownloadStream(
+      std::unique_ptr<Azure::Core::IO::BodyStream> firstChunk,
+      int64_t firstChunkLength,
+      int64_t offset,
+      int64_t length,
+      ChunkDownloader chunkDownloader,
+      const ParallelDownloadStreamOptions& options,
+      std::shared_ptr<ThreadPool> threadPool,
+      const Azure::Core::Context& context)
+      : m_firstChunk(std::move(firstChunk)), m_firstChunkRemaining(firstChunkLength),
+        m_length(firstChunkLength + length),
+        m_state(std::make_shared<_detail::ParallelDownloadState>()),
+        m_threadPool(std::move(threadPool))
+  {
+    const int64_t chunkSize = (std::max)(options.ChunkSize, int64_t(1));
+    m_state->ChunkDownloader = std::move(chunkDownloader);
+    m_state->DownloadContext = context.WithDeadline((Azure::DateTime::max)());
+    m_state->Offset = offset;
+    m_state->Length = length;
+    m_state->ChunkSize = chunkSize;
+    m_state->NumChunks = (length + chunkSize - 1) / chunkSize;
+    m_state->NumBuffers = (std::min)(
+        (std::max)(options.MaxBufferedBytes / chunkSize, int64_t(1)), m_state->NumChunks);
+    m_state->Concurrency = (std::max)(options.Concurrency, 1);
+    m_state->Buffers.resize(static_cast<size_t>(m_state->NumBuffers));
+    m_state->IsChunkDownloaded.resize(static_cast<size_t>(m_state->NumBuffers), false);
+    if (options.ComputeCrc64)
+    {
+      m_state->Crc64 = std::make_unique<ChunkedCrc64Hash>(m_state->NumChunks + 1);
+    }
+
+    if (m_state->NumChunks > 0)
+    {
+      if (!m_threadPool)
+      {
+        m_threadPool = ThreadPool::GetShared();
+      }
+      std::lock_guard<std::mutex> guard(m_state->Mutex);
+      StartDownloads();
+    }
+  }
+
+  ParallelDownloadStream::~ParallelDownloadStream()
+  {
+    // The chunks being downloaded are cancelled, and the stream waits for them so that the chunk
+    // downloader isn't used or destroyed by a thread of the pool once the stream is destroyed.
+    m_state->DownloadContext.Cancel();
+    ChunkDownloader chunkDownloader;
+    {
+      std::unique_lock<std::mutex> guard(m_state->Mutex);
+      m_state->IsClosed = true;
+      m_state->ChunkDownloaded.wait(guard, [this]() { return m_state->NumDownloadTasks == 0; });
+      chunkDownloader = std::move(m_state->ChunkDownloader);
+    }
+  }
+
+  // Called with the state locked.
+  void ParallelDownloadStream::StartDownloads()
+  {
+    const int64_t numChunksToStart
+        = (std::min)(m_state->NumChunks, m_state->ReadChunkId + m_state->NumBuffers)
+        - m_state->NextChunkId;
+    while (m_state->CanDownloadChunk() && m_state->NumDownloadTasks < m_state->Concurrency
+           && m_state->NumDownloadTasks < numChunksToStart)
+    {
+      ++m_state->NumDownloadTasks;
+      auto state = m_state;
+      m_threadPool->Submit([state]() { _detail::DownloadChunks(state); });
+    }
+  }
+
+  std::vector<uint8_t> ParallelDownloadStream::FinalCrc64() const
+  {
+    return m_state->Crc64->Final();
+  }
+
+  size_t ParallelDownloadStream::OnRead(
+      uint8_t* buffer,
+      size_t count,
+      const Azure::Core::Context& context)
+  {
+    if (m_firstChunkRemaining > 0)
+    {
+      const size_t bytesRead = m_firstChunk->Read(
+          buffer,
+          static_cast<size_t>((std::min)(static_cast<int64_t>(count), m_firstChunkRemaining)),
+          context);
+      if (bytesRead == 0)
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
+      }
+      if (m_state->Crc64)
+      {
+        m_state->Crc64->Append(0, buffer, bytesRead);
+      }
+      m_firstChunkRemaining -= static_cast<int64_t>(bytesRead);
+      if (m_firstChunkRemaining == 0)
+      {
+        m_firstChunk.reset();
+      }
+      return bytesRead;
+    }
+
+    std::unique_lock<std::mutex> guard(m_state->Mutex);
+    if (m_state->ReadChunkId == m_state->NumChunks)
+    {
+      return 0;
+    }
+    const size_t bufferIndex = static_cast<size_t>(m_state->ReadChunkId % m_state->NumBuffers);
+    while (!m_state->IsChunkDownloaded[bufferIndex])
+    {
+      if (m_state->Error)
+      {
+        std::rethrow_exception(m_state->Error);
+      }
+      context.ThrowIfCancelled();
+      m_state->ChunkDownloaded.wait_for(guard, _detail::ChunkWaitInterval);
+    }
+    const std::vector<uint8_t>& chunk = m_state->Buffers[bufferIndex];
+    guard.unlock();
+
+    const size_t bytesRead = (std::min)(count, chunk.size() - m_chunkReadOffset);
+    std::memcpy(buffer, chunk.data() + m_chunkReadOffset, bytesRead);
+    m_chunkReadOffset += bytesRead;
+    if (m_chunkReadOffset == chunk.size())
+    {
+      m_chunkReadOffset = 0;
+      guard.lock();
+      m_state->IsChunkDownloaded[bufferIndex] = false;
+      ++m_state->ReadChunkId;
+      StartDownloads();
+    }
+    return bytesRead;
+  }
+
+}}} // namespace Azure::Storage::_internal
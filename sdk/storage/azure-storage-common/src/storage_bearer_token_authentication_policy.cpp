@@ -25,6 +25,23 @@ namespace Azure { namespace Storage { namespace _internal {
     return nextPolicy.Send(request, context);
   }
 
+  std::future<std::unique_ptr<Azure::Core::Http::RawResponse>>
+  StorageBearerTokenAuthenticationPolicy::AuthorizeAndSendRequestAsync(
+      Azure::Core::Http::Request& request,
+      Azure::Core::Http::Policies::NextHttpPolicy& nextPolicy,
+      Azure::Core::Context const& context) const
+  {
+    std::string tenantId = m_safeTenantId.Get();
+    if (!tenantId.empty() || !m_enableTenantDiscovery)
+    {
+      Azure::Core::Credentials::TokenRequestContext tokenRequestContext;
+      tokenRequestContext.Scopes = m_scopes;
+      tokenRequestContext.TenantId = tenantId;
+      AuthenticateAndAuthorizeRequest(request, tokenRequestContext, context);
+    }
+    return nextPolicy.SendAsync(request, context);
+  }
+
   bool StorageBearerTokenAuthenticationPolicy::AuthorizeRequestOnChallenge(
       std::string const& challenge,
       Azure::Core::Http ::Request& request,
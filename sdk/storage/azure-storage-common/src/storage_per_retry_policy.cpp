@@ -14,12 +14,11 @@
 
 namespace Azure { namespace Storage { namespace _internal {
 
-  std::unique_ptr<Core::Http::RawResponse> StoragePerRetryPolicy::Send(
+  void StoragePerRetryPolicy::PrepareRequest(
       Core::Http::Request& request,
-      Core::Http::Policies::NextHttpPolicy nextPolicy,
       Core::Context const& context) const
   {
-    const auto& headers = request.GetHeaders();
+    const auto headers = request.GetHeadersView();
     if (headers.find(HttpHeaderDate) == headers.end())
     {
       // add x-ms-date header in RFC1123 format
@@ -53,8 +52,24 @@ namespace Azure { namespace Storage { namespace _internal {
         request.SetHeader(HttpHeaderClientRequestId, client_request_id);
       }
     }
+  }
 
+  std::unique_ptr<Core::Http::RawResponse> StoragePerRetryPolicy::Send(
+      Core::Http::Request& request,
+      Core::Http::Policies::NextHttpPolicy nextPolicy,
+      Core::Context const& context) const
+  {
+    PrepareRequest(request, context);
     return nextPolicy.Send(request, context);
   }
 
+  std::future<std::unique_ptr<Core::Http::RawResponse>> StoragePerRetryPolicy::SendAsync(
+      Core::Http::Request& request,
+      Core::Http::Policies::NextHttpPolicy nextPolicy,
+      Core::Context const& context) const
+  {
+    PrepareRequest(request, context);
+    return nextPolicy.SendAsync(request, context);
+  }
+
 }}} // namespace Azure::Storage::_internal
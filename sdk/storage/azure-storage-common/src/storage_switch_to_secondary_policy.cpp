@@ -3,16 +3,17 @@
 
 #include <azure/storage/common/internal/storage_switch_to_secondary_policy.hpp>
 
+#include <future>
+
 namespace Azure { namespace Storage { namespace _internal {
 
   Azure::Core::Context::Key const SecondaryHostReplicaStatusKey;
 
-  std::unique_ptr<Azure::Core::Http::RawResponse> StorageSwitchToSecondaryPolicy::Send(
+  bool StorageSwitchToSecondaryPolicy::PrepareRequest(
       Azure::Core::Http::Request& request,
-      Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
-      const Azure::Core::Context& context) const
+      const Azure::Core::Context& context,
+      std::shared_ptr<bool>& replicaStatus) const
   {
-    std::shared_ptr<bool> replicaStatus;
     context.TryGetValue(SecondaryHostReplicaStatusKey, replicaStatus);
 
     bool considerSecondary = (request.GetMethod() == Azure::Core::Http::HttpMethod::Get
@@ -32,21 +33,74 @@ namespace Azure { namespace Storage { namespace _internal {
         request.GetUrl().SetHost(m_primaryHost);
       }
     }
+    return considerSecondary;
+  }
 
-    auto response = nextPolicy.Send(request, context);
-
+  bool StorageSwitchToSecondaryPolicy::SwitchBackToPrimary(
+      Azure::Core::Http::Request& request,
+      const Azure::Core::Http::RawResponse& response,
+      bool considerSecondary,
+      const std::shared_ptr<bool>& replicaStatus) const
+  {
     if (considerSecondary
-        && (response->GetStatusCode() == Azure::Core::Http::HttpStatusCode::NotFound
-            || response->GetStatusCode() == Core::Http::HttpStatusCode::PreconditionFailed)
+        && (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::NotFound
+            || response.GetStatusCode() == Core::Http::HttpStatusCode::PreconditionFailed)
         && request.GetUrl().GetHost() == m_secondaryHost)
     {
       *replicaStatus = false;
       // switch back
       request.GetUrl().SetHost(m_primaryHost);
+      return true;
+    }
+    return false;
+  }
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> StorageSwitchToSecondaryPolicy::Send(
+      Azure::Core::Http::Request& request,
+      Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+      const Azure::Core::Context& context) const
+  {
+    std::shared_ptr<bool> replicaStatus;
+    bool considerSecondary = PrepareRequest(request, context, replicaStatus);
+
+    auto response = nextPolicy.Send(request, context);
+
+    if (SwitchBackToPrimary(request, *response, considerSecondary, replicaStatus))
+    {
       response = nextPolicy.Send(request, context);
     }
 
     return response;
   }
 
+  std::future<std::unique_ptr<Azure::Core::Http::RawResponse>>
+  StorageSwitchToSecondaryPolicy::SendAsync(
+      Azure::Core::Http::Request& request,
+      Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+      const Azure::Core::Context& context) const
+  {
+    std::shared_ptr<bool> replicaStatus;
+    bool considerSecondary = PrepareRequest(request, context, replicaStatus);
+
+    auto pendingResponse = nextPolicy.SendAsync(request, context);
+
+    // The request is sent to the primary host again by the thread waiting for the future.
+    return std::async(
+        std::launch::deferred,
+        [this,
+         &request,
+         nextPolicy,
+         context,
+         considerSecondary,
+         replicaStatus,
+         pendingResponse = std::move(pendingResponse)]() mutable {
+          auto response = pendingResponse.get();
+          if (SwitchBackToPrimary(request, *response, considerSecondary, replicaStatus))
+          {
+            response = nextPolicy.Send(request, context);
+          }
+          return response;
+        });
+  }
+
 }}} // namespace Azure::Storage::_internal
@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/internal/thread_pool.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+    // The pool and the queue owned by the current thread, if it belongs to a pool.
+    thread_local ThreadPool* CurrentPool = nullptr;
+    thread_local size_t CurrentQueue = 0;
+  } // namespace
+
+  ThreadPool::ThreadPool(size_t threadCount)
+  {
+    if (threadCount == 0)
+    {
+      threadCount = DefaultThreadCount();
+    }
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+      m_queues.emplace_back(std::make_unique<TaskQueue>());
+    }
+  }
+
+  ThreadPool::~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_stopRequested = true;
+    }
+    m_taskAvailable.notify_all();
+    for (auto& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  void ThreadPool::Submit(std::function<void()> task)
+  {
+    std::call_once(m_startThreads, [this]() {
+      m_threads.reserve(m_queues.size());
+      for (size_t i = 0; i < m_queues.size(); ++i)
+      {
+        m_threads.emplace_back([this, i]() { Run(i); });
+      }
+    });
+    const size_t index
+        = CurrentPool == this ? CurrentQueue : m_nextQueue.fetch_add(1) % m_queues.size();
+    {
+      std::lock_guard<std::mutex> guard(m_queues[index]->Mutex);
+      m_queues[index]->Tasks.emplace_back(std::move(task));
+    }
+    ++m_queuedTaskCount;
+    // An idle thread counts itself before checking m_queuedTaskCount under m_mutex, so either it
+    // sees the task, or it is counted here and waits on m_mutex until it is notified.
+    if (m_idleThreadCount != 0)
+    {
+      {
+        std::lock_guard<std::mutex> guard(m_mutex);
+      }
+      m_taskAvailable.notify_one();
+    }
+  }
+
+  bool ThreadPool::HasQueuedTasks() { return m_queuedTaskCount != 0; }
+
+  bool ThreadPool::TryClaimTask()
+  {
+    size_t count = m_queuedTaskCount;
+    while (count != 0)
+    {
+      if (m_queuedTaskCount.compare_exchange_weak(count, count - 1))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ThreadPool::TryTakeTask(size_t index, std::function<void()>& task)
+  {
+    {
+      auto& queue = *m_queues[index];
+      std::lock_guard<std::mutex> guard(queue.Mutex);
+      if (!queue.Tasks.empty())
+      {
+        task = std::move(queue.Tasks.front());
+        queue.Tasks.pop_front();
+        return true;
+      }
+    }
+    for (size_t i = 1; i < m_queues.size(); ++i)
+    {
+      auto& queue = *m_queues[(index + i) % m_queues.size()];
+      std::lock_guard<std::mutex> guard(queue.Mutex);
+      if (!queue.Tasks.empty())
+      {
+        task = std::move(queue.Tasks.back());
+        queue.Tasks.pop_back();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void ThreadPool::Run(size_t index)
+  {
+    CurrentPool = this;
+    CurrentQueue = index;
+    while (!m_stopRequested)
+    {
+      if (!TryClaimTask())
+      {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        ++m_idleThreadCount;
+        m_taskAvailable.wait(
+            guard, [this]() { return m_stopRequested || m_queuedTaskCount != 0; });
+        --m_idleThreadCount;
+        continue;
+      }
+      // Every thread taking a task has claimed one, so the queues hold at least as many tasks as
+      // the threads looking for one. A task queued behind this thread's scan is found by the next
+      // scan.
+      std::function<void()> task;
+      while (!TryTakeTask(index, task))
+      {
+      }
+      task();
+    }
+  }
+
+  size_t ThreadPool::DefaultThreadCount()
+  {
+    return (std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(8));
+  }
+
+  std::shared_ptr<ThreadPool> ThreadPool::GetShared(int32_t threadCount)
+  {
+    const size_t size = threadCount > 0 ? static_cast<size_t>(threadCount) : DefaultThreadCount();
+
+    static std::mutex sharedPoolsMutex;
+    static std::map<size_t, std::weak_ptr<ThreadPool>> sharedPools;
+
+    std::lock_guard<std::mutex> guard(sharedPoolsMutex);
+    auto& sharedPool = sharedPools[size];
+    auto pool = sharedPool.lock();
+    if (!pool)
+    {
+      pool = std::make_shared<ThreadPool>(size);
+      sharedPool = pool;
+    }
+    return pool;
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -0,0 +1,687 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/internal/xml_scanner.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// Text is searched for its delimiters 16 bytes at a time with SSE2, which every x86-64 CPU has.
+// Elsewhere memchr, which the C libraries vectorize, is used instead.
+#if defined(__x86_64__) || defined(_M_X64)
+#define AZ_STORAGE_XML_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+    constexpr size_t MinBufferSize = 64 * 1024;
+
+    [[noreturn]] void ThrowParseError() { throw std::runtime_error("Failed to parse xml."); }
+
+    bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    bool IsNameEnd(char c) { return IsBlank(c) || c == '>' || c == '/' || c == '='; }
+
+    bool IsBlank(const char* begin, const char* end)
+    {
+      return std::all_of(begin, end, [](char c) { return IsBlank(c); });
+    }
+
+#if defined(AZ_STORAGE_XML_SSE2)
+    int CountTrailingZeros(int mask)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+      unsigned long index;
+      _BitScanForward(&index, static_cast<unsigned long>(mask));
+      return static_cast<int>(index);
+#else
+      return __builtin_ctz(static_cast<unsigned int>(mask));
+#endif
+    }
+#endif
+
+    // Returns the first '<' in [begin, end), or end. needsDecoding is set if the text before it
+    // contains an entity reference or a carriage return.
+    const char* FindTextEnd(const char* begin, const char* end, bool& needsDecoding)
+    {
+      const char* p = begin;
+#if defined(AZ_STORAGE_XML_SSE2)
+      const __m128i lessThan = _mm_set1_epi8('<');
+      const __m128i ampersand = _mm_set1_epi8('&');
+      const __m128i carriageReturn = _mm_set1_epi8('\r');
+      for (; end - p >= 16; p += 16)
+      {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const int lessThanMask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, lessThan));
+        const int decodeMask = _mm_movemask_epi8(_mm_or_si128(
+            _mm_cmpeq_epi8(chunk, ampersand), _mm_cmpeq_epi8(chunk, carriageReturn)));
+        if (lessThanMask != 0)
+        {
+          const int index = CountTrailingZeros(lessThanMask);
+          if ((decodeMask & ((1 << index) - 1)) != 0)
+          {
+            needsDecoding = true;
+          }
+          return p + index;
+        }
+        if (decodeMask != 0)
+        {
+          needsDecoding = true;
+        }
+      }
+#endif
+      auto found = static_cast<const char*>(std::memchr(p, '<', static_cast<size_t>(end - p)));
+      const char* textEnd = found ? found : end;
+      if (!needsDecoding
+          && (std::memchr(p, '&', static_cast<size_t>(textEnd - p))
+              || std::memchr(p, '\r', static_cast<size_t>(textEnd - p))))
+      {
+        needsDecoding = true;
+      }
+      return textEnd;
+    }
+
+    const char* Find(const char* begin, const char* end, const char* pattern, size_t length)
+    {
+      auto found = std::search(begin, end, pattern, pattern + length);
+      return found == end ? nullptr : found;
+    }
+
+    void AppendUtf8(std::string& out, uint32_t codePoint)
+    {
+      if (codePoint == 0 || codePoint > 0x10ffff || (codePoint >= 0xd800 && codePoint <= 0xdfff))
+      {
+        ThrowParseError();
+      }
+      if (codePoint < 0x80)
+      {
+        out += static_cast<char>(codePoint);
+      }
+      else if (codePoint < 0x800)
+      {
+        out += static_cast<char>(0xc0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3f));
+      }
+      else if (codePoint < 0x10000)
+      {
+        out += static_cast<char>(0xe0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+        out += static_cast<char>(0x80 | (codePoint & 0x3f));
+      }
+      else
+      {
+        out += static_cast<char>(0xf0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+        out += static_cast<char>(0x80 | (codePoint & 0x3f));
+      }
+    }
+
+    // Decodes the reference between '&' and ';'.
+    void AppendReference(std::string& out, const char* begin, const char* end)
+    {
+      const size_t length = static_cast<size_t>(end - begin);
+      if (length >= 2 && begin[0] == '#')
+      {
+        const bool hex = begin[1] == 'x';
+        const char* digits = begin + (hex ? 2 : 1);
+        if (digits == end)
+        {
+          ThrowParseError();
+        }
+        uint32_t codePoint = 0;
+        for (const char* p = digits; p != end; ++p)
+        {
+          uint32_t digit;
+          if (*p >= '0' && *p <= '9')
+          {
+            digit = static_cast<uint32_t>(*p - '0');
+          }
+          else if (hex && *p >= 'a' && *p <= 'f')
+          {
+            digit = static_cast<uint32_t>(*p - 'a' + 10);
+          }
+          else if (hex && *p >= 'A' && *p <= 'F')
+          {
+            digit = static_cast<uint32_t>(*p - 'A' + 10);
+          }
+          else
+          {
+            ThrowParseError();
+          }
+          codePoint = codePoint * (hex ? 16 : 10) + digit;
+          if (codePoint > 0x10ffff)
+          {
+            ThrowParseError();
+          }
+        }
+        AppendUtf8(out, codePoint);
+      }
+      else if (length == 2 && std::memcmp(begin, "lt", 2) == 0)
+      {
+        out += '<';
+      }
+      else if (length == 2 && std::memcmp(begin, "gt", 2) == 0)
+      {
+        out += '>';
+      }
+      else if (length == 3 && std::memcmp(begin, "amp", 3) == 0)
+      {
+        out += '&';
+      }
+      else if (length == 4 && std::memcmp(begin, "quot", 4) == 0)
+      {
+        out += '"';
+      }
+      else if (length == 4 && std::memcmp(begin, "apos", 4) == 0)
+      {
+        out += '\'';
+      }
+      else
+      {
+        ThrowParseError();
+      }
+    }
+  } // namespace
+
+  XmlScanner::XmlScanner(const char* data, size_t length) : m_data(data), m_length(length) {}
+
+  XmlScanner::XmlScanner(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context)
+      : m_stream(&stream), m_context(context), m_endOfStream(false)
+  {
+  }
+
+  bool XmlScanner::FillBuffer()
+  {
+    if (m_endOfStream)
+    {
+      return false;
+    }
+
+    // The bytes already scanned are discarded. The buffer grows only when a single node doesn't
+    // fit in it.
+    const size_t remaining = m_length - m_position;
+    if (m_position != 0 && remaining != 0)
+    {
+      std::memmove(m_buffer.data(), m_buffer.data() + m_position, remaining);
+    }
+    m_position = 0;
+    m_length = remaining;
+    if (m_buffer.size() - m_length < m_buffer.size() / 2 || m_buffer.empty())
+    {
+      m_buffer.resize((std::max)(MinBufferSize, m_buffer.size() * 2));
+    }
+    m_data = m_buffer.data();
+
+    const size_t bytesRead = m_stream->Read(
+        reinterpret_cast<uint8_t*>(m_buffer.data() + m_length),
+        m_buffer.size() - m_length,
+        m_context);
+    if (bytesRead == 0)
+    {
+      m_endOfStream = true;
+      return false;
+    }
+    m_length += bytesRead;
+    return true;
+  }
+
+  XmlToken XmlScanner::Scan()
+  {
+    XmlToken token;
+    if (m_nextAttribute < m_attributes.size())
+    {
+      const auto& attribute = m_attributes[m_nextAttribute++];
+      token.Type = XmlNodeType::Attribute;
+      token.Name = m_data + attribute.NameOffset;
+      token.NameLength = attribute.NameLength;
+      token.Value = m_data + attribute.ValueOffset;
+      token.ValueLength = attribute.ValueLength;
+      token.HasValue = true;
+      token.NeedsDecoding = attribute.NeedsDecoding;
+      return token;
+    }
+    if (m_pendingEndTag)
+    {
+      m_pendingEndTag = false;
+      token.Type = XmlNodeType::EndTag;
+      return token;
+    }
+    m_attributes.clear();
+    m_nextAttribute = 0;
+
+    while (true)
+    {
+      if (m_position == m_length)
+      {
+        if (FillBuffer())
+        {
+          continue;
+        }
+        if (!m_rootSeen || !m_openElementOffsets.empty())
+        {
+          ThrowParseError();
+        }
+        token.Type = XmlNodeType::End;
+        return token;
+      }
+      if (!m_byteOrderMarkChecked)
+      {
+        if (m_length - m_position < 3 && !m_endOfStream)
+        {
+          FillBuffer();
+          continue;
+        }
+        if (m_length - m_position >= 3
+            && std::memcmp(m_data + m_position, "\xef\xbb\xbf", 3) == 0)
+        {
+          m_position += 3;
+        }
+        m_byteOrderMarkChecked = true;
+        continue;
+      }
+
+      const ScanResult result
+          = m_data[m_position] == '<' ? ScanMarkup(token) : ScanText(token);
+      if (result == ScanResult::Token)
+      {
+        return token;
+      }
+      if (result == ScanResult::NeedMoreData)
+      {
+        // A node is scanned again from its start, so read at least as much again as is buffered
+        // for it, or a long node arriving in small reads would be scanned in quadratic time.
+        const size_t buffered = m_length - m_position;
+        while (FillBuffer() && m_length - m_position < buffered * 2)
+        {
+        }
+      }
+    }
+  }
+
+  XmlScanner::ScanResult XmlScanner::ScanText(XmlToken& token)
+  {
+    const char* begin = m_data + m_position;
+    const char* end = m_data + m_length;
+    bool needsDecoding = false;
+    const char* textEnd = FindTextEnd(begin, end, needsDecoding);
+    if (textEnd == end && !m_endOfStream)
+    {
+      return ScanResult::NeedMoreData;
+    }
+    m_position = static_cast<size_t>(textEnd - m_data);
+
+    // Blank text is ignorable whitespace between elements, and only blanks are allowed outside
+    // the root element.
+    if (IsBlank(begin, textEnd))
+    {
+      return ScanResult::Skipped;
+    }
+    if (m_openElementOffsets.empty())
+    {
+      ThrowParseError();
+    }
+    token.Type = XmlNodeType::Text;
+    token.Value = begin;
+    token.ValueLength = static_cast<size_t>(textEnd - begin);
+    token.HasValue = true;
+    token.NeedsDecoding = needsDecoding;
+    return ScanResult::Token;
+  }
+
+  XmlScanner::ScanResult XmlScanner::SkipUntil(
+      size_t from,
+      const char* terminator,
+      size_t terminatorLength)
+  {
+    const char* found = Find(m_data + from, m_data + m_length, terminator, terminatorLength);
+    if (!found)
+    {
+      if (!m_endOfStream)
+      {
+        return ScanResult::NeedMoreData;
+      }
+      ThrowParseError();
+    }
+    m_position = static_cast<size_t>(found - m_data) + terminatorLength;
+    return ScanResult::Skipped;
+  }
+
+  XmlScanner::ScanResult XmlScanner::ScanMarkup(XmlToken& token)
+  {
+    const char* begin = m_data + m_position;
+    const size_t available = m_length - m_position;
+    auto startsWith = [&](const char* prefix, size_t length) {
+      return available >= length && std::memcmp(begin, prefix, length) == 0;
+    };
+    // Enough to tell the kinds of markup apart.
+    if (available < 9 && !m_endOfStream)
+    {
+      return ScanResult::NeedMoreData;
+    }
+
+    if (startsWith("</", 2))
+    {
+      return ScanEndTag(token);
+    }
+    if (startsWith("<?", 2))
+    {
+      const size_t start = m_position;
+      const ScanResult result = SkipUntil(m_position + 2, "?>", 2);
+      if (result == ScanResult::Skipped && startsWith("<?xml", 5))
+      {
+        // Only UTF-8 documents are supported.
+        const char* declarationEnd = m_data + m_position;
+        const char* encoding = Find(m_data + start, declarationEnd, "encoding", 8);
+        if (encoding)
+        {
+          const char* quote = std::find_if(
+              encoding, declarationEnd, [](char c) { return c == '"' || c == '\''; });
+          const char* name = quote + 1;
+          if (quote == declarationEnd
+              || !((declarationEnd - name > 5) && (name[0] == 'u' || name[0] == 'U')
+                   && (name[1] == 't' || name[1] == 'T') && (name[2] == 'f' || name[2] == 'F')
+                   && name[3] == '-' && name[4] == '8' && name[5] == *quote))
+          {
+            throw std::runtime_error("Unsupported xml encoding.");
+          }
+        }
+      }
+      return result;
+    }
+    if (startsWith("<!--", 4))
+    {
+      return SkipUntil(m_position + 4, "-->", 3);
+    }
+    if (startsWith("<![CDATA[", 9))
+    {
+      const char* contentBegin = begin + 9;
+      const char* found = Find(contentBegin, m_data + m_length, "]]>", 3);
+      if (!found)
+      {
+        if (!m_endOfStream)
+        {
+          return ScanResult::NeedMoreData;
+        }
+        ThrowParseError();
+      }
+      if (m_openElementOffsets.empty())
+      {
+        ThrowParseError();
+      }
+      m_position = static_cast<size_t>(found - m_data) + 3;
+      token.Type = XmlNodeType::Text;
+      token.Value = contentBegin;
+      token.ValueLength = static_cast<size_t>(found - contentBegin);
+      token.HasValue = true;
+      return ScanResult::Token;
+    }
+    if (startsWith("<!", 2))
+    {
+      // Document type declarations aren't supported.
+      ThrowParseError();
+    }
+    return ScanStartTag(token);
+  }
+
+  XmlScanner::ScanResult XmlScanner::ScanStartTag(XmlToken& token)
+  {
+    auto incomplete = [this]() {
+      m_attributes.clear();
+      if (m_endOfStream)
+      {
+        ThrowParseError();
+      }
+      return ScanResult::NeedMoreData;
+    };
+
+    size_t p = m_position + 1;
+    const size_t nameOffset = p;
+    while (p < m_length && !IsNameEnd(m_data[p]))
+    {
+      ++p;
+    }
+    if (p == m_length)
+    {
+      return incomplete();
+    }
+    const size_t nameLength = p - nameOffset;
+    if (nameLength == 0)
+    {
+      ThrowParseError();
+    }
+
+    bool isEmpty = false;
+    while (true)
+    {
+      const size_t separatorOffset = p;
+      while (p < m_length && IsBlank(m_data[p]))
+      {
+        ++p;
+      }
+      if (p == m_length)
+      {
+        return incomplete();
+      }
+      if (m_data[p] == '>')
+      {
+        ++p;
+        break;
+      }
+      if (m_data[p] == '/')
+      {
+        if (p + 1 == m_length)
+        {
+          return incomplete();
+        }
+        if (m_data[p + 1] != '>')
+        {
+          ThrowParseError();
+        }
+        p += 2;
+        isEmpty = true;
+        break;
+      }
+      if (p == separatorOffset)
+      {
+        // Attributes must be separated by blanks.
+        ThrowParseError();
+      }
+
+      Attribute attribute;
+      attribute.NameOffset = p;
+      while (p < m_length && !IsNameEnd(m_data[p]))
+      {
+        ++p;
+      }
+      attribute.NameLength = p - attribute.NameOffset;
+      while (p < m_length && IsBlank(m_data[p]))
+      {
+        ++p;
+      }
+      if (p == m_length)
+      {
+        return incomplete();
+      }
+      if (attribute.NameLength == 0 || m_data[p] != '=')
+      {
+        ThrowParseError();
+      }
+      ++p;
+      while (p < m_length && IsBlank(m_data[p]))
+      {
+        ++p;
+      }
+      if (p == m_length)
+      {
+        return incomplete();
+      }
+      const char quote = m_data[p];
+      if (quote != '"' && quote != '\'')
+      {
+        ThrowParseError();
+      }
+      const char* valueBegin = m_data + p + 1;
+      const char* valueEnd = static_cast<const char*>(
+          std::memchr(valueBegin, quote, static_cast<size_t>(m_data + m_length - valueBegin)));
+      if (!valueEnd)
+      {
+        return incomplete();
+      }
+      const size_t valueLength = static_cast<size_t>(valueEnd - valueBegin);
+      if (std::memchr(valueBegin, '<', valueLength))
+      {
+        ThrowParseError();
+      }
+      attribute.ValueOffset = static_cast<size_t>(valueBegin - m_data);
+      attribute.ValueLength = valueLength;
+      attribute.NeedsDecoding = std::any_of(valueBegin, valueEnd, [](char c) {
+        return c == '&' || c == '\r' || c == '\n' || c == '\t';
+      });
+      m_attributes.push_back(attribute);
+      p = static_cast<size_t>(valueEnd - m_data) + 1;
+    }
+    // Namespace declarations are reported first, like XmlReader does.
+    std::stable_partition(m_attributes.begin(), m_attributes.end(), [this](const Attribute& a) {
+      return a.NameLength >= 5 && std::memcmp(m_data + a.NameOffset, "xmlns", 5) == 0
+          && (a.NameLength == 5 || m_data[a.NameOffset + 5] == ':');
+    });
+
+    if (m_openElementOffsets.empty())
+    {
+      if (m_rootSeen)
+      {
+        ThrowParseError();
+      }
+      m_rootSeen = true;
+    }
+    if (isEmpty)
+    {
+      m_pendingEndTag = true;
+    }
+    else
+    {
+      m_openElementOffsets.push_back(m_openElements.size());
+      m_openElements.append(m_data + nameOffset, nameLength);
+    }
+    m_position = p;
+
+    token.Type = XmlNodeType::StartTag;
+    token.Name = m_data + nameOffset;
+    token.NameLength = nameLength;
+    return ScanResult::Token;
+  }
+
+  XmlScanner::ScanResult XmlScanner::ScanEndTag(XmlToken& token)
+  {
+    size_t p = m_position + 2;
+    const size_t nameOffset = p;
+    while (p < m_length && !IsNameEnd(m_data[p]))
+    {
+      ++p;
+    }
+    const size_t nameLength = p - nameOffset;
+    while (p < m_length && IsBlank(m_data[p]))
+    {
+      ++p;
+    }
+    if (p == m_length)
+    {
+      if (!m_endOfStream)
+      {
+        return ScanResult::NeedMoreData;
+      }
+      ThrowParseError();
+    }
+    if (m_data[p] != '>' || m_openElementOffsets.empty())
+    {
+      ThrowParseError();
+    }
+    const size_t openOffset = m_openElementOffsets.back();
+    if (m_openElements.size() - openOffset != nameLength
+        || m_openElements.compare(openOffset, nameLength, m_data + nameOffset, nameLength) != 0)
+    {
+      ThrowParseError();
+    }
+    m_openElements.resize(openOffset);
+    m_openElementOffsets.pop_back();
+    m_position = p + 1;
+
+    token.Type = XmlNodeType::EndTag;
+    return ScanResult::Token;
+  }
+
+  XmlNode XmlScanner::Read()
+  {
+    const XmlToken token = Scan();
+    switch (token.Type)
+    {
+      case XmlNodeType::StartTag:
+        return XmlNode{XmlNodeType::StartTag, std::string(token.Name, token.NameLength)};
+      case XmlNodeType::Text:
+        return XmlNode{
+            XmlNodeType::Text,
+            std::string(),
+            token.NeedsDecoding ? DecodeValue(token)
+                                : std::string(token.Value, token.ValueLength)};
+      case XmlNodeType::Attribute:
+        return XmlNode{
+            XmlNodeType::Attribute,
+            std::string(token.Name, token.NameLength),
+            token.NeedsDecoding ? DecodeValue(token)
+                                : std::string(token.Value, token.ValueLength)};
+      default:
+        return XmlNode{token.Type};
+    }
+  }
+
+  std::string XmlScanner::DecodeValue(const XmlToken& token)
+  {
+    // Line breaks are normalized to line feeds, and blanks in attribute values to spaces. Blanks
+    // from character references are kept.
+    const bool isAttribute = token.Type == XmlNodeType::Attribute;
+    const char* p = token.Value;
+    const char* end = token.Value + token.ValueLength;
+    std::string value;
+    value.reserve(token.ValueLength);
+    while (p != end)
+    {
+      const char c = *p++;
+      if (c == '&')
+      {
+        const char* semicolon
+            = static_cast<const char*>(std::memchr(p, ';', static_cast<size_t>(end - p)));
+        if (!semicolon)
+        {
+          ThrowParseError();
+        }
+        AppendReference(value, p, semicolon);
+        p = semicolon + 1;
+      }
+      else if (c == '\r')
+      {
+        if (p != end && *p == '\n')
+        {
+          ++p;
+        }
+        value += isAttribute ? ' ' : '\n';
+      }
+      else if (isAttribute && (c == '\n' || c == '\t'))
+      {
+        value += ' ';
+      }
+      else
+      {
+        value += c;
+      }
+    }
+    return value;
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -3,13 +3,17 @@
 
 #include "azure/storage/common/internal/xml_wrapper.hpp"
 
+#include "azure/storage/common/internal/xml_scanner.hpp"
+
 #include <azure/core/platform.hpp>
 
 #include <cstring>
+#include <exception>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <vector>
 
 #if defined(AZ_PLATFORM_WINDOWS)
 #if !defined(WIN32_LEAN_AND_MEAN)
@@ -30,11 +34,45 @@
 
 namespace Azure { namespace Storage { namespace _internal {
 
+#if defined(AZ_STORAGE_BUILTIN_XML_READER)
+
+  struct XmlReader::XmlReaderContext
+  {
+    explicit XmlReaderContext(XmlScanner&& scanner_) : scanner(std::move(scanner_)) {}
+
+    XmlScanner scanner;
+  };
+
+  XmlReader::XmlReader(const char* data, size_t length)
+      : m_context(std::make_unique<XmlReaderContext>(XmlScanner(data, length)))
+  {
+  }
+
+  XmlReader::XmlReader(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context)
+      : m_context(std::make_unique<XmlReaderContext>(XmlScanner(stream, context)))
+  {
+  }
+
+  XmlReader::XmlReader(XmlReader&& other) noexcept { *this = std::move(other); }
+
+  XmlReader& XmlReader::operator=(XmlReader&& other) noexcept
+  {
+    m_context = std::move(other.m_context);
+    return *this;
+  }
+
+  XmlReader::~XmlReader() = default;
+
+  XmlNode XmlReader::Read() { return m_context->scanner.Read(); }
+
+#endif
+
 #if defined(AZ_PLATFORM_WINDOWS)
 
   void XmlGlobalInitialize() {}
   void XmlGlobalDeinitialize() {}
 
+#if !defined(AZ_STORAGE_BUILTIN_XML_READER)
   struct XmlReader::XmlReaderContext
   {
     XmlReaderContext()
@@ -64,17 +102,20 @@ namespace Azure { namespace Storage { namespace _internal {
     bool readingAttributes = false;
     ULONG attributeIndex = 0;
     const WS_XML_ELEMENT_NODE* attributeElementNode = nullptr;
+    std::vector<uint8_t> buffer;
   };
 
-  XmlReader::XmlReader(const char* data, size_t length)
+  static void SetXmlReaderInput(
+      WS_XML_READER* reader,
+      WS_ERROR* error,
+      const char* data,
+      size_t length)
   {
     if (length > static_cast<size_t>((std::numeric_limits<ULONG>::max)()))
     {
       throw std::runtime_error("Xml data too big.");
     }
 
-    auto context = std::make_unique<XmlReaderContext>();
-
     WS_XML_READER_BUFFER_INPUT bufferInput;
     ZeroMemory(&bufferInput, sizeof(bufferInput));
     bufferInput.input.inputType = WS_XML_READER_INPUT_TYPE_BUFFER;
@@ -84,8 +125,7 @@ namespace Azure { namespace Storage { namespace _internal {
     ZeroMemory(&textEncoding, sizeof(textEncoding));
     textEncoding.encoding.encodingType = WS_XML_READER_ENCODING_TYPE_TEXT;
     textEncoding.charSet = WS_CHARSET_AUTO;
-    HRESULT ret = WsSetInput(
-        context->reader, &textEncoding.encoding, &bufferInput.input, nullptr, 0, context->error);
+    HRESULT ret = WsSetInput(reader, &textEncoding.encoding, &bufferInput.input, nullptr, 0, error);
     if (ret != S_OK)
     {
       throw std::runtime_error("Failed to initialize xml reader.");
@@ -93,7 +133,7 @@ namespace Azure { namespace Storage { namespace _internal {
 
     WS_CHARSET charSet;
     ret = WsGetReaderProperty(
-        context->reader, WS_XML_READER_PROPERTY_CHARSET, &charSet, sizeof(charSet), context->error);
+        reader, WS_XML_READER_PROPERTY_CHARSET, &charSet, sizeof(charSet), error);
     if (ret != S_OK)
     {
       throw std::runtime_error("Failed to get xml encoding.");
@@ -102,10 +142,29 @@ namespace Azure { namespace Storage { namespace _internal {
     {
       throw std::runtime_error("Unsupported xml encoding.");
     }
+  }
 
+  XmlReader::XmlReader(const char* data, size_t length)
+  {
+    auto context = std::make_unique<XmlReaderContext>();
+    SetXmlReaderInput(context->reader, context->error, data, length);
     m_context = std::move(context);
   }
 
+  XmlReader::XmlReader(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context)
+  {
+    // Buffer input is the only input WsReadNode can parse without pumping the reader with
+    // WsFillReader, so the body is read up front here.
+    auto readerContext = std::make_unique<XmlReaderContext>();
+    readerContext->buffer = stream.ReadToEnd(context);
+    SetXmlReaderInput(
+        readerContext->reader,
+        readerContext->error,
+        reinterpret_cast<const char*>(readerContext->buffer.data()),
+        readerContext->buffer.size());
+    m_context = std::move(readerContext);
+  }
+
   XmlReader::~XmlReader() {}
 
   XmlNode XmlReader::Read()
@@ -219,6 +278,7 @@ namespace Azure { namespace Storage { namespace _internal {
             "Unknown type " + std::to_string(node->nodeType) + " while parsing xml.");
     }
   }
+#endif
 
   struct XmlWriter::XmlWriterContext
   {
@@ -396,15 +456,47 @@ namespace Azure { namespace Storage { namespace _internal {
 
   static void XmlGlobalInitialize() { static XmlGlobalInitializer globalInitializer; }
 
+#if !defined(AZ_STORAGE_BUILTIN_XML_READER)
   struct XmlReader::XmlReaderContext
   {
     using XmlTextReaderPtr = std::unique_ptr<xmlTextReader, decltype(&xmlFreeTextReader)>;
 
-    XmlTextReaderPtr reader;
+    XmlTextReaderPtr reader{nullptr, xmlFreeTextReader};
     bool readingAttributes = false;
     bool readingEmptyTag = false;
 
-    explicit XmlReaderContext(XmlTextReaderPtr&& reader_) : reader(std::move(reader_)) {}
+    Azure::Core::IO::BodyStream* stream = nullptr;
+    Azure::Core::Context streamContext;
+    std::exception_ptr streamException;
+
+    static int StreamRead(void* ioContext, char* buffer, int length)
+    {
+      auto context = static_cast<XmlReaderContext*>(ioContext);
+      // Exceptions must not unwind through libxml2, they're rethrown from Read() instead.
+      try
+      {
+        return static_cast<int>(context->stream->Read(
+            reinterpret_cast<uint8_t*>(buffer),
+            static_cast<size_t>(length),
+            context->streamContext));
+      }
+      catch (...)
+      {
+        context->streamException = std::current_exception();
+        return -1;
+      }
+    }
+
+    static int StreamClose(void*) { return 0; }
+
+    void ThrowParseError() const
+    {
+      if (streamException)
+      {
+        std::rethrow_exception(streamException);
+      }
+      throw std::runtime_error("Failed to parse xml.");
+    }
   };
 
   XmlReader::XmlReader(const char* data, size_t length)
@@ -416,15 +508,38 @@ namespace Azure { namespace Storage { namespace _internal {
       throw std::runtime_error("Xml data too big.");
     }
 
-    auto reader = XmlReaderContext::XmlTextReaderPtr(
-        xmlReaderForMemory(data, static_cast<int>(length), nullptr, nullptr, 0), xmlFreeTextReader);
+    auto context = std::make_unique<XmlReaderContext>();
+    context->reader.reset(xmlReaderForMemory(data, static_cast<int>(length), nullptr, nullptr, 0));
 
-    if (!reader)
+    if (!context->reader)
     {
       throw std::runtime_error("Failed to parse xml.");
     }
 
-    m_context = std::make_unique<XmlReaderContext>(std::move(reader));
+    m_context = std::move(context);
+  }
+
+  XmlReader::XmlReader(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context)
+  {
+    XmlGlobalInitialize();
+
+    auto readerContext = std::make_unique<XmlReaderContext>();
+    readerContext->stream = &stream;
+    readerContext->streamContext = context;
+    readerContext->reader.reset(xmlReaderForIO(
+        XmlReaderContext::StreamRead,
+        XmlReaderContext::StreamClose,
+        readerContext.get(),
+        nullptr,
+        nullptr,
+        0));
+
+    if (!readerContext->reader)
+    {
+      readerContext->ThrowParseError();
+    }
+
+    m_context = std::move(readerContext);
   }
 
   XmlReader::XmlReader(XmlReader&& other) noexcept { *this = std::move(other); }
@@ -456,7 +571,7 @@ namespace Azure { namespace Storage { namespace _internal {
       }
       else
       {
-        throw std::runtime_error("Failed to parse xml.");
+        context->ThrowParseError();
       }
     }
     if (context->readingEmptyTag)
@@ -472,7 +587,7 @@ namespace Azure { namespace Storage { namespace _internal {
     }
     if (ret != 1)
     {
-      throw std::runtime_error("Failed to parse xml.");
+      context->ThrowParseError();
     }
 
     int type = xmlTextReaderNodeType(reader);
@@ -519,6 +634,7 @@ namespace Azure { namespace Storage { namespace _internal {
 
     return Read();
   }
+#endif
 
   struct XmlWriter::XmlWriterContext
   {
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(ConcurrentTransferTest, AllChunks)
+  {
+    auto threadPool = std::make_shared<_internal::ThreadPool>(4);
+    EXPECT_EQ(threadPool->ThreadCount(), 4U);
+
+    std::mutex mutex;
+    std::vector<int64_t> chunkOffsets;
+    std::vector<int64_t> chunkLengths;
+    std::set<std::thread::id> threadIds;
+    std::atomic<int> numRunningChunks{0};
+    std::atomic<int> maxRunningChunks{0};
+    _internal::ConcurrentTransfer(
+        100,
+        1000,
+        64,
+        3,
+        [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+          int running = ++numRunningChunks;
+          int expected = maxRunningChunks;
+          while (running > expected && !maxRunningChunks.compare_exchange_weak(expected, running))
+          {
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          {
+            std::lock_guard<std::mutex> guard(mutex);
+            EXPECT_EQ(numChunks, 16);
+            EXPECT_EQ(offset, 100 + chunkId * 64);
+            chunkOffsets.push_back(offset);
+            chunkLengths.push_back(length);
+            threadIds.insert(std::this_thread::get_id());
+          }
+          --numRunningChunks;
+        },
+        threadPool);
+
+    EXPECT_EQ(chunkOffsets.size(), 16U);
+    std::sort(chunkOffsets.begin(), chunkOffsets.end());
+    for (size_t i = 0; i < chunkOffsets.size(); ++i)
+    {
+      EXPECT_EQ(chunkOffsets[i], static_cast<int64_t>(100 + i * 64));
+    }
+    int64_t totalLength = 0;
+    for (auto length : chunkLengths)
+    {
+      totalLength += length;
+    }
+    EXPECT_EQ(totalLength, 1000);
+    EXPECT_LE(maxRunningChunks.load(), 3);
+    // Any thread of the pool can run the chunks, along with the calling thread.
+    EXPECT_LE(threadIds.size(), 5U);
+  }
+
+  TEST(ConcurrentTransferTest, Failure)
+  {
+    std::atomic<int> numChunks{0};
+    EXPECT_THROW(
+        _internal::ConcurrentTransfer(
+            0,
+            1000,
+            10,
+            8,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              ++numChunks;
+              if (chunkId == 5)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+            }),
+        std::runtime_error);
+    // The transfer stops once a chunk failed.
+    EXPECT_LT(numChunks.load(), 100);
+  }
+
+  TEST(ConcurrentTransferTest, SharedThreadPool)
+  {
+    auto threadPool = _internal::ThreadPool::GetShared(2);
+    EXPECT_EQ(threadPool->ThreadCount(), 2U);
+    EXPECT_EQ(threadPool, _internal::ThreadPool::GetShared(2));
+    EXPECT_NE(threadPool, _internal::ThreadPool::GetShared(3));
+    EXPECT_GE(_internal::ThreadPool::GetShared()->ThreadCount(), 8U);
+
+    // Transfers running at the same time share the threads of the pool.
+    std::vector<std::thread> transfers;
+    std::atomic<int64_t> totalLength{0};
+    for (int i = 0; i < 8; ++i)
+    {
+      transfers.emplace_back([&]() {
+        _internal::ConcurrentTransfer(
+            0,
+            4096,
+            128,
+            4,
+            [&](int64_t, int64_t length, int64_t, int64_t) { totalLength += length; },
+            threadPool);
+      });
+    }
+    for (auto& transfer : transfers)
+    {
+      transfer.join();
+    }
+    EXPECT_EQ(totalLength.load(), 8 * 4096);
+  }
+
+  TEST(ConcurrentTransferTest, ThreadPoolTasks)
+  {
+    auto threadPool = std::make_shared<_internal::ThreadPool>(4);
+
+    // Tasks submitted from several threads, and from the tasks themselves, are all run once.
+    constexpr int submitterCount = 4;
+    constexpr int taskCount = 1000;
+    std::atomic<int> runCount{0};
+    std::vector<std::thread> submitters;
+    for (int i = 0; i < submitterCount; ++i)
+    {
+      submitters.emplace_back([&]() {
+        for (int j = 0; j < taskCount; ++j)
+        {
+          threadPool->Submit([&]() {
+            ++runCount;
+            threadPool->Submit([&]() { ++runCount; });
+          });
+        }
+      });
+    }
+    for (auto& submitter : submitters)
+    {
+      submitter.join();
+    }
+    for (int i = 0; i < 1000 && runCount != 2 * submitterCount * taskCount; ++i)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(runCount.load(), 2 * submitterCount * taskCount);
+    EXPECT_FALSE(threadPool->HasQueuedTasks());
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -6,6 +6,7 @@
 #include <azure/storage/common/crypt.hpp>
 
 #include <cstring>
+#include <thread>
 
 namespace Azure { namespace Storage { namespace Test {
 
@@ -114,6 +115,69 @@ namespace Azure { namespace Storage { namespace Test {
         crc64Single.Final(reinterpret_cast<const uint8_t*>(allData.data()), allData.size()));
   }
 
+  TEST_F(CryptFunctionsTest, Crc64Hash_Hardware)
+  {
+    if (!_detail::IsCrc64HardwareAccelerated())
+    {
+      GTEST_SKIP();
+    }
+
+    // Unaligned data of all the lengths around the block sizes, with random CRCs of the preceding
+    // data.
+    auto data = RandomBuffer(static_cast<size_t>(1_MB));
+    for (size_t length = 0; length < 1024; ++length)
+    {
+      const size_t offset = static_cast<size_t>(RandomInt(0, 15));
+      const uint64_t crc = RandomInt();
+      ASSERT_EQ(
+          _detail::Crc64Hardware(crc, data.data() + offset, length),
+          _detail::Crc64Software(crc, data.data() + offset, length))
+          << "length " << length << ", offset " << offset;
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+      const size_t offset = static_cast<size_t>(RandomInt(0, data.size()));
+      const size_t length = static_cast<size_t>(RandomInt(0, data.size() - offset));
+      const uint64_t crc = RandomInt();
+      ASSERT_EQ(
+          _detail::Crc64Hardware(crc, data.data() + offset, length),
+          _detail::Crc64Software(crc, data.data() + offset, length))
+          << "length " << length << ", offset " << offset;
+    }
+  }
+
+  TEST_F(CryptFunctionsTest, ChunkedCrc64Hash)
+  {
+    auto data = RandomBuffer(static_cast<size_t>(1_MB));
+    const size_t chunkSize = static_cast<size_t>(100_KB);
+    const int64_t numChunks = static_cast<int64_t>((data.size() + chunkSize - 1) / chunkSize);
+
+    _internal::ChunkedCrc64Hash chunkedCrc64(numChunks);
+    std::vector<std::thread> threads;
+    for (int64_t i = numChunks - 1; i >= 0; --i)
+    {
+      threads.emplace_back([&, i]() {
+        const size_t offset = static_cast<size_t>(i) * chunkSize;
+        const size_t length = (std::min)(chunkSize, data.size() - offset);
+        // A chunk can be appended in several parts.
+        chunkedCrc64.Append(i, data.data() + offset, length / 2);
+        chunkedCrc64.Append(i, data.data() + offset + length / 2, length - length / 2);
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    EXPECT_EQ(chunkedCrc64.Final(), Crc64Hash().Final(data.data(), data.size()));
+    EXPECT_EQ(chunkedCrc64.ChunkFinal(1), Crc64Hash().Final(data.data() + chunkSize, chunkSize));
+    EXPECT_EQ(
+        chunkedCrc64.ChunkFinal(numChunks - 1),
+        Crc64Hash().Final(
+            data.data() + chunkSize * (numChunks - 1), data.size() - chunkSize * (numChunks - 1)));
+    EXPECT_EQ(_internal::ChunkedCrc64Hash(0).Final(), Crc64Hash().Final());
+  }
+
   TEST_F(CryptFunctionsTest, Crc64Hash_CtorDtor)
   {
     {
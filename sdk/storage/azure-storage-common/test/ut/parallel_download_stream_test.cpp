@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/parallel_download_stream.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    // A memory body stream owning its content.
+    class ChunkBodyStream final : public Azure::Core::IO::BodyStream {
+    public:
+      explicit ChunkBodyStream(std::vector<uint8_t> content)
+          : m_content(std::move(content)), m_stream(m_content)
+      {
+      }
+
+      int64_t Length() const override { return m_stream.Length(); }
+
+    private:
+      std::vector<uint8_t> m_content;
+      Azure::Core::IO::MemoryBodyStream m_stream;
+
+      size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context& context) override
+      {
+        return m_stream.Read(buffer, count, context);
+      }
+    };
+
+    std::vector<uint8_t> MakeContent(size_t length)
+    {
+      std::vector<uint8_t> content(length);
+      for (size_t i = 0; i < length; ++i)
+      {
+        content[i] = static_cast<uint8_t>(i * 7 + i / 256);
+      }
+      return content;
+    }
+  } // namespace
+
+  TEST(ParallelDownloadStreamTest, ReadInOrder)
+  {
+    const auto content = MakeContent(1000);
+    const int64_t firstChunkLength = 100;
+    std::atomic<int64_t> numDownloads{0};
+    std::atomic<int64_t> maxDownloaded{0};
+    std::atomic<int64_t> bytesRead{0};
+
+    _internal::ParallelDownloadStreamOptions options;
+    options.ChunkSize = 64;
+    options.Concurrency = 4;
+    options.MaxBufferedBytes = 200;
+    options.ComputeCrc64 = true;
+    auto downloader = [&](int64_t offset, int64_t length, const Azure::Core::Context&) {
+      ++numDownloads;
+      // Completes the chunks out of order.
+      std::this_thread::sleep_for(std::chrono::milliseconds((offset / 64) % 3));
+      int64_t downloaded = offset + length;
+      int64_t expected = maxDownloaded;
+      while (downloaded > expected && !maxDownloaded.compare_exchange_weak(expected, downloaded))
+      {
+      }
+      // No more than 3 chunks are downloaded ahead of the reader, which may not have counted its
+      // last read yet, and whose first chunk isn't downloaded in parallel.
+      EXPECT_LE(downloaded - (std::max)(bytesRead.load(), firstChunkLength), 3 * 64 + 64);
+      return std::unique_ptr<Azure::Core::IO::BodyStream>(
+          std::make_unique<ChunkBodyStream>(std::vector<uint8_t>(
+              content.begin() + static_cast<ptrdiff_t>(offset),
+              content.begin() + static_cast<ptrdiff_t>(offset + length))));
+    };
+
+    _internal::ParallelDownloadStream stream(
+        std::make_unique<ChunkBodyStream>(
+            std::vector<uint8_t>(content.begin(), content.begin() + firstChunkLength)),
+        firstChunkLength,
+        firstChunkLength,
+        static_cast<int64_t>(content.size()) - firstChunkLength,
+        downloader,
+        options,
+        std::make_shared<_internal::ThreadPool>(4),
+        Azure::Core::Context());
+    EXPECT_EQ(stream.Length(), 1000);
+
+    std::vector<uint8_t> result;
+    uint8_t buffer[37];
+    while (true)
+    {
+      size_t n = stream.Read(buffer, sizeof(buffer));
+      if (n == 0)
+      {
+        break;
+      }
+      result.insert(result.end(), buffer, buffer + n);
+      bytesRead += static_cast<int64_t>(n);
+    }
+    EXPECT_EQ(result, content);
+    EXPECT_EQ(numDownloads.load(), 15);
+    EXPECT_EQ(stream.FinalCrc64(), Crc64Hash().Final(content.data(), content.size()));
+  }
+
+  TEST(ParallelDownloadStreamTest, EmptyRange)
+  {
+    _internal::ParallelDownloadStream stream(
+        std::make_unique<ChunkBodyStream>(std::vector<uint8_t>()),
+        0,
+        0,
+        0,
+        [](int64_t, int64_t, const Azure::Core::Context&)
+            -> std::unique_ptr<Azure::Core::IO::BodyStream> {
+          throw std::logic_error("no chunk is expected to be downloaded");
+        },
+        _internal::ParallelDownloadStreamOptions(),
+        nullptr,
+        Azure::Core::Context());
+    uint8_t buffer[16];
+    EXPECT_EQ(stream.Read(buffer, sizeof(buffer)), 0U);
+  }
+
+  TEST(ParallelDownloadStreamTest, ChunkFailure)
+  {
+    const auto content = MakeContent(512);
+    _internal::ParallelDownloadStreamOptions options;
+    options.ChunkSize = 64;
+    _internal::ParallelDownloadStream stream(
+        std::make_unique<ChunkBodyStream>(std::vector<uint8_t>()),
+        0,
+        0,
+        static_cast<int64_t>(content.size()),
+        [&](int64_t offset, int64_t length, const Azure::Core::Context&)
+            -> std::unique_ptr<Azure::Core::IO::BodyStream> {
+          if (offset == 256)
+          {
+            throw std::runtime_error("chunk failed");
+          }
+          return std::make_unique<ChunkBodyStream>(std::vector<uint8_t>(
+              content.begin() + static_cast<ptrdiff_t>(offset),
+              content.begin() + static_cast<ptrdiff_t>(offset + length)));
+        },
+        options,
+        nullptr,
+        Azure::Core::Context());
+    std::vector<uint8_t> buffer(512);
+    EXPECT_THROW(stream.ReadToCount(buffer.data(), buffer.size()), std::runtime_error);
+  }
+
+  TEST(ParallelDownloadStreamTest, CloseBeforeEnd)
+  {
+    const auto content = MakeContent(4096);
+    std::atomic<int> numDownloads{0};
+    _internal::ParallelDownloadStreamOptions options;
+    options.ChunkSize = 64;
+    options.Concurrency = 2;
+    options.MaxBufferedBytes = 128;
+    {
+      _internal::ParallelDownloadStream stream(
+          std::make_unique<ChunkBodyStream>(std::vector<uint8_t>()),
+          0,
+          0,
+          static_cast<int64_t>(content.size()),
+          [&](int64_t offset, int64_t length, const Azure::Core::Context&) {
+            ++numDownloads;
+            return std::unique_ptr<Azure::Core::IO::BodyStream>(
+                std::make_unique<ChunkBodyStream>(std::vector<uint8_t>(
+                    content.begin() + static_cast<ptrdiff_t>(offset),
+                    content.begin() + static_cast<ptrdiff_t>(offset + length))));
+          },
+          options,
+          nullptr,
+          Azure::Core::Context());
+      uint8_t buffer[64];
+      EXPECT_EQ(stream.ReadToCount(buffer, sizeof(buffer)), sizeof(buffer));
+      EXPECT_TRUE(std::equal(buffer, buffer + sizeof(buffer), content.begin()));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // Only the chunks within the buffered range were downloaded.
+    EXPECT_LE(numDownloads.load(), 3);
+  }
+
+  TEST(ParallelDownloadStreamTest, CloseWaitsForDownloads)
+  {
+    std::atomic<int> numRunningDownloads{0};
+    std::atomic<bool> isDownloaderDestroyed{false};
+    // Destroyed with the chunk downloader.
+    std::shared_ptr<void> downloaderGuard(
+        nullptr, [&](void*) { isDownloaderDestroyed = true; });
+    _internal::ParallelDownloadStreamOptions options;
+    options.ChunkSize = 64;
+    options.Concurrency = 2;
+    {
+      _internal::ParallelDownloadStream stream(
+          std::make_unique<ChunkBodyStream>(std::vector<uint8_t>()),
+          0,
+          0,
+          1024,
+          [&, downloaderGuard](int64_t, int64_t, const Azure::Core::Context& context)
+              -> std::unique_ptr<Azure::Core::IO::BodyStream> {
+            ++numRunningDownloads;
+            while (!context.IsCancelled())
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            --numRunningDownloads;
+            context.ThrowIfCancelled();
+            return nullptr;
+          },
+          options,
+          nullptr,
+          Azure::Core::Context());
+      downloaderGuard.reset();
+      while (numRunningDownloads == 0)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+    EXPECT_EQ(numRunningDownloads.load(), 0);
+    EXPECT_TRUE(isDownloaderDestroyed.load());
+  }
+
+}}} // namespace Azure::Storage::Test
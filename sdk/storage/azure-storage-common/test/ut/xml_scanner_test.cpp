@@ -0,0 +1,550 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/xml_scanner.hpp>
+#include <azure/storage/common/internal/xml_wrapper.hpp>
+
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    using Nodes = std::vector<std::tuple<_internal::XmlNodeType, std::string, std::string>>;
+
+    // A memory body stream returning at most a few bytes per read.
+    class TrickleBodyStream final : public Azure::Core::IO::BodyStream {
+    public:
+      explicit TrickleBodyStream(const std::string& content, size_t readSize)
+          : m_content(content), m_readSize(readSize)
+      {
+      }
+
+      int64_t Length() const override { return static_cast<int64_t>(m_content.size()); }
+
+    private:
+      std::string m_content;
+      size_t m_readSize;
+      size_t m_offset = 0;
+
+      size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context&) override
+      {
+        count = (std::min)({count, m_readSize, m_content.size() - m_offset});
+        std::copy(m_content.begin() + m_offset, m_content.begin() + m_offset + count, buffer);
+        m_offset += count;
+        return count;
+      }
+    };
+
+    template <class Reader> Nodes ReadAll(Reader& reader)
+    {
+      Nodes nodes;
+      while (true)
+      {
+        auto node = reader.Read();
+        nodes.emplace_back(node.Type, node.Name, node.Value);
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          break;
+        }
+      }
+      return nodes;
+    }
+
+    Nodes::value_type StartTag(std::string name)
+    {
+      return Nodes::value_type{_internal::XmlNodeType::StartTag, std::move(name), std::string()};
+    }
+
+    Nodes::value_type Attribute(std::string name, std::string value)
+    {
+      return Nodes::value_type{_internal::XmlNodeType::Attribute, std::move(name), std::move(value)};
+    }
+
+    Nodes::value_type Text(std::string value)
+    {
+      return Nodes::value_type{_internal::XmlNodeType::Text, std::string(), std::move(value)};
+    }
+
+    Nodes::value_type EndTag()
+    {
+      return Nodes::value_type{_internal::XmlNodeType::EndTag, std::string(), std::string()};
+    }
+
+    // Every way of reading a document: XmlReader, which is libxml2 or WebServices unless the
+    // library is built with STORAGE_BUILTIN_XML_READER, and XmlScanner from memory and from streams
+    // returning a few bytes per read. Each reader returns the nodes or throws.
+    std::vector<std::function<Nodes()>> Readers(const std::string& document)
+    {
+      std::vector<std::function<Nodes()>> readers;
+      readers.push_back([&document]() {
+        _internal::XmlReader reader(document.data(), document.size());
+        // libxml2 reports the attributes of an element again after its end tag when the element
+        // has content. XmlScanner only reports them after the start tag.
+        Nodes nodes;
+        for (auto& node : ReadAll(reader))
+        {
+          if (std::get<0>(node) != _internal::XmlNodeType::Attribute || nodes.empty()
+              || std::get<0>(nodes.back()) == _internal::XmlNodeType::StartTag
+              || std::get<0>(nodes.back()) == _internal::XmlNodeType::Attribute)
+          {
+            nodes.push_back(std::move(node));
+          }
+        }
+        return nodes;
+      });
+      readers.push_back([&document]() {
+        _internal::XmlScanner scanner(document.data(), document.size());
+        return ReadAll(scanner);
+      });
+      for (size_t readSize : {size_t(1), size_t(3), size_t(4096)})
+      {
+        readers.push_back([&document, readSize]() {
+          TrickleBodyStream stream(document, readSize);
+          _internal::XmlScanner scanner(stream, Azure::Core::Context());
+          return ReadAll(scanner);
+        });
+      }
+      return readers;
+    }
+
+    // Checks that every reader reports the expected nodes, followed by End.
+    void ExpectNodes(const std::string& document, Nodes expected)
+    {
+      expected.emplace_back(_internal::XmlNodeType::End, std::string(), std::string());
+      auto readers = Readers(document);
+      for (size_t i = 0; i < readers.size(); ++i)
+      {
+        try
+        {
+          EXPECT_EQ(readers[i](), expected) << "reader " << i << " on " << document;
+        }
+        catch (std::runtime_error& e)
+        {
+          ADD_FAILURE() << "reader " << i << " failed with " << e.what() << " on " << document;
+        }
+      }
+    }
+
+    // Checks that every reader rejects the document.
+    void ExpectFailure(const std::string& document)
+    {
+      auto readers = Readers(document);
+      for (size_t i = 0; i < readers.size(); ++i)
+      {
+        EXPECT_THROW(readers[i](), std::runtime_error) << "reader " << i << " on " << document;
+      }
+    }
+
+    std::string XmlEscape(const std::string& text)
+    {
+      std::string escaped;
+      for (char c : text)
+      {
+        switch (c)
+        {
+          case '<':
+            escaped += "&lt;";
+            break;
+          case '>':
+            escaped += "&gt;";
+            break;
+          case '&':
+            escaped += "&amp;";
+            break;
+          case '"':
+            escaped += "&quot;";
+            break;
+          default:
+            escaped += c;
+            break;
+        }
+      }
+      return escaped;
+    }
+  } // namespace
+
+  TEST(XmlScannerTest, ServiceResponses)
+  {
+    const std::string declaration = "\xef\xbb\xbf<?xml version=\"1.0\" encoding=\"utf-8\"?>";
+    ExpectNodes(
+        declaration
+            + "<EnumerationResults ServiceEndpoint=\"https://account.blob.core.windows.net/\" "
+              "ContainerName=\"container\"><Prefix>a&amp;b</Prefix><Marker /><MaxResults>2"
+              "</MaxResults><Delimiter>/</Delimiter><Blobs><Blob><Name Encoded=\"true\">a%2Fb"
+              "</Name><Properties><Creation-Time>Wed, 01 Jan 2025 00:00:00 GMT</Creation-Time>"
+              "<Content-Length>1024</Content-Length><Content-MD5 /><BlobType>BlockBlob"
+              "</BlobType></Properties><Metadata><key1>value &lt;1&gt;</key1><Key2 /></Metadata>"
+              "<Tags><TagSet><Tag><Key>k</Key><Value>\"v\" &apos;w&apos;</Value></Tag></TagSet>"
+              "</Tags><OrMetadata><or-policy_rule>Complete</or-policy_rule></OrMetadata></Blob>"
+              "<BlobPrefix><Name>dir/</Name></BlobPrefix></Blobs><NextMarker />"
+              "</EnumerationResults>",
+        {StartTag("EnumerationResults"),
+         Attribute("ServiceEndpoint", "https://account.blob.core.windows.net/"),
+         Attribute("ContainerName", "container"),
+         StartTag("Prefix"),
+         Text("a&b"),
+         EndTag(),
+         StartTag("Marker"),
+         EndTag(),
+         StartTag("MaxResults"),
+         Text("2"),
+         EndTag(),
+         StartTag("Delimiter"),
+         Text("/"),
+         EndTag(),
+         StartTag("Blobs"),
+         StartTag("Blob"),
+         StartTag("Name"),
+         Attribute("Encoded", "true"),
+         Text("a%2Fb"),
+         EndTag(),
+         StartTag("Properties"),
+         StartTag("Creation-Time"),
+         Text("Wed, 01 Jan 2025 00:00:00 GMT"),
+         EndTag(),
+         StartTag("Content-Length"),
+         Text("1024"),
+         EndTag(),
+         StartTag("Content-MD5"),
+         EndTag(),
+         StartTag("BlobType"),
+         Text("BlockBlob"),
+         EndTag(),
+         EndTag(),
+         StartTag("Metadata"),
+         StartTag("key1"),
+         Text("value <1>"),
+         EndTag(),
+         StartTag("Key2"),
+         EndTag(),
+         EndTag(),
+         StartTag("Tags"),
+         StartTag("TagSet"),
+         StartTag("Tag"),
+         StartTag("Key"),
+         Text("k"),
+         EndTag(),
+         StartTag("Value"),
+         Text("\"v\" 'w'"),
+         EndTag(),
+         EndTag(),
+         EndTag(),
+         EndTag(),
+         StartTag("OrMetadata"),
+         StartTag("or-policy_rule"),
+         Text("Complete"),
+         EndTag(),
+         EndTag(),
+         EndTag(),
+         StartTag("BlobPrefix"),
+         StartTag("Name"),
+         Text("dir/"),
+         EndTag(),
+         EndTag(),
+         EndTag(),
+         StartTag("NextMarker"),
+         EndTag(),
+         EndTag()});
+    ExpectNodes(
+        declaration
+            + "<Error><Code>BlobNotFound</Code><Message>The specified blob does not exist.\n"
+              "RequestId:0b8e0a2e-701e-0042-6b8a-3c1c5c000000\nTime:2025-01-01T00:00:00.0000000Z"
+              "</Message></Error>",
+        {StartTag("Error"),
+         StartTag("Code"),
+         Text("BlobNotFound"),
+         EndTag(),
+         StartTag("Message"),
+         Text("The specified blob does not exist.\nRequestId:0b8e0a2e-701e-0042-6b8a-3c1c5c000000"
+              "\nTime:2025-01-01T00:00:00.0000000Z"),
+         EndTag(),
+         EndTag()});
+    ExpectNodes(
+        declaration
+            + "\n<BlockList>\n  <CommittedBlocks>\n    <Block>\n      <Name>YmxvY2sx</Name>\n"
+              "      <Size>4194304</Size>\n    </Block>\n  </CommittedBlocks>\n"
+              "  <UncommittedBlocks />\n</BlockList>\n",
+        {StartTag("BlockList"),
+         StartTag("CommittedBlocks"),
+         StartTag("Block"),
+         StartTag("Name"),
+         Text("YmxvY2sx"),
+         EndTag(),
+         StartTag("Size"),
+         Text("4194304"),
+         EndTag(),
+         EndTag(),
+         EndTag(),
+         StartTag("UncommittedBlocks"),
+         EndTag(),
+         EndTag()});
+    ExpectNodes(
+        declaration
+            + "<QueueMessagesList><QueueMessage><MessageId>id</MessageId><MessageText>"
+              "&lt;xml&gt; &#x4e2d;&#25991; &#x1F600; tab\there</MessageText></QueueMessage>"
+              "</QueueMessagesList>",
+        {StartTag("QueueMessagesList"),
+         StartTag("QueueMessage"),
+         StartTag("MessageId"),
+         Text("id"),
+         EndTag(),
+         StartTag("MessageText"),
+         Text("<xml> \xe4\xb8\xad\xe6\x96\x87 \xf0\x9f\x98\x80 tab\there"),
+         EndTag(),
+         EndTag(),
+         EndTag()});
+    ExpectNodes(
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?><PageList><PageRange><Start>0</Start><End>511"
+        "</End></PageRange><ClearRange><Start>512</Start><End>1023</End></ClearRange>"
+        "<NextMarker>m</NextMarker></PageList>",
+        {StartTag("PageList"),
+         StartTag("PageRange"),
+         StartTag("Start"),
+         Text("0"),
+         EndTag(),
+         StartTag("End"),
+         Text("511"),
+         EndTag(),
+         EndTag(),
+         StartTag("ClearRange"),
+         StartTag("Start"),
+         Text("512"),
+         EndTag(),
+         StartTag("End"),
+         Text("1023"),
+         EndTag(),
+         EndTag(),
+         StartTag("NextMarker"),
+         Text("m"),
+         EndTag(),
+         EndTag()});
+  }
+
+  TEST(XmlScannerTest, EdgeCases)
+  {
+    // Attributes, quotes, namespaces and empty elements. Namespace declarations come first.
+    ExpectNodes(
+        "<a x='1' y = \"2\" xmlns:n=\"urn:n\"><n:b z=\"a&gt;b\"/><c></c></a>",
+        {StartTag("a"),
+         Attribute("xmlns:n", "urn:n"),
+         Attribute("x", "1"),
+         Attribute("y", "2"),
+         StartTag("n:b"),
+         Attribute("z", "a>b"),
+         EndTag(),
+         StartTag("c"),
+         EndTag(),
+         EndTag()});
+    ExpectNodes(
+        "<a x=\"&lt;&#65;&#x42;&amp;\" y=\"a>b\"/>",
+        {StartTag("a"), Attribute("x", "<AB&"), Attribute("y", "a>b"), EndTag()});
+    // Line breaks and blanks are normalized in attribute values, but not character references.
+    ExpectNodes(
+        "<a x=\"1\r\n2\n3\t4\r5\" y=\"&#10;&#9;\"/>",
+        {StartTag("a"), Attribute("x", "1 2 3 4 5"), Attribute("y", "\n\t"), EndTag()});
+    // Line breaks are normalized in text.
+    ExpectNodes("<a>1\r\n2\r3\n4</a>", {StartTag("a"), Text("1\n2\n3\n4"), EndTag()});
+    // Blank text is ignored, other text is kept as is.
+    ExpectNodes(
+        "<a>\n  <b> x </b>\n  <c>  </c>\n</a>\n",
+        {StartTag("a"), StartTag("b"), Text(" x "), EndTag(), StartTag("c"), EndTag(), EndTag()});
+    ExpectNodes(
+        "<a>x<b/>y<c>z</c>w</a>",
+        {StartTag("a"),
+         Text("x"),
+         StartTag("b"),
+         EndTag(),
+         Text("y"),
+         StartTag("c"),
+         Text("z"),
+         EndTag(),
+         Text("w"),
+         EndTag()});
+    // Multi-byte UTF-8 passes through.
+    ExpectNodes(
+        "<a name=\"\xe4\xb8\xad\">\xe6\x96\x87\xf0\x9f\x98\x80</a>",
+        {StartTag("a"),
+         Attribute("name", "\xe4\xb8\xad"),
+         Text("\xe6\x96\x87\xf0\x9f\x98\x80"),
+         EndTag()});
+    // Text across many buffer refills.
+    ExpectNodes(
+        "<a>" + std::string(200000, 'x') + "&amp;" + std::string(100, 'y') + "</a>",
+        {StartTag("a"), Text(std::string(200000, 'x') + "&" + std::string(100, 'y')), EndTag()});
+    ExpectNodes(
+        "<a b=\"" + std::string(100000, 'v') + "\"/>",
+        {StartTag("a"), Attribute("b", std::string(100000, 'v')), EndTag()});
+    // Deep nesting.
+    std::string deep;
+    Nodes deepNodes;
+    for (int i = 0; i < 100; ++i)
+    {
+      deep += "<e" + std::to_string(i) + ">";
+      deepNodes.push_back(StartTag("e" + std::to_string(i)));
+    }
+    for (int i = 99; i >= 0; --i)
+    {
+      deep += "</e" + std::to_string(i) + ">";
+      deepNodes.push_back(EndTag());
+    }
+    ExpectNodes(deep, deepNodes);
+    ExpectNodes("<a></a >", {StartTag("a"), EndTag()});
+    ExpectNodes("<a/>", {StartTag("a"), EndTag()});
+  }
+
+  TEST(XmlScannerTest, MalformedDocuments)
+  {
+    for (const std::string document : {
+             "",
+             "   ",
+             "<a>",
+             "<a></b>",
+             "<a><b></a></b>",
+             "<a></a><b></b>",
+             "<a></a>text",
+             "text<a></a>",
+             "<a>&unknown;</a>",
+             "<a>&amp</a>",
+             "<a x=1/>",
+             "<a x=\"1\"y=\"2\"/>",
+             "<a x=\"1/>",
+             "<a x=\"<\"/>",
+             "<a",
+             "<a><!-- unterminated </a>",
+             "</a>",
+             "<>",
+         })
+    {
+      ExpectFailure(document);
+    }
+  }
+
+  TEST(XmlScannerTest, Comments)
+  {
+    // XmlReader fails on comments and processing instructions, XmlScanner skips them.
+    _internal::XmlScanner scanner(
+        "<!-- c --><?pi x?><a><!-- c --><b>x</b><?pi?></a><!-- c -->", 59);
+    Nodes expected{
+        {_internal::XmlNodeType::StartTag, "a", ""},
+        {_internal::XmlNodeType::StartTag, "b", ""},
+        {_internal::XmlNodeType::Text, "", "x"},
+        {_internal::XmlNodeType::EndTag, "", ""},
+        {_internal::XmlNodeType::EndTag, "", ""},
+        {_internal::XmlNodeType::End, "", ""},
+    };
+    EXPECT_EQ(ReadAll(scanner), expected);
+
+    const std::string cdata = "<a><![CDATA[<b>&amp;</b>]]></a>";
+    _internal::XmlScanner cdataScanner(cdata.data(), cdata.size());
+    EXPECT_EQ(cdataScanner.Read().Type, _internal::XmlNodeType::StartTag);
+    EXPECT_EQ(cdataScanner.Read().Value, "<b>&amp;</b>");
+
+    const std::string latin1 = "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?><a/>";
+    _internal::XmlScanner latin1Scanner(latin1.data(), latin1.size());
+    EXPECT_THROW(latin1Scanner.Read(), std::runtime_error);
+  }
+
+  TEST(XmlScannerTest, Tokens)
+  {
+    const std::string document = "<a x=\"1&amp;2\">text</a>";
+    _internal::XmlScanner scanner(document.data(), document.size());
+    auto token = scanner.Scan();
+    EXPECT_EQ(token.Type, _internal::XmlNodeType::StartTag);
+    EXPECT_EQ(token.Name, document.data() + 1);
+    EXPECT_EQ(token.NameLength, 1U);
+    token = scanner.Scan();
+    EXPECT_EQ(token.Type, _internal::XmlNodeType::Attribute);
+    EXPECT_EQ(std::string(token.Value, token.ValueLength), "1&amp;2");
+    EXPECT_TRUE(token.NeedsDecoding);
+    EXPECT_EQ(_internal::XmlScanner::DecodeValue(token), "1&2");
+    token = scanner.Scan();
+    EXPECT_EQ(token.Type, _internal::XmlNodeType::Text);
+    // Values are views of the input.
+    EXPECT_EQ(token.Value, document.data() + document.find("text"));
+    EXPECT_FALSE(token.NeedsDecoding);
+  }
+
+  TEST(XmlScannerTest, RandomDocuments)
+  {
+    std::mt19937 random(20250101);
+    auto randomInt = [&](int min, int max) {
+      return std::uniform_int_distribution<int>(min, max)(random);
+    };
+    // Each text with its value as an attribute and as element content.
+    const std::vector<std::tuple<std::string, std::string, std::string>> texts{
+        {"x", "x", "x"},
+        {"hello world", "hello world", "hello world"},
+        {" padded ", " padded ", " padded "},
+        {"a&b<c>d\"e'f", "a&b<c>d\"e'f", "a&b<c>d\"e'f"},
+        {"\xc3\xa9\xe4\xb8\xad", "\xc3\xa9\xe4\xb8\xad", "\xc3\xa9\xe4\xb8\xad"},
+        {"1\r\n2", "1 2", "1\n2"},
+        {"\t", " ", "\t"},
+    };
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+      std::string document;
+      Nodes expected;
+      // Adjacent text is reported as one node, and only if it isn't blank.
+      std::string text;
+      auto flushText = [&]() {
+        if (text.find_first_not_of(" \t\n") != std::string::npos)
+        {
+          expected.push_back(Text(text));
+        }
+        text.clear();
+      };
+      auto addText = [&]() {
+        auto& t = texts[static_cast<size_t>(randomInt(0, 6))];
+        document += XmlEscape(std::get<0>(t));
+        text += std::get<2>(t);
+      };
+      std::function<void(int)> element = [&](int depth) {
+        flushText();
+        const std::string name = "e" + std::to_string(randomInt(0, 20));
+        document += "<" + name;
+        expected.push_back(StartTag(name));
+        for (int i = randomInt(0, 3); i > 0; --i)
+        {
+          auto& t = texts[static_cast<size_t>(randomInt(0, 6))];
+          document += " a" + std::to_string(i) + "=\"" + XmlEscape(std::get<0>(t)) + "\"";
+          expected.push_back(Attribute("a" + std::to_string(i), std::get<1>(t)));
+        }
+        if (randomInt(0, 4) == 0)
+        {
+          document += "/>";
+          expected.push_back(EndTag());
+          return;
+        }
+        document += ">";
+        for (int i = depth < 5 ? randomInt(0, 4) : 0; i > 0; --i)
+        {
+          if (randomInt(0, 2) == 0)
+          {
+            addText();
+          }
+          element(depth + 1);
+          if (randomInt(0, 3) == 0)
+          {
+            document += "\n  ";
+            text += "\n  ";
+          }
+        }
+        if (randomInt(0, 2) == 0)
+        {
+          addText();
+        }
+        flushText();
+        document += "</" + name + ">";
+        expected.push_back(EndTag());
+      };
+      element(0);
+      ExpectNodes(document, expected);
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
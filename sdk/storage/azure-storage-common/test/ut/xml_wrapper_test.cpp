@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/core/http/transport.hpp>
+#include <azure/storage/common/internal/xml_wrapper.hpp>
+
+#include <stdexcept>
+#include <tuple>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    // A memory body stream returning at most a few bytes per read, optionally failing once
+    // everything before the failure offset has been read.
+    class TrickleBodyStream final : public Azure::Core::IO::BodyStream {
+    public:
+      explicit TrickleBodyStream(
+          const std::string& content,
+          size_t readSize,
+          size_t failureOffset = std::string::npos)
+          : m_content(content), m_readSize(readSize), m_failureOffset(failureOffset)
+      {
+      }
+
+      int64_t Length() const override { return static_cast<int64_t>(m_content.size()); }
+
+    private:
+      std::string m_content;
+      size_t m_readSize;
+      size_t m_failureOffset;
+      size_t m_offset = 0;
+
+      size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context& context) override
+      {
+        context.ThrowIfCancelled();
+        if (m_offset >= m_failureOffset)
+        {
+          throw Azure::Core::Http::TransportException("Connection reset.");
+        }
+        count = (std::min)({count, m_readSize, m_content.size() - m_offset});
+        std::copy(m_content.begin() + m_offset, m_content.begin() + m_offset + count, buffer);
+        m_offset += count;
+        return count;
+      }
+    };
+
+    std::string ListBlobsBody(int numBlobs)
+    {
+      std::string body = "\xef\xbb\xbf<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+                         "<EnumerationResults ServiceEndpoint=\"https://a.blob.core.windows.net/\" "
+                         "ContainerName=\"c\"><Prefix /><Blobs>";
+      for (int i = 0; i < numBlobs; ++i)
+      {
+        body += "<Blob><Name>blob" + std::to_string(i)
+            + "</Name><Properties><Content-Length>" + std::to_string(i * 1024)
+            + "</Content-Length><Content-MD5 /></Properties><Metadata><key>"
+            + std::string(static_cast<size_t>(i % 100), 'v') + "</key></Metadata></Blob>";
+      }
+      body += "</Blobs><NextMarker>marker&amp;1</NextMarker></EnumerationResults>";
+      return body;
+    }
+
+    std::vector<std::tuple<_internal::XmlNodeType, std::string, std::string>> ReadAll(
+        _internal::XmlReader& reader)
+    {
+      std::vector<std::tuple<_internal::XmlNodeType, std::string, std::string>> nodes;
+      while (true)
+      {
+        auto node = reader.Read();
+        nodes.emplace_back(node.Type, node.Name, node.Value);
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          break;
+        }
+      }
+      return nodes;
+    }
+  } // namespace
+
+  TEST(XmlWrapperTest, StreamReader)
+  {
+    const auto body = ListBlobsBody(1000);
+    _internal::XmlReader memoryReader(body.data(), body.size());
+    const auto expected = ReadAll(memoryReader);
+    EXPECT_GT(expected.size(), 1000U * 10U);
+
+    for (size_t readSize : {size_t(1), size_t(7), size_t(4096), body.size()})
+    {
+      TrickleBodyStream stream(body, readSize);
+      _internal::XmlReader streamReader(stream, Azure::Core::Context());
+      EXPECT_EQ(ReadAll(streamReader), expected) << "read size " << readSize;
+    }
+  }
+
+  TEST(XmlWrapperTest, StreamReaderError)
+  {
+    const auto body = ListBlobsBody(100);
+    TrickleBodyStream stream(body, 64, body.size() / 2);
+    // The stream's exception is surfaced instead of a parse error.
+    EXPECT_THROW(
+        {
+          _internal::XmlReader reader(stream, Azure::Core::Context());
+          while (reader.Read().Type != _internal::XmlNodeType::End)
+          {
+          }
+        },
+        Azure::Core::Http::TransportException);
+
+    const std::string malformed = "<a><b></a>";
+    TrickleBodyStream malformedStream(malformed, 4);
+    EXPECT_THROW(
+        {
+          _internal::XmlReader malformedReader(malformedStream, Azure::Core::Context());
+          while (malformedReader.Read().Type != _internal::XmlNodeType::End)
+          {
+          }
+        },
+        std::runtime_error);
+  }
+
+}}} // namespace Azure::Storage::Test
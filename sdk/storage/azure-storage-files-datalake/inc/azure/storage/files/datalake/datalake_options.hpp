@@ -190,6 +190,15 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
      * if Audience is not set.
      */
     Azure::Nullable<DataLakeAudience> Audience;
+
+    /**
+     * The number of threads running the chunks of the parallel transfers, such as
+     * #Azure::Storage::Files::DataLake::DataLakeFileClient::DownloadTo and
+     * #Azure::Storage::Files::DataLake::DataLakeFileClient::UploadFrom. The threads are shared by
+     * all the clients created with the same value. The number of processors, and at least 8, is
+     * used if it's 0.
+     */
+    int32_t TransferThreadPoolSize = 0;
   };
 
   /**
@@ -124,7 +124,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     auto renamedBlobClient = Blobs::BlobClient(
         _detail::GetBlobUrlFromUrl(destinationDfsUrl),
         m_pipeline,
-        m_clientConfiguration.CustomerProvidedKey);
+        m_clientConfiguration.CustomerProvidedKey,
+        Azure::Nullable<std::string>(),
+        m_blobClient.m_transferThreadPool);
     auto renamedFileClient = DataLakeFileClient(
         std::move(destinationDfsUrl),
         std::move(renamedBlobClient),
@@ -177,7 +179,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     auto renamedBlobClient = Blobs::BlobClient(
         _detail::GetBlobUrlFromUrl(destinationDfsUrl),
         m_pipeline,
-        m_clientConfiguration.CustomerProvidedKey);
+        m_clientConfiguration.CustomerProvidedKey,
+        Azure::Nullable<std::string>(),
+        m_blobClient.m_transferThreadPool);
     auto renamedDirectoryClient = DataLakeDirectoryClient(
         std::move(destinationDfsUrl),
         std::move(renamedBlobClient),
@@ -8,6 +8,7 @@
 #include "azure/storage/files/shares/share_service_client.hpp"
 
 #include <azure/core/response.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
 #include <azure/storage/common/storage_credential.hpp>
 
 #include <memory>
@@ -248,6 +249,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     Nullable<bool> m_allowTrailingDot;
     Nullable<bool> m_allowSourceTrailingDot;
     Nullable<Models::ShareTokenIntent> m_shareTokenIntent;
+    std::shared_ptr<Storage::_internal::ThreadPool> m_transferThreadPool;
 
     explicit ShareClient(
         Azure::Core::Url shareUrl,
@@ -9,6 +9,7 @@
 
 #include <azure/core/internal/http/pipeline.hpp>
 #include <azure/core/response.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
 #include <azure/storage/common/storage_credential.hpp>
 
 #include <memory>
@@ -278,6 +279,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     Nullable<bool> m_allowTrailingDot;
     Nullable<bool> m_allowSourceTrailingDot;
     Nullable<Models::ShareTokenIntent> m_shareTokenIntent;
+    std::shared_ptr<Storage::_internal::ThreadPool> m_transferThreadPool;
 
     explicit ShareDirectoryClient(
         Azure::Core::Url shareDirectoryUrl,
@@ -294,6 +294,15 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
      * Audience is not set.
      */
     Azure::Nullable<ShareAudience> Audience;
+
+    /**
+     * The number of threads running the chunks of the parallel transfers, such as
+     * #Azure::Storage::Files::Shares::ShareFileClient::DownloadTo and
+     * #Azure::Storage::Files::Shares::ShareFileClient::UploadFrom. The threads are shared by all
+     * the clients created with the same value. The number of processors, and at least 8, is used
+     * if it's 0.
+     */
+    int32_t TransferThreadPoolSize = 0;
   };
 
   /**
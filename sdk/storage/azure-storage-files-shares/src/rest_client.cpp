@@ -4,6 +4,10 @@
 //
 // Code generated by Microsoft (R) AutoRest C++ Code Generator.
 // Changes may cause incorrect behavior and will be lost if the code is regenerated.
+//
+// Edited by hand after generation: the xml deserializers keep their element name maps in static
+// storage. Re-apply this when regenerating. test/ut/xml_deserialization_test.cpp checks that every
+// element reaches its field.
 #include <azure/core/base64.hpp>
 #include <azure/core/context.hpp>
 #include <azure/core/datetime.hpp>
@@ -390,7 +394,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kSMB,
           kMultichannel,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"StorageServiceProperties", XmlTagEnum::kStorageServiceProperties},
             {"HourMetrics", XmlTagEnum::kHourMetrics},
             {"Version", XmlTagEnum::kVersion},
@@ -647,7 +651,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kNextAllowedProvisionedBandwidthDowngradeTime,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Prefix", XmlTagEnum::kPrefix},
             {"Marker", XmlTagEnum::kMarker},
@@ -1847,7 +1851,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kExpiry,
           kPermission,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"SignedIdentifiers", XmlTagEnum::kSignedIdentifiers},
             {"SignedIdentifier", XmlTagEnum::kSignedIdentifier},
             {"Id", XmlTagEnum::kId},
@@ -2026,7 +2030,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kShareStats,
           kShareUsageBytes,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"ShareStats", XmlTagEnum::kShareStats},
             {"ShareUsageBytes", XmlTagEnum::kShareUsageBytes},
         };
@@ -2566,7 +2570,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kNextMarker,
           kDirectoryId,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Prefix", XmlTagEnum::kPrefix},
             {"Marker", XmlTagEnum::kMarker},
@@ -2940,7 +2944,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kAccessRight,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Entries", XmlTagEnum::kEntries},
             {"Handle", XmlTagEnum::kHandle},
@@ -4402,7 +4406,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kEnd,
           kClearRange,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"Ranges", XmlTagEnum::kRanges},
             {"Range", XmlTagEnum::kRange},
             {"Start", XmlTagEnum::kStart},
@@ -4702,7 +4706,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           kAccessRight,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Entries", XmlTagEnum::kEntries},
             {"Handle", XmlTagEnum::kHandle},
@@ -46,7 +46,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const ShareClientOptions& options)
       : m_shareDirectoryUrl(shareDirectoryUrl), m_allowTrailingDot(options.AllowTrailingDot),
         m_allowSourceTrailingDot(options.AllowSourceTrailingDot),
-        m_shareTokenIntent(options.ShareTokenIntent)
+        m_shareTokenIntent(options.ShareTokenIntent),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     ShareClientOptions newOptions = options;
     newOptions.PerRetryPolicies.emplace_back(
@@ -71,7 +72,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const ShareClientOptions& options)
       : m_shareDirectoryUrl(shareDirectoryUrl), m_allowTrailingDot(options.AllowTrailingDot),
         m_allowSourceTrailingDot(options.AllowSourceTrailingDot),
-        m_shareTokenIntent(options.ShareTokenIntent)
+        m_shareTokenIntent(options.ShareTokenIntent),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     ShareClientOptions newOptions = options;
 
@@ -103,7 +105,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const ShareClientOptions& options)
       : m_shareDirectoryUrl(shareDirectoryUrl), m_allowTrailingDot(options.AllowTrailingDot),
         m_allowSourceTrailingDot(options.AllowSourceTrailingDot),
-        m_shareTokenIntent(options.ShareTokenIntent)
+        m_shareTokenIntent(options.ShareTokenIntent),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -127,6 +130,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     subdirectoryClient.m_allowTrailingDot = m_allowTrailingDot;
     subdirectoryClient.m_allowSourceTrailingDot = m_allowSourceTrailingDot;
     subdirectoryClient.m_shareTokenIntent = m_shareTokenIntent;
+    subdirectoryClient.m_transferThreadPool = m_transferThreadPool;
     return subdirectoryClient;
   }
 
@@ -138,6 +142,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     fileClient.m_allowTrailingDot = m_allowTrailingDot;
     fileClient.m_allowSourceTrailingDot = m_allowSourceTrailingDot;
     fileClient.m_shareTokenIntent = m_shareTokenIntent;
+    fileClient.m_transferThreadPool = m_transferThreadPool;
     return fileClient;
   }
 
@@ -302,6 +307,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     renamedFileClient.m_allowTrailingDot = m_allowTrailingDot;
     renamedFileClient.m_allowSourceTrailingDot = m_allowSourceTrailingDot;
     renamedFileClient.m_shareTokenIntent = m_shareTokenIntent;
+    renamedFileClient.m_transferThreadPool = m_transferThreadPool;
     return Azure::Response<ShareFileClient>(
         std::move(renamedFileClient), std::move(response.RawResponse));
   }
@@ -365,6 +371,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     renamedSubdirectoryClient.m_allowTrailingDot = m_allowTrailingDot;
     renamedSubdirectoryClient.m_allowSourceTrailingDot = m_allowSourceTrailingDot;
     renamedSubdirectoryClient.m_shareTokenIntent = m_shareTokenIntent;
+    renamedSubdirectoryClient.m_transferThreadPool = m_transferThreadPool;
     return Azure::Response<ShareDirectoryClient>(
         std::move(renamedSubdirectoryClient), std::move(response.RawResponse));
   }
@@ -51,7 +51,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const ShareClientOptions& options)
       : m_shareFileUrl(shareFileUrl), m_allowTrailingDot(options.AllowTrailingDot),
         m_allowSourceTrailingDot(options.AllowSourceTrailingDot),
-        m_shareTokenIntent(options.ShareTokenIntent)
+        m_shareTokenIntent(options.ShareTokenIntent),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     ShareClientOptions newOptions = options;
     newOptions.PerRetryPolicies.emplace_back(
@@ -76,7 +77,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const ShareClientOptions& options)
       : m_shareFileUrl(shareFileUrl), m_allowTrailingDot(options.AllowTrailingDot),
         m_allowSourceTrailingDot(options.AllowSourceTrailingDot),
-        m_shareTokenIntent(options.ShareTokenIntent)
+        m_shareTokenIntent(options.ShareTokenIntent),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     ShareClientOptions newOptions = options;
 
@@ -108,7 +110,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const ShareClientOptions& options)
       : m_shareFileUrl(shareFileUrl), m_allowTrailingDot(options.AllowTrailingDot),
         m_allowSourceTrailingDot(options.AllowSourceTrailingDot),
-        m_shareTokenIntent(options.ShareTokenIntent)
+        m_shareTokenIntent(options.ShareTokenIntent),
+        m_transferThreadPool(_internal::ThreadPool::GetShared(options.TransferThreadPoolSize))
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -1032,7 +1035,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        m_transferThreadPool);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
@@ -1150,7 +1154,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        m_transferThreadPool);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
@@ -1258,7 +1263,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (bufferSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          bufferSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          m_transferThreadPool);
     }
 
     Models::UploadFileFromResult result;
@@ -1370,7 +1380,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (fileSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, fileSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          fileSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          m_transferThreadPool);
     }
 
     Models::UploadFileFromResult result;
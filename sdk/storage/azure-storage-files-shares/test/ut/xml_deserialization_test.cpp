@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test/ut/test_base.hpp"
+
+#include <azure/storage/files/shares.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    // Answers every request with the same XML body, buffered and as a stream.
+    class XmlResponsePolicy final : public Core::Http::Policies::HttpPolicy {
+    public:
+      explicit XmlResponsePolicy(std::string body)
+          : m_body(std::make_shared<std::string>(std::move(body)))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<XmlResponsePolicy>(*this);
+      }
+
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Http::Request& request,
+          Core::Http::Policies::NextHttpPolicy nextPolicy,
+          Core::Context const& context) const override
+      {
+        (void)request;
+        (void)nextPolicy;
+        (void)context;
+        auto response = std::make_unique<Core::Http::RawResponse>(
+            1, 1, Core::Http::HttpStatusCode::Ok, "OK");
+        response->SetHeader("content-type", "application/xml");
+        response->SetHeader("x-ms-request-id", "request-id");
+        response->SetHeader("x-ms-version", Files::Shares::_detail::ApiVersion);
+        response->SetBody(std::vector<uint8_t>(m_body->begin(), m_body->end()));
+        response->SetBodyStream(std::make_unique<Core::IO::MemoryBodyStream>(
+            reinterpret_cast<const uint8_t*>(m_body->data()), m_body->size()));
+        return response;
+      }
+
+    private:
+      std::shared_ptr<std::string> m_body;
+    };
+
+    Files::Shares::ShareClientOptions OptionsWithResponse(std::string body)
+    {
+      Files::Shares::ShareClientOptions options;
+      options.PerRetryPolicies.push_back(std::make_unique<XmlResponsePolicy>(std::move(body)));
+      return options;
+    }
+  } // namespace
+
+  // ListShares has the largest of the hand-edited tag classifiers in rest_client.cpp.
+
+  TEST(XmlDeserializationTest, ListShares)
+  {
+    const std::string body
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+          "<EnumerationResults ServiceEndpoint=\"https://a.file.core.windows.net/\">"
+          "<Prefix>p</Prefix><Marker>m</Marker><MaxResults>1</MaxResults><Shares><Share>"
+          "<Name>share</Name>"
+          "<Snapshot>snapshot</Snapshot>"
+          "<Deleted>true</Deleted>"
+          "<Version>version</Version>"
+          "<Properties>"
+          "<Last-Modified>Mon, 01 Jan 2024 00:00:01 GMT</Last-Modified>"
+          "<Etag>0x1</Etag>"
+          "<Quota>100</Quota>"
+          "<ProvisionedIops>1</ProvisionedIops>"
+          "<ProvisionedIngressMBps>2</ProvisionedIngressMBps>"
+          "<ProvisionedEgressMBps>3</ProvisionedEgressMBps>"
+          "<ProvisionedBandwidthMiBps>4</ProvisionedBandwidthMiBps>"
+          "<NextAllowedQuotaDowngradeTime>Mon, 01 Jan 2024 00:00:02 GMT"
+          "</NextAllowedQuotaDowngradeTime>"
+          "<DeletedTime>Mon, 01 Jan 2024 00:00:03 GMT</DeletedTime>"
+          "<RemainingRetentionDays>5</RemainingRetentionDays>"
+          "<AccessTier>Hot</AccessTier>"
+          "<AccessTierChangeTime>Mon, 01 Jan 2024 00:00:04 GMT</AccessTierChangeTime>"
+          "<AccessTierTransitionState>pending-from-cool</AccessTierTransitionState>"
+          "<LeaseStatus>locked</LeaseStatus>"
+          "<LeaseState>leased</LeaseState>"
+          "<LeaseDuration>infinite</LeaseDuration>"
+          "<EnabledProtocols>NFS</EnabledProtocols>"
+          "<RootSquash>AllSquash</RootSquash>"
+          "<EnableSnapshotVirtualDirectoryAccess>true</EnableSnapshotVirtualDirectoryAccess>"
+          "<PaidBurstingEnabled>true</PaidBurstingEnabled>"
+          "<PaidBurstingMaxIops>6</PaidBurstingMaxIops>"
+          "<PaidBurstingMaxBandwidthMibps>7</PaidBurstingMaxBandwidthMibps>"
+          "<IncludedBurstIops>8</IncludedBurstIops>"
+          "<MaxBurstCreditsForIops>9</MaxBurstCreditsForIops>"
+          "<NextAllowedProvisionedIopsDowngradeTime>Mon, 01 Jan 2024 00:00:05 GMT"
+          "</NextAllowedProvisionedIopsDowngradeTime>"
+          "<NextAllowedProvisionedBandwidthDowngradeTime>Mon, 01 Jan 2024 00:00:06 GMT"
+          "</NextAllowedProvisionedBandwidthDowngradeTime>"
+          "</Properties>"
+          "<Metadata><key1>value1</key1><key2>value2</key2></Metadata>"
+          "</Share></Shares><NextMarker>next</NextMarker></EnumerationResults>";
+    Files::Shares::ShareServiceClient serviceClient(
+        "https://a.file.core.windows.net/", OptionsWithResponse(body));
+    auto page = serviceClient.ListShares();
+
+    EXPECT_EQ(page.ServiceEndpoint, "https://a.file.core.windows.net/");
+    EXPECT_EQ(page.Prefix, "p");
+    EXPECT_EQ(page.NextPageToken.Value(), "next");
+    ASSERT_EQ(page.Shares.size(), 1U);
+    const auto& share = page.Shares[0];
+    EXPECT_EQ(share.Name, "share");
+    EXPECT_EQ(share.Snapshot, "snapshot");
+    EXPECT_TRUE(share.Deleted);
+    EXPECT_EQ(share.Version, "version");
+    EXPECT_EQ(share.Metadata.size(), 2U);
+    EXPECT_EQ(share.Metadata.at("key1"), "value1");
+    EXPECT_EQ(share.Metadata.at("key2"), "value2");
+    const auto& details = share.Details;
+    EXPECT_EQ(
+        details.LastModified,
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:01 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(details.Etag, ETag("0x1"));
+    EXPECT_EQ(details.Quota, 100);
+    EXPECT_EQ(details.ProvisionedIops.Value(), 1);
+    EXPECT_EQ(details.ProvisionedIngressMBps.Value(), 2);
+    EXPECT_EQ(details.ProvisionedEgressMBps.Value(), 3);
+    EXPECT_EQ(details.ProvisionedBandwidthMBps.Value(), 4);
+    EXPECT_EQ(
+        details.NextAllowedQuotaDowngradeTime.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:02 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(
+        details.DeletedOn.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:03 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(details.RemainingRetentionDays, 5);
+    EXPECT_EQ(details.AccessTier.Value(), Files::Shares::Models::AccessTier::Hot);
+    EXPECT_EQ(
+        details.AccessTierChangedOn.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:04 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(details.AccessTierTransitionState.Value(), "pending-from-cool");
+    EXPECT_EQ(details.LeaseStatus, Files::Shares::Models::LeaseStatus::Locked);
+    EXPECT_EQ(details.LeaseState, Files::Shares::Models::LeaseState::Leased);
+    EXPECT_EQ(details.LeaseDuration, Files::Shares::Models::LeaseDurationType::Infinite);
+    EXPECT_EQ(details.EnabledProtocols.Value(), Files::Shares::Models::ShareProtocols::Nfs);
+    EXPECT_EQ(details.RootSquash.Value(), Files::Shares::Models::ShareRootSquash::AllSquash);
+    EXPECT_TRUE(details.EnableSnapshotVirtualDirectoryAccess.Value());
+    EXPECT_TRUE(details.PaidBurstingEnabled.Value());
+    EXPECT_EQ(details.PaidBurstingMaxIops.Value(), 6);
+    EXPECT_EQ(details.PaidBurstingMaxBandwidthMibps.Value(), 7);
+    EXPECT_EQ(details.IncludedBurstIops.Value(), 8);
+    EXPECT_EQ(details.MaxBurstCreditsForIops.Value(), 9);
+    EXPECT_EQ(
+        details.NextAllowedProvisionedIopsDowngradeTime.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:05 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(
+        details.NextAllowedProvisionedBandwidthDowngradeTime.Value(),
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:06 GMT", DateTime::DateFormat::Rfc1123));
+  }
+
+}}} // namespace Azure::Storage::Test
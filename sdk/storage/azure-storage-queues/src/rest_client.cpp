@@ -4,6 +4,10 @@
 //
 // Code generated by Microsoft (R) AutoRest C++ Code Generator.
 // Changes may cause incorrect behavior and will be lost if the code is regenerated.
+//
+// Edited by hand after generation: the xml deserializers keep their element name maps in static
+// storage. Re-apply this when regenerating. test/ut/xml_deserialization_test.cpp checks that every
+// element reaches its field.
 #include <azure/core/context.hpp>
 #include <azure/core/datetime.hpp>
 #include <azure/core/http/http.hpp>
@@ -245,7 +249,7 @@ namespace Azure { namespace Storage { namespace Queues {
           kExposedHeaders,
           kMaxAgeInSeconds,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"StorageServiceProperties", XmlTagEnum::kStorageServiceProperties},
             {"Logging", XmlTagEnum::kLogging},
             {"Version", XmlTagEnum::kVersion},
@@ -467,7 +471,7 @@ namespace Azure { namespace Storage { namespace Queues {
           kStatus,
           kLastSyncTime,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"StorageServiceStats", XmlTagEnum::kStorageServiceStats},
             {"GeoReplication", XmlTagEnum::kGeoReplication},
             {"Status", XmlTagEnum::kStatus},
@@ -569,7 +573,7 @@ namespace Azure { namespace Storage { namespace Queues {
           kMetadata,
           kNextMarker,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"EnumerationResults", XmlTagEnum::kEnumerationResults},
             {"Prefix", XmlTagEnum::kPrefix},
             {"Queues", XmlTagEnum::kQueues},
@@ -779,7 +783,7 @@ namespace Azure { namespace Storage { namespace Queues {
           kExpiry,
           kPermission,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"SignedIdentifiers", XmlTagEnum::kSignedIdentifiers},
             {"SignedIdentifier", XmlTagEnum::kSignedIdentifier},
             {"Id", XmlTagEnum::kId},
@@ -951,7 +955,7 @@ namespace Azure { namespace Storage { namespace Queues {
           kDequeueCount,
           kMessageText,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"QueueMessagesList", XmlTagEnum::kQueueMessagesList},
             {"QueueMessage", XmlTagEnum::kQueueMessage},
             {"MessageId", XmlTagEnum::kMessageId},
@@ -1117,7 +1121,7 @@ namespace Azure { namespace Storage { namespace Queues {
           kPopReceipt,
           kTimeNextVisible,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"QueueMessagesList", XmlTagEnum::kQueueMessagesList},
             {"QueueMessage", XmlTagEnum::kQueueMessage},
             {"MessageId", XmlTagEnum::kMessageId},
@@ -1226,7 +1230,7 @@ namespace Azure { namespace Storage { namespace Queues {
           kDequeueCount,
           kMessageText,
         };
-        const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
+        static const std::unordered_map<std::string, XmlTagEnum> XmlTagEnumMap{
             {"QueueMessagesList", XmlTagEnum::kQueueMessagesList},
             {"QueueMessage", XmlTagEnum::kQueueMessage},
             {"MessageId", XmlTagEnum::kMessageId},
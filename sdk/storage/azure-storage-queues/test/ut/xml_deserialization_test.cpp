@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test/ut/test_base.hpp"
+
+#include <azure/storage/queues.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    // Answers every request with the same XML body, buffered and as a stream.
+    class XmlResponsePolicy final : public Core::Http::Policies::HttpPolicy {
+    public:
+      explicit XmlResponsePolicy(std::string body)
+          : m_body(std::make_shared<std::string>(std::move(body)))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<XmlResponsePolicy>(*this);
+      }
+
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Http::Request& request,
+          Core::Http::Policies::NextHttpPolicy nextPolicy,
+          Core::Context const& context) const override
+      {
+        (void)request;
+        (void)nextPolicy;
+        (void)context;
+        auto response = std::make_unique<Core::Http::RawResponse>(
+            1, 1, Core::Http::HttpStatusCode::Ok, "OK");
+        response->SetHeader("content-type", "application/xml");
+        response->SetHeader("x-ms-request-id", "request-id");
+        response->SetHeader("x-ms-version", Queues::_detail::ApiVersion);
+        response->SetBody(std::vector<uint8_t>(m_body->begin(), m_body->end()));
+        response->SetBodyStream(std::make_unique<Core::IO::MemoryBodyStream>(
+            reinterpret_cast<const uint8_t*>(m_body->data()), m_body->size()));
+        return response;
+      }
+
+    private:
+      std::shared_ptr<std::string> m_body;
+    };
+
+    Queues::QueueClientOptions OptionsWithResponse(std::string body)
+    {
+      Queues::QueueClientOptions options;
+      options.PerRetryPolicies.push_back(std::make_unique<XmlResponsePolicy>(std::move(body)));
+      return options;
+    }
+  } // namespace
+
+  // Covers the hand-edited tag classifiers of the service properties and message deserializers.
+
+  TEST(XmlDeserializationTest, GetServiceProperties)
+  {
+    const std::string body
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+          "<StorageServiceProperties>"
+          "<Logging><Version>1.0</Version><Delete>true</Delete>"
+          "<Read>true</Read><Write>true</Write>"
+          "<RetentionPolicy><Enabled>true</Enabled><Days>1</Days>"
+          "</RetentionPolicy></Logging>"
+          "<HourMetrics><Version>2.0</Version><Enabled>true</Enabled>"
+          "<IncludeAPIs>true</IncludeAPIs>"
+          "<RetentionPolicy><Enabled>true</Enabled><Days>2</Days>"
+          "</RetentionPolicy></HourMetrics>"
+          "<MinuteMetrics><Version>3.0</Version><Enabled>true</Enabled>"
+          "<IncludeAPIs>false</IncludeAPIs>"
+          "<RetentionPolicy><Enabled>true</Enabled><Days>3</Days>"
+          "</RetentionPolicy></MinuteMetrics>"
+          "<Cors><CorsRule><AllowedOrigins>origins</AllowedOrigins>"
+          "<AllowedMethods>GET</AllowedMethods>"
+          "<AllowedHeaders>allowed</AllowedHeaders>"
+          "<ExposedHeaders>exposed</ExposedHeaders>"
+          "<MaxAgeInSeconds>60</MaxAgeInSeconds></CorsRule></Cors>"
+          "</StorageServiceProperties>";
+    Queues::QueueServiceClient serviceClient(
+        "https://a.queue.core.windows.net/", OptionsWithResponse(body));
+    auto properties = serviceClient.GetProperties().Value;
+
+    EXPECT_EQ(properties.Logging.Version, "1.0");
+    EXPECT_TRUE(properties.Logging.Delete);
+    EXPECT_TRUE(properties.Logging.Read);
+    EXPECT_TRUE(properties.Logging.Write);
+    EXPECT_TRUE(properties.Logging.RetentionPolicy.IsEnabled);
+    EXPECT_EQ(properties.Logging.RetentionPolicy.Days.Value(), 1);
+    EXPECT_EQ(properties.HourMetrics.Version, "2.0");
+    EXPECT_TRUE(properties.HourMetrics.IsEnabled);
+    EXPECT_TRUE(properties.HourMetrics.IncludeApis.Value());
+    EXPECT_TRUE(properties.HourMetrics.RetentionPolicy.IsEnabled);
+    EXPECT_EQ(properties.HourMetrics.RetentionPolicy.Days.Value(), 2);
+    EXPECT_EQ(properties.MinuteMetrics.Version, "3.0");
+    EXPECT_TRUE(properties.MinuteMetrics.IsEnabled);
+    EXPECT_FALSE(properties.MinuteMetrics.IncludeApis.Value());
+    EXPECT_TRUE(properties.MinuteMetrics.RetentionPolicy.IsEnabled);
+    EXPECT_EQ(properties.MinuteMetrics.RetentionPolicy.Days.Value(), 3);
+    ASSERT_EQ(properties.Cors.size(), 1U);
+    EXPECT_EQ(properties.Cors[0].AllowedOrigins, "origins");
+    EXPECT_EQ(properties.Cors[0].AllowedMethods, "GET");
+    EXPECT_EQ(properties.Cors[0].AllowedHeaders, "allowed");
+    EXPECT_EQ(properties.Cors[0].ExposedHeaders, "exposed");
+    EXPECT_EQ(properties.Cors[0].MaxAgeInSeconds, 60);
+  }
+
+  TEST(XmlDeserializationTest, ReceiveMessages)
+  {
+    const std::string body
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+          "<QueueMessagesList><QueueMessage>"
+          "<MessageId>id</MessageId>"
+          "<InsertionTime>Mon, 01 Jan 2024 00:00:01 GMT</InsertionTime>"
+          "<ExpirationTime>Mon, 01 Jan 2024 00:00:02 GMT</ExpirationTime>"
+          "<PopReceipt>receipt</PopReceipt>"
+          "<TimeNextVisible>Mon, 01 Jan 2024 00:00:03 GMT</TimeNextVisible>"
+          "<DequeueCount>5</DequeueCount>"
+          "<MessageText>text</MessageText>"
+          "</QueueMessage></QueueMessagesList>";
+    Queues::QueueClient queueClient(
+        "https://a.queue.core.windows.net/q", OptionsWithResponse(body));
+    auto messages = queueClient.ReceiveMessages().Value.Messages;
+
+    ASSERT_EQ(messages.size(), 1U);
+    EXPECT_EQ(messages[0].MessageId, "id");
+    EXPECT_EQ(
+        messages[0].InsertedOn,
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:01 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(
+        messages[0].ExpiresOn,
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:02 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(messages[0].PopReceipt, "receipt");
+    EXPECT_EQ(
+        messages[0].NextVisibleOn,
+        DateTime::Parse("Mon, 01 Jan 2024 00:00:03 GMT", DateTime::DateFormat::Rfc1123));
+    EXPECT_EQ(messages[0].DequeueCount, 5);
+    EXPECT_EQ(messages[0].MessageText, "text");
+  }
+
+}}} // namespace Azure::Storage::Test
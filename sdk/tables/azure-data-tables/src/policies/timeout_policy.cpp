@@ -16,7 +16,7 @@ namespace Azure { namespace Data { namespace Tables { namespace _detail { namesp
       Core::Http::Policies::NextHttpPolicy nextPolicy,
       Core::Context const& context) const
   {
-    const auto& headers = request.GetHeaders();
+    const auto headers = request.GetHeadersView();
     if (headers.find(HttpHeaderDate) == headers.end())
     {
       // add x-ms-date header in RFC1123 format